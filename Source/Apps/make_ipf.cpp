@@ -40,59 +40,16 @@ public:
 
   void run() const
   {
-    std::vector<LaueOps::Pointer> ops = LaueOps::GetAllOrientationOps();
     double refDir[3] = {m_ReferenceDir[0], m_ReferenceDir[1], m_ReferenceDir[2]};
-    double dEuler[3] = {0.0, 0.0, 0.0};
-    EbsdLib::Rgb argb = 0x00000000;
-    int32_t phase = 0;
-    bool calcIPF = false;
-    size_t index = 0;
-    int32_t numPhases = static_cast<int32_t>(m_PhaseInfos.size());
-
-    std::vector<size_t> laueOpsIndex(m_PhaseInfos.size());
+
+    std::vector<uint32_t> laueOpsIndex(m_PhaseInfos.size());
     for(size_t i = 0; i < laueOpsIndex.size(); i++)
     {
       laueOpsIndex[i] = m_PhaseInfos[i]->determineLaueGroup();
     }
 
     size_t totalPoints = m_CellEulerAngles.size() / 3;
-    for(size_t i = 0; i < totalPoints; i++)
-    {
-      phase = m_CellPhases[i];
-      index = i * 3;
-      m_CellIPFColors[index] = 0;
-      m_CellIPFColors[index + 1] = 0;
-      m_CellIPFColors[index + 2] = 0;
-      dEuler[0] = m_CellEulerAngles[index];
-      dEuler[1] = m_CellEulerAngles[index + 1];
-      dEuler[2] = m_CellEulerAngles[index + 2];
-
-      // Make sure we are using a valid Euler Angles with valid crystal symmetry
-      calcIPF = true;
-      if(nullptr != m_GoodVoxels)
-      {
-        calcIPF = m_GoodVoxels[i];
-      }
-      // Sanity check the phase data to make sure we do not walk off the end of the array
-      if(phase >= numPhases)
-      {
-        // m_Filter->incrementPhaseWarningCount();
-        std::cout << "phase > number of phases" << std::endl;
-      }
-
-      size_t currentLaueOpsIndex = laueOpsIndex[phase];
-
-      if(phase < numPhases && calcIPF && currentLaueOpsIndex < EbsdLib::CrystalStructure::LaueGroupEnd)
-      {
-        argb = ops[currentLaueOpsIndex]->generateIPFColor(dEuler, refDir, false);
-        m_CellIPFColors[index] = static_cast<uint8_t>(EbsdLib::RgbColor::dRed(argb));
-        m_CellIPFColors[index + 1] = static_cast<uint8_t>(EbsdLib::RgbColor::dGreen(argb));
-        m_CellIPFColors[index + 2] = static_cast<uint8_t>(EbsdLib::RgbColor::dBlue(argb));
-
-        //  std::cout << (int32_t)(m_CellIPFColors[index]) << "\t" << (int32_t)(m_CellIPFColors[index + 1]) << (int32_t)(m_CellIPFColors[index + 2]) << m_CellEulerAngles[index] << "\t"
-        //            << m_CellEulerAngles[index + 1] << "\t" << m_CellEulerAngles[index + 2] << std::endl;
-      }
-    }
+    LaueOps::GenerateIPFColors(m_CellEulerAngles.data(), m_CellPhases, laueOpsIndex.data(), laueOpsIndex.size(), totalPoints, refDir, m_CellIPFColors, m_GoodVoxels, false);
   }
 
 private:
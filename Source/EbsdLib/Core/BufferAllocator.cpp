@@ -0,0 +1,311 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#include "BufferAllocator.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(_WIN32)
+#include <malloc.h>
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#ifdef EbsdLib_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#endif
+
+namespace
+{
+/**
+ * @brief Stored directly in front of every block handed out by the AlignedAllocator so that deallocate() only needs
+ * the pointer.
+ */
+struct BlockHeader
+{
+  void* base = nullptr; // Start of the underlying heap block or mapping
+  size_t length = 0;    // Length of the mapping, 0 for heap blocks
+  bool mapped = false;
+};
+
+size_t RoundUp(size_t value, size_t multiple)
+{
+  return (value + multiple - 1) / multiple * multiple;
+}
+
+size_t SystemPageSize()
+{
+#if defined(_WIN32)
+  SYSTEM_INFO info;
+  GetSystemInfo(&info);
+  static const size_t pageSize = static_cast<size_t>(info.dwPageSize);
+#else
+  static const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#endif
+  return pageSize;
+}
+
+/**
+ * @brief Writes a zero into the first byte of every page of [begin, begin + numBytes). The memory comes zeroed from
+ * the kernel so this only faults the pages in from the calling threads.
+ */
+void TouchPages(uint8_t* begin, size_t numBytes, size_t pageSize)
+{
+  auto touch = [begin, pageSize](size_t first, size_t last) {
+    for(size_t page = first; page < last; page++)
+    {
+      *static_cast<volatile uint8_t*>(begin + page * pageSize) = 0;
+    }
+  };
+  size_t numPages = (numBytes + pageSize - 1) / pageSize;
+
+#ifdef EbsdLib_USE_PARALLEL_ALGORITHMS
+  bool doParallel = true;
+  if(doParallel)
+  {
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(0, numPages), [&](const tbb::blocked_range<size_t>& r) { touch(r.begin(), r.end()); }, tbb::auto_partitioner());
+    return;
+  }
+#endif
+  touch(0, numPages);
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+BufferAllocator::BufferAllocator() = default;
+
+// -----------------------------------------------------------------------------
+BufferAllocator::~BufferAllocator() = default;
+
+// -----------------------------------------------------------------------------
+BufferAllocator::Pointer BufferAllocator::NullPointer()
+{
+  return Pointer(static_cast<Self*>(nullptr));
+}
+
+// -----------------------------------------------------------------------------
+std::string BufferAllocator::getNameOfClass() const
+{
+  return ClassName();
+}
+
+// -----------------------------------------------------------------------------
+std::string BufferAllocator::ClassName()
+{
+  return std::string("BufferAllocator");
+}
+
+// -----------------------------------------------------------------------------
+AlignedAllocator::AlignedAllocator(size_t alignment, bool useHugePages, bool parallelFirstTouch)
+: m_UseHugePages(useHugePages)
+, m_ParallelFirstTouch(parallelFirstTouch)
+{
+  // The header is stored inside the first alignment sized slot of every block
+  m_Alignment = 16;
+  while(m_Alignment < alignment || m_Alignment < sizeof(BlockHeader))
+  {
+    m_Alignment *= 2;
+  }
+}
+
+// -----------------------------------------------------------------------------
+AlignedAllocator::~AlignedAllocator() = default;
+
+// -----------------------------------------------------------------------------
+AlignedAllocator::Pointer AlignedAllocator::New(size_t alignment, bool useHugePages, bool parallelFirstTouch)
+{
+  return Pointer(new AlignedAllocator(alignment, useHugePages, parallelFirstTouch));
+}
+
+// -----------------------------------------------------------------------------
+std::string AlignedAllocator::getNameOfClass() const
+{
+  return ClassName();
+}
+
+// -----------------------------------------------------------------------------
+std::string AlignedAllocator::ClassName()
+{
+  return std::string("AlignedAllocator");
+}
+
+// -----------------------------------------------------------------------------
+size_t AlignedAllocator::getAlignment() const
+{
+  return m_Alignment;
+}
+
+// -----------------------------------------------------------------------------
+bool AlignedAllocator::getUseHugePages() const
+{
+  return m_UseHugePages;
+}
+
+// -----------------------------------------------------------------------------
+bool AlignedAllocator::getParallelFirstTouch() const
+{
+  return m_ParallelFirstTouch;
+}
+
+// -----------------------------------------------------------------------------
+void* AlignedAllocator::allocate(size_t numBytes, bool zeroFill)
+{
+  if(numBytes > std::numeric_limits<size_t>::max() - m_Alignment - k_HugePageSize * 2)
+  {
+    return nullptr;
+  }
+  if(numBytes >= k_MappedThreshold)
+  {
+    return allocateMapped(numBytes);
+  }
+
+  size_t totalBytes = m_Alignment + numBytes;
+  void* base = nullptr;
+#if defined(_WIN32)
+  base = _aligned_malloc(totalBytes, m_Alignment);
+#else
+  if(posix_memalign(&base, m_Alignment, totalBytes) != 0)
+  {
+    base = nullptr;
+  }
+#endif
+  if(base == nullptr)
+  {
+    return nullptr;
+  }
+  auto data = static_cast<uint8_t*>(base) + m_Alignment;
+  auto header = reinterpret_cast<BlockHeader*>(data) - 1;
+  *header = BlockHeader();
+  header->base = base;
+  if(zeroFill)
+  {
+    std::memset(data, 0, numBytes);
+  }
+  return data;
+}
+
+// -----------------------------------------------------------------------------
+void* AlignedAllocator::allocateMapped(size_t numBytes)
+{
+  size_t pageSize = SystemPageSize();
+  size_t length = RoundUp(m_Alignment + numBytes, pageSize);
+  uint8_t* base = nullptr;
+#if defined(_WIN32)
+  // Large pages need the SeLockMemoryPrivilege on Windows so huge pages are not requested here
+  base = static_cast<uint8_t*>(VirtualAlloc(nullptr, length, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE));
+  if(base == nullptr)
+  {
+    return nullptr;
+  }
+#else
+  if(m_UseHugePages)
+  {
+    // Over map by one huge page and trim the ends so that the block starts on a huge page boundary
+    length = RoundUp(m_Alignment + numBytes, k_HugePageSize);
+    size_t mappedLength = length + k_HugePageSize;
+    void* raw = mmap(nullptr, mappedLength, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(raw == MAP_FAILED)
+    {
+      return nullptr;
+    }
+    auto rawBegin = static_cast<uint8_t*>(raw);
+    base = reinterpret_cast<uint8_t*>(RoundUp(reinterpret_cast<uintptr_t>(rawBegin), k_HugePageSize));
+    if(base != rawBegin)
+    {
+      munmap(rawBegin, static_cast<size_t>(base - rawBegin));
+    }
+    size_t tailLength = static_cast<size_t>((rawBegin + mappedLength) - (base + length));
+    if(tailLength != 0)
+    {
+      munmap(base + length, tailLength);
+    }
+#ifdef MADV_HUGEPAGE
+    madvise(base, length, MADV_HUGEPAGE);
+#endif
+    pageSize = k_HugePageSize;
+  }
+  else
+  {
+    void* raw = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(raw == MAP_FAILED)
+    {
+      return nullptr;
+    }
+    base = static_cast<uint8_t*>(raw);
+  }
+#endif
+
+  // Mapped memory is always zero filled by the operating system
+  uint8_t* data = base + m_Alignment;
+  auto header = reinterpret_cast<BlockHeader*>(data) - 1;
+  header->base = base;
+  header->length = length;
+  header->mapped = true;
+  if(m_ParallelFirstTouch)
+  {
+    TouchPages(base, length, pageSize);
+  }
+  return data;
+}
+
+// -----------------------------------------------------------------------------
+void AlignedAllocator::deallocate(void* ptr)
+{
+  if(ptr == nullptr)
+  {
+    return;
+  }
+  auto header = reinterpret_cast<BlockHeader*>(ptr) - 1;
+  if(header->mapped)
+  {
+#if defined(_WIN32)
+    VirtualFree(header->base, 0, MEM_RELEASE);
+#else
+    munmap(header->base, header->length);
+#endif
+    return;
+  }
+#if defined(_WIN32)
+  _aligned_free(header->base);
+#else
+  free(header->base);
+#endif
+}
@@ -0,0 +1,200 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <new>
+#include <string>
+#include <type_traits>
+
+#include "EbsdLib/EbsdLib.h"
+
+/**
+ * @class BufferAllocator BufferAllocator.h EbsdLib/Core/BufferAllocator.h
+ * @brief Interface for the allocators that provide the storage of the EbsdReader data columns and of
+ * EbsdDataArray. A null BufferAllocator::Pointer selects plain new[]/delete[] which keeps buffers whose ownership
+ * is released to a caller compatible with delete[]. A buffer obtained from any other allocator must be returned to
+ * that same allocator.
+ */
+class EbsdLib_EXPORT BufferAllocator
+{
+public:
+  using Self = BufferAllocator;
+  using Pointer = std::shared_ptr<Self>;
+  using ConstPointer = std::shared_ptr<const Self>;
+  using WeakPointer = std::weak_ptr<Self>;
+  using ConstWeakPointer = std::weak_ptr<const Self>;
+  static Pointer NullPointer();
+
+  /**
+   * @brief Returns the name of the class for BufferAllocator
+   */
+  virtual std::string getNameOfClass() const;
+  /**
+   * @brief Returns the name of the class for BufferAllocator
+   */
+  static std::string ClassName();
+
+  virtual ~BufferAllocator();
+
+  /**
+   * @brief Allocates a block of memory
+   * @param numBytes The size of the block in bytes
+   * @param zeroFill If true the block reads as zeros, otherwise the contents are undefined
+   * @return Pointer to the block or nullptr if the memory could not be allocated
+   */
+  virtual void* allocate(size_t numBytes, bool zeroFill) = 0;
+
+  /**
+   * @brief Frees a block that was returned by allocate() of this allocator. A nullptr is ignored.
+   * @param ptr
+   */
+  virtual void deallocate(void* ptr) = 0;
+
+  /**
+   * @brief Allocates numElements values of type T from the allocator or with new[] if the allocator is null.
+   * @param allocator
+   * @param numElements
+   * @param zeroFill If false the values are left uninitialized for callers that overwrite every value anyway
+   * @return Pointer to the values or nullptr if the memory could not be allocated
+   */
+  template <typename T>
+  static T* Allocate(const Pointer& allocator, size_t numElements, bool zeroFill)
+  {
+    static_assert(std::is_trivially_copyable<T>::value && std::is_trivially_destructible<T>::value, "BufferAllocator only holds trivial types");
+    if(allocator == nullptr)
+    {
+      return zeroFill ? new(std::nothrow) T[numElements]() : new(std::nothrow) T[numElements];
+    }
+    if(numElements > std::numeric_limits<size_t>::max() / sizeof(T))
+    {
+      return nullptr;
+    }
+    return static_cast<T*>(allocator->allocate(numElements * sizeof(T), zeroFill));
+  }
+
+  /**
+   * @brief Frees values returned by Allocate() with the same allocator.
+   * @param allocator
+   * @param ptr
+   */
+  template <typename T>
+  static void Deallocate(const Pointer& allocator, T* ptr)
+  {
+    if(allocator == nullptr)
+    {
+      delete[](ptr);
+      return;
+    }
+    allocator->deallocate(ptr);
+  }
+
+protected:
+  BufferAllocator();
+
+public:
+  BufferAllocator(const BufferAllocator&) = delete;            // Copy Constructor Not Implemented
+  BufferAllocator(BufferAllocator&&) = delete;                 // Move Constructor Not Implemented
+  BufferAllocator& operator=(const BufferAllocator&) = delete; // Copy Assignment Not Implemented
+  BufferAllocator& operator=(BufferAllocator&&) = delete;      // Move Assignment Not Implemented
+};
+
+/**
+ * @class AlignedAllocator BufferAllocator.h EbsdLib/Core/BufferAllocator.h
+ * @brief Allocates blocks aligned for SIMD loads. Blocks of at least k_MappedThreshold bytes are mapped directly
+ * from the operating system: the kernel supplies them zeroed so a zero filled block costs no extra pass, and
+ * pages are only committed when they are first written. Optionally those blocks are advised to use transparent
+ * huge pages (Linux) and have their pages touched from the TBB worker threads so that each page is placed on the
+ * NUMA node of the thread that later processes that part of the array.
+ */
+class EbsdLib_EXPORT AlignedAllocator : public BufferAllocator
+{
+public:
+  using Self = AlignedAllocator;
+  using Pointer = std::shared_ptr<Self>;
+  using ConstPointer = std::shared_ptr<const Self>;
+  using WeakPointer = std::weak_ptr<Self>;
+  using ConstWeakPointer = std::weak_ptr<const Self>;
+
+  static constexpr size_t k_DefaultAlignment = 64;
+  static constexpr size_t k_MappedThreshold = 1024 * 1024;
+  static constexpr size_t k_HugePageSize = 2 * 1024 * 1024;
+
+  /**
+   * @brief Creates a new allocator. The settings are fixed for the lifetime of the allocator so that every block
+   * can be freed the same way it was allocated.
+   * @param alignment Alignment of the returned blocks in bytes. Rounded up to a power of two that is large enough to
+   * also hold the bookkeeping header stored in front of each block.
+   * @param useHugePages Request transparent huge pages for mapped blocks
+   * @param parallelFirstTouch Touch the pages of mapped blocks in parallel when they are allocated
+   */
+  static Pointer New(size_t alignment = k_DefaultAlignment, bool useHugePages = false, bool parallelFirstTouch = false);
+
+  /**
+   * @brief Returns the name of the class for AlignedAllocator
+   */
+  std::string getNameOfClass() const override;
+  /**
+   * @brief Returns the name of the class for AlignedAllocator
+   */
+  static std::string ClassName();
+
+  ~AlignedAllocator() override;
+
+  size_t getAlignment() const;
+  bool getUseHugePages() const;
+  bool getParallelFirstTouch() const;
+
+  void* allocate(size_t numBytes, bool zeroFill) override;
+  void deallocate(void* ptr) override;
+
+protected:
+  AlignedAllocator(size_t alignment, bool useHugePages, bool parallelFirstTouch);
+
+private:
+  size_t m_Alignment = k_DefaultAlignment;
+  bool m_UseHugePages = false;
+  bool m_ParallelFirstTouch = false;
+
+  void* allocateMapped(size_t numBytes);
+
+public:
+  AlignedAllocator(const AlignedAllocator&) = delete;            // Copy Constructor Not Implemented
+  AlignedAllocator(AlignedAllocator&&) = delete;                 // Move Constructor Not Implemented
+  AlignedAllocator& operator=(const AlignedAllocator&) = delete; // Copy Assignment Not Implemented
+  AlignedAllocator& operator=(AlignedAllocator&&) = delete;      // Move Assignment Not Implemented
+};
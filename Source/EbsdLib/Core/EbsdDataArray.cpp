@@ -36,6 +36,7 @@
 #include "EbsdDataArray.hpp"
 
 #include <cstring>
+#include <fstream>
 #include <functional>
 #include <iomanip>
 #include <iostream>
@@ -68,6 +69,7 @@
 #endif
 
 #include "EbsdLib/Core/EbsdMacros.h"
+#include "EbsdLib/Utilities/MemoryMappedFile.h"
 
 namespace
 {
@@ -225,7 +227,8 @@ typename EbsdDataArray<T>::Pointer EbsdDataArray<T>::CreateArray(size_t numTuple
   }
   comp_dims_type cDims = {1};
   auto d = std::make_shared<EbsdDataArray<T>>(numTuples, name, cDims, static_cast<T>(0), allocate);
-  if(allocate)
+  // The constructor already allocated and initialized the array, only retry if that failed
+  if(allocate && !d->isAllocated())
   {
     if(d->allocate() < 0)
     {
@@ -247,7 +250,8 @@ typename EbsdDataArray<T>::Pointer EbsdDataArray<T>::CreateArray(size_t numTuple
   comp_dims_type cDims(static_cast<size_t>(rank));
   std::copy(dims, dims + rank, cDims.begin());
   auto d = std::make_shared<EbsdDataArray<T>>(numTuples, name, cDims, static_cast<T>(0), allocate);
-  if(allocate)
+  // The constructor already allocated and initialized the array, only retry if that failed
+  if(allocate && !d->isAllocated())
   {
     if(d->allocate() < 0)
     {
@@ -267,7 +271,8 @@ typename EbsdDataArray<T>::Pointer EbsdDataArray<T>::CreateArray(size_t numTuple
     return nullptr;
   }
   auto d = std::make_shared<EbsdDataArray<T>>(numTuples, name, compDims, static_cast<T>(0), allocate);
-  if(allocate)
+  // The constructor already allocated and initialized the array, only retry if that failed
+  if(allocate && !d->isAllocated())
   {
     if(d->allocate() < 0)
     {
@@ -290,7 +295,8 @@ typename EbsdDataArray<T>::Pointer EbsdDataArray<T>::CreateArray(const comp_dims
   size_t numTuples = std::accumulate(tupleDims.cbegin(), tupleDims.cend(), static_cast<size_t>(1), std::multiplies<>());
 
   auto d = std::make_shared<EbsdDataArray<T>>(numTuples, name, compDims, static_cast<T>(0), allocate);
-  if(allocate)
+  // The constructor already allocated and initialized the array, only retry if that failed
+  if(allocate && !d->isAllocated())
   {
     if(d->allocate() < 0)
     {
@@ -369,8 +375,9 @@ typename EbsdDataArray<T>::Pointer EbsdDataArray<T>::WrapPointer(T* data, size_t
 
   // Now set the internal array to the raw pointer
   d->m_Array = data;
-  // Set who owns the data, i.e., who is going to "free" the memory
+  // Set who owns the data, i.e., who is going to "free" the memory. Wrapped memory is always freed with delete[]
   d->m_OwnsData = ownsData;
+  d->m_ArrayAllocator = nullptr;
   if(nullptr != data)
   {
     d->m_IsAllocated = true;
@@ -379,6 +386,58 @@ typename EbsdDataArray<T>::Pointer EbsdDataArray<T>::WrapPointer(T* data, size_t
   return d;
 }
 
+// -----------------------------------------------------------------------------
+template <typename T>
+typename EbsdDataArray<T>::Pointer EbsdDataArray<T>::CreateMappedArray(size_t numTuples, const comp_dims_type& compDims, const std::string& name, const std::string& filePath)
+{
+  if(numTuples == 0)
+  {
+    return NullPointer();
+  }
+  {
+    // Start from an empty file so that no stale values survive
+    std::ofstream truncated(filePath, std::ios::out | std::ios::binary | std::ios::trunc);
+    if(!truncated.is_open())
+    {
+      return NullPointer();
+    }
+  }
+  return MapFile(filePath, 0, numTuples, compDims, name, true);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+typename EbsdDataArray<T>::Pointer EbsdDataArray<T>::MapFile(const std::string& filePath, size_t fileOffset, size_t numTuples, const comp_dims_type& compDims, const std::string& name, bool writable)
+{
+  size_t tupleBytes = std::accumulate(compDims.cbegin(), compDims.cend(), static_cast<size_t>(1), std::multiplies<>()) * sizeof(T);
+  if(tupleBytes == 0)
+  {
+    return NullPointer();
+  }
+  auto mappedFile = std::make_shared<MemoryMappedFile>();
+  MemoryMappedFile::Access access = writable ? MemoryMappedFile::Access::ReadWrite : MemoryMappedFile::Access::CopyOnWrite;
+  if(!mappedFile->openRegion(filePath, fileOffset, numTuples * tupleBytes, access))
+  {
+    return NullPointer();
+  }
+  if(numTuples == 0)
+  {
+    numTuples = mappedFile->size() / tupleBytes;
+  }
+  char* values = mappedFile->writableData();
+  if(numTuples == 0 || reinterpret_cast<uintptr_t>(values) % alignof(T) != 0)
+  {
+    return NullPointer();
+  }
+
+  auto d = std::make_shared<EbsdDataArray<T>>(numTuples, name, compDims, static_cast<T>(0), false);
+  d->m_Array = reinterpret_cast<T*>(values);
+  d->m_MappedFile = mappedFile;
+  d->m_OwnsData = true;
+  d->m_IsAllocated = true;
+  return d;
+}
+
 //========================================= Begin API =================================
 
 template <typename T>
@@ -607,6 +666,34 @@ void EbsdDataArray<T>::setInitValue(T initValue)
   m_InitValue = initValue;
 }
 
+// -----------------------------------------------------------------------------
+template <typename T>
+void EbsdDataArray<T>::setAllocator(const BufferAllocator::Pointer& allocator)
+{
+  m_Allocator = allocator;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+BufferAllocator::Pointer EbsdDataArray<T>::getAllocator() const
+{
+  return m_Allocator;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bool EbsdDataArray<T>::isMapped() const
+{
+  return m_MappedFile != nullptr;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bool EbsdDataArray<T>::flush()
+{
+  return m_MappedFile == nullptr || m_MappedFile->flush();
+}
+
 // -----------------------------------------------------------------------------
 template <typename T>
 void EbsdDataArray<T>::takeOwnership()
@@ -639,12 +726,14 @@ int32_t EbsdDataArray<T>::allocate()
   }
 
   size_t newSize = m_Size;
-  m_Array = new(std::nothrow) T[newSize]();
+  m_Array = BufferAllocator::Allocate<T>(m_Allocator, newSize, true);
   if(!m_Array)
   {
     std::cout << "Unable to allocate " << newSize << " elements of size " << sizeof(T) << " bytes. ";
     return -1;
   }
+  m_ArrayAllocator = m_Allocator;
+  m_MappedFile.reset();
   m_Size = newSize;
   m_IsAllocated = true;
 
@@ -704,8 +793,12 @@ int32_t EbsdDataArray<T>::eraseTuples(const comp_dims_type& idxs)
   // Calculate the new size of the array to copy into
   size_t newSize = (getNumberOfTuples() - idxs.size()) * m_NumComponents;
 
-  // Create a new m_Array to copy into
-  T* newArray = new T[newSize]();
+  // Create a new m_Array to copy into. Every value is copied from the current array so it is not initialized.
+  T* newArray = BufferAllocator::Allocate<T>(m_Allocator, newSize, false);
+  if(nullptr == newArray)
+  {
+    return -101;
+  }
 
 #ifndef NDEBUG
   // Splat AB across the array so we know if we are copying the values or not
@@ -738,6 +831,8 @@ int32_t EbsdDataArray<T>::eraseTuples(const comp_dims_type& idxs)
     deallocate();
     m_Size = newSize;
     m_Array = newArray;
+    m_ArrayAllocator = m_Allocator;
+    m_MappedFile.reset();
     m_OwnsData = true;
     m_MaxId = newSize - 1;
     m_IsAllocated = true;
@@ -781,6 +876,8 @@ int32_t EbsdDataArray<T>::eraseTuples(const comp_dims_type& idxs)
   // Allocation was successful.  Save it.
   m_Size = newSize;
   m_Array = newArray;
+  m_ArrayAllocator = m_Allocator;
+  m_MappedFile.reset();
   // This object has now allocated its memory and owns it.
   m_OwnsData = true;
   m_IsAllocated = true;
@@ -1387,6 +1484,7 @@ void EbsdDataArray<T>::clear()
     deallocate();
   }
   m_Array = nullptr;
+  m_MappedFile.reset();
   m_Size = 0;
   m_OwnsData = true;
   m_MaxId = 0;
@@ -1403,7 +1501,8 @@ void EbsdDataArray<T>::deallocate()
 #ifndef NDEBUG
   // We are going to splat 0xABABAB across the first value of the array as a debugging aid
   auto cptr = reinterpret_cast<unsigned char*>(m_Array);
-  if(nullptr != cptr)
+  // Never splat the values of a mapped file, they may be written back to the file
+  if(nullptr != cptr && nullptr == m_MappedFile)
   {
     if(m_Size > 0)
     {
@@ -1442,9 +1541,18 @@ void EbsdDataArray<T>::deallocate()
       }
 #endif
 
-  delete[](m_Array);
+  if(nullptr != m_MappedFile)
+  {
+    // Unmapping a writable file leaves the modified pages to be written back by the operating system
+    m_MappedFile.reset();
+  }
+  else
+  {
+    BufferAllocator::Deallocate(m_ArrayAllocator, m_Array);
+  }
 
   m_Array = nullptr;
+  m_ArrayAllocator = nullptr;
   m_IsAllocated = false;
 }
 
@@ -1480,7 +1588,8 @@ T* EbsdDataArray<T>::resizeAndExtend(size_t size)
     return m_Array;
   }
   newSize = size;
-  oldSize = m_Size;
+  // An array that was never allocated has a size but no values, so every value of the new array is initialized
+  oldSize = (m_Array != nullptr) ? m_Size : 0;
 
   // Wipe out the array completely if new size is zero.
   if(newSize == 0)
@@ -1489,7 +1598,8 @@ T* EbsdDataArray<T>::resizeAndExtend(size_t size)
     return m_Array;
   }
 
-  newArray = new(std::nothrow) T[newSize]();
+  // Only the values that are not copied from the old array are initialized below
+  newArray = BufferAllocator::Allocate<T>(m_Allocator, newSize, false);
   if(!newArray)
   {
     std::cout << "Unable to allocate " << newSize << " elements of size " << sizeof(T) << " bytes. ";
@@ -1514,6 +1624,8 @@ T* EbsdDataArray<T>::resizeAndExtend(size_t size)
   // Allocation was successful.  Save it.
   m_Size = newSize;
   m_Array = newArray;
+  m_ArrayAllocator = m_Allocator;
+  m_MappedFile.reset();
 
   // This object has now allocated its memory and owns it.
   m_OwnsData = true;
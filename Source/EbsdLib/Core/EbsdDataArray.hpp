@@ -35,16 +35,21 @@
 #pragma once
 
 // STL Includes
+#include <algorithm>
 #include <cassert>
 #include <iterator>
 #include <memory>
+#include <new>
 #include <sstream>
 #include <string>
 #include <vector>
 
+#include "EbsdLib/Core/BufferAllocator.h"
 #include "EbsdLib/Core/EbsdLibConstants.h"
 #include "EbsdLib/EbsdLib.h"
 
+class MemoryMappedFile;
+
 /**
  * @class EbsdDataArray
  * @brief Template class for wrapping raw arrays of data and is the basis for storing data within the SIMPL data structure.
@@ -231,11 +236,57 @@ public:
   static Pointer WrapPointer(T* data, size_t numTuples, const comp_dims_type& compDims, const std::string& name, bool ownsData);
 
   /**
-   * @brief Use this method to move the pointer ownership from this class to another similar class, such as SIMPLib::DataArray<T>
+   * @brief CreateMappedArray Creates an array whose values are stored in a memory mapped file instead of on the heap
+   * so that it can be larger than the physical memory. The file is created or truncated and then extended with
+   * zeros, so the array starts out zero filled. The values are stored in the native byte order without a header and
+   * the file can be reopened later with MapFile(). Operations that change the size of the array (resizeTuples(),
+   * eraseTuples()) move the values back into memory. The values are only valid while the array exists, even
+   * after releaseOwnership().
+   * @param numTuples
+   * @param compDims
+   * @param name
+   * @param filePath The sidecar file that stores the values
+   * @return The array or a null pointer if the file could not be created
+   */
+  static Pointer CreateMappedArray(size_t numTuples, const comp_dims_type& compDims, const std::string& name, const std::string& filePath);
+
+  /**
+   * @brief MapFile Creates an array on top of values that already exist in a file, such as a sidecar file written by
+   * CreateMappedArray() or an uncompressed contiguous HDF5 dataset (see H5EbsdChunkedIO::MapDataset()). Nothing is
+   * read up front; the operating system pages the values in when they are first accessed.
+   * @param filePath
+   * @param fileOffset Byte offset of the first value in the file
+   * @param numTuples The number of tuples. 0 uses all the tuples between fileOffset and the end of the file.
+   * @param compDims
+   * @param name
+   * @param writable If true changes are written back to the file, otherwise they are only kept in memory
+   * @return The array or a null pointer if the file could not be mapped
+   */
+  static Pointer MapFile(const std::string& filePath, size_t fileOffset, size_t numTuples, const comp_dims_type& compDims, const std::string& name, bool writable);
+
+  /**
+   * @brief Use this method to move the pointer ownership from this class to another similar class, such as SIMPLib::DataArray<T>.
+   * The other class frees the memory with delete[]. Memory that came from a BufferAllocator is therefore copied
+   * into new[] storage and this array keeps its own values. Memory mapped arrays can not be moved and return a
+   * null pointer.
    */
   template <typename DataArrayType>
   std::shared_ptr<DataArrayType> moveToDataArrayType()
   {
+    if(isMapped())
+    {
+      return nullptr;
+    }
+    if(nullptr != m_ArrayAllocator)
+    {
+      T* copy = new(std::nothrow) T[getSize()];
+      if(nullptr == copy)
+      {
+        return nullptr;
+      }
+      std::copy(data(), data() + getSize(), copy);
+      return DataArrayType::WrapPointer(copy, getNumberOfTuples(), getComponentDimensions(), getName().c_str(), true);
+    }
     std::shared_ptr<DataArrayType> output = DataArrayType::WrapPointer(data(), getNumberOfTuples(), getComponentDimensions(), getName().c_str(), true);
     releaseOwnership();
     return output;
@@ -324,6 +375,34 @@ public:
     return m_InitValue;
   }
 
+  /**
+   * @brief Sets the allocator used for all memory this array allocates from now on. The current memory is still
+   * freed by the allocator that provided it. The default (null) allocator uses new[]/delete[] which is what
+   * callers of releaseOwnership() that free the memory themselves expect; moveToDataArrayType() copies memory that
+   * came from any other allocator.
+   * @param allocator
+   */
+  void setAllocator(const BufferAllocator::Pointer& allocator);
+
+  /**
+   * @brief Returns the allocator used for new allocations of this array
+   * @return
+   */
+  BufferAllocator::Pointer getAllocator() const;
+
+  /**
+   * @brief Returns true if the values are stored in a memory mapped file
+   * @return
+   */
+  bool isMapped() const;
+
+  /**
+   * @brief Writes the modified values of a writable memory mapped array to its file and waits until they are
+   * stored. The values are also written back when the array is destroyed but without waiting for the disk.
+   * @return true on success and for arrays that are not writable memory mapped arrays
+   */
+  bool flush();
+
   /**
    * @brief Makes this class responsible for freeing the memory
    */
@@ -1202,6 +1281,9 @@ private:
   comp_dims_type m_CompDims = {1};
   bool m_IsAllocated = false;
   bool m_OwnsData = true;
+  BufferAllocator::Pointer m_Allocator = nullptr;      // Used for new allocations
+  BufferAllocator::Pointer m_ArrayAllocator = nullptr; // Allocator that provided m_Array
+  std::shared_ptr<MemoryMappedFile> m_MappedFile;       // Set when m_Array points into a mapped file
 };
 
 // -----------------------------------------------------------------------------
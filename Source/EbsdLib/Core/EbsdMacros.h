@@ -250,7 +250,7 @@ private:
 
 #define SHUFFLE_ARRAY(name, var, Type)                                                                                                                                                                 \
   {                                                                                                                                                                                                    \
-    Type* f = allocateArray<Type>(totalDataRows);                                                                                                                                                      \
+    Type* f = allocateArray<Type>(totalDataRows, false); /* The shuffle writes every value */                                                                                                          \
     for(size_t i = 0; i < totalDataRows; ++i)                                                                                                                                                          \
     {                                                                                                                                                                                                  \
       size_t nIdx = shuffleTable[i];                                                                                                                                                                   \
@@ -266,7 +266,6 @@ private:
     auto _##name = allocateArray<type>(totalDataRows);                                                                                                                                                 \
     if(nullptr != _##name)                                                                                                                                                                             \
     {                                                                                                                                                                                                  \
-      ::memset(_##name, 0, numBytes);                                                                                                                                                                  \
       std::string dataName = h5name;                                                                                                                                                                   \
       err = H5Lite::readPointerDataset(gid, dataName, _##name);                                                                                                                                        \
       if(err < 0)                                                                                                                                                                                      \
@@ -283,3 +282,27 @@ private:
     }                                                                                                                                                                                                  \
     set##name##Pointer(_##name);                                                                                                                                                                       \
   }
+
+#define ANG_READER_ALLOCATE_AND_READ_ROWS(name, h5name, type, numColumns, rowStart, rowCount, chunkCacheSize)                                                                                          \
+  free##name##Pointer(); /* Always free the current data before reading new data */                                                                                                                    \
+  if(m_ReadAllArrays == true || m_ArrayNames.find(h5name) != m_ArrayNames.end())                                                                                                                       \
+  {                                                                                                                                                                                                    \
+    auto _##name = allocateArray<type>(totalDataRows, false); /* ReadRows writes every value */                                                                                                        \
+    if(nullptr != _##name)                                                                                                                                                                             \
+    {                                                                                                                                                                                                  \
+      std::string dataName = h5name;                                                                                                                                                                   \
+      err = H5EbsdChunkedIO::ReadRows(gid, dataName, numColumns, rowStart, rowCount, chunkCacheSize, _##name);                                                                                         \
+      if(err < 0)                                                                                                                                                                                      \
+      {                                                                                                                                                                                                \
+        deallocateArrayData(_##name); /*deallocate the array*/                                                                                                                                         \
+        setErrorCode(-90020);                                                                                                                                                                          \
+        ss << "Error reading dataset '" << #name                                                                                                                                                       \
+           << "' from the HDF5 file. This data set is required to be in the file because either "                                                                                                      \
+              "the program is set to read ALL the Data arrays or the program was instructed to read this array.";                                                                                      \
+        setErrorMessage(sBuf);                                                                                                                                                                         \
+        err = H5Gclose(gid);                                                                                                                                                                           \
+        return -90020;                                                                                                                                                                                 \
+      }                                                                                                                                                                                                \
+    }                                                                                                                                                                                                  \
+    set##name##Pointer(_##name);                                                                                                                                                                       \
+  }
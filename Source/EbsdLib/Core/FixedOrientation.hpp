@@ -0,0 +1,286 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+
+#include "EbsdLib/Core/Orientation.hpp"
+#include "EbsdLib/Core/OrientationRepresentation.h"
+#include "EbsdLib/Math/Matrix3X3.hpp"
+
+/**
+ * @brief The FixedOrientation class holds a single orientation of a known representation
+ * (Euler, Orientation Matrix, Axis-Angle, Rodrigues, Homochoric, Cubochoric or Stereographic)
+ * in a fixed size array that lives on the stack. It implements the same subset of the
+ * container interface as the Orientation class so it can be used as either the InputType or
+ * OutputType of the OrientationTransformation functions, but it never allocates memory. This makes
+ * it suitable for per-voxel work over very large data sets. Quaternions already have a fixed size
+ * representation in the Quaternion class.
+ */
+template <typename T, OrientationRepresentation::Type R>
+class FixedOrientation
+{
+public:
+  static_assert(std::is_floating_point_v<T>, "T must be a floating point type");
+  static_assert(OrientationRepresentation::ComponentCount(R) > 0, "The representation must have a known number of components");
+
+  static constexpr size_t k_Size = OrientationRepresentation::ComponentCount(R);
+  static constexpr OrientationRepresentation::Type k_Representation = R;
+
+  using size_type = size_t;
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using pointer = T*;
+  using iterator = T*;
+  using const_iterator = const T*;
+
+  FixedOrientation() = default;
+  ~FixedOrientation() = default;
+
+  FixedOrientation(const FixedOrientation&) = default;
+  FixedOrientation(FixedOrientation&&) noexcept = default;
+  FixedOrientation& operator=(const FixedOrientation&) = default;
+  FixedOrientation& operator=(FixedOrientation&&) noexcept = default;
+
+  /**
+   * @brief Constructor that matches the Orientation(size, init) constructor so that the
+   * templated transformation functions can create their outputs. The storage is always
+   * k_Size elements; asking for fewer is allowed for scratch values, asking for more is an error.
+   * @param size The number of elements requested
+   * @param init Initialization value to be assigned to each element
+   */
+  explicit FixedOrientation(size_type size, T init = static_cast<T>(0))
+  {
+    if(size > k_Size)
+    {
+      throw std::out_of_range("FixedOrientation requested size is larger than the representation allows");
+    }
+    m_Array.fill(init);
+  }
+
+  /**
+   * @brief Constructs the orientation from exactly k_Size values
+   */
+  template <typename... Args, typename = std::enable_if_t<sizeof...(Args) == k_Size && (sizeof...(Args) > 1) && (std::is_arithmetic_v<Args> && ...)>>
+  FixedOrientation(Args... args)
+  : m_Array{{static_cast<T>(args)...}}
+  {
+  }
+
+  /**
+   * @brief Copies the values out of an Orientation object. Missing values are set to zero.
+   * @param orientation
+   */
+  explicit FixedOrientation(const Orientation<T>& orientation)
+  {
+    size_t count = orientation.size() < k_Size ? orientation.size() : k_Size;
+    for(size_t i = 0; i < count; i++)
+    {
+      m_Array[i] = orientation[i];
+    }
+  }
+
+  /**
+   * @brief Converts to the same representation using a different value type
+   */
+  template <class U, class = std::enable_if_t<std::is_floating_point_v<U>>>
+  FixedOrientation<U, R> to() const
+  {
+    FixedOrientation<U, R> out;
+    for(size_t i = 0; i < k_Size; i++)
+    {
+      out[i] = static_cast<U>(m_Array[i]);
+    }
+    return out;
+  }
+
+  /**
+   * @brief Copies the values into a heap allocated Orientation object for use with older APIs.
+   */
+  Orientation<T> toOrientation() const
+  {
+    Orientation<T> out(k_Size);
+    for(size_t i = 0; i < k_Size; i++)
+    {
+      out[i] = m_Array[i];
+    }
+    return out;
+  }
+
+  // ######### Iterators #########
+
+  iterator begin() noexcept
+  {
+    return m_Array.data();
+  }
+
+  iterator end() noexcept
+  {
+    return m_Array.data() + k_Size;
+  }
+
+  const_iterator begin() const noexcept
+  {
+    return m_Array.data();
+  }
+
+  const_iterator end() const noexcept
+  {
+    return m_Array.data() + k_Size;
+  }
+
+  // ######### Capacity #########
+
+  static constexpr size_type size() noexcept
+  {
+    return k_Size;
+  }
+
+  static constexpr bool empty() noexcept
+  {
+    return false;
+  }
+
+  // ######### Element Access #########
+
+  inline reference operator[](size_type index)
+  {
+    return m_Array[index];
+  }
+
+  inline const_reference operator[](size_type index) const
+  {
+    return m_Array[index];
+  }
+
+  inline reference at(size_type index)
+  {
+    return m_Array.at(index);
+  }
+
+  inline const_reference at(size_type index) const
+  {
+    return m_Array.at(index);
+  }
+
+  inline T* data() noexcept
+  {
+    return m_Array.data();
+  }
+
+  inline const T* data() const noexcept
+  {
+    return m_Array.data();
+  }
+
+  /**
+   * @brief copyInto Copies the values into a raw array
+   * @param ptr Destination array that can hold at least size elements
+   * @param size Maximum number of values to copy
+   */
+  void copyInto(T* ptr, size_type size) const
+  {
+    if(size > k_Size)
+    {
+      size = k_Size;
+    }
+    for(size_type i = 0; i < size; i++)
+    {
+      ptr[i] = m_Array[i];
+    }
+  }
+
+  /**
+   * @brief toGMatrix Copies the values of an orientation matrix into the 3x3 "G" Matrix
+   * @param g
+   */
+  void toGMatrix(T g[3][3]) const
+  {
+    static_assert(R == OrientationRepresentation::Type::OrientationMatrix, "toGMatrix is only available for orientation matrices");
+    g[0][0] = m_Array[0];
+    g[0][1] = m_Array[1];
+    g[0][2] = m_Array[2];
+    g[1][0] = m_Array[3];
+    g[1][1] = m_Array[4];
+    g[1][2] = m_Array[5];
+    g[2][0] = m_Array[6];
+    g[2][1] = m_Array[7];
+    g[2][2] = m_Array[8];
+  }
+
+  EbsdLib::Matrix3X3<T> toGMatrixObj() const
+  {
+    static_assert(R == OrientationRepresentation::Type::OrientationMatrix, "toGMatrixObj is only available for orientation matrices");
+    return {m_Array[0], m_Array[1], m_Array[2], m_Array[3], m_Array[4], m_Array[5], m_Array[6], m_Array[7], m_Array[8]};
+  }
+
+private:
+  std::array<T, k_Size> m_Array = {};
+};
+
+template <typename T>
+using EulerType = FixedOrientation<T, OrientationRepresentation::Type::Euler>;
+template <typename T>
+using OrientationMatrixType = FixedOrientation<T, OrientationRepresentation::Type::OrientationMatrix>;
+template <typename T>
+using AxisAngleType = FixedOrientation<T, OrientationRepresentation::Type::AxisAngle>;
+template <typename T>
+using RodriguesType = FixedOrientation<T, OrientationRepresentation::Type::Rodrigues>;
+template <typename T>
+using HomochoricType = FixedOrientation<T, OrientationRepresentation::Type::Homochoric>;
+template <typename T>
+using CubochoricType = FixedOrientation<T, OrientationRepresentation::Type::Cubochoric>;
+template <typename T>
+using StereographicType = FixedOrientation<T, OrientationRepresentation::Type::Stereographic>;
+
+using EulerD = EulerType<double>;
+using EulerF = EulerType<float>;
+using OrientationMatrixD = OrientationMatrixType<double>;
+using OrientationMatrixF = OrientationMatrixType<float>;
+using AxisAngleD = AxisAngleType<double>;
+using AxisAngleF = AxisAngleType<float>;
+using RodriguesD = RodriguesType<double>;
+using RodriguesF = RodriguesType<float>;
+using HomochoricD = HomochoricType<double>;
+using HomochoricF = HomochoricType<float>;
+using CubochoricD = CubochoricType<double>;
+using CubochoricF = CubochoricType<float>;
+using StereographicD = StereographicType<double>;
+using StereographicF = StereographicType<float>;
@@ -31,6 +31,8 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #pragma once
 
+#include <cstddef>
+
 namespace OrientationRepresentation
 {
 enum class Type : int
@@ -45,4 +47,32 @@ enum class Type : int
   Stereographic,
   Unknown
 };
+
+/**
+ * @brief ComponentCount Returns the number of values needed to store a single orientation
+ * in the given representation.
+ * @param type The orientation representation
+ * @return Number of components, or zero for an unknown representation
+ */
+constexpr size_t ComponentCount(Type type)
+{
+  switch(type)
+  {
+  case Type::Euler:
+    return 3;
+  case Type::OrientationMatrix:
+    return 9;
+  case Type::Quaternion:
+  case Type::AxisAngle:
+  case Type::Rodrigues:
+    return 4;
+  case Type::Homochoric:
+  case Type::Cubochoric:
+  case Type::Stereographic:
+    return 3;
+  case Type::Unknown:
+    break;
+  }
+  return 0;
 }
+} // namespace OrientationRepresentation
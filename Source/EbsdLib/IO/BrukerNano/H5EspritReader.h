@@ -230,6 +230,11 @@ protected:
    */
   int sanityCheckForOpening();
 
+  /**
+   * @brief Lists the data arrays for the readFileInRowWindows() implementation of EbsdReader
+   */
+  std::vector<RowWindowArray> getRowWindowArrays() override;
+
 private:
   std::string m_HDF5Path = {};
 
@@ -0,0 +1,219 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "DataSectionChunks.h"
+
+#include <algorithm>
+
+#ifdef EbsdLib_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#endif
+
+#include "EbsdLib/Utilities/EbsdStringUtils.hpp"
+
+namespace
+{
+// Each chunk should hold enough lines to amortize the task overhead
+constexpr size_t k_TargetChunkSize = 1024 * 1024;
+
+/**
+ * @brief Counts the number of lines in a single chunk. The chunk always starts at the beginning of a
+ * line and every line except possibly the last line of the buffer is terminated by a newline.
+ */
+class CountRowsImpl
+{
+public:
+  CountRowsImpl(std::vector<DataSectionChunks::Chunk>& chunks, const char* bufferEnd)
+  : m_Chunks(chunks)
+  , m_BufferEnd(bufferEnd)
+  {
+  }
+
+  void count(size_t start, size_t end) const
+  {
+    for(size_t i = start; i < end; i++)
+    {
+      DataSectionChunks::Chunk& chunk = m_Chunks[i];
+      size_t numRows = static_cast<size_t>(std::count(chunk.first, chunk.last, '\n'));
+      if(chunk.last == m_BufferEnd && chunk.first != chunk.last && *(chunk.last - 1) != '\n')
+      {
+        // The final line of the file does not have a newline. Only count it if it holds data.
+        const char* lineStart = chunk.last;
+        while(lineStart != chunk.first && *(lineStart - 1) != '\n')
+        {
+          --lineStart;
+        }
+        if(std::any_of(lineStart, chunk.last, [](char c) { return !EbsdStringUtils::isBlank(c); }))
+        {
+          ++numRows;
+        }
+      }
+      chunk.numRows = numRows;
+    }
+  }
+
+#ifdef EbsdLib_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    count(r.begin(), r.end());
+  }
+#endif
+
+private:
+  std::vector<DataSectionChunks::Chunk>& m_Chunks;
+  const char* m_BufferEnd = nullptr;
+};
+} // namespace
+
+// -----------------------------------------------------------------------------
+std::vector<DataSectionChunks::Chunk> DataSectionChunks::Split(const char* first, const char* last, size_t maxRows, bool parallel)
+{
+  std::vector<Chunk> chunks;
+  if(first == last || maxRows == 0)
+  {
+    return chunks;
+  }
+
+  size_t numBytes = static_cast<size_t>(last - first);
+  size_t numChunks = parallel ? std::max(numBytes / k_TargetChunkSize, static_cast<size_t>(1)) : 1;
+  size_t chunkSize = numBytes / numChunks;
+
+  // Move each nominal split point forward to just past the next newline
+  const char* chunkStart = first;
+  for(size_t i = 0; i < numChunks && chunkStart != last; i++)
+  {
+    const char* chunkEnd = last;
+    if(i + 1 < numChunks)
+    {
+      chunkEnd = std::max(chunkStart, first + (i + 1) * chunkSize);
+      chunkEnd = FindLineEnd(chunkEnd, last);
+      if(chunkEnd != last)
+      {
+        ++chunkEnd;
+      }
+    }
+    Chunk chunk;
+    chunk.first = chunkStart;
+    chunk.last = chunkEnd;
+    chunks.push_back(chunk);
+    chunkStart = chunkEnd;
+  }
+
+#ifdef EbsdLib_USE_PARALLEL_ALGORITHMS
+  if(parallel)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, chunks.size()), CountRowsImpl(chunks, last), tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    CountRowsImpl serial(chunks, last);
+    serial.count(0, chunks.size());
+  }
+
+  // Prefix sum the row counts so each chunk knows where its rows go
+  size_t firstRow = 0;
+  std::vector<Chunk> validChunks;
+  validChunks.reserve(chunks.size());
+  for(auto& chunk : chunks)
+  {
+    if(firstRow >= maxRows)
+    {
+      break;
+    }
+    chunk.firstRow = firstRow;
+    firstRow += chunk.numRows;
+    chunk.numRows = std::min(chunk.numRows, maxRows - chunk.firstRow);
+    if(chunk.numRows > 0)
+    {
+      validChunks.push_back(chunk);
+    }
+  }
+  return validChunks;
+}
+
+// -----------------------------------------------------------------------------
+size_t DataSectionChunks::TotalRows(const std::vector<Chunk>& chunks)
+{
+  size_t total = 0;
+  for(const auto& chunk : chunks)
+  {
+    total += chunk.numRows;
+  }
+  return total;
+}
+
+// -----------------------------------------------------------------------------
+void DataSectionChunks::ForEach(const std::vector<Chunk>& chunks, bool parallel, const std::function<void(size_t, const Chunk&)>& func)
+{
+#ifdef EbsdLib_USE_PARALLEL_ALGORITHMS
+  if(parallel)
+  {
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(0, chunks.size()),
+        [&chunks, &func](const tbb::blocked_range<size_t>& r) {
+          for(size_t i = r.begin(); i < r.end(); i++)
+          {
+            func(i, chunks[i]);
+          }
+        },
+        tbb::auto_partitioner());
+    return;
+  }
+#endif
+  for(size_t i = 0; i < chunks.size(); i++)
+  {
+    func(i, chunks[i]);
+  }
+}
+
+// -----------------------------------------------------------------------------
+size_t DataSectionChunks::ReadLines(std::istream& in, size_t maxRows, std::string& block)
+{
+  size_t numRows = 0;
+  std::string line;
+  while(numRows < maxRows && std::getline(in, line))
+  {
+    if(in.eof() && std::all_of(line.begin(), line.end(), [](char c) { return EbsdStringUtils::isBlank(c); }))
+    {
+      break;
+    }
+    block.append(line).append(1, '\n');
+    ++numRows;
+  }
+  return numRows;
+}
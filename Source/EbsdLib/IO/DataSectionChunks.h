@@ -0,0 +1,107 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <istream>
+#include <string>
+#include <vector>
+
+#include "EbsdLib/EbsdLib.h"
+
+/**
+ * @brief These functions split the data section of an ASCII EBSD file (.ang, .ctf) that is held
+ * in memory into chunks that each start at the beginning of a line. The number of rows (lines) in
+ * each chunk is counted and prefix summed so that every chunk knows the index of its first row
+ * which allows the chunks to be parsed independently of each other into preallocated arrays.
+ */
+namespace DataSectionChunks
+{
+
+struct Chunk
+{
+  const char* first = nullptr; // First character of the first line in the chunk
+  const char* last = nullptr;  // One past the last character of the chunk
+  size_t firstRow = 0;         // Zero based index of the first line in the chunk
+  size_t numRows = 0;          // Number of lines in the chunk that should be parsed
+};
+
+/**
+ * @brief Splits [first, last) into chunks at newline boundaries. A line that is not terminated by a
+ * newline at the end of the buffer is counted as a row unless it only holds white space.
+ * @param first The first character of the data section
+ * @param last One past the last character of the data section
+ * @param maxRows No rows past this number are assigned to any chunk
+ * @param parallel If false a single chunk is produced, otherwise the buffer is split into roughly
+ * equal sized chunks and the rows are counted in parallel.
+ * @return The chunks in file order. Chunks that hold no rows to parse are not returned.
+ */
+EbsdLib_EXPORT std::vector<Chunk> Split(const char* first, const char* last, size_t maxRows, bool parallel);
+
+/**
+ * @brief Returns the total number of rows over all of the chunks
+ */
+EbsdLib_EXPORT size_t TotalRows(const std::vector<Chunk>& chunks);
+
+/**
+ * @brief Calls the function once for each chunk, in parallel if requested and EbsdLib was compiled with
+ * parallel algorithms. The function receives the index of the chunk so it can store per chunk results.
+ */
+EbsdLib_EXPORT void ForEach(const std::vector<Chunk>& chunks, bool parallel, const std::function<void(size_t, const Chunk&)>& func);
+
+/**
+ * @brief Reads up to maxRows lines from the stream and appends each of them, terminated by a newline, to
+ * block so that the block can be handed to Split(). A final line that only holds white space is not
+ * counted, the same way Split() treats it. This lets a data section be parsed one window at a time.
+ * @return The number of lines that were appended
+ */
+EbsdLib_EXPORT size_t ReadLines(std::istream& in, size_t maxRows, std::string& block);
+
+/**
+ * @brief Returns one past the last character of the line that starts at 'first', which is either
+ * the newline character or 'last'.
+ */
+inline const char* FindLineEnd(const char* first, const char* last)
+{
+  while(first != last && *first != '\n')
+  {
+    ++first;
+  }
+  return first;
+}
+
+} // namespace DataSectionChunks
@@ -34,6 +34,7 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #pragma once
 
+#include <cstdint>
 #include <iostream>
 
 #include "EbsdLib/Core/EbsdSetGetMacros.h"
@@ -42,6 +43,19 @@
 #ifdef EbsdLib_ENABLE_HDF5
 #include <hdf5.h>
 #endif
+
+/**
+ * @brief The H5EbsdStorageOptions struct controls how an EbsdImporter lays out the data arrays of each slice
+ * in the HDF5 file. The defaults give the contiguous, uncompressed datasets of the h5ebsd specification.
+ */
+struct H5EbsdStorageOptions
+{
+  size_t chunkRows = 0;      // Number of scan rows in each chunk. 0 writes contiguous datasets.
+  int32_t deflateLevel = 0;  // gzip level from 1 to 9, 0 disables compression. Needs chunkRows > 0
+  bool shuffle = false;      // Byte shuffle the values before compressing them. Needs chunkRows > 0
+  size_t chunkCacheSize = 0; // Bytes of chunk cache for each dataset. 0 keeps the HDF5 default.
+};
+
 /**
  * @class EbsdImporter EbsdImporter.h EbsdLib/EbsdImporter.h
  * @brief  This class is a pure virtual class that defines the interface that
@@ -171,6 +185,23 @@ public:
    */
   virtual void setFileVersion(uint32_t version) = 0;
 
+  /**
+   * @brief Setter property for StorageOptions
+   */
+  void setStorageOptions(const H5EbsdStorageOptions& value)
+  {
+    m_StorageOptions = value;
+  }
+
+  /**
+   * @brief Getter property for StorageOptions
+   * @return Value of StorageOptions
+   */
+  const H5EbsdStorageOptions& getStorageOptions() const
+  {
+    return m_StorageOptions;
+  }
+
 protected:
   EbsdImporter() = default;
 
@@ -183,4 +214,5 @@ public:
 private:
   int m_ErrorCode = 0;
   bool m_Cancel = false;
+  H5EbsdStorageOptions m_StorageOptions;
 };
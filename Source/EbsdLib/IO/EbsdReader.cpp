@@ -35,6 +35,9 @@
 
 #include "EbsdReader.h"
 
+#include <algorithm>
+#include <cstring>
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -66,6 +69,58 @@ void EbsdReader::appendOriginalHeader(const std::string& more)
   m_OriginalHeader.append(more);
 }
 
+// -----------------------------------------------------------------------------
+int EbsdReader::readFileInRowWindows(size_t rowsPerWindow, const RowWindowCallback& callback)
+{
+  int err = readFile();
+  if(err < 0)
+  {
+    return err;
+  }
+  size_t numElements = getNumberOfElements();
+  size_t numRows = static_cast<size_t>(std::max(getYDimension(), 1));
+  size_t numColumns = numElements / numRows;
+  std::vector<RowWindowArray> arrays = getRowWindowArrays();
+  if(arrays.empty() || numColumns * numRows != numElements)
+  {
+    rowsPerWindow = numRows;
+  }
+  rowsPerWindow = std::max(rowsPerWindow, static_cast<size_t>(1));
+
+  RowWindow window;
+  while(window.firstRow < numRows)
+  {
+    window.numRows = std::min(rowsPerWindow, numRows - window.firstRow);
+    window.numElements = (window.numRows == numRows) ? numElements : window.numRows * numColumns;
+    // The values of the earlier windows are no longer needed, so the window is moved to the start of each array.
+    // The destination always ends before the source starts.
+    if(window.firstElement > 0)
+    {
+      for(const auto& array : arrays)
+      {
+        if(array.data != nullptr)
+        {
+          uint8_t* data = static_cast<uint8_t*>(array.data);
+          std::memmove(data, data + window.firstElement * array.bytesPerPoint, window.numElements * array.bytesPerPoint);
+        }
+      }
+    }
+    if(!callback(window))
+    {
+      break;
+    }
+    window.firstRow += window.numRows;
+    window.firstElement += window.numElements;
+  }
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+std::vector<EbsdReader::RowWindowArray> EbsdReader::getRowWindowArrays()
+{
+  return {};
+}
+
 // -----------------------------------------------------------------------------
 void EbsdReader::setErrorMessage(const std::string& value)
 {
@@ -35,9 +35,12 @@
 
 #pragma once
 
+#include <functional>
 #include <map>
 #include <string>
+#include <vector>
 
+#include "EbsdLib/Core/BufferAllocator.h"
 #include "EbsdLib/Core/EbsdLibConstants.h"
 #include "EbsdLib/Core/EbsdSetGetMacros.h"
 #include "EbsdLib/EbsdLib.h"
@@ -134,6 +137,13 @@ public:
    */
   /** @brief Will this class be responsible for deallocating the memory for the data arrays */
   EBSD_INSTANCE_PROPERTY(bool, ManageMemory)
+  /**
+   * @brief The allocator used for the data arrays. The default (null) allocator uses new[]/delete[] so that
+   * pointers whose ownership is released with get[NAME]Pointer(true) can be freed with delete[]. Pointers
+   * released from a reader with any other allocator must be freed with BufferAllocator::Deallocate(getAllocator(), ptr).
+   * Only change the allocator while the reader holds no data arrays.
+   */
+  EBSD_INSTANCE_PROPERTY(BufferAllocator::Pointer, Allocator)
   /** @brief Has the complete header been read */
   EBSD_INSTANCE_PROPERTY(bool, HeaderIsComplete)
   /** @brief The number of elements in a column of data. This should be rows * columns */
@@ -198,16 +208,48 @@ public:
   virtual int readHeaderOnly() = 0;
 
   /**
-   * @brief Allocats a contiguous chunk of memory to store values from the .ang file
-   * @param numberOfElements The number of elements in the Array. This method can
-   * also optionally produce SSE aligned memory for use with SSE intrinsics
+   * @brief The RowWindow struct describes the block of scan rows that the reader holds while
+   * readFileInRowWindows() is running. The data arrays of the reader hold exactly these rows with the first
+   * point of the window at index 0.
+   */
+  struct RowWindow
+  {
+    size_t firstRow = 0;     // Zero based index of the first scan row in the window
+    size_t numRows = 0;      // Number of scan rows in the window
+    size_t firstElement = 0; // Index of the first point of the window within the complete scan
+    size_t numElements = 0;  // Number of points in the window
+  };
+
+  /**
+   * @brief Called once for each window. Return false to stop reading the file.
+   */
+  using RowWindowCallback = std::function<bool(const RowWindow&)>;
+
+  /**
+   * @brief Reads the header and then the data section of the file in windows of at most rowsPerWindow scan
+   * rows so that scans larger than the available memory can be processed. Only a single window is held in
+   * memory: the data pointers (get[NAME]Pointer(), getPointerByName()) are only valid inside the callback, are
+   * reused for the next window and must not have their ownership released. getNumberOfElements() returns the
+   * number of points in the complete scan. The default implementation reads the complete file and then moves
+   * each window of the arrays listed by getRowWindowArrays() to index 0 before reporting it. Scans whose rows
+   * do not all hold the same number of points, and readers that list no arrays, are reported as a single window.
+   * @param rowsPerWindow Maximum number of scan rows in each window. A value of 0 is treated as 1.
+   * @param callback Called once per window in file order
+   * @return 0 on success or a negative error code
+   */
+  virtual int readFileInRowWindows(size_t rowsPerWindow, const RowWindowCallback& callback);
+
+  /**
+   * @brief Allocates a contiguous chunk of memory from the allocator of this reader to store the values of a
+   * data column
+   * @param numberOfElements The number of elements in the Array.
+   * @param zeroFill Zero the memory. Pass false when every element is going to be written anyway.
    * @return Pointer to allocated memory
    */
   template <typename T>
-  T* allocateArray(size_t numberOfElements)
+  T* allocateArray(size_t numberOfElements, bool zeroFill = true)
   {
-    T* m_buffer = new T[numberOfElements]();
-    return m_buffer;
+    return BufferAllocator::Allocate<T>(m_Allocator, numberOfElements, zeroFill);
   }
 
   /**
@@ -220,7 +262,7 @@ public:
   {
     if(ptr != nullptr && this->m_ManageMemory)
     {
-      delete[](ptr);
+      BufferAllocator::Deallocate(m_Allocator, ptr);
       ptr = nullptr;
     }
   }
@@ -286,6 +328,21 @@ public:
 protected:
   std::map<std::string, EbsdHeaderEntry::Pointer> m_HeaderMap;
 
+  /**
+   * @brief The RowWindowArray struct points to one of the per point data arrays of the reader
+   */
+  struct RowWindowArray
+  {
+    void* data = nullptr;     // The first value of the array
+    size_t bytesPerPoint = 0; // The size of all of the components of a single point
+  };
+
+  /**
+   * @brief Returns the per point data arrays that the default readFileInRowWindows() moves to index 0 for each
+   * window. Arrays that were not read may be listed with a null pointer. The default lists no arrays.
+   */
+  virtual std::vector<RowWindowArray> getRowWindowArrays();
+
 public:
   EbsdReader(const EbsdReader&) = delete;            // Copy Constructor Not Implemented
   EbsdReader(EbsdReader&&) = delete;                 // Move Constructor Not Implemented
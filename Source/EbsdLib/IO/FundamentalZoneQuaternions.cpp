@@ -0,0 +1,226 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "FundamentalZoneQuaternions.h"
+
+#include <algorithm>
+
+#ifdef EbsdLib_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#endif
+
+#include "EbsdLib/Core/EbsdLibConstants.h"
+#include "EbsdLib/Core/OrientationTransformation.hpp"
+#include "EbsdLib/IO/HKL/CtfReader.h"
+#include "EbsdLib/IO/TSL/AngReader.h"
+#include "EbsdLib/LaueOps/LaueOps.h"
+#include "EbsdLib/Math/EbsdLibMath.h"
+
+#ifdef EbsdLib_ENABLE_HDF5
+#include "EbsdLib/IO/BrukerNano/H5EspritReader.h"
+#endif
+
+namespace
+{
+/**
+ * @brief The ConvertEulersToFZQuatsImpl class converts a range of Euler angles into quaternions and moves each one
+ * into the Fundamental Zone of its phase in the same pass.
+ */
+class ConvertEulersToFZQuatsImpl
+{
+  const float* m_Phi1;
+  const float* m_Phi;
+  const float* m_Phi2;
+  const int32_t* m_Phases;
+  const std::vector<const LaueOps*>& m_PhaseOps;
+  double m_Scale;
+  float* m_Quats;
+
+public:
+  ConvertEulersToFZQuatsImpl(const float* phi1, const float* phi, const float* phi2, const int32_t* phases, const std::vector<const LaueOps*>& phaseOps, bool convertDegrees, float* quats)
+  : m_Phi1(phi1)
+  , m_Phi(phi)
+  , m_Phi2(phi2)
+  , m_Phases(phases)
+  , m_PhaseOps(phaseOps)
+  , m_Scale(convertDegrees ? EbsdLib::Constants::k_PiOver180D : 1.0)
+  , m_Quats(quats)
+  {
+  }
+  virtual ~ConvertEulersToFZQuatsImpl() = default;
+
+  void generate(size_t start, size_t end) const
+  {
+    const int32_t numPhases = static_cast<int32_t>(m_PhaseOps.size());
+    for(size_t i = start; i < end; i++)
+    {
+      EulerD eu(m_Phi1[i] * m_Scale, m_Phi[i] * m_Scale, m_Phi2[i] * m_Scale);
+      QuatD q = OrientationTransformation::eu2qu(eu);
+
+      int32_t phase = (nullptr == m_Phases) ? 0 : m_Phases[i];
+      if(phase >= 0 && phase < numPhases && nullptr != m_PhaseOps[phase])
+      {
+        q = m_PhaseOps[phase]->getFZQuat(q);
+      }
+      q.to<float>().copyInto(m_Quats + i * 4, QuatF::Order::VectorScalar);
+    }
+  }
+
+#ifdef EbsdLib_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    generate(r.begin(), r.end());
+  }
+#endif
+};
+
+/**
+ * @brief Maps each phase of a reader onto its crystal structure using the phase index that the file stores in its
+ * phase column. Phase indices that the file does not describe stay UnknownCrystalStructure.
+ */
+template <typename PhaseType>
+std::vector<uint32_t> CrystalStructuresFromPhases(const std::vector<PhaseType>& phaseVector)
+{
+  std::vector<uint32_t> crystalStructures;
+  for(const auto& phase : phaseVector)
+  {
+    int32_t index = phase->getPhaseIndex();
+    if(index < 0)
+    {
+      continue;
+    }
+    if(static_cast<size_t>(index) >= crystalStructures.size())
+    {
+      crystalStructures.resize(index + 1, EbsdLib::CrystalStructure::UnknownCrystalStructure);
+    }
+    crystalStructures[index] = phase->determineLaueGroup();
+  }
+  return crystalStructures;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+FundamentalZoneQuaternions::FundamentalZoneQuaternions() = default;
+
+// -----------------------------------------------------------------------------
+FundamentalZoneQuaternions::~FundamentalZoneQuaternions() = default;
+
+// -----------------------------------------------------------------------------
+EbsdLib::FloatArrayType::Pointer FundamentalZoneQuaternions::FromEulers(const float* phi1, const float* phi, const float* phi2, const int32_t* phases, const std::vector<uint32_t>& crystalStructures,
+                                                                        size_t numPoints, bool convertDegrees)
+{
+  std::vector<size_t> cDims = {4};
+  EbsdLib::FloatArrayType::Pointer quats = EbsdLib::FloatArrayType::CreateArray(numPoints, cDims, "FZ Quats", true);
+  if(nullptr == quats || (numPoints > 0 && nullptr == quats->getPointer(0)))
+  {
+    return EbsdLib::FloatArrayType::NullPointer();
+  }
+
+  std::vector<LaueOps::Pointer> allOps = LaueOps::GetAllOrientationOps();
+  std::vector<const LaueOps*> phaseOps(crystalStructures.size(), nullptr);
+  for(size_t i = 0; i < crystalStructures.size(); i++)
+  {
+    if(crystalStructures[i] < allOps.size())
+    {
+      phaseOps[i] = allOps[crystalStructures[i]].get();
+    }
+  }
+
+  ConvertEulersToFZQuatsImpl serial(phi1, phi, phi2, phases, phaseOps, convertDegrees, quats->getPointer(0));
+#ifdef EbsdLib_USE_PARALLEL_ALGORITHMS
+  bool doParallel = true;
+  if(doParallel)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numPoints), serial, tbb::auto_partitioner());
+    return quats;
+  }
+#endif
+  serial.generate(0, numPoints);
+  return quats;
+}
+
+// -----------------------------------------------------------------------------
+EbsdLib::FloatArrayType::Pointer FundamentalZoneQuaternions::FromAngReader(AngReader& reader)
+{
+  float* phi1 = reader.getPhi1Pointer();
+  float* phi = reader.getPhiPointer();
+  float* phi2 = reader.getPhi2Pointer();
+  if(nullptr == phi1 || nullptr == phi || nullptr == phi2)
+  {
+    return EbsdLib::FloatArrayType::NullPointer();
+  }
+
+  std::vector<AngPhase::Pointer> phaseVector = reader.getPhaseVector();
+  std::vector<uint32_t> crystalStructures = CrystalStructuresFromPhases(phaseVector);
+  if(phaseVector.size() == 1 && crystalStructures.size() > 1)
+  {
+    crystalStructures[0] = crystalStructures.back();
+  }
+  return FromEulers(phi1, phi, phi2, reader.getPhaseDataPointer(), crystalStructures, reader.getNumberOfElements(), false);
+}
+
+// -----------------------------------------------------------------------------
+EbsdLib::FloatArrayType::Pointer FundamentalZoneQuaternions::FromCtfReader(CtfReader& reader)
+{
+  float* phi1 = reader.getEuler1Pointer();
+  float* phi = reader.getEuler2Pointer();
+  float* phi2 = reader.getEuler3Pointer();
+  if(nullptr == phi1 || nullptr == phi || nullptr == phi2)
+  {
+    return EbsdLib::FloatArrayType::NullPointer();
+  }
+
+  std::vector<uint32_t> crystalStructures = CrystalStructuresFromPhases(reader.getPhaseVector());
+  return FromEulers(phi1, phi, phi2, reader.getPhasePointer(), crystalStructures, reader.getNumberOfElements(), true);
+}
+
+#ifdef EbsdLib_ENABLE_HDF5
+// -----------------------------------------------------------------------------
+EbsdLib::FloatArrayType::Pointer FundamentalZoneQuaternions::FromH5EspritReader(H5EspritReader& reader)
+{
+  float* phi1 = reader.getphi1Pointer();
+  float* phi = reader.getPHIPointer();
+  float* phi2 = reader.getphi2Pointer();
+  if(nullptr == phi1 || nullptr == phi || nullptr == phi2)
+  {
+    return EbsdLib::FloatArrayType::NullPointer();
+  }
+
+  std::vector<uint32_t> crystalStructures = CrystalStructuresFromPhases(reader.getPhaseVector());
+  return FromEulers(phi1, phi, phi2, reader.getPhasePointer(), crystalStructures, reader.getNumberOfElements(), true);
+}
+#endif
@@ -0,0 +1,112 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "EbsdLib/Core/EbsdDataArray.hpp"
+#include "EbsdLib/EbsdLib.h"
+
+class AngReader;
+class CtfReader;
+#ifdef EbsdLib_ENABLE_HDF5
+class H5EspritReader;
+#endif
+
+/**
+ * @brief The FundamentalZoneQuaternions class converts the Euler angle columns of a freshly read EBSD file into
+ * quaternions that are already moved into the Fundamental Zone of the phase of each point. Doing the symmetry
+ * reduction once at load time lets later neighbor comparisons use LaueOps::calculateMisorientationAngleFZ()
+ * instead of searching all symmetry operators for every pair.
+ *
+ * The quaternions are stored 4 values per point in <XYZ>W order. Points whose phase does not map onto a known
+ * crystal structure keep the quaternion of their Euler angles without any reduction.
+ */
+class EbsdLib_EXPORT FundamentalZoneQuaternions
+{
+public:
+  ~FundamentalZoneQuaternions();
+
+  /**
+   * @brief FromEulers Converts three Euler angle columns into Fundamental Zone quaternions.
+   * @param phi1 First Euler angle of each point
+   * @param phi Second Euler angle of each point
+   * @param phi2 Third Euler angle of each point
+   * @param phases The phase of each point. Can be a null pointer in which case every point uses phase 0.
+   * @param crystalStructures The crystal structure (EbsdLib::CrystalStructure) of each phase index
+   * @param numPoints The number of points
+   * @param convertDegrees Are the input angles in Degrees
+   * @return A 4 component array, or a null pointer if the array could not be allocated
+   */
+  static EbsdLib::FloatArrayType::Pointer FromEulers(const float* phi1, const float* phi, const float* phi2, const int32_t* phases, const std::vector<uint32_t>& crystalStructures,
+                                                     size_t numPoints, bool convertDegrees);
+
+  /**
+   * @brief FromAngReader Uses the Phi1, Phi, Phi2 and PhaseData columns of a TSL .ang file. The angles are in
+   * radians. Single phase files that write 0 into the phase column use their only phase for those points.
+   * @param reader An AngReader that has read its file
+   * @return A 4 component array, or a null pointer if the reader does not hold the needed columns
+   */
+  static EbsdLib::FloatArrayType::Pointer FromAngReader(AngReader& reader);
+
+  /**
+   * @brief FromCtfReader Uses the Euler1, Euler2, Euler3 and Phase columns of an HKL .ctf file. The angles are
+   * converted from degrees.
+   * @param reader A CtfReader that has read its file
+   * @return A 4 component array, or a null pointer if the reader does not hold the needed columns
+   */
+  static EbsdLib::FloatArrayType::Pointer FromCtfReader(CtfReader& reader);
+
+#ifdef EbsdLib_ENABLE_HDF5
+  /**
+   * @brief FromH5EspritReader Uses the phi1, PHI, phi2 and Phase columns of a Bruker Esprit HDF5 file. The
+   * angles are converted from degrees.
+   * @param reader An H5EspritReader that has read its file
+   * @return A 4 component array, or a null pointer if the reader does not hold the needed columns
+   */
+  static EbsdLib::FloatArrayType::Pointer FromH5EspritReader(H5EspritReader& reader);
+#endif
+
+protected:
+  FundamentalZoneQuaternions();
+
+public:
+  FundamentalZoneQuaternions(const FundamentalZoneQuaternions&) = delete;            // Copy Constructor Not Implemented
+  FundamentalZoneQuaternions(FundamentalZoneQuaternions&&) = delete;                 // Move Constructor Not Implemented
+  FundamentalZoneQuaternions& operator=(const FundamentalZoneQuaternions&) = delete; // Copy Assignment Not Implemented
+  FundamentalZoneQuaternions& operator=(FundamentalZoneQuaternions&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,94 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "H5EbsdChunkedIO.h"
+
+#include <algorithm>
+
+// -----------------------------------------------------------------------------
+hid_t H5EbsdChunkedIO::CreateDatasetProperties(const H5EbsdStorageOptions& options, hsize_t numColumns, hsize_t numRows)
+{
+  hid_t dcpl = H5Pcreate(H5P_DATASET_CREATE);
+  if(dcpl < 0)
+  {
+    return dcpl;
+  }
+  hsize_t chunkDims[1] = {std::max<hsize_t>(1, std::min<hsize_t>(options.chunkRows, numRows)) * numColumns};
+  herr_t err = H5Pset_chunk(dcpl, 1, chunkDims);
+  // The shuffle filter only helps when it runs before the deflate filter
+  if(err >= 0 && options.shuffle)
+  {
+    err = H5Pset_shuffle(dcpl);
+  }
+  if(err >= 0 && options.deflateLevel > 0)
+  {
+    err = H5Pset_deflate(dcpl, static_cast<unsigned>(std::min(options.deflateLevel, 9)));
+  }
+  if(err < 0)
+  {
+    H5Pclose(dcpl);
+    return -1;
+  }
+  return dcpl;
+}
+
+// -----------------------------------------------------------------------------
+hid_t H5EbsdChunkedIO::CreateAccessProperties(size_t chunkCacheSize)
+{
+  if(chunkCacheSize == 0)
+  {
+    return H5P_DEFAULT;
+  }
+  hid_t dapl = H5Pcreate(H5P_DATASET_ACCESS);
+  if(dapl < 0)
+  {
+    return H5P_DEFAULT;
+  }
+  if(H5Pset_chunk_cache(dapl, H5D_CHUNK_CACHE_NSLOTS_DEFAULT, chunkCacheSize, H5D_CHUNK_CACHE_W0_DEFAULT) < 0)
+  {
+    H5Pclose(dapl);
+    return H5P_DEFAULT;
+  }
+  return dapl;
+}
+
+// -----------------------------------------------------------------------------
+void H5EbsdChunkedIO::CloseProperties(hid_t plist)
+{
+  if(plist >= 0 && plist != H5P_DEFAULT)
+  {
+    H5Pclose(plist);
+  }
+}
@@ -0,0 +1,337 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <hdf5.h>
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "H5Support/H5Lite.h"
+
+#include "EbsdLib/Core/EbsdDataArray.hpp"
+#include "EbsdLib/EbsdLib.h"
+#include "EbsdLib/IO/EbsdImporter.h"
+
+/**
+ * @brief The H5EbsdChunkedIO namespace writes the per slice data arrays of an h5ebsd file with an optional
+ * chunked and compressed layout and reads back a range of scan rows with a hyperslab, so that a region of
+ * interest does not require reading the whole slice. The arrays stay 1D (columns * rows) as required by
+ * the h5ebsd specification, so chunks are always strips of whole scan rows.
+ *
+ * Contiguous datasets can instead be memory mapped as the storage of an EbsdDataArray (MapDataset()) so that
+ * results larger than the physical memory are computed in place and reopened without reading them.
+ */
+namespace H5EbsdChunkedIO
+{
+/**
+ * @brief Returns the native HDF5 type of T
+ */
+template <typename T>
+hid_t NativeType()
+{
+  if constexpr(std::is_same_v<T, float>)
+  {
+    return H5T_NATIVE_FLOAT;
+  }
+  else if constexpr(std::is_same_v<T, double>)
+  {
+    return H5T_NATIVE_DOUBLE;
+  }
+  else if constexpr(std::is_same_v<T, int32_t>)
+  {
+    return H5T_NATIVE_INT32;
+  }
+  else if constexpr(std::is_same_v<T, uint32_t>)
+  {
+    return H5T_NATIVE_UINT32;
+  }
+  else if constexpr(std::is_same_v<T, int16_t>)
+  {
+    return H5T_NATIVE_INT16;
+  }
+  else if constexpr(std::is_same_v<T, uint16_t>)
+  {
+    return H5T_NATIVE_UINT16;
+  }
+  else if constexpr(std::is_same_v<T, int8_t>)
+  {
+    return H5T_NATIVE_INT8;
+  }
+  else
+  {
+    static_assert(std::is_same_v<T, uint8_t>, "H5EbsdChunkedIO: Unsupported primitive type");
+    return H5T_NATIVE_UINT8;
+  }
+}
+
+/**
+ * @brief Creates the dataset creation property list of a chunked slice array. The chunk holds
+ * options.chunkRows scan rows (clamped to the number of rows) and the shuffle and deflate filters are added
+ * when requested.
+ * @return A property list that the caller must close with H5Pclose, or a negative value on error
+ */
+EbsdLib_EXPORT hid_t CreateDatasetProperties(const H5EbsdStorageOptions& options, hsize_t numColumns, hsize_t numRows);
+
+/**
+ * @brief Creates a dataset access property list with a chunk cache of the given size.
+ * @return H5P_DEFAULT when chunkCacheSize is 0, otherwise a property list that the caller must close with H5Pclose
+ */
+EbsdLib_EXPORT hid_t CreateAccessProperties(size_t chunkCacheSize);
+
+/**
+ * @brief Closes a property list created by CreateDatasetProperties() or CreateAccessProperties()
+ */
+EbsdLib_EXPORT void CloseProperties(hid_t plist);
+
+/**
+ * @brief WriteDataset Writes one slice data array. Contiguous layouts are written with H5Lite exactly as before.
+ * @param gid The 'Data' group of the slice
+ * @param name The dataset name
+ * @param numColumns Number of scan columns
+ * @param numRows Number of scan rows
+ * @param data numColumns * numRows values
+ * @param options The storage layout
+ * @return Negative on error
+ */
+template <typename T>
+herr_t WriteDataset(hid_t gid, const std::string& name, hsize_t numColumns, hsize_t numRows, const T* data, const H5EbsdStorageOptions& options)
+{
+  hsize_t dims[1] = {numColumns * numRows};
+  if(options.chunkRows == 0 || dims[0] == 0)
+  {
+    return H5Support::H5Lite::writePointerDataset(gid, name, 1, dims, data);
+  }
+
+  hid_t dcpl = CreateDatasetProperties(options, numColumns, numRows);
+  if(dcpl < 0)
+  {
+    return -1;
+  }
+  hid_t dapl = CreateAccessProperties(options.chunkCacheSize);
+  herr_t err = -1;
+  hid_t dataspace = H5Screate_simple(1, dims, nullptr);
+  if(dataspace >= 0)
+  {
+    hid_t dataset = H5Dcreate2(gid, name.c_str(), NativeType<T>(), dataspace, H5P_DEFAULT, dcpl, dapl);
+    if(dataset >= 0)
+    {
+      err = H5Dwrite(dataset, NativeType<T>(), H5S_ALL, H5S_ALL, H5P_DEFAULT, data);
+      H5Dclose(dataset);
+    }
+    H5Sclose(dataspace);
+  }
+  CloseProperties(dapl);
+  CloseProperties(dcpl);
+  return err;
+}
+
+/**
+ * @brief ReadRows Reads the scan rows [rowStart, rowStart + rowCount) of a slice data array with a hyperslab.
+ * Only the chunks that overlap the rows are read and decompressed. The first dimension of the dataset indexes
+ * the scan points; any further dimensions (such as the height and width of pattern data) are read whole.
+ * @param gid The 'Data' group of the slice
+ * @param name The dataset name
+ * @param numColumns Number of scan columns
+ * @param rowStart First row to read
+ * @param rowCount Number of rows to read
+ * @param chunkCacheSize Bytes of chunk cache to use, 0 keeps the HDF5 default
+ * @param data [output] numColumns * rowCount points, each holding the product of the trailing dimensions values
+ * @return Negative on error, including when the rows are outside of the dataset
+ */
+template <typename T>
+herr_t ReadRows(hid_t gid, const std::string& name, hsize_t numColumns, hsize_t rowStart, hsize_t rowCount, size_t chunkCacheSize, T* data)
+{
+  hid_t dapl = CreateAccessProperties(chunkCacheSize);
+  hid_t dataset = H5Dopen2(gid, name.c_str(), dapl);
+  CloseProperties(dapl);
+  if(dataset < 0)
+  {
+    return -1;
+  }
+  herr_t err = -1;
+  hid_t filespace = H5Dget_space(dataset);
+  if(filespace >= 0)
+  {
+    int rank = H5Sget_simple_extent_ndims(filespace);
+    std::vector<hsize_t> dims(static_cast<size_t>(std::max(rank, 1)), 0);
+    if(rank >= 1 && H5Sget_simple_extent_dims(filespace, dims.data(), nullptr) >= 0 && (rowStart + rowCount) * numColumns <= dims[0])
+    {
+      std::vector<hsize_t> offset(dims.size(), 0);
+      std::vector<hsize_t> count = dims;
+      offset[0] = rowStart * numColumns;
+      count[0] = rowCount * numColumns;
+      err = H5Sselect_hyperslab(filespace, H5S_SELECT_SET, offset.data(), nullptr, count.data(), nullptr);
+      hid_t memspace = H5Screate_simple(rank, count.data(), nullptr);
+      if(err >= 0 && memspace >= 0)
+      {
+        err = H5Dread(dataset, NativeType<T>(), memspace, filespace, H5P_DEFAULT, data);
+      }
+      if(memspace >= 0)
+      {
+        H5Sclose(memspace);
+      }
+    }
+    H5Sclose(filespace);
+  }
+  H5Dclose(dataset);
+  return err;
+}
+
+/**
+ * @brief GetContiguousRegion Finds where the values of a dataset are stored in the HDF5 file. Only datasets with a
+ * contiguous (and therefore uncompressed) layout whose storage is allocated and whose file type is the native type
+ * of T qualify, because only those can be memory mapped directly.
+ * @param gid The group that holds the dataset
+ * @param name The dataset name
+ * @param fileOffset [output] Byte offset of the first value in the file
+ * @param numValues [output] Number of values in the dataset
+ * @return Negative if the dataset can not be mapped
+ */
+template <typename T>
+herr_t GetContiguousRegion(hid_t gid, const std::string& name, size_t& fileOffset, size_t& numValues)
+{
+  hid_t dataset = H5Dopen2(gid, name.c_str(), H5P_DEFAULT);
+  if(dataset < 0)
+  {
+    return -1;
+  }
+  herr_t err = -1;
+  hid_t dcpl = H5Dget_create_plist(dataset);
+  hid_t fileType = H5Dget_type(dataset);
+  hid_t filespace = H5Dget_space(dataset);
+  haddr_t address = H5Dget_offset(dataset);
+  if(dcpl >= 0 && fileType >= 0 && filespace >= 0 && address != HADDR_UNDEF && H5Pget_layout(dcpl) == H5D_CONTIGUOUS && H5Tequal(fileType, NativeType<T>()) > 0)
+  {
+    hssize_t numPoints = H5Sget_simple_extent_npoints(filespace);
+    if(numPoints > 0)
+    {
+      fileOffset = static_cast<size_t>(address);
+      numValues = static_cast<size_t>(numPoints);
+      err = 0;
+    }
+  }
+  if(filespace >= 0)
+  {
+    H5Sclose(filespace);
+  }
+  if(fileType >= 0)
+  {
+    H5Tclose(fileType);
+  }
+  CloseProperties(dcpl);
+  H5Dclose(dataset);
+  return err;
+}
+
+/**
+ * @brief CreateContiguousDataset Creates a 1D contiguous dataset whose storage is allocated in the file right away
+ * so that it can be memory mapped with MapDataset() and filled in place. HDF5 does not write any values.
+ * @param gid The group that will hold the dataset
+ * @param name The dataset name
+ * @param numValues Number of values in the dataset
+ * @return Negative on error
+ */
+template <typename T>
+herr_t CreateContiguousDataset(hid_t gid, const std::string& name, hsize_t numValues)
+{
+  hid_t dcpl = H5Pcreate(H5P_DATASET_CREATE);
+  if(dcpl < 0)
+  {
+    return -1;
+  }
+  herr_t err = H5Pset_layout(dcpl, H5D_CONTIGUOUS);
+  if(err >= 0)
+  {
+    err = H5Pset_alloc_time(dcpl, H5D_ALLOC_TIME_EARLY);
+  }
+  if(err >= 0)
+  {
+    err = H5Pset_fill_time(dcpl, H5D_FILL_TIME_NEVER);
+  }
+  hsize_t dims[1] = {numValues};
+  hid_t dataspace = (err >= 0) ? H5Screate_simple(1, dims, nullptr) : -1;
+  err = -1;
+  if(dataspace >= 0)
+  {
+    hid_t dataset = H5Dcreate2(gid, name.c_str(), NativeType<T>(), dataspace, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+    if(dataset >= 0)
+    {
+      err = 0;
+      H5Dclose(dataset);
+    }
+    H5Sclose(dataspace);
+  }
+  H5Pclose(dcpl);
+  return err;
+}
+
+/**
+ * @brief MapDataset Maps a contiguous dataset of an HDF5 file as the storage of an EbsdDataArray. The file is only
+ * opened to locate the dataset; the values are paged in by the operating system when they are accessed. A writable
+ * array changes the file directly so the file must not be open for writing through HDF5 at the same time.
+ * @param filePath The HDF5 file
+ * @param datasetPath Path of the dataset inside the file
+ * @param compDims The component dimensions of the array
+ * @param writable If true changes are written back to the file, otherwise they are only kept in memory
+ * @return The array or a null pointer if the dataset could not be mapped
+ */
+template <typename T>
+typename EbsdDataArray<T>::Pointer MapDataset(const std::string& filePath, const std::string& datasetPath, const std::vector<size_t>& compDims, bool writable)
+{
+  hid_t fileId = H5Fopen(filePath.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+  if(fileId < 0)
+  {
+    return EbsdDataArray<T>::NullPointer();
+  }
+  size_t fileOffset = 0;
+  size_t numValues = 0;
+  herr_t err = GetContiguousRegion<T>(fileId, datasetPath, fileOffset, numValues);
+  H5Fclose(fileId);
+
+  size_t numComponents = std::accumulate(compDims.cbegin(), compDims.cend(), static_cast<size_t>(1), std::multiplies<>());
+  if(err < 0 || numComponents == 0 || numValues % numComponents != 0)
+  {
+    return EbsdDataArray<T>::NullPointer();
+  }
+  std::string name = datasetPath.substr(datasetPath.find_last_of('/') + 1);
+  return EbsdDataArray<T>::MapFile(filePath, fileOffset, numValues / numComponents, compDims, name, writable);
+}
+} // namespace H5EbsdChunkedIO
@@ -0,0 +1,191 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "EbsdLib/EbsdLib.h"
+
+#ifdef EbsdLib_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#endif
+
+/**
+ * @brief The H5EbsdSliceCopier class scatters the arrays of a single 2D slice into
+ * their z plane of a 3D volume. A slice that is smaller than the volume is centered
+ * in X and Y, a slice that is larger is cropped around its center. Each array is
+ * registered once per slice so the copy itself carries no per element checks. Rows
+ * are copied with std::copy and when the slice spans the full X dimension a block of
+ * rows is one contiguous copy straight into the slice offset of the volume.
+ */
+class H5EbsdSliceCopier
+{
+public:
+  /**
+   * @param xDim X dimension of the volume
+   * @param yDim Y dimension of the volume
+   * @param xSlice X dimension of the slice
+   * @param ySlice Y dimension of the slice
+   * @param zIndex The Z plane of the volume that receives the slice
+   */
+  H5EbsdSliceCopier(int64_t xDim, int64_t yDim, int64_t xSlice, int64_t ySlice, int64_t zIndex)
+  : m_XDim(xDim)
+  , m_XSlice(xSlice)
+  , m_NumColumns(std::min(xDim, xSlice))
+  , m_NumRows(std::min(yDim, ySlice))
+  , m_SrcXStart(std::max(xSlice - xDim, int64_t(0)) / 2)
+  , m_SrcYStart(std::max(ySlice - yDim, int64_t(0)) / 2)
+  , m_DstXStart(std::max(xDim - xSlice, int64_t(0)) / 2)
+  , m_DstYStart(std::max(yDim - ySlice, int64_t(0)) / 2)
+  , m_ZOffset(zIndex * xDim * yDim)
+  {
+  }
+  ~H5EbsdSliceCopier() = default;
+
+  /**
+   * @brief Registers an array to copy. Arrays where either the source or the
+   * destination is nullptr are skipped.
+   * @param src Slice array
+   * @param dst Volume array
+   */
+  template <typename T>
+  void addArray(const T* src, T* dst)
+  {
+    if(nullptr == src || nullptr == dst)
+    {
+      return;
+    }
+    m_Copies.push_back([this, src, dst](int64_t rowStart, int64_t rowEnd) {
+      if(m_XSlice == m_XDim)
+      {
+        std::copy(src + sourceIndex(rowStart), src + sourceIndex(rowEnd), dst + destinationIndex(rowStart));
+        return;
+      }
+      for(int64_t j = rowStart; j < rowEnd; j++)
+      {
+        std::copy(src + sourceIndex(j), src + sourceIndex(j) + m_NumColumns, dst + destinationIndex(j));
+      }
+    });
+  }
+
+  /**
+   * @brief Registers an array to copy where every value is raised to at least minValue.
+   * @param src Slice array
+   * @param dst Volume array
+   * @param minValue Smallest value written into the volume
+   */
+  template <typename T>
+  void addArrayWithMinimum(const T* src, T* dst, T minValue)
+  {
+    if(nullptr == src || nullptr == dst)
+    {
+      return;
+    }
+    m_Copies.push_back([this, src, dst, minValue](int64_t rowStart, int64_t rowEnd) {
+      auto clamp = [minValue](T value) { return std::max(value, minValue); };
+      for(int64_t j = rowStart; j < rowEnd; j++)
+      {
+        std::transform(src + sourceIndex(j), src + sourceIndex(j) + m_NumColumns, dst + destinationIndex(j), clamp);
+      }
+    });
+  }
+
+  /**
+   * @brief Copies the rows [start, end) of every registered array. Rows are counted
+   * from the first row of the slice that lies inside the volume.
+   */
+  void generate(size_t start, size_t end) const
+  {
+    for(const auto& copyRows : m_Copies)
+    {
+      copyRows(static_cast<int64_t>(start), static_cast<int64_t>(end));
+    }
+  }
+
+  /**
+   * @brief Copies every registered array into the volume.
+   */
+  void copy() const
+  {
+    if(m_NumRows <= 0 || m_NumColumns <= 0)
+    {
+      return;
+    }
+#ifdef EbsdLib_USE_PARALLEL_ALGORITHMS
+    bool doParallel = true;
+    if(doParallel)
+    {
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, static_cast<size_t>(m_NumRows)), [this](const tbb::blocked_range<size_t>& r) { generate(r.begin(), r.end()); },
+                      tbb::auto_partitioner());
+      return;
+    }
+#endif
+    generate(0, static_cast<size_t>(m_NumRows));
+  }
+
+private:
+  int64_t m_XDim = 0;
+  int64_t m_XSlice = 0;
+  int64_t m_NumColumns = 0;
+  int64_t m_NumRows = 0;
+  int64_t m_SrcXStart = 0;
+  int64_t m_SrcYStart = 0;
+  int64_t m_DstXStart = 0;
+  int64_t m_DstYStart = 0;
+  int64_t m_ZOffset = 0;
+  std::vector<std::function<void(int64_t, int64_t)>> m_Copies;
+
+  int64_t sourceIndex(int64_t row) const
+  {
+    return (row + m_SrcYStart) * m_XSlice + m_SrcXStart;
+  }
+
+  int64_t destinationIndex(int64_t row) const
+  {
+    return m_ZOffset + (row + m_DstYStart) * m_XDim + m_DstXStart;
+  }
+
+public:
+  H5EbsdSliceCopier(const H5EbsdSliceCopier&) = delete;            // Copy Constructor Not Implemented
+  H5EbsdSliceCopier(H5EbsdSliceCopier&&) = delete;                 // Move Constructor Not Implemented
+  H5EbsdSliceCopier& operator=(const H5EbsdSliceCopier&) = delete; // Copy Assignment Not Implemented
+  H5EbsdSliceCopier& operator=(H5EbsdSliceCopier&&) = delete;      // Move Assignment Not Implemented
+};
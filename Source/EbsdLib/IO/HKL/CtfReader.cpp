@@ -36,14 +36,17 @@
 #include "CtfReader.h"
 
 #include <algorithm>
+#include <array>
 #include <fstream>
 #include <iostream>
 #include <sstream>
 
 #include "CtfPhase.h"
 #include "EbsdLib/Core/EbsdMacros.h"
+#include "EbsdLib/IO/DataSectionChunks.h"
 #include "EbsdLib/Math/EbsdLibMath.h"
 #include "EbsdLib/Utilities/EbsdStringUtils.hpp"
+#include "EbsdLib/Utilities/MemoryMappedFile.h"
 
 //#define PI_OVER_2f       90.0f
 //#define THREE_PI_OVER_2f 270.0f
@@ -121,6 +124,9 @@ CtfReader::CtfReader()
   setXCells(0);
   setYCells(0);
   setZCells(1);
+
+  m_UseMemoryMapping = false;
+  m_UseParallelParsing = false;
 }
 
 // -----------------------------------------------------------------------------
@@ -429,13 +435,29 @@ int CtfReader::readFile()
     setErrorMessage(msg);
     return -100;
   }
+  err = readHeaderSection(in);
+  if(err < 0)
+  {
+    return err;
+  }
+
+  err = readData(in);
+
+  return err;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int CtfReader::readHeaderSection(std::ifstream& in)
+{
   std::string origHeader;
   setOriginalHeader(origHeader);
   m_PhaseVector.clear();
 
   // Parse the header
   std::vector<std::string> headerLines;
-  err = getHeaderLines(in, headerLines);
+  int err = getHeaderLines(in, headerLines);
   if(err < 0)
   {
     return err;
@@ -457,10 +479,102 @@ int CtfReader::readFile()
     setErrorMessage("Either the X Cells or Y Cells was Zero (0) which is NOT allowed. Please update the CTF file header with appropriate values.");
     return -103;
   }
+  return 0;
+}
 
-  err = readData(in);
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int CtfReader::readFileInRowWindows(size_t rowsPerWindow, const RowWindowCallback& callback)
+{
+  setErrorCode(0);
+  setErrorMessage("");
+  std::ifstream in(getFileName(), std::ios_base::in);
+  setHeaderIsComplete(false);
+  if(!in.is_open())
+  {
+    std::string msg = std::string("Ctf file could not be opened: ") + getFileName();
+    setErrorCode(-100);
+    setErrorMessage(msg);
+    return -100;
+  }
+  m_NamePointerMap.clear();
 
-  return err;
+  int err = readHeaderSection(in);
+  if(err < 0)
+  {
+    return err;
+  }
+
+  int32_t xCells = getXCells();
+  int32_t yCells = getYCells();
+  if(xCells < 0 || yCells < 0)
+  {
+    setErrorCode(-110);
+    std::stringstream ss;
+    ss << "The number of X Cells (" << xCells << ") or Y Cells (" << yCells << ") was reported as a negative value. These values must be larger than ZERO.\n";
+    setErrorMessage(ss.str());
+    return -110;
+  }
+  int32_t zCells = getZCells();
+  size_t numSlices = (zCells < 0 || m_SingleSliceRead >= 0) ? 1 : static_cast<size_t>(zCells);
+  size_t pointsPerRow = static_cast<size_t>(xCells);
+  size_t numRows = static_cast<size_t>(yCells) * numSlices;
+  setNumberOfElements(pointsPerRow * numRows);
+
+  // The data arrays only ever hold a single window
+  rowsPerWindow = std::max(rowsPerWindow, static_cast<size_t>(1));
+  err = readColumnHeader(in, rowsPerWindow * pointsPerRow);
+  if(err < 0)
+  {
+    return err;
+  }
+
+  // When only a single slice is read all the lines of the slices before it are skipped
+  size_t skippedLines = 0;
+  if(m_SingleSliceRead >= 0)
+  {
+    std::string buf;
+    size_t linesToSkip = static_cast<size_t>(m_SingleSliceRead) * pointsPerRow * static_cast<size_t>(yCells);
+    while(skippedLines < linesToSkip && std::getline(in, buf))
+    {
+      ++skippedLines;
+    }
+  }
+
+  std::string block;
+  RowWindow window;
+  while(window.firstRow < numRows)
+  {
+    window.numRows = std::min(rowsPerWindow, numRows - window.firstRow);
+    window.numElements = window.numRows * pointsPerRow;
+
+    block.clear();
+    size_t numLines = DataSectionChunks::ReadLines(in, window.numElements, block);
+    size_t numParsed = 0;
+    err = parseDataSection(block.data(), block.data() + block.size(), 0, window.numElements, skippedLines + window.firstElement, pointsPerRow, static_cast<size_t>(yCells), numParsed);
+    if(err < 0)
+    {
+      return err;
+    }
+    if(numLines != window.numElements || numParsed != window.numElements)
+    {
+      size_t counter = window.firstElement + numParsed;
+      std::stringstream ss;
+      ss << "Premature End Of File reached.\n" << getFileName() << "\nNumRows=" << getNumberOfElements() << "\ncounter=" << counter << "\nTotal Data Points Read=" << counter << "\n";
+      setErrorMessage(ss.str());
+      setErrorCode(-105);
+      return -105;
+    }
+
+    if(!callback(window))
+    {
+      break;
+    }
+    window.firstRow += window.numRows;
+    window.firstElement += window.numElements;
+  }
+  return 0;
 }
 
 // -----------------------------------------------------------------------------
@@ -511,9 +625,82 @@ int CtfReader::readData(std::ifstream& in)
 
   setNumberOfElements(totalScanPoints);
 
+  // Read the column Headers and allocate the necessary arrays
+  int err = readColumnHeader(in, totalScanPoints);
+  if(err < 0)
+  {
+    return err;
+  }
+
+  if(m_UseMemoryMapping || m_UseParallelParsing)
+  {
+    std::streampos dataOffset = in.tellg();
+    MemoryMappedFile mappedFile;
+    if(dataOffset >= 0 && mappedFile.open(getFileName()))
+    {
+      in.close();
+      return readMappedData(mappedFile, static_cast<size_t>(dataOffset), xCells, yCells);
+    }
+  }
+
+  // Now start reading the data line by line
   std::string buf;
+  size_t counter = 0;
+  for(int slice = zStart; slice < zEnd; ++slice)
+  {
+    for(size_t row = 0; row < yCells; ++row)
+    {
+      for(size_t col = 0; col < xCells; ++col)
+      {
+        std::getline(in, buf);               // Read the line into a std:::string including the newline
+        buf = EbsdStringUtils::trimmed(buf); // Remove leading and trailing whitespace
 
-  // Read the column Headers and allocate the necessary arrays
+        if((m_SingleSliceRead < 0) || (m_SingleSliceRead >= 0 && slice == m_SingleSliceRead))
+        {
+
+          if(in.eof() && buf.empty()) // We have to have read to the end of the file AND the buffer is empty
+                                      // otherwise we read EXACTLY the last line and we still need to parse the line.
+          {
+            //  ++counter; // We need to make sure this gets incremented before leaving
+            break;
+          }
+          err = parseDataLine(buf, row, col, counter, xCells, yCells);
+          if(err < 0)
+          {
+            return err;
+          }
+          ++counter;
+        }
+      }
+      if(in.eof())
+      {
+        break;
+      }
+    }
+    //   std::cout << ".ctf Z Slice " << slice << " Reading complete." << std::endl;
+    if(m_SingleSliceRead >= 0 && slice == m_SingleSliceRead)
+    {
+      break;
+    }
+  }
+
+  if(counter != getNumberOfElements() && in.eof())
+  {
+    std::stringstream ss;
+    ss << "Premature End Of File reached.\n" << getFileName() << "\nNumRows=" << getNumberOfElements() << "\ncounter=" << counter << "\nTotal Data Points Read=" << counter << "\n";
+    setErrorMessage(ss.str());
+    setErrorCode(-105);
+    return -105;
+  }
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int CtfReader::readColumnHeader(std::ifstream& in, size_t numPoints)
+{
+  std::string buf;
   std::getline(in, buf);
   std::string originalHeader = getOriginalHeader();
   originalHeader = originalHeader + buf;
@@ -539,23 +726,23 @@ int CtfReader::readData(std::ifstream& in)
     }
     if(EbsdLib::NumericTypes::Type::Int32 == pType)
     {
-      Int32Parser::Pointer dparser = Int32Parser::New(nullptr, totalScanPoints, name, i);
-      didAllocate = dparser->allocateArray(totalScanPoints);
+      Int32Parser::Pointer dparser = Int32Parser::New(nullptr, numPoints, name, i);
+      dparser->setAllocator(getAllocator());
+      didAllocate = dparser->allocateArray(numPoints);
       // Q_ASSERT_X(dparser->getVoidPointer() != nullptr, __FILE__, "Could not allocate memory for Integer data in CTF File.");
       if(didAllocate)
       {
-        ::memset(dparser->getVoidPointer(), 0xAB, sizeof(int32_t) * totalScanPoints);
         m_NamePointerMap[name] = dparser;
       }
     }
     else if(EbsdLib::NumericTypes::Type::Float == pType)
     {
-      FloatParser::Pointer dparser = FloatParser::New(nullptr, totalScanPoints, name, i);
-      didAllocate = dparser->allocateArray(totalScanPoints);
+      FloatParser::Pointer dparser = FloatParser::New(nullptr, numPoints, name, i);
+      dparser->setAllocator(getAllocator());
+      didAllocate = dparser->allocateArray(numPoints);
       // Q_ASSERT_X(dparser->getVoidPointer() != nullptr, __FILE__, "Could not allocate memory for Integer data in CTF File.");
       if(didAllocate)
       {
-        ::memset(dparser->getVoidPointer(), 0xAB, sizeof(float) * totalScanPoints);
         m_NamePointerMap[name] = dparser;
       }
     }
@@ -575,57 +762,59 @@ int CtfReader::readData(std::ifstream& in)
       ss << "\n X Cells: " << getXCells();
       ss << "\n Y Cells: " << getYCells();
       ss << "\n Z Cells: " << getZCells();
-      ss << "\n Total Scan Points: " << totalScanPoints;
+      ss << "\n Total Scan Points: " << numPoints;
       setErrorMessage(ss.str());
       return -106; // Could not allocate the memory
     }
   }
+  return 0;
+}
 
-  // Now start reading the data line by line
-  int err = 0;
-  size_t counter = 0;
-  for(int slice = zStart; slice < zEnd; ++slice)
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void CtfReader::setColumnCountError(size_t numTokens, size_t row)
+{
+  setErrorCode(-107);
+  std::stringstream ss;
+  ss << "The number of tab delimited data columns (" << numTokens << ") does not match the number of tab delimited header columns (";
+  ss << m_NamePointerMap.size() << "). Please check the CTF file for mistakes, specifically the header line that labels each column of data.";
+  ss << "The error occurred at data row " << row << " which is " << row << " past ";
+  ss << "the column header row.";
+  ss << "\nThe CTF Reader will now abort reading any further in the file.";
+
+  setErrorMessage(ss.str());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int CtfReader::readMappedData(const MemoryMappedFile& mappedFile, size_t dataOffset, size_t xCells, size_t yCells)
+{
+  if(dataOffset > mappedFile.size())
   {
-    for(size_t row = 0; row < yCells; ++row)
-    {
-      for(size_t col = 0; col < xCells; ++col)
-      {
-        std::getline(in, buf);               // Read the line into a std:::string including the newline
-        buf = EbsdStringUtils::trimmed(buf); // Remove leading and trailing whitespace
+    dataOffset = mappedFile.size();
+  }
+  const char* dataFirst = mappedFile.data() + dataOffset;
+  const char* dataLast = mappedFile.data() + mappedFile.size();
 
-        if((m_SingleSliceRead < 0) || (m_SingleSliceRead >= 0 && slice == m_SingleSliceRead))
-        {
+  // When only a single slice is read all the lines of the slices before it are skipped
+  size_t pointsPerSlice = xCells * yCells;
+  size_t firstRow = (m_SingleSliceRead >= 0) ? static_cast<size_t>(m_SingleSliceRead) * pointsPerSlice : 0;
+  size_t numElements = getNumberOfElements();
 
-          if(in.eof() && buf.empty()) // We have to have read to the end of the file AND the buffer is empty
-                                      // otherwise we read EXACTLY the last line and we still need to parse the line.
-          {
-            //  ++counter; // We need to make sure this gets incremented before leaving
-            break;
-          }
-          err = parseDataLine(buf, row, col, counter, xCells, yCells);
-          if(err < 0)
-          {
-            return err;
-          }
-          ++counter;
-        }
-      }
-      if(in.eof())
-      {
-        break;
-      }
-    }
-    //   std::cout << ".ctf Z Slice " << slice << " Reading complete." << std::endl;
-    if(m_SingleSliceRead >= 0 && slice == m_SingleSliceRead)
-    {
-      break;
-    }
+  size_t numRows = 0;
+  int err = parseDataSection(dataFirst, dataLast, firstRow, numElements, 0, xCells, yCells, numRows);
+  if(err < 0)
+  {
+    return err;
   }
 
-  if(counter != getNumberOfElements() && in.eof())
+  size_t counter = (numRows > firstRow) ? numRows - firstRow : 0;
+  if(counter != numElements)
   {
     std::stringstream ss;
-    ss << "Premature End Of File reached.\n" << getFileName() << "\nNumRows=" << getNumberOfElements() << "\ncounter=" << counter << "\nTotal Data Points Read=" << counter << "\n";
+    ss << "Premature End Of File reached.\n" << getFileName() << "\nNumRows=" << numElements << "\ncounter=" << counter << "\nTotal Data Points Read=" << counter << "\n";
     setErrorMessage(ss.str());
     setErrorCode(-105);
     return -105;
@@ -633,6 +822,73 @@ int CtfReader::readData(std::ifstream& in)
   return 0;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int CtfReader::parseDataSection(const char* first, const char* last, size_t firstRow, size_t numPoints, size_t rowOffset, size_t xCells, size_t yCells, size_t& numRows)
+{
+  // The parsers are looked up by the column index of each token
+  std::vector<DataParser*> parsers(m_NamePointerMap.size(), nullptr);
+  for(const auto& iter : m_NamePointerMap)
+  {
+    parsers.at(iter.second->getColumnIndex()) = iter.second.get();
+  }
+
+  bool parallel = m_UseParallelParsing;
+  std::vector<DataSectionChunks::Chunk> chunks = DataSectionChunks::Split(first, last, firstRow + numPoints, parallel);
+  numRows = DataSectionChunks::TotalRows(chunks);
+
+  struct ChunkError
+  {
+    int errorCode = 0;
+    size_t errorColumn = 0;
+    size_t row = 0;
+  };
+  std::vector<ChunkError> chunkErrors(chunks.size());
+
+  DataSectionChunks::ForEach(chunks, parallel, [this, firstRow, &parsers, &chunkErrors](size_t chunkIndex, const DataSectionChunks::Chunk& chunk) {
+    const char* lineFirst = chunk.first;
+    for(size_t i = 0; i < chunk.numRows; ++i)
+    {
+      const char* lineLast = DataSectionChunks::FindLineEnd(lineFirst, chunk.last);
+      size_t row = chunk.firstRow + i;
+      if(row >= firstRow)
+      {
+        size_t errorColumn = 0;
+        int err = parseDataLine(lineFirst, lineLast, row - firstRow, parsers, errorColumn);
+        if(err < 0)
+        {
+          chunkErrors[chunkIndex] = {err, errorColumn, row};
+          return;
+        }
+      }
+      lineFirst = (lineLast == chunk.last) ? chunk.last : lineLast + 1;
+    }
+  });
+
+  // The chunks are in file order so the first chunk with an error holds the first bad line
+  auto firstError = std::find_if(chunkErrors.begin(), chunkErrors.end(), [](const ChunkError& chunkError) { return chunkError.errorCode < 0; });
+  if(firstError != chunkErrors.end())
+  {
+    size_t row = ((rowOffset + firstError->row) / xCells) % yCells;
+    if(firstError->errorCode == -109)
+    {
+      setColumnCountError(firstError->errorColumn, row);
+    }
+    else
+    {
+      setErrorCode(firstError->errorCode);
+      std::stringstream ss;
+      ss << "The value in data column " << firstError->errorColumn << " (Zero Based) could not be converted to a number. The error occurred at data row " << row << " which is " << row
+         << " past the column header row.";
+      ss << "\nThe CTF Reader will now abort reading any further in the file.";
+      setErrorMessage(ss.str());
+    }
+    return firstError->errorCode;
+  }
+  return 0;
+}
+
 #if 0
 #define PRINT_HTML_TABLE_ROW(p)                                                                                                                                                                        \
   std::cout << "<tr>\n    <td>" << p->getKey() << "</td>\n    <td>" << p->getHDFType() << "</td>\n";                                                                                                   \
@@ -782,15 +1038,7 @@ int CtfReader::parseDataLine(std::string& line, size_t row, size_t col, size_t o
   EbsdStringUtils::StringTokenType tokens = EbsdStringUtils::split(line, '\t');
   if(tokens.size() != m_NamePointerMap.size())
   {
-    setErrorCode(-107);
-    std::stringstream ss;
-    ss << "The number of tab delimited data columns (" << tokens.size() << ") does not match the number of tab delimited header columns (";
-    ss << m_NamePointerMap.size() << "). Please check the CTF file for mistakes, specifically the header line that labels each column of data.";
-    ss << "The error occurred at data row " << row << " which is " << row << " past ";
-    ss << "the column header row.";
-    ss << "\nThe CTF Reader will now abort reading any further in the file.";
-
-    setErrorMessage(ss.str());
+    setColumnCountError(tokens.size(), row);
     return -109;
   }
 
@@ -802,6 +1050,70 @@ int CtfReader::parseDataLine(std::string& line, size_t row, size_t col, size_t o
   return 0;
 }
 
+// -----------------------------------------------------------------------------
+//  Read the data part of the .ctf file directly from the file buffer
+// -----------------------------------------------------------------------------
+int CtfReader::parseDataLine(const char* first, const char* last, size_t offset, const std::vector<DataParser*>& parsers, size_t& errorColumn) const
+{
+  // Remove leading and trailing whitespace
+  while(first != last && EbsdStringUtils::isBlank(*first))
+  {
+    ++first;
+  }
+  while(last != first && EbsdStringUtils::isBlank(*(last - 1)))
+  {
+    --last;
+  }
+
+  // Find the tab delimited tokens. Consecutive tabs do not produce empty tokens.
+  constexpr size_t k_MaxTokens = 32;
+  std::array<std::pair<const char*, const char*>, k_MaxTokens> tokens;
+  size_t numTokens = 0;
+  while(first != last)
+  {
+    const char* tokenEnd = std::find(first, last, '\t');
+    if(tokenEnd != first)
+    {
+      if(numTokens < k_MaxTokens)
+      {
+        tokens[numTokens] = {first, tokenEnd};
+      }
+      ++numTokens;
+    }
+    first = (tokenEnd == last) ? last : tokenEnd + 1;
+  }
+  if(numTokens != parsers.size())
+  {
+    errorColumn = numTokens;
+    return -109;
+  }
+
+  std::array<char, 64> buffer = {};
+  for(size_t column = 0; column < numTokens; ++column)
+  {
+    const char* tokenFirst = tokens[column].first;
+    const char* tokenLast = tokens[column].second;
+    while(tokenFirst != tokenLast && EbsdStringUtils::isBlank(*tokenFirst))
+    {
+      ++tokenFirst;
+    }
+    // Convert European comma style decimals to US/UK style points
+    if(std::find(tokenFirst, tokenLast, ',') != tokenLast)
+    {
+      size_t length = std::min(static_cast<size_t>(tokenLast - tokenFirst), buffer.size());
+      std::replace_copy(tokenFirst, tokenFirst + length, buffer.begin(), ',', '.');
+      tokenFirst = buffer.data();
+      tokenLast = buffer.data() + length;
+    }
+    if(!parsers[column]->parse(tokenFirst, tokenLast, offset))
+    {
+      errorColumn = column;
+      return -112;
+    }
+  }
+  return 0;
+}
+
 #if 0
 // -----------------------------------------------------------------------------
 //
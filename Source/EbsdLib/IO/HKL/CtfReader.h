@@ -50,6 +50,8 @@
 #include "EbsdLib/EbsdLib.h"
 #include "EbsdLib/IO/EbsdReader.h"
 
+class MemoryMappedFile;
+
 #define CTF_READER_PTR_PROP(name, var, type)                                                                                                                                                           \
   type* get##name##Pointer()                                                                                                                                                                           \
   {                                                                                                                                                                                                    \
@@ -103,6 +105,20 @@ public:
   EBSDHEADER_INSTANCE_PROPERTY(CtfIntHeaderType, int, NumPhases, EbsdLib::Ctf::NumPhases)
   EBSD_INSTANCE_PROPERTY(std::vector<CtfPhase::Pointer>, PhaseVector)
 
+  /**
+   * @brief When true the data section of the file is memory mapped and the values are
+   * parsed in place instead of reading the file line by line through a std::ifstream.
+   * If the file can not be mapped the reader falls back to the std::ifstream code path.
+   */
+  EBSD_INSTANCE_PROPERTY(bool, UseMemoryMapping)
+
+  /**
+   * @brief When true the data section of the file is split into chunks at line boundaries and the
+   * chunks are parsed concurrently. This implies UseMemoryMapping. Without parallel algorithms
+   * compiled into EbsdLib the chunks are parsed serially.
+   */
+  EBSD_INSTANCE_PROPERTY(bool, UseParallelParsing)
+
   CTF_READER_PTR_PROP(Phase, Phase, int)
   CTF_READER_PTR_PROP(X, X, float)
   CTF_READER_PTR_PROP(Y, Y, float)
@@ -152,6 +168,16 @@ public:
    */
   int readHeaderOnly() override;
 
+  /**
+   * @brief Reads the HKL .ctf file one window of scan rows at a time. The data section is parsed incrementally
+   * (in parallel within each window if UseParallelParsing is set). The rows of all Z slices, or only of the slice
+   * set with readOnlySliceIndex(), are handed over in file order.
+   * @param rowsPerWindow Maximum number of scan rows in each window
+   * @param callback Called once per window
+   * @return 0 on success or a negative error code
+   */
+  int readFileInRowWindows(size_t rowsPerWindow, const RowWindowCallback& callback) override;
+
   void readOnlySliceIndex(int slice);
 
   int getXDimension() override;
@@ -195,12 +221,60 @@ private:
    */
   int parseHeaderLines(std::vector<std::string>& headerLines);
 
+  /**
+   * @brief Reads and parses the header section of the file up to, but not including, the column header line.
+   * @param in The input file stream to read from
+   * @return 0 on success or a negative error code
+   */
+  int readHeaderSection(std::ifstream& in);
+
+  /**
+   * @brief Reads the column header line and allocates a data parser for each column.
+   * @param in The input file stream to read from
+   * @param numPoints The number of values each data array needs to hold
+   * @return 0 on success or a negative error code
+   */
+  int readColumnHeader(std::ifstream& in, size_t numPoints);
+
   /**
    * @brief
    * @param in The input file stream to read from
    */
   int readData(std::ifstream& in);
 
+  /**
+   * @brief Reads the data section of a memory mapped .ctf file
+   * @param mappedFile The memory mapped .ctf file
+   * @param dataOffset The byte offset of the first line of data in the file
+   * @param xCells Number of X Data Points
+   * @param yCells Number of Y Data Points
+   * @return 0 on success or a negative error code
+   */
+  int readMappedData(const MemoryMappedFile& mappedFile, size_t dataOffset, size_t xCells, size_t yCells);
+
+  /**
+   * @brief Parses the lines in [first, last) into the data arrays, split into chunks that are parsed in parallel
+   * if UseParallelParsing is set. Sets the error code and message for the first line that can not be parsed.
+   * @param first The first character of the first line
+   * @param last One past the last character
+   * @param firstRow The number of lines to skip before the first line that is stored at index 0
+   * @param numPoints No more than this number of lines are parsed after the skipped lines
+   * @param rowOffset Number of data lines in the file before 'first', only used for the error message
+   * @param xCells Number of X Data Points
+   * @param yCells Number of Y Data Points
+   * @param numRows [output] The number of lines that were found, including the skipped lines
+   * @return 0 on success or a negative error code
+   */
+  int parseDataSection(const char* first, const char* last, size_t firstRow, size_t numPoints, size_t rowOffset, size_t xCells, size_t yCells, size_t& numRows);
+
+  /**
+   * @brief Sets the error code and message for a line that does not have the same number of
+   * columns as the column header line.
+   * @param numTokens The number of columns that were found on the line
+   * @param row Current Row of Data
+   */
+  void setColumnCountError(size_t numTokens, size_t row);
+
   /**
    * @brief Reads a line of Data from the ASCII based file
    * @param line The current line of data
@@ -212,6 +286,18 @@ private:
    */
   int parseDataLine(std::string& line, size_t row, size_t col, size_t i, size_t xCells, size_t yCells);
 
+  /**
+   * @brief Reads a line of Data directly from the file buffer
+   * @param first The first character of the line
+   * @param last One past the last character of the line, not including the newline
+   * @param offset The current index into a flat array
+   * @param parsers The data parsers ordered by their column index
+   * @param errorColumn Set to the number of columns found on the line for a column count error or to the
+   * zero based column that could not be parsed
+   * @return 0 on success, -109 if the number of columns is wrong or -112 if a value could not be parsed
+   */
+  int parseDataLine(const char* first, const char* last, size_t offset, const std::vector<DataParser*>& parsers, size_t& errorColumn) const;
+
 public:
   CtfReader(const CtfReader&) = delete;            // Copy Constructor Not Implemented
   CtfReader(CtfReader&&) = delete;                 // Move Constructor Not Implemented
@@ -37,8 +37,10 @@
 
 #include <string>
 
+#include "EbsdLib/Core/BufferAllocator.h"
 #include "EbsdLib/Core/EbsdMacros.h"
 #include "EbsdLib/Core/EbsdSetGetMacros.h"
+#include "EbsdLib/Utilities/EbsdStringUtils.hpp"
 
 class DataParser
 {
@@ -93,6 +95,8 @@ public:
   }
 
   EBSD_INSTANCE_PROPERTY(bool, ManageMemory)
+  /** @brief The allocator used by allocateArray() and to free the array. Null means new[]/delete[] */
+  EBSD_INSTANCE_PROPERTY(BufferAllocator::Pointer, Allocator)
   EBSD_INSTANCE_PROPERTY(size_t, Size)
   EBSD_INSTANCE_STRING_PROPERTY(ColumnName)
   EBSD_INSTANCE_PROPERTY(int, ColumnIndex)
@@ -101,6 +105,18 @@ public:
   {
   }
 
+  /**
+   * @brief Parses the value held in the character range [first, last) without allocating memory
+   * @param first The first character of the token
+   * @param last One past the last character of the token
+   * @param index The index into the array to store the value
+   * @return true if the value could be parsed
+   */
+  virtual bool parse(const char* /* first */, const char* /* last */, size_t /* index */)
+  {
+    return false;
+  }
+
 protected:
   DataParser()
   : m_ManageMemory(false)
@@ -162,7 +178,7 @@ public:
   {
     if(m_Ptr != nullptr && getManageMemory())
     {
-      delete[] m_Ptr;
+      BufferAllocator::Deallocate(getAllocator(), m_Ptr);
       m_Ptr = nullptr;
     }
   }
@@ -178,7 +194,7 @@ public:
 
   bool allocateArray(size_t numberOfElements) override
   {
-    m_Ptr = new(std::nothrow) uint8_t[numberOfElements]();
+    m_Ptr = BufferAllocator::Allocate<uint8_t>(getAllocator(), numberOfElements, true);
     return (m_Ptr != nullptr);
   }
 
@@ -202,6 +218,17 @@ public:
     m_Ptr[index] = std::stoi(token);
   }
 
+  bool parse(const char* first, const char* last, size_t index) override
+  {
+    int32_t value = 0;
+    if(!EbsdStringUtils::parseValue(first, last, value))
+    {
+      return false;
+    }
+    m_Ptr[index] = static_cast<uint8_t>(value);
+    return true;
+  }
+
 protected:
   UInt8Parser(uint8_t* ptr, size_t size, const std::string& name, int index)
   : m_Ptr(ptr)
@@ -268,7 +295,7 @@ public:
   {
     if(m_Ptr != nullptr && getManageMemory())
     {
-      delete[] m_Ptr;
+      BufferAllocator::Deallocate(getAllocator(), m_Ptr);
       m_Ptr = nullptr;
     }
   }
@@ -284,7 +311,7 @@ public:
 
   bool allocateArray(size_t numberOfElements) override
   {
-    m_Ptr = new(std::nothrow) int32_t[numberOfElements]();
+    m_Ptr = BufferAllocator::Allocate<int32_t>(getAllocator(), numberOfElements, true);
     return (m_Ptr != nullptr);
   }
 
@@ -308,6 +335,11 @@ public:
     m_Ptr[index] = std::stoi(token);
   }
 
+  bool parse(const char* first, const char* last, size_t index) override
+  {
+    return EbsdStringUtils::parseValue(first, last, m_Ptr[index]);
+  }
+
 protected:
   Int32Parser(int32_t* ptr, size_t size, const std::string& name, int index)
   : m_Ptr(ptr)
@@ -373,7 +405,7 @@ public:
   {
     if(m_Ptr != nullptr && getManageMemory())
     {
-      delete[] m_Ptr;
+      BufferAllocator::Deallocate(getAllocator(), m_Ptr);
       m_Ptr = nullptr;
     }
   }
@@ -389,7 +421,7 @@ public:
 
   bool allocateArray(size_t numberOfElements) override
   {
-    m_Ptr = new(std::nothrow) float[numberOfElements]();
+    m_Ptr = BufferAllocator::Allocate<float>(getAllocator(), numberOfElements, true);
     return (m_Ptr != nullptr);
   }
 
@@ -412,6 +444,11 @@ public:
     m_Ptr[index] = std::stof(token);
   }
 
+  bool parse(const char* first, const char* last, size_t index) override
+  {
+    return EbsdStringUtils::parseValue(first, last, m_Ptr[index]);
+  }
+
 protected:
   FloatParser(float* ptr, size_t size, const std::string& name, int index)
   : m_Ptr(ptr)
@@ -476,7 +513,7 @@ public:
   {
     if(m_Ptr != nullptr && getManageMemory())
     {
-      delete[] m_Ptr;
+      BufferAllocator::Deallocate(getAllocator(), m_Ptr);
       m_Ptr = nullptr;
     }
   }
@@ -492,7 +529,7 @@ public:
 
   bool allocateArray(size_t numberOfElements) override
   {
-    m_Ptr = new(std::nothrow) T[numberOfElements]();
+    m_Ptr = BufferAllocator::Allocate<T>(getAllocator(), numberOfElements, true);
     return (m_Ptr != nullptr);
   }
 
@@ -515,6 +552,17 @@ public:
     m_Ptr[index] = std::stof(token);
   }
 
+  bool parse(const char* first, const char* last, size_t index) override
+  {
+    float value = 0.0f;
+    if(!EbsdStringUtils::parseValue(first, last, value))
+    {
+      return false;
+    }
+    m_Ptr[index] = static_cast<T>(value);
+    return true;
+  }
+
 protected:
   NumericParser<T>(T* ptr, size_t size, const std::string& name, int index)
   : m_Ptr(ptr)
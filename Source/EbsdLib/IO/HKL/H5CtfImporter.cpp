@@ -42,6 +42,7 @@
 
 #include "EbsdLib/Core/EbsdLibConstants.h"
 #include "EbsdLib/EbsdLibVersion.h"
+#include "EbsdLib/IO/H5EbsdChunkedIO.h"
 #include "EbsdLib/Utilities/EbsdStringUtils.hpp"
 
 using namespace H5Support;
@@ -88,7 +89,7 @@ using namespace H5Support;
   {                                                                                                                                                                                                    \
     if(nullptr != dataPtr)                                                                                                                                                                             \
     {                                                                                                                                                                                                  \
-      err = H5Lite::writePointerDataset(gid, key, rank, dims, dataPtr);                                                                                                                                \
+      err = H5EbsdChunkedIO::WriteDataset(gid, key, numCols, numRows, dataPtr, getStorageOptions());                                                                                                  \
       if(err < 0)                                                                                                                                                                                      \
       {                                                                                                                                                                                                \
         std::stringstream ss;                                                                                                                                                                          \
@@ -329,8 +330,9 @@ int H5CtfImporter::writeSliceData(hid_t fileId, CtfReader& reader, int z, int ac
     return -1;
   }
 
-  int32_t rank = 1;
-  hsize_t dims[1] = {static_cast<hsize_t>(reader.getXCells() * reader.getYCells())};
+  hsize_t numCols = static_cast<hsize_t>(reader.getXCells());
+  hsize_t numRows = static_cast<hsize_t>(reader.getYCells());
+  hsize_t dims[1] = {numCols * numRows};
 
   EbsdLib::NumericTypes::Type numType = EbsdLib::NumericTypes::Type::UnknownNumType;
   std::vector<std::string> columnNames = reader.getColumnNames();
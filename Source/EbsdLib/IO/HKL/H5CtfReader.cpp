@@ -175,6 +175,15 @@ int H5CtfReader::readHeaderOnly()
   return err;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int H5CtfReader::readFileInRowWindows(size_t rowsPerWindow, const RowWindowCallback& callback)
+{
+  // The text parser of the base class does not apply to HDF5 files
+  return EbsdReader::readFileInRowWindows(rowsPerWindow, callback);
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -302,6 +311,29 @@ int H5CtfReader::readHeader(hid_t parId)
   return err;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<EbsdReader::RowWindowArray> H5CtfReader::getRowWindowArrays()
+{
+  return {{getPhasePointer(), sizeof(int)},
+          {getXPointer(), sizeof(float)},
+          {getYPointer(), sizeof(float)},
+          {getZPointer(), sizeof(float)},
+          {getBandCountPointer(), sizeof(int)},
+          {getErrorPointer(), sizeof(int)},
+          {getEuler1Pointer(), sizeof(float)},
+          {getEuler2Pointer(), sizeof(float)},
+          {getEuler3Pointer(), sizeof(float)},
+          {getMeanAngularDeviationPointer(), sizeof(float)},
+          {getBandContrastPointer(), sizeof(int)},
+          {getBandSlopePointer(), sizeof(int)},
+          {getGrainIndexPointer(), sizeof(int)},
+          {getGrainRandomColourRPointer(), sizeof(int)},
+          {getGrainRandomColourGPointer(), sizeof(int)},
+          {getGrainRandomColourBPointer(), sizeof(int)}};
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -328,7 +360,6 @@ int H5CtfReader::readData(hid_t parId)
   }
 
   setNumberOfElements(totalDataRows);
-  size_t numBytes = totalDataRows * sizeof(float);
   std::string sBuf;
   std::stringstream ss(sBuf);
 
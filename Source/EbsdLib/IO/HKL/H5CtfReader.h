@@ -132,6 +132,12 @@ public:
    */
   int readFile() override;
 
+  /**
+   * @brief Reads the complete slice with readFile() and hands it over in windows of scan rows, see
+   * EbsdReader::readFileInRowWindows().
+   */
+  int readFileInRowWindows(size_t rowsPerWindow, const RowWindowCallback& callback) override;
+
   /**
    * @brief Reads the header section of the file
    * @param Valid HDF5 Group ID
@@ -177,6 +183,11 @@ protected:
    */
   int readData(hid_t parId);
 
+  /**
+   * @brief Lists the data arrays for the readFileInRowWindows() implementation of EbsdReader
+   */
+  std::vector<RowWindowArray> getRowWindowArrays() override;
+
 private:
   std::string m_HDF5Path = {};
 
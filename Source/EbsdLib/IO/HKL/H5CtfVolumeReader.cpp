@@ -37,10 +37,15 @@
 
 #include <cmath>
 
+#ifdef EbsdLib_USE_PARALLEL_ALGORITHMS
+#include <tbb/task_group.h>
+#endif
+
 #include "H5Support/H5Lite.h"
 #include "H5Support/H5Utilities.h"
 
 #include "EbsdLib/Core/EbsdLibConstants.h"
+#include "EbsdLib/IO/H5EbsdSliceCopier.hpp"
 #include "EbsdLib/IO/HKL/H5CtfReader.h"
 #include "EbsdLib/Utilities/EbsdStringUtils.hpp"
 
@@ -256,25 +261,23 @@ std::vector<CtfPhase::Pointer> H5CtfVolumeReader::getPhases()
 // -----------------------------------------------------------------------------
 int H5CtfVolumeReader::loadData(int64_t xpoints, int64_t ypoints, int64_t zpoints, uint32_t ZDir)
 {
-  int index = 0;
   int err = -1;
   // Initialize all the pointers
   initPointers(xpoints * ypoints * zpoints);
 
-  int readerIndex = 0;
-  int64_t xpointsslice = 0;
-  int64_t ypointsslice = 0;
-  int64_t xpointstemp = 0;
-  int64_t ypointstemp = 0;
-  int zval = 0;
-
-  int xstartspot = 0;
-  int ystartspot = 0;
-
   err = readVolumeInfo();
+  if(zpoints <= 0)
+  {
+    return err;
+  }
 
-  for(int64_t slice = 0; slice < zpoints; ++slice)
+  // If no stacking order preference was passed, read it from the file and use that value
+  if(ZDir == EbsdLib::RefFrameZDir::UnknownRefFrameZDirection)
   {
+    ZDir = getStackingOrder();
+  }
+
+  auto readSlice = [this](int64_t slice, int& sliceErr) {
     H5CtfReader::Pointer reader = H5CtfReader::New();
     reader->setFileName(getFileName());
     reader->setHDF5Path(EbsdStringUtils::number(slice + getSliceStart()));
@@ -285,115 +288,70 @@ int H5CtfVolumeReader::loadData(int64_t xpoints, int64_t ypoints, int64_t zpoint
     reader->setEulerTransformationAxis(getEulerTransformationAxis());
     reader->readAllArrays(getReadAllArrays());
     reader->setArraysToRead(getArraysToRead());
+    sliceErr = reader->readFile();
+    return reader;
+  };
 
-    err = reader->readFile();
-    if(err < 0)
+  // Only one slice is ever read from the HDF5 file at a time. While slice N is
+  // copied into the volume the read of slice N+1 runs on its own task.
+  int sliceErr = 0;
+  H5CtfReader::Pointer reader = readSlice(0, sliceErr);
+  for(int64_t slice = 0; slice < zpoints; ++slice)
+  {
+    if(sliceErr < 0)
     {
       std::cout << "H5CtfVolumeReader Error: There was an issue loading the data from the hdf5 file." << std::endl;
       return -77000;
     }
-    readerIndex = 0;
-    xpointsslice = reader->getXCells();
-    ypointsslice = reader->getYCells();
-    int* phasePtr = reader->getPhasePointer();
-    float* xPtr = reader->getXPointer();
-    float* yPtr = reader->getYPointer();
-    int* bandPtr = reader->getBandCountPointer();
-    int* errorPtr = reader->getErrorPointer();
-    float* euler1Ptr = reader->getEuler1Pointer();
-    float* euler2Ptr = reader->getEuler2Pointer();
-    float* euler3Ptr = reader->getEuler3Pointer();
-    float* madPtr = reader->getMeanAngularDeviationPointer();
-    int* bcPtr = reader->getBandContrastPointer();
-    int* bsPtr = reader->getBandSlopePointer();
+    err = sliceErr;
 
-    xpointstemp = xpoints;
-    ypointstemp = ypoints;
-    xstartspot = static_cast<int>((xpointstemp - xpointsslice) / 2);
-    ystartspot = static_cast<int>((ypointstemp - ypointsslice) / 2);
-
-    // If no stacking order preference was passed, read it from the file and use that value
-    if(ZDir == EbsdLib::RefFrameZDir::UnknownRefFrameZDirection)
-    {
-      ZDir = getStackingOrder();
-    }
+    int64_t zval = 0;
     if(ZDir == 0)
     {
-      zval = static_cast<int>(slice);
+      zval = slice;
     }
     if(ZDir == 1)
     {
-      zval = static_cast<int>((zpoints - 1) - slice);
+      zval = (zpoints - 1) - slice;
     }
 
-    // Copy the data from the current storage into the Storage Location
-    for(int64_t j = 0; j < ypointsslice; j++)
-    {
-      for(int64_t i = 0; i < xpointsslice; i++)
-      {
-        index = static_cast<int32_t>((zval * xpointstemp * ypointstemp) + ((j + ystartspot) * xpointstemp) + (i + xstartspot));
-        if(nullptr != phasePtr)
-        {
-          m_Phase[index] = phasePtr[readerIndex];
-        }
-        if(nullptr != xPtr)
-        {
-          m_X[index] = xPtr[readerIndex];
-        }
-        if(nullptr != yPtr)
-        {
-          m_Y[index] = yPtr[readerIndex];
-        }
-        if(nullptr != bandPtr)
-        {
-          m_Bands[index] = bandPtr[readerIndex];
-        }
-        if(nullptr != errorPtr)
-        {
-          m_Error[index] = errorPtr[readerIndex];
-        }
-        if(nullptr != euler1Ptr)
-        {
-          m_Euler1[index] = euler1Ptr[readerIndex];
-        }
-        if(nullptr != euler2Ptr)
-        {
-          m_Euler2[index] = euler2Ptr[readerIndex];
-        }
-        if(nullptr != euler3Ptr)
-        {
-          m_Euler3[index] = euler3Ptr[readerIndex];
-        }
-        if(nullptr != madPtr)
-        {
-          m_MAD[index] = madPtr[readerIndex];
-        }
-        if(nullptr != bcPtr)
-        {
-          m_BC[index] = bcPtr[readerIndex];
-        }
-        if(nullptr != bsPtr)
-        {
-          m_BS[index] = bsPtr[readerIndex];
-        }
-
-        /* For HKL OIM Files if there is a single phase then the value of the phase
-         * data is one (1). If there are 2 or more phases then the lowest value
-         * of phase is also one (1). However, if there are "zero solutions" in the data
-         * then those points are assigned a phase of zero.  Since those points can be identified
-         * by other methods, the phase of these points should be changed to one since in the rest
-         * of the reconstruction code we follow the convention that the lowest value is One (1)
-         * even if there is only a single phase. The next if statement converts all zeros to ones
-         * if there is a single phase in the OIM data.
-         */
-        //        if(nullptr != phasePtr && m_Phase[index] < 1)
-        //        {
-        //          m_Phase[index] = 1;
-        //        }
+    H5EbsdSliceCopier copier(xpoints, ypoints, reader->getXCells(), reader->getYCells(), zval);
+    copier.addArray(reader->getPhasePointer(), m_Phase);
+    copier.addArray(reader->getXPointer(), m_X);
+    copier.addArray(reader->getYPointer(), m_Y);
+    copier.addArray(reader->getBandCountPointer(), m_Bands);
+    copier.addArray(reader->getErrorPointer(), m_Error);
+    copier.addArray(reader->getEuler1Pointer(), m_Euler1);
+    copier.addArray(reader->getEuler2Pointer(), m_Euler2);
+    copier.addArray(reader->getEuler3Pointer(), m_Euler3);
+    copier.addArray(reader->getMeanAngularDeviationPointer(), m_MAD);
+    copier.addArray(reader->getBandContrastPointer(), m_BC);
+    copier.addArray(reader->getBandSlopePointer(), m_BS);
 
-        ++readerIndex;
-      }
+    H5CtfReader::Pointer nextReader;
+    int nextErr = 0;
+    bool readNext = (slice + 1 < zpoints);
+#ifdef EbsdLib_USE_PARALLEL_ALGORITHMS
+    bool doParallel = true;
+    if(doParallel && readNext)
+    {
+      std::shared_ptr<tbb::task_group> g(new tbb::task_group);
+      g->run([&] { nextReader = readSlice(slice + 1, nextErr); });
+      copier.copy();
+      g->wait(); // Wait for the next slice to finish reading before moving on.
+      readNext = false;
+    }
+    else
+#endif
+    {
+      copier.copy();
+    }
+    if(readNext)
+    {
+      nextReader = readSlice(slice + 1, nextErr);
     }
+    reader = nextReader;
+    sliceErr = nextErr;
   }
   return err;
 }
@@ -592,6 +592,34 @@ int32_t AllocateAndReadData(H5OINAReader* c, hid_t gid, const std::string& name,
   return err;
 }
 
+// -----------------------------------------------------------------------------
+std::vector<EbsdReader::RowWindowArray> H5OINAReader::getRowWindowArrays()
+{
+  std::vector<RowWindowArray> arrays;
+  const size_t numElements = getNumberOfElements();
+  if(numElements == 0)
+  {
+    return arrays;
+  }
+  // The Euler array holds 3 components per point so the size of each point is taken from the array itself
+  auto addArray = [&arrays, numElements](auto& values) {
+    if(!values.empty())
+    {
+      arrays.push_back({values.data(), values.size() * sizeof(values[0]) / numElements});
+    }
+  };
+  addArray(m_BandContrast);
+  addArray(m_BandSlope);
+  addArray(m_Bands);
+  addArray(m_Error);
+  addArray(m_Euler);
+  addArray(m_MeanAngularDeviation);
+  addArray(m_Phase);
+  addArray(m_X);
+  addArray(m_Y);
+  return arrays;
+}
+
 // -----------------------------------------------------------------------------
 int H5OINAReader::readData(hid_t parId)
 {
@@ -243,6 +243,11 @@ protected:
    */
   int readData(hid_t parId);
 
+  /**
+   * @brief Lists the data arrays for the readFileInRowWindows() implementation of EbsdReader
+   */
+  std::vector<RowWindowArray> getRowWindowArrays() override;
+
 private:
   std::string m_HDF5Path = {};
 
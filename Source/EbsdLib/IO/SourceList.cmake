@@ -5,11 +5,15 @@ set(EbsdLib_${DIR_NAME}_HDRS
   ${EbsdLibProj_SOURCE_DIR}/Source/EbsdLib/${DIR_NAME}/EbsdImporter.h       
   ${EbsdLibProj_SOURCE_DIR}/Source/EbsdLib/${DIR_NAME}/EbsdHeaderEntry.h    
   ${EbsdLibProj_SOURCE_DIR}/Source/EbsdLib/${DIR_NAME}/AngleFileLoader.h
+  ${EbsdLibProj_SOURCE_DIR}/Source/EbsdLib/${DIR_NAME}/DataSectionChunks.h
+  ${EbsdLibProj_SOURCE_DIR}/Source/EbsdLib/${DIR_NAME}/FundamentalZoneQuaternions.h
 )
 
 set(EbsdLib_${DIR_NAME}_SRCS
   ${EbsdLibProj_SOURCE_DIR}/Source/EbsdLib/${DIR_NAME}/EbsdReader.cpp
   ${EbsdLibProj_SOURCE_DIR}/Source/EbsdLib/${DIR_NAME}/AngleFileLoader.cpp
+  ${EbsdLibProj_SOURCE_DIR}/Source/EbsdLib/${DIR_NAME}/DataSectionChunks.cpp
+  ${EbsdLibProj_SOURCE_DIR}/Source/EbsdLib/${DIR_NAME}/FundamentalZoneQuaternions.cpp
 )
 
 if(EbsdLib_ENABLE_HDF5)
@@ -17,11 +21,14 @@ if(EbsdLib_ENABLE_HDF5)
     ${EbsdLib_${DIR_NAME}_HDRS}
     ${EbsdLibProj_SOURCE_DIR}/Source/EbsdLib/${DIR_NAME}/H5EbsdVolumeReader.h
     ${EbsdLibProj_SOURCE_DIR}/Source/EbsdLib/${DIR_NAME}/H5EbsdVolumeInfo.h
+    ${EbsdLibProj_SOURCE_DIR}/Source/EbsdLib/${DIR_NAME}/H5EbsdSliceCopier.hpp
+    ${EbsdLibProj_SOURCE_DIR}/Source/EbsdLib/${DIR_NAME}/H5EbsdChunkedIO.h
   )
   set(EbsdLib_${DIR_NAME}_SRCS
     ${EbsdLib_${DIR_NAME}_SRCS}
     ${EbsdLibProj_SOURCE_DIR}/Source/EbsdLib/${DIR_NAME}/H5EbsdVolumeInfo.cpp
     ${EbsdLibProj_SOURCE_DIR}/Source/EbsdLib/${DIR_NAME}/H5EbsdVolumeReader.cpp
+    ${EbsdLibProj_SOURCE_DIR}/Source/EbsdLib/${DIR_NAME}/H5EbsdChunkedIO.cpp
   )
 endif()
 
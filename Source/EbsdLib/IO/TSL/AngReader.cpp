@@ -37,8 +37,11 @@
 #include "AngConstants.h"
 
 #include "EbsdLib/Core/EbsdMacros.h"
+#include "EbsdLib/IO/DataSectionChunks.h"
 #include "EbsdLib/IO/EbsdReader.h"
 #include "EbsdLib/Math/EbsdLibMath.h"
+#include "EbsdLib/Utilities/EbsdStringUtils.hpp"
+#include "EbsdLib/Utilities/MemoryMappedFile.h"
 
 #include <algorithm>
 #include <fstream>
@@ -111,6 +114,8 @@ AngReader::AngReader()
   setNumFeatures(10);
 
   m_ReadHexGrid = false;
+  m_UseMemoryMapping = false;
+  m_UseParallelParsing = false;
 
   // Initialize the map of header key to header value
   m_HeaderMap[EbsdLib::Ang::TEMPIXPerUM] = AngHeaderEntry<float>::NewEbsdHeaderEntry(EbsdLib::Ang::TEMPIXPerUM);
@@ -350,6 +355,66 @@ int AngReader::readFile()
     return -100;
   }
 
+  int err = readHeaderSection(in, buf);
+  if(err < 0)
+  {
+    return err;
+  }
+  MemoryMappedFile mappedFile;
+  if((m_UseMemoryMapping || m_UseParallelParsing) && mappedFile.open(getFileName()))
+  {
+    in.close();
+    readMappedData(mappedFile);
+  }
+  else
+  {
+    // We need to pass in the buffer because it has the first line of data
+    readData(in, buf);
+  }
+  if(getErrorCode() < 0)
+  {
+    return getErrorCode();
+  }
+  std::vector<int64_t> indexMap;
+  std::string grid = getGrid();
+  if(grid.find(EbsdLib::Ang::SquareGrid) == 0)
+  {
+    std::pair<int, std::string> result = fixOrderOfData(indexMap);
+
+    if(result.first < 0)
+    {
+      setErrorCode(result.first);
+      setErrorMessage(result.second);
+      return result.first;
+    }
+
+    std::vector<std::string> arrayNames = {"Phi1", "Phi", "Phi2", "X Position", "Y Position", "Image Quality", "Confidence Index", "PhaseData", "SEM Signal", "Fit"};
+    for(const auto& arrayName : arrayNames)
+    {
+      void* oldArray = getPointerByName(arrayName);
+
+      if(getPointerType(arrayName) == EbsdLib::NumericTypes::Type::Float)
+      {
+        CopyTupleUsingIndexList<float>(oldArray, indexMap);
+      }
+      else if(getPointerType(arrayName) == EbsdLib::NumericTypes::Type::Int32)
+      {
+        CopyTupleUsingIndexList<int32_t>(oldArray, indexMap);
+      }
+      else
+      {
+        std::cout << "Type returned was not of Float or int32. The Array name probably isn't correct." << std::endl;
+      }
+    }
+  }
+  return getErrorCode();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int AngReader::readHeaderSection(std::ifstream& in, std::string& buf)
+{
   std::string origHeader;
   setOriginalHeader(origHeader);
   m_PhaseVector.clear();
@@ -388,43 +453,118 @@ int AngReader::readFile()
     setErrorMessage("No phase was parsed in the header portion of the file. This possibly means that part of the header is missing.");
     return -150;
   }
-  // We need to pass in the buffer because it has the first line of data
-  readData(in, buf);
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int AngReader::readFileInRowWindows(size_t rowsPerWindow, const RowWindowCallback& callback)
+{
+  setErrorCode(0);
+  setErrorMessage("");
+  std::string buf;
+  setHeaderIsComplete(false);
+
+  std::ifstream in(getFileName(), std::ios_base::in);
+  if(!in.is_open())
+  {
+    std::string msg = "Ang file could not be opened:" + getFileName();
+    setErrorCode(-100);
+    setErrorMessage(msg);
+    return -100;
+  }
+
+  int err = readHeaderSection(in, buf);
+  if(err < 0)
+  {
+    return err;
+  }
+
+  size_t totalDataPoints = computeNumberOfDataPoints();
   if(getErrorCode() < 0)
   {
     return getErrorCode();
   }
-  std::vector<int64_t> indexMap;
-  std::string grid = getGrid();
-  if(grid.find(EbsdLib::Ang::SquareGrid) == 0)
+  setNumberOfElements(totalDataPoints);
+
+  // Square grids have the same number of points in every row, hex grids alternate between the odd and even
+  // column counts starting with the odd one.
+  size_t numRows = static_cast<size_t>(getNumRows());
+  size_t nOddCols = static_cast<size_t>(std::max(getNumOddCols(), 0));
+  size_t nEvenCols = static_cast<size_t>(std::max(getNumEvenCols(), 0));
+  bool hexGrid = getGrid().find(EbsdLib::Ang::HexGrid) == 0;
+  bool squareGrid = getGrid().find(EbsdLib::Ang::SquareGrid) == 0;
+  std::array<float, 2> origin = {0.0f, 0.0f};
+  if(!hexGrid)
   {
-    std::pair<int, std::string> result = fixOrderOfData(indexMap);
+    nOddCols = (nOddCols > 0) ? nOddCols : nEvenCols;
+    nEvenCols = nOddCols;
+  }
+  rowsPerWindow = std::max(rowsPerWindow, static_cast<size_t>(1));
+  if(!allocateArrays(rowsPerWindow * std::max(nOddCols, nEvenCols)))
+  {
+    return getErrorCode();
+  }
 
-    if(result.first < 0)
+  // The header loop already read the first line of data
+  std::string block = buf;
+  block.append(1, '\n');
+  size_t pendingRows = 1;
+
+  RowWindow window;
+  while(window.firstRow < numRows)
+  {
+    window.numRows = std::min(rowsPerWindow, numRows - window.firstRow);
+    window.numElements = 0;
+    for(size_t row = window.firstRow; row < window.firstRow + window.numRows; row++)
     {
-      setErrorCode(result.first);
-      setErrorMessage(result.second);
-      return result.first;
+      window.numElements += (row % 2 == 0) ? nOddCols : nEvenCols;
     }
 
-    std::vector<std::string> arrayNames = {"Phi1", "Phi", "Phi2", "X Position", "Y Position", "Image Quality", "Confidence Index", "PhaseData", "SEM Signal", "Fit"};
-    for(const auto& arrayName : arrayNames)
+    size_t numLines = pendingRows + DataSectionChunks::ReadLines(in, window.numElements - std::min(pendingRows, window.numElements), block);
+    pendingRows = 0;
+    size_t numParsed = 0;
+    DataSectionError error = parseDataSection(block.data(), block.data() + block.size(), window.numElements, numParsed);
+    if(error.errorCode < 0)
     {
-      void* oldArray = getPointerByName(arrayName);
+      setErrorCode(error.errorCode);
+      m_ErrorColumn = error.errorColumn;
+      std::stringstream ss;
+      ss << "Error parsing the data line (Numeric conversion). Error code is " << getErrorCode() << " and occurred at data column " << m_ErrorColumn << " (Zero Based)\n"
+         << std::string(error.lineFirst, error.lineLast) << "\n***Parsing Position ***\nCurrent Data Point Count: " << window.firstElement + error.index + 1 << "\n";
+      setErrorMessage(ss.str());
+      return getErrorCode();
+    }
+    if(numLines < window.numElements || numParsed != window.numElements)
+    {
+      std::stringstream ss;
+      ss << "End of ANG file reached before all data was parsed.\n"
+         << getFileName() << "\nCalculated Data Points: " << totalDataPoints << "\nCurrent Data Point Count: " << window.firstElement + numParsed << "\n";
+      setErrorMessage(ss.str());
+      setErrorCode(-600);
+      return -600;
+    }
 
-      if(getPointerType(arrayName) == EbsdLib::NumericTypes::Type::Float)
-      {
-        CopyTupleUsingIndexList<float>(oldArray, indexMap);
-      }
-      else if(getPointerType(arrayName) == EbsdLib::NumericTypes::Type::Int32)
-      {
-        CopyTupleUsingIndexList<int32_t>(oldArray, indexMap);
-      }
-      else
+    // readFile() reorders square grids after reading all of the data, which a single window can not do
+    if(squareGrid)
+    {
+      std::pair<int, std::string> result = checkRowOrder(window, origin);
+      if(result.first < 0)
       {
-        std::cout << "Type returned was not of Float or int32. The Array name probably isn't correct." << std::endl;
+        setErrorCode(result.first);
+        setErrorMessage(result.second);
+        return result.first;
       }
     }
+
+    if(!callback(window))
+    {
+      break;
+    }
+    block.clear();
+    window.firstRow += window.numRows;
+    window.firstElement += window.numElements;
   }
   return getErrorCode();
 }
@@ -432,11 +572,28 @@ int AngReader::readFile()
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void AngReader::readData(std::ifstream& in, std::string& buf)
+size_t AngReader::allocateDataArrays()
 {
-  std::string streamBuf;
-  std::stringstream ss(streamBuf);
+  size_t totalDataPoints = computeNumberOfDataPoints();
+  if(getErrorCode() < 0)
+  {
+    return 0;
+  }
 
+  // Initialize all the pointers and allocate memory
+  setNumberOfElements(totalDataPoints);
+  if(!allocateArrays(totalDataPoints))
+  {
+    return 0;
+  }
+  return totalDataPoints;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t AngReader::computeNumberOfDataPoints()
+{
   size_t totalDataPoints = 0;
 
   std::string grid = getGrid();
@@ -449,7 +606,7 @@ void AngReader::readData(std::ifstream& in, std::string& buf)
   {
     setErrorCode(-200);
     setErrorMessage("NumRows Sanity Check not correct. Check the entry for NROWS in the .ang file");
-    return;
+    return 0;
   }
   if(grid.find(EbsdLib::Ang::SquareGrid) == 0)
   {
@@ -470,7 +627,7 @@ void AngReader::readData(std::ifstream& in, std::string& buf)
   {
     setErrorCode(-400);
     setErrorMessage("Ang Files with Hex Grids Are NOT currently supported - Try converting them to Square Grid with the Hex2Sqr Converter filter.");
-    return;
+    return 0;
   }
   else if(grid.find(EbsdLib::Ang::HexGrid) == 0 && m_ReadHexGrid)
   {
@@ -494,40 +651,54 @@ void AngReader::readData(std::ifstream& in, std::string& buf)
   {
     setErrorMessage("Ang file is missing the 'GRID' header entry.");
     setErrorCode(-300);
-    return;
+    return 0;
   }
+  return totalDataPoints;
+}
 
-  // Initialize all the pointers and allocate memory
-  setNumberOfElements(totalDataPoints);
-  size_t numBytes = totalDataPoints * sizeof(float);
-  m_Phi1 = allocateArray<float>(totalDataPoints);
-  m_Phi = allocateArray<float>(totalDataPoints);
-  m_Phi2 = allocateArray<float>(totalDataPoints);
-  m_Iq = allocateArray<float>(totalDataPoints);
-  m_Ci = allocateArray<float>(totalDataPoints);
-  m_PhaseData = allocateArray<int>(totalDataPoints);
-  m_X = allocateArray<float>(totalDataPoints);
-  m_Y = allocateArray<float>(totalDataPoints);
-  m_SEMSignal = allocateArray<float>(totalDataPoints);
-  m_Fit = allocateArray<float>(totalDataPoints);
-
-  ::memset(m_Phi1, 0, numBytes);
-  ::memset(m_Phi, 0, numBytes);
-  ::memset(m_Phi2, 0, numBytes);
-  ::memset(m_Iq, 0, numBytes);
-  ::memset(m_Ci, 0, numBytes);
-  ::memset(m_PhaseData, 0, numBytes);
-  ::memset(m_X, 0, numBytes);
-  ::memset(m_Y, 0, numBytes);
-  ::memset(m_SEMSignal, 0, numBytes);
-  ::memset(m_Fit, 0, numBytes);
-
-  if(nullptr == m_Phi1 || nullptr == m_Phi || nullptr == m_Phi2 || nullptr == m_Iq || nullptr == m_SEMSignal || nullptr == m_Ci || nullptr == m_PhaseData || m_X == nullptr || m_Y == nullptr)
-  {
-    ss.str("");
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool AngReader::allocateArrays(size_t numPoints)
+{
+  // allocateArray() zeroes the arrays so points missing from a short file read as zero
+  setPhi1Pointer(allocateArray<float>(numPoints));
+  setPhiPointer(allocateArray<float>(numPoints));
+  setPhi2Pointer(allocateArray<float>(numPoints));
+  setImageQualityPointer(allocateArray<float>(numPoints));
+  setConfidenceIndexPointer(allocateArray<float>(numPoints));
+  setPhaseDataPointer(allocateArray<int>(numPoints));
+  setXPositionPointer(allocateArray<float>(numPoints));
+  setYPositionPointer(allocateArray<float>(numPoints));
+  setSEMSignalPointer(allocateArray<float>(numPoints));
+  setFitPointer(allocateArray<float>(numPoints));
+
+  if(nullptr == m_Phi1 || nullptr == m_Phi || nullptr == m_Phi2 || nullptr == m_Iq || nullptr == m_SEMSignal || nullptr == m_Ci || nullptr == m_PhaseData || m_X == nullptr || m_Y == nullptr || m_Fit == nullptr)
+  {
+    std::stringstream ss;
     ss << "Internal pointers were nullptr at " << __FILE__ << "(" << __LINE__ << ")\n";
     setErrorMessage(ss.str());
     setErrorCode(-2500);
+    return false;
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void AngReader::readData(std::ifstream& in, std::string& buf)
+{
+  std::string streamBuf;
+  std::stringstream ss(streamBuf);
+
+  int nOddCols = getNumOddCols();
+  int nEvenCols = getNumEvenCols();
+  int numRows = getNumRows();
+
+  size_t totalDataPoints = allocateDataArrays();
+  if(getErrorCode() < 0)
+  {
     return;
   }
 
@@ -619,6 +790,143 @@ void AngReader::readData(std::ifstream& in, std::string& buf)
   }
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void AngReader::readMappedData(const MemoryMappedFile& mappedFile)
+{
+  const char* cursor = mappedFile.data();
+  const char* fileEnd = cursor + mappedFile.size();
+
+  // Skip over the header. The first line that does not start with a '#' is the first line of data
+  while(cursor != fileEnd && *cursor == '#')
+  {
+    cursor = std::find(cursor, fileEnd, '\n');
+    if(cursor != fileEnd)
+    {
+      ++cursor;
+    }
+  }
+
+  int nOddCols = getNumOddCols();
+  int nEvenCols = getNumEvenCols();
+  int numRows = getNumRows();
+
+  size_t totalDataPoints = allocateDataArrays();
+  if(getErrorCode() < 0)
+  {
+    return;
+  }
+
+  size_t counter = 0;
+  DataSectionError firstError = parseDataSection(cursor, fileEnd, totalDataPoints, counter);
+  if(firstError.errorCode < 0)
+  {
+    setErrorCode(firstError.errorCode);
+    m_ErrorColumn = firstError.errorColumn;
+    counter = firstError.index + 1;
+    std::pair<int, int> rowCol = findRowAndColumn(firstError.index);
+    std::stringstream ss;
+    ss << "Error parsing the data line (Numeric conversion). Error code is " << getErrorCode() << " and occurred at data column " << m_ErrorColumn << " (Zero Based)\n"
+       << std::string(firstError.lineFirst, firstError.lineLast) << "\n*** Header information ***\nRows=" << numRows << " EvenCols=" << nEvenCols << " OddCols=" << nOddCols
+       << "  Calculated Data Points: " << totalDataPoints << "\n***Parsing Position ***\nCurrent Row: " << rowCol.first << "  Current Column Index: " << rowCol.second
+       << "  Current Data Point Count: " << counter << "\n";
+    setErrorMessage(ss.str());
+  }
+
+  if(getNumFeatures() < 10)
+  {
+    deallocateArrayData<float>(m_Fit);
+  }
+  if(getNumFeatures() < 9)
+  {
+    deallocateArrayData<float>(m_SEMSignal);
+  }
+  if(getErrorCode() < 0)
+  {
+    return;
+  }
+
+  if(counter != totalDataPoints)
+  {
+    std::pair<int, int> rowCol = findRowAndColumn(counter);
+    std::stringstream ss;
+    ss << "End of ANG file reached before all data was parsed.\n"
+       << getFileName() << "\n*** Header information ***\nRows=" << numRows << " EvenCols=" << nEvenCols << " OddCols=" << nOddCols << "  Calculated Data Points: " << totalDataPoints
+       << "\n***Parsing Position ***\nCurrent Row: " << rowCol.first << "  Current Column Index: " << rowCol.second << "  Current Data Point Count: " << counter << "\n";
+    setErrorMessage(ss.str());
+    setErrorCode(-600);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+AngReader::DataSectionError AngReader::parseDataSection(const char* first, const char* last, size_t numPoints, size_t& numRows)
+{
+  // Split the data section into chunks of complete lines. Each chunk knows the index of its first
+  // data point so the chunks can be parsed independently of each other.
+  bool parallel = m_UseParallelParsing;
+  std::vector<DataSectionChunks::Chunk> chunks = DataSectionChunks::Split(first, last, numPoints, parallel);
+  numRows = DataSectionChunks::TotalRows(chunks);
+
+  std::vector<DataSectionError> chunkErrors(chunks.size());
+
+  DataSectionChunks::ForEach(chunks, parallel, [this, &chunkErrors](size_t chunkIndex, const DataSectionChunks::Chunk& chunk) {
+    const char* lineFirst = chunk.first;
+    for(size_t row = 0; row < chunk.numRows; ++row)
+    {
+      const char* lineLast = DataSectionChunks::FindLineEnd(lineFirst, chunk.last);
+      int errorColumn = 0;
+      int err = parseDataLine(lineFirst, lineLast, chunk.firstRow + row, errorColumn);
+      if(err < 0)
+      {
+        chunkErrors[chunkIndex] = {err, errorColumn, chunk.firstRow + row, lineFirst, lineLast};
+        return;
+      }
+      lineFirst = (lineLast == chunk.last) ? chunk.last : lineLast + 1;
+    }
+  });
+
+  // The chunks are in file order so the first chunk with an error holds the first bad line
+  auto firstError = std::find_if(chunkErrors.begin(), chunkErrors.end(), [](const DataSectionError& chunkError) { return chunkError.errorCode < 0; });
+  if(firstError != chunkErrors.end())
+  {
+    return *firstError;
+  }
+  return {};
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::pair<int, int> AngReader::findRowAndColumn(size_t numPoints)
+{
+  int row = 0;
+  int col = 0;
+  if(m_Y == nullptr)
+  {
+    return {row, col};
+  }
+  // The arrays are zero initialized before parsing so the Y position starts at 0.0
+  float oldY = 0.0f;
+  numPoints = std::min(numPoints, getNumberOfElements());
+  for(size_t i = 0; i < numPoints; ++i)
+  {
+    if(fabs(m_Y[i] - oldY) > 1e-6)
+    {
+      ++row;
+      oldY = m_Y[i];
+      col = 0;
+    }
+    else
+    {
+      col++;
+    }
+  }
+  return {row, col};
+}
+
 // -----------------------------------------------------------------------------
 //  Read the Header part of the ANG file
 // -----------------------------------------------------------------------------
@@ -956,6 +1264,91 @@ void AngReader::parseDataLine(std::string& line, size_t i)
   }
 }
 
+// -----------------------------------------------------------------------------
+//  Read the data part of the ANG file directly from the file buffer
+// -----------------------------------------------------------------------------
+int AngReader::parseDataLine(const char* first, const char* last, size_t offset, int& errorColumn) const
+{
+  // The columns are in the same order as described in the std::string based parseDataLine() above
+  int column = 0;
+  while(column < 10)
+  {
+    while(first != last && EbsdStringUtils::isBlank(*first))
+    {
+      ++first;
+    }
+    if(first == last)
+    {
+      break;
+    }
+    const char* tokenEnd = first;
+    while(tokenEnd != last && !EbsdStringUtils::isBlank(*tokenEnd))
+    {
+      ++tokenEnd;
+    }
+
+    bool ok = true;
+    switch(column)
+    {
+    case 0:
+      ok = EbsdStringUtils::parseValue(first, tokenEnd, m_Phi1[offset]);
+      break;
+    case 1:
+      ok = EbsdStringUtils::parseValue(first, tokenEnd, m_Phi[offset]);
+      break;
+    case 2:
+      ok = EbsdStringUtils::parseValue(first, tokenEnd, m_Phi2[offset]);
+      break;
+    case 3:
+      ok = EbsdStringUtils::parseValue(first, tokenEnd, m_X[offset]);
+      break;
+    case 4:
+      ok = EbsdStringUtils::parseValue(first, tokenEnd, m_Y[offset]);
+      break;
+    case 5:
+      ok = EbsdStringUtils::parseValue(first, tokenEnd, m_Iq[offset]);
+      break;
+    case 6:
+      ok = EbsdStringUtils::parseValue(first, tokenEnd, m_Ci[offset]);
+      break;
+    case 7: {
+      int32_t ph = 0;
+      ok = EbsdStringUtils::parseValue(first, tokenEnd, ph);
+      if(!ok)
+      {
+        // Some have floats instead of integers so lets try that.
+        float f = 0.0f;
+        ok = EbsdStringUtils::parseValue(first, tokenEnd, f);
+        ph = static_cast<int32_t>(f);
+      }
+      m_PhaseData[offset] = ph;
+      if(!ok)
+      {
+        errorColumn = column;
+        return -2588;
+      }
+      break;
+    }
+    case 8:
+      ok = EbsdStringUtils::parseValue(first, tokenEnd, m_SEMSignal[offset]);
+      break;
+    case 9:
+      ok = EbsdStringUtils::parseValue(first, tokenEnd, m_Fit[offset]);
+      break;
+    default:
+      break;
+    }
+    if(!ok)
+    {
+      errorColumn = column;
+      return -2501 - column;
+    }
+    first = tokenEnd;
+    ++column;
+  }
+  return 0;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -1035,6 +1428,62 @@ std::pair<int, std::string> AngReader::fixOrderOfData(std::vector<int64_t>& inde
   return {0, ""};
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::pair<int, std::string> AngReader::checkRowOrder(const RowWindow& window, std::array<float, 2>& origin)
+{
+  size_t numCols = static_cast<size_t>(std::max(getNumOddCols(), 1));
+  size_t numRows = static_cast<size_t>(getNumRows());
+  float xStep = getXStep();
+  float yStep = getYStep();
+  const float* xPosition = getXPositionPointer();
+  const float* yPosition = getYPositionPointer();
+  if(window.firstElement == 0 && window.numElements > 0)
+  {
+    origin = {xPosition[0], yPosition[0]};
+  }
+
+  for(size_t i = 0; i < window.numElements; i++)
+  {
+    size_t element = window.firstElement + i;
+    float col = std::floor((xPosition[i] - origin[0]) / xStep + 0.5f);
+    float row = std::floor((yPosition[i] - origin[1]) / yStep + 0.5f);
+    if(col != static_cast<float>(element % numCols))
+    {
+      std::stringstream message;
+      message << "Error: The X Position " << xPosition[i] << " of data point " << element << " does not match column " << element % numCols << " of " << numCols
+              << " columns. Reading in row windows requires the points in row order and a matching NCOLS_ODD header value." << std::endl;
+      return {-101100, message.str()};
+    }
+    if(row != static_cast<float>(element / numCols) || element / numCols >= numRows)
+    {
+      std::stringstream message;
+      message << "Error: The Y Position " << yPosition[i] << " of data point " << element << " does not match row " << element / numCols << " of " << numRows
+              << " rows. Reading in row windows requires the points in row order and a matching NROWS header value." << std::endl;
+      return {-101101, message.str()};
+    }
+  }
+  return {0, ""};
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<EbsdReader::RowWindowArray> AngReader::getRowWindowArrays()
+{
+  return {{getPhi1Pointer(), sizeof(float)},
+          {getPhiPointer(), sizeof(float)},
+          {getPhi2Pointer(), sizeof(float)},
+          {getXPositionPointer(), sizeof(float)},
+          {getYPositionPointer(), sizeof(float)},
+          {getImageQualityPointer(), sizeof(float)},
+          {getConfidenceIndexPointer(), sizeof(float)},
+          {getPhaseDataPointer(), sizeof(int)},
+          {getSEMSignalPointer(), sizeof(float)},
+          {getFitPointer(), sizeof(float)}};
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
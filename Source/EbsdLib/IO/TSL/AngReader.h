@@ -35,6 +35,7 @@
 
 #pragma once
 
+#include <array>
 #include <fstream>
 #include <map>
 #include <string>
@@ -49,6 +50,8 @@
 #include "EbsdLib/EbsdLib.h"
 #include "EbsdLib/IO/EbsdReader.h"
 
+class MemoryMappedFile;
+
 /**
  * @class AngReader AngReader.h EbsdLib/IO/TSL/AngReader.h
  * @brief This class is a self contained TSL OIM .ang file reader and will read a
@@ -103,6 +106,20 @@ public:
 
   EBSD_INSTANCE_PROPERTY(bool, ReadHexGrid)
 
+  /**
+   * @brief When true the data section of the file is memory mapped and the values are
+   * parsed in place instead of reading the file line by line through a std::ifstream.
+   * If the file can not be mapped the reader falls back to the std::ifstream code path.
+   */
+  EBSD_INSTANCE_PROPERTY(bool, UseMemoryMapping)
+
+  /**
+   * @brief When true the data section of the file is split into chunks at line boundaries and the
+   * chunks are parsed concurrently. This implies UseMemoryMapping. Without parallel algorithms
+   * compiled into EbsdLib the chunks are parsed serially.
+   */
+  EBSD_INSTANCE_PROPERTY(bool, UseParallelParsing)
+
   EBSD_INSTANCE_PROPERTY(std::string, Notes)
   EBSD_INSTANCE_PROPERTY(std::string, ColumnNotes)
 
@@ -165,6 +182,17 @@ public:
    */
   int readHeaderOnly() override;
 
+  /**
+   * @brief Reads the TSL .ang file one window of scan rows at a time. The data section is parsed incrementally
+   * (in parallel within each window if UseParallelParsing is set). A window can not be reordered on its own, so
+   * square grids must store their points in row order; files that readFile() would have to reorder, or whose
+   * X/Y positions do not match NCOLS_ODD/NROWS, are rejected with the same -101100/-101101 errors.
+   * @param rowsPerWindow Maximum number of scan rows in each window
+   * @param callback Called once per window
+   * @return 0 on success or a negative error code
+   */
+  int readFileInRowWindows(size_t rowsPerWindow, const RowWindowCallback& callback) override;
+
   int getXDimension() override;
   void setXDimension(int xdim) override;
   int getYDimension() override;
@@ -194,12 +222,88 @@ public:
     std::copy(buffer.begin(), buffer.end(), oldArr);
   }
 
+protected:
+  /**
+   * @brief Lists the data arrays for the readFileInRowWindows() implementation of EbsdReader, which the H5 readers use
+   */
+  std::vector<RowWindowArray> getRowWindowArrays() override;
+
 private:
   AngPhase::Pointer m_CurrentPhase;
   int m_ErrorColumn = 0;
 
+  /**
+   * @brief The first line of the data section that could not be parsed
+   */
+  struct DataSectionError
+  {
+    int errorCode = 0;
+    int errorColumn = 0;
+    size_t index = 0;
+    const char* lineFirst = nullptr;
+    const char* lineLast = nullptr;
+  };
+
+  /**
+   * @brief Reads and parses the header section of the file. On return buf holds the first line of data.
+   * @return 0 on success or a negative error code
+   */
+  int readHeaderSection(std::ifstream& in, std::string& buf);
+
   void readData(std::ifstream& in, std::string& buf);
 
+  /**
+   * @brief Reads the data section of a memory mapped .ang file
+   * @param mappedFile The memory mapped .ang file
+   */
+  void readMappedData(const MemoryMappedFile& mappedFile);
+
+  /**
+   * @brief Computes the number of data points from the header values and allocates all of the data arrays.
+   * @return The total number of data points. The error code is set if the header values are not valid.
+   */
+  size_t allocateDataArrays();
+
+  /**
+   * @brief Computes the number of data points from the header values.
+   * @return The total number of data points. The error code is set if the header values are not valid.
+   */
+  size_t computeNumberOfDataPoints();
+
+  /**
+   * @brief Allocates and zeros all of the data arrays so that each can hold numPoints values.
+   * @return false if an array could not be allocated, in which case the error code is set
+   */
+  bool allocateArrays(size_t numPoints);
+
+  /**
+   * @brief Parses the lines in [first, last) into the data arrays starting at index 0, split into chunks that
+   * are parsed in parallel if UseParallelParsing is set.
+   * @param first The first character of the first line
+   * @param last One past the last character
+   * @param numPoints No more than this number of lines are parsed
+   * @param numRows [output] The number of lines that were found, up to numPoints
+   * @return The first line that could not be parsed. The errorCode is 0 if all lines were parsed.
+   */
+  DataSectionError parseDataSection(const char* first, const char* last, size_t numPoints, size_t& numRows);
+
+  /**
+   * @brief Computes the current row and column after a number of data points have been parsed by following
+   * the changes in the Y Position the same way the data reading loop does. Used to generate the error messages.
+   * @param numPoints The number of data points that have been parsed
+   * @return The row and the column
+   */
+  std::pair<int, int> findRowAndColumn(size_t numPoints);
+
+  /**
+   * @brief Checks that the points of a square grid window are in row order, i.e., where fixOrderOfData() would
+   * leave them. The X/Y position of the first point of the scan is the origin.
+   * @param window The window held by the data arrays
+   * @param origin The X and Y position of the first point of the scan, set from the first window
+   * @return 0 or the same -101100 (columns) / -101101 (rows) errors that fixOrderOfData() reports
+   */
+  std::pair<int, std::string> checkRowOrder(const RowWindow& window, std::array<float, 2>& origin);
+
   /** @brief Parses the value from a single line of the header section of the TSL .ang file
    * @param line The line to parse
    */
@@ -210,6 +314,15 @@ private:
    */
   void parseDataLine(std::string& line, size_t i);
 
+  /** @brief Parses the data from a line of data from the TSL .ang file without copying it out of the file buffer
+   * @param first The first character of the line
+   * @param last One past the last character of the line, not including the newline
+   * @param offset The index of the data point that the line holds
+   * @param errorColumn Set to the zero based column that could not be parsed
+   * @return 0 on success or a negative error code
+   */
+  int parseDataLine(const char* first, const char* last, size_t offset, int& errorColumn) const;
+
   bool m_InsideNotes = false;
   bool m_InsideColumnNotes = false;
 
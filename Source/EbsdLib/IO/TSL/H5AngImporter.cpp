@@ -40,6 +40,7 @@
 
 #include "EbsdLib/Core/EbsdLibConstants.h"
 #include "EbsdLib/EbsdLibVersion.h"
+#include "EbsdLib/IO/H5EbsdChunkedIO.h"
 
 using namespace H5Support;
 
@@ -103,7 +104,7 @@ H5AngImporter::~H5AngImporter() = default;
     m_msgType* dataPtr = reader.get##prpty##Pointer();                                                                                                                                                 \
     if(nullptr != dataPtr)                                                                                                                                                                             \
     {                                                                                                                                                                                                  \
-      err = H5Lite::writePointerDataset(gid, key, rank, dims, dataPtr);                                                                                                                                \
+      err = H5EbsdChunkedIO::WriteDataset(gid, key, numCols, numRows, dataPtr, getStorageOptions());                                                                                                  \
       if(err < 0)                                                                                                                                                                                      \
       {                                                                                                                                                                                                \
         ss.str("");                                                                                                                                                                                    \
@@ -298,8 +299,8 @@ int H5AngImporter::importFile(hid_t fileId, int64_t z, const std::string& angFil
     return -1;
   }
 
-  int32_t rank = 1;
-  hsize_t dims[1] = {static_cast<hsize_t>(reader.getNumEvenCols() * reader.getNumRows())};
+  hsize_t numCols = static_cast<hsize_t>(reader.getNumEvenCols());
+  hsize_t numRows = static_cast<hsize_t>(reader.getNumRows());
 
   WRITE_ANG_DATA_ARRAY(reader, float, gid, Phi1, EbsdLib::Ang::Phi1);
   WRITE_ANG_DATA_ARRAY(reader, float, gid, Phi, EbsdLib::Ang::Phi);
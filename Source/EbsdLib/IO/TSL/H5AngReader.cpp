@@ -49,6 +49,7 @@
 
 #include "EbsdLib/Core/EbsdLibConstants.h"
 #include "EbsdLib/Core/EbsdMacros.h"
+#include "EbsdLib/IO/H5EbsdChunkedIO.h"
 
 using namespace H5Support;
 
@@ -65,6 +66,15 @@ H5AngReader::H5AngReader()
 // -----------------------------------------------------------------------------
 H5AngReader::~H5AngReader() = default;
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int H5AngReader::readFileInRowWindows(size_t rowsPerWindow, const RowWindowCallback& callback)
+{
+  // The text parser of the base class does not apply to HDF5 files
+  return EbsdReader::readFileInRowWindows(rowsPerWindow, callback);
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -323,6 +333,7 @@ int H5AngReader::readData(hid_t parId)
   size_t nOddCols = getNumOddCols();
   size_t nEvenCols = getNumEvenCols();
   size_t nRows = getNumRows();
+  size_t nColumns = 0;
 
   if(nRows < 1)
   {
@@ -336,16 +347,13 @@ int H5AngReader::readData(hid_t parId)
     // if (nCols > 0) { numElements = nRows * nCols; }
     if(nOddCols > 0)
     {
-      totalDataRows = nRows * nOddCols; /* nCols = nOddCols;*/
+      nColumns = nOddCols;
     }
     else if(nEvenCols > 0)
     {
-      totalDataRows = nRows * nEvenCols; /* nCols = nEvenCols; */
-    }
-    else
-    {
-      totalDataRows = 0;
+      nColumns = nEvenCols;
     }
+    totalDataRows = nRows * nColumns;
   }
   else if(grid.find(EbsdLib::Ang::HexGrid) == 0)
   {
@@ -360,6 +368,19 @@ int H5AngReader::readData(hid_t parId)
     return -300;
   }
 
+  // Only the requested scan rows are read from the data arrays. Hex grids, whose rows alternate between
+  // NumOddCols and NumEvenCols, were rejected above so every row holds nColumns points.
+  size_t readColumns = nColumns;
+  size_t readRowStart = m_ReadRowStart;
+  size_t readRowCount = (m_ReadRowCount == 0 && readRowStart < nRows) ? nRows - readRowStart : m_ReadRowCount;
+  if(readRowCount == 0 || readRowStart + readRowCount > nRows)
+  {
+    setErrorCode(-90302);
+    setErrorMessage("The requested row range is outside of the scan.");
+    return -302;
+  }
+  totalDataRows = readColumns * readRowCount;
+
   hid_t gid = H5Gopen(parId, EbsdLib::H5OIM::Data.c_str(), H5P_DEFAULT);
   if(gid < 0)
   {
@@ -368,7 +389,6 @@ int H5AngReader::readData(hid_t parId)
     return getErrorCode();
   }
   setNumberOfElements(totalDataRows);
-  size_t numBytes = totalDataRows * sizeof(float);
   std::string sBuf;
   std::stringstream ss(sBuf);
 
@@ -382,26 +402,30 @@ int H5AngReader::readData(hid_t parId)
   }
 
   // Initialize new pointers
-  ANG_READER_ALLOCATE_AND_READ(Phi1, EbsdLib::Ang::Phi1, float);
-  ANG_READER_ALLOCATE_AND_READ(Phi, EbsdLib::Ang::Phi, float);
-  ANG_READER_ALLOCATE_AND_READ(Phi2, EbsdLib::Ang::Phi2, float);
-  ANG_READER_ALLOCATE_AND_READ(ImageQuality, EbsdLib::Ang::ImageQuality, float);
-  ANG_READER_ALLOCATE_AND_READ(ConfidenceIndex, EbsdLib::Ang::ConfidenceIndex, float);
-  ANG_READER_ALLOCATE_AND_READ(PhaseData, EbsdLib::Ang::PhaseData, int);
-  ANG_READER_ALLOCATE_AND_READ(XPosition, EbsdLib::Ang::XPosition, float);
-  ANG_READER_ALLOCATE_AND_READ(YPosition, EbsdLib::Ang::YPosition, float);
-  ANG_READER_ALLOCATE_AND_READ(Fit, EbsdLib::Ang::Fit, float);
+  ANG_READER_ALLOCATE_AND_READ_ROWS(Phi1, EbsdLib::Ang::Phi1, float, readColumns, readRowStart, readRowCount, m_ChunkCacheSize);
+  ANG_READER_ALLOCATE_AND_READ_ROWS(Phi, EbsdLib::Ang::Phi, float, readColumns, readRowStart, readRowCount, m_ChunkCacheSize);
+  ANG_READER_ALLOCATE_AND_READ_ROWS(Phi2, EbsdLib::Ang::Phi2, float, readColumns, readRowStart, readRowCount, m_ChunkCacheSize);
+  ANG_READER_ALLOCATE_AND_READ_ROWS(ImageQuality, EbsdLib::Ang::ImageQuality, float, readColumns, readRowStart, readRowCount, m_ChunkCacheSize);
+  ANG_READER_ALLOCATE_AND_READ_ROWS(ConfidenceIndex, EbsdLib::Ang::ConfidenceIndex, float, readColumns, readRowStart, readRowCount, m_ChunkCacheSize);
+  ANG_READER_ALLOCATE_AND_READ_ROWS(PhaseData, EbsdLib::Ang::PhaseData, int, readColumns, readRowStart, readRowCount, m_ChunkCacheSize);
+  ANG_READER_ALLOCATE_AND_READ_ROWS(XPosition, EbsdLib::Ang::XPosition, float, readColumns, readRowStart, readRowCount, m_ChunkCacheSize);
+  ANG_READER_ALLOCATE_AND_READ_ROWS(YPosition, EbsdLib::Ang::YPosition, float, readColumns, readRowStart, readRowCount, m_ChunkCacheSize);
+  ANG_READER_ALLOCATE_AND_READ_ROWS(Fit, EbsdLib::Ang::Fit, float, readColumns, readRowStart, readRowCount, m_ChunkCacheSize);
   if(err < 0)
   {
     setNumFeatures(9);
   }
 
-  ANG_READER_ALLOCATE_AND_READ(SEMSignal, EbsdLib::Ang::SEMSignal, float);
+  ANG_READER_ALLOCATE_AND_READ_ROWS(SEMSignal, EbsdLib::Ang::SEMSignal, float, readColumns, readRowStart, readRowCount, m_ChunkCacheSize);
   if(err < 0)
   {
     setNumFeatures(8);
   }
 
+  if(readRowCount != nRows)
+  {
+    setNumRows(static_cast<int>(readRowCount));
+  }
   err = H5Gclose(gid);
 
   return err;
@@ -423,6 +447,19 @@ void H5AngReader::readAllArrays(bool b)
   m_ReadAllArrays = b;
 }
 
+// -----------------------------------------------------------------------------
+void H5AngReader::setReadRowRange(size_t rowStart, size_t rowCount)
+{
+  m_ReadRowStart = rowStart;
+  m_ReadRowCount = rowCount;
+}
+
+// -----------------------------------------------------------------------------
+void H5AngReader::setChunkCacheSize(size_t bytes)
+{
+  m_ChunkCacheSize = bytes;
+}
+
 // -----------------------------------------------------------------------------
 H5AngReader::Pointer H5AngReader::NullPointer()
 {
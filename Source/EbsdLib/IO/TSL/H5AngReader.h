@@ -138,6 +138,12 @@ public:
    */
   int readFile() override;
 
+  /**
+   * @brief Reads the complete slice with readFile() and hands it over in windows of scan rows, see
+   * EbsdReader::readFileInRowWindows().
+   */
+  int readFileInRowWindows(size_t rowsPerWindow, const RowWindowCallback& callback) override;
+
   /**
    * @brief Reads the header section of the file
    * @param Valid HDF5 Group ID
@@ -173,6 +179,20 @@ public:
    */
   void readAllArrays(bool b);
 
+  /**
+   * @brief Restricts the data arrays that are read to the scan rows [rowStart, rowStart + rowCount). The rows
+   * are read with a hyperslab so only the chunks that hold them are read from chunked files. After reading,
+   * NumRows holds the number of rows that were read. Hex grid scans are not supported and are rejected.
+   * @param rowStart The first scan row
+   * @param rowCount The number of scan rows. 0 reads up to the last row.
+   */
+  void setReadRowRange(size_t rowStart, size_t rowCount);
+
+  /**
+   * @brief Sets the size in bytes of the chunk cache used for each data array. 0 keeps the HDF5 default.
+   */
+  void setChunkCacheSize(size_t bytes);
+
 protected:
   H5AngReader();
 
@@ -196,6 +216,9 @@ private:
   std::vector<AngPhase::Pointer> m_Phases;
   std::set<std::string> m_ArrayNames;
   bool m_ReadAllArrays;
+  size_t m_ReadRowStart = 0;
+  size_t m_ReadRowCount = 0;
+  size_t m_ChunkCacheSize = 0;
 
 public:
   H5AngReader(const H5AngReader&) = delete;            // Copy Constructor Not Implemented
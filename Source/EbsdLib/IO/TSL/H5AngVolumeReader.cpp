@@ -38,10 +38,15 @@
 
 #include <string>
 
+#ifdef EbsdLib_USE_PARALLEL_ALGORITHMS
+#include <tbb/task_group.h>
+#endif
+
 #include "H5Support/H5Lite.h"
 #include "H5Support/H5Utilities.h"
 
 #include "EbsdLib/Core/EbsdLibConstants.h"
+#include "EbsdLib/IO/H5EbsdSliceCopier.hpp"
 #include "EbsdLib/IO/TSL/H5AngReader.h"
 
 using namespace H5Support;
@@ -261,26 +266,24 @@ std::vector<AngPhase::Pointer> H5AngVolumeReader::getPhases()
 // -----------------------------------------------------------------------------
 int H5AngVolumeReader::loadData(int64_t xpoints, int64_t ypoints, int64_t zpoints, uint32_t ZDir)
 {
-  int index = 0;
   int err = -1;
   // Initialize all the pointers
   initPointers(xpoints * ypoints * zpoints);
 
-  int readerIndex = 0;
-  int xpointsslice = 0;
-  int ypointsslice = 0;
-  int xpointstemp = 0;
-  int ypointstemp = 0;
-  int xstop = 0;
-  int ystop = 0;
-  int zval = 0;
-
-  int xstartspot = 0;
-  int ystartspot = 0;
   int numPhases = getNumPhases();
   err = readVolumeInfo();
-  for(int slice = 0; slice < zpoints; ++slice)
+  if(zpoints <= 0)
+  {
+    return err;
+  }
+
+  // If no stacking order preference was passed, read it from the file and use that value
+  if(ZDir == EbsdLib::RefFrameZDir::UnknownRefFrameZDirection)
   {
+    ZDir = getStackingOrder();
+  }
+
+  auto readSlice = [this](int64_t slice, int& sliceErr) {
     H5AngReader::Pointer reader = H5AngReader::New();
     reader->setFileName(getFileName());
     reader->setHDF5Path(EbsdStringUtils::number(slice + getSliceStart()));
@@ -291,16 +294,25 @@ int H5AngVolumeReader::loadData(int64_t xpoints, int64_t ypoints, int64_t zpoint
     reader->setEulerTransformationAxis(getEulerTransformationAxis());
     reader->readAllArrays(getReadAllArrays());
     reader->setArraysToRead(getArraysToRead());
-    err = reader->readFile();
-    if(err < 0)
+    reader->setReadRowRange(m_ReadRowStart, m_ReadRowCount);
+    reader->setChunkCacheSize(m_ChunkCacheSize);
+    sliceErr = reader->readFile();
+    return reader;
+  };
+
+  // Only one slice is ever read from the HDF5 file at a time. While slice N is
+  // copied into the volume the read of slice N+1 runs on its own task.
+  int sliceErr = 0;
+  H5AngReader::Pointer reader = readSlice(0, sliceErr);
+  for(int64_t slice = 0; slice < zpoints; ++slice)
+  {
+    if(sliceErr < 0)
     {
-      setErrorCode(reader->getErrorCode());
+      setErrorCode(reader->getErrorCode() < 0 ? reader->getErrorCode() : sliceErr);
       setErrorMessage(reader->getErrorMessage());
       return getErrorCode();
     }
-    readerIndex = 0;
-    xpointsslice = reader->getNumEvenCols();
-    ypointsslice = reader->getNumRows();
+    err = sliceErr;
     float* euler1Ptr = reader->getPhi1Pointer();
     if(nullptr == euler1Ptr)
     {
@@ -308,103 +320,83 @@ int H5AngVolumeReader::loadData(int64_t xpoints, int64_t ypoints, int64_t zpoint
       setErrorMessage("Euler1 Pointer was nullptr from Reader");
       return getErrorCode();
     }
-    float* euler2Ptr = reader->getPhiPointer();
-    float* euler3Ptr = reader->getPhi2Pointer();
-    float* xPtr = reader->getXPositionPointer();
-    float* yPtr = reader->getYPositionPointer();
-    float* iqPtr = reader->getImageQualityPointer();
-    float* ciPtr = reader->getConfidenceIndexPointer();
-    int* phasePtr = reader->getPhaseDataPointer();
-    float* sigPtr = reader->getSEMSignalPointer();
-    float* fitPtr = reader->getFitPointer();
-
-    xpointstemp = static_cast<int>(xpoints);
-    ypointstemp = static_cast<int>(ypoints);
-    xstartspot = (xpointstemp - xpointsslice) / 2;
-    ystartspot = (ypointstemp - ypointsslice) / 2;
-    xstop = xpointsslice;
-    ystop = ypointsslice;
 
-    // If no stacking order preference was passed, read it from the file and use that value
-    if(ZDir == EbsdLib::RefFrameZDir::UnknownRefFrameZDirection)
-    {
-      ZDir = getStackingOrder();
-    }
+    int64_t zval = 0;
     if(ZDir == EbsdLib::RefFrameZDir::LowtoHigh)
     {
       zval = slice;
     }
     if(ZDir == EbsdLib::RefFrameZDir::HightoLow)
     {
-      zval = static_cast<int>((zpoints - 1) - slice);
+      zval = (zpoints - 1) - slice;
     }
 
-    // Copy the data from the current storage into the new memory Location
-    for(int j = 0; j < ystop; j++)
+    H5EbsdSliceCopier copier(xpoints, ypoints, reader->getNumEvenCols(), reader->getNumRows(), zval);
+    copier.addArray(euler1Ptr, m_Phi1);
+    copier.addArray(reader->getPhiPointer(), m_Phi);
+    copier.addArray(reader->getPhi2Pointer(), m_Phi2);
+    copier.addArray(reader->getXPositionPointer(), m_X);
+    copier.addArray(reader->getYPositionPointer(), m_Y);
+    copier.addArray(reader->getImageQualityPointer(), m_Iq);
+    copier.addArray(reader->getConfidenceIndexPointer(), m_Ci);
+    copier.addArray(reader->getSEMSignalPointer(), m_SEMSignal);
+    copier.addArray(reader->getFitPointer(), m_Fit);
+    /* For TSL OIM Files if there is a single phase then the value of the phase
+     * data is zero (0). If there are 2 or more phases then the lowest value
+     * of phase is one (1). In the rest of the reconstruction code we follow the
+     * convention that the lowest value is One (1) even if there is only a single
+     * phase. The single phase case converts all zeros to ones while copying.
+     */
+    if(numPhases == 1)
     {
-      for(int i = 0; i < xstop; i++)
-      {
-        index = (zval * xpointstemp * ypointstemp) + ((j + ystartspot) * xpointstemp) + (i + xstartspot);
-        if(nullptr != euler1Ptr)
-        {
-          m_Phi1[index] = euler1Ptr[readerIndex];
-        }
-        if(nullptr != euler2Ptr)
-        {
-          m_Phi[index] = euler2Ptr[readerIndex];
-        }
-        if(nullptr != euler3Ptr)
-        {
-          m_Phi2[index] = euler3Ptr[readerIndex];
-        }
-        if(nullptr != xPtr)
-        {
-          m_X[index] = xPtr[readerIndex];
-        }
-        if(nullptr != yPtr)
-        {
-          m_Y[index] = yPtr[readerIndex];
-        }
-        if(nullptr != iqPtr)
-        {
-          m_Iq[index] = iqPtr[readerIndex];
-        }
-        if(nullptr != ciPtr)
-        {
-          m_Ci[index] = ciPtr[readerIndex];
-        }
-        if(nullptr != phasePtr)
-        {
-          m_PhaseData[index] = phasePtr[readerIndex];
-        } // Phase
-        if(nullptr != sigPtr)
-        {
-          m_SEMSignal[index] = sigPtr[readerIndex];
-        }
-        if(nullptr != fitPtr)
-        {
-          m_Fit[index] = fitPtr[readerIndex];
-        }
-
-        /* For TSL OIM Files if there is a single phase then the value of the phase
-         * data is zero (0). If there are 2 or more phases then the lowest value
-         * of phase is one (1). In the rest of the reconstruction code we follow the
-         * convention that the lowest value is One (1) even if there is only a single
-         * phase. The next if statement converts all zeros to ones if there is a single
-         * phase in the OIM data.
-         */
-        if(numPhases == 1 && nullptr != phasePtr && m_PhaseData[index] < 1)
-        {
-          m_PhaseData[index] = 1;
-        }
+      copier.addArrayWithMinimum(reader->getPhaseDataPointer(), m_PhaseData, 1);
+    }
+    else
+    {
+      copier.addArray(reader->getPhaseDataPointer(), m_PhaseData);
+    }
 
-        ++readerIndex;
-      }
+    H5AngReader::Pointer nextReader;
+    int nextErr = 0;
+    bool readNext = (slice + 1 < zpoints);
+#ifdef EbsdLib_USE_PARALLEL_ALGORITHMS
+    bool doParallel = true;
+    if(doParallel && readNext)
+    {
+      std::shared_ptr<tbb::task_group> g(new tbb::task_group);
+      g->run([&] { nextReader = readSlice(slice + 1, nextErr); });
+      copier.copy();
+      g->wait(); // Wait for the next slice to finish reading before moving on.
+      readNext = false;
+    }
+    else
+#endif
+    {
+      copier.copy();
     }
+    if(readNext)
+    {
+      nextReader = readSlice(slice + 1, nextErr);
+    }
+    reader = nextReader;
+    sliceErr = nextErr;
   }
   return err;
 }
 
+// -----------------------------------------------------------------------------
+void H5AngVolumeReader::setReadRowRange(size_t rowStart, size_t rowCount)
+{
+  m_ReadRowStart = rowStart;
+  m_ReadRowCount = rowCount;
+}
+
+// -----------------------------------------------------------------------------
+void H5AngVolumeReader::setChunkCacheSize(size_t bytes)
+{
+  m_ChunkCacheSize = bytes;
+}
+
 // -----------------------------------------------------------------------------
 H5AngVolumeReader::Pointer H5AngVolumeReader::NullPointer()
 {
@@ -89,6 +89,19 @@ public:
    */
   int loadData(int64_t xpoints, int64_t ypoints, int64_t zpoints, uint32_t ZDir) override;
 
+  /**
+   * @brief Restricts loadData() to the scan rows [rowStart, rowStart + rowCount) of every slice. Only those rows
+   * are read from the file, so ypoints passed to loadData() should be the number of rows in the range.
+   * @param rowStart The first scan row
+   * @param rowCount The number of scan rows. 0 reads up to the last row.
+   */
+  void setReadRowRange(size_t rowStart, size_t rowCount);
+
+  /**
+   * @brief Sets the size in bytes of the chunk cache used for each data array. 0 keeps the HDF5 default.
+   */
+  void setChunkCacheSize(size_t bytes);
+
   /**
    * @brief
    * @return
@@ -121,6 +134,9 @@ protected:
 
 private:
   std::vector<AngPhase::Pointer> m_Phases;
+  size_t m_ReadRowStart = 0;
+  size_t m_ReadRowCount = 0;
+  size_t m_ChunkCacheSize = 0;
 
 public:
   H5AngVolumeReader(const H5AngVolumeReader&) = delete;            // Copy Constructor Not Implemented
@@ -50,6 +50,7 @@
 
 #include "EbsdLib/Core/EbsdLibConstants.h"
 #include "EbsdLib/Core/EbsdMacros.h"
+#include "EbsdLib/IO/H5EbsdChunkedIO.h"
 #include "EbsdLib/Utilities/EbsdStringUtils.hpp"
 
 using namespace H5Support;
@@ -92,6 +93,15 @@ H5OIMReader::~H5OIMReader()
   this->deallocateArrayData<uint8_t>(m_PatternData);
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int H5OIMReader::readFileInRowWindows(size_t rowsPerWindow, const RowWindowCallback& callback)
+{
+  // The text parser of the base class does not apply to HDF5 files
+  return EbsdReader::readFileInRowWindows(rowsPerWindow, callback);
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -587,6 +597,19 @@ int H5OIMReader::readData(hid_t parId)
     return -301;
   }
 
+  // Only the requested scan rows are read from the data arrays. Hex grids, whose rows alternate between
+  // NumOddCols and NumEvenCols, were rejected above so every row holds nColumns points.
+  size_t readColumns = nColumns;
+  size_t readRowStart = m_ReadRowStart;
+  size_t readRowCount = (m_ReadRowCount == 0 && readRowStart < nRows) ? nRows - readRowStart : m_ReadRowCount;
+  if(readRowCount == 0 || readRowStart + readRowCount > nRows)
+  {
+    setErrorCode(-90302);
+    setErrorMessage("The requested row range is outside of the scan.");
+    return -302;
+  }
+  totalDataRows = readColumns * readRowCount;
+
   hid_t gid = H5Gopen(parId, EbsdLib::H5OIM::Data.c_str(), H5P_DEFAULT);
   if(gid < 0)
   {
@@ -595,7 +618,6 @@ int H5OIMReader::readData(hid_t parId)
     return -90012;
   }
   setNumberOfElements(totalDataRows);
-  size_t numBytes = totalDataRows * sizeof(float);
   std::string sBuf;
   std::stringstream ss(sBuf);
 
@@ -608,22 +630,22 @@ int H5OIMReader::readData(hid_t parId)
     return err;
   }
 
-  ANG_READER_ALLOCATE_AND_READ(Phi1, EbsdLib::Ang::Phi1, float);
-  ANG_READER_ALLOCATE_AND_READ(Phi, EbsdLib::Ang::Phi, float);
-  ANG_READER_ALLOCATE_AND_READ(Phi2, EbsdLib::Ang::Phi2, float);
-  ANG_READER_ALLOCATE_AND_READ(ImageQuality, EbsdLib::Ang::IQ, float);
-  ANG_READER_ALLOCATE_AND_READ(ConfidenceIndex, EbsdLib::Ang::CI, float);
-  ANG_READER_ALLOCATE_AND_READ(PhaseData, EbsdLib::Ang::Phase, int);
-  ANG_READER_ALLOCATE_AND_READ(XPosition, EbsdLib::Ang::XPosition, float);
-  ANG_READER_ALLOCATE_AND_READ(YPosition, EbsdLib::Ang::YPosition, float);
-  ANG_READER_ALLOCATE_AND_READ(Fit, EbsdLib::Ang::Fit, float);
+  ANG_READER_ALLOCATE_AND_READ_ROWS(Phi1, EbsdLib::Ang::Phi1, float, readColumns, readRowStart, readRowCount, m_ChunkCacheSize);
+  ANG_READER_ALLOCATE_AND_READ_ROWS(Phi, EbsdLib::Ang::Phi, float, readColumns, readRowStart, readRowCount, m_ChunkCacheSize);
+  ANG_READER_ALLOCATE_AND_READ_ROWS(Phi2, EbsdLib::Ang::Phi2, float, readColumns, readRowStart, readRowCount, m_ChunkCacheSize);
+  ANG_READER_ALLOCATE_AND_READ_ROWS(ImageQuality, EbsdLib::Ang::IQ, float, readColumns, readRowStart, readRowCount, m_ChunkCacheSize);
+  ANG_READER_ALLOCATE_AND_READ_ROWS(ConfidenceIndex, EbsdLib::Ang::CI, float, readColumns, readRowStart, readRowCount, m_ChunkCacheSize);
+  ANG_READER_ALLOCATE_AND_READ_ROWS(PhaseData, EbsdLib::Ang::Phase, int, readColumns, readRowStart, readRowCount, m_ChunkCacheSize);
+  ANG_READER_ALLOCATE_AND_READ_ROWS(XPosition, EbsdLib::Ang::XPosition, float, readColumns, readRowStart, readRowCount, m_ChunkCacheSize);
+  ANG_READER_ALLOCATE_AND_READ_ROWS(YPosition, EbsdLib::Ang::YPosition, float, readColumns, readRowStart, readRowCount, m_ChunkCacheSize);
+  ANG_READER_ALLOCATE_AND_READ_ROWS(Fit, EbsdLib::Ang::Fit, float, readColumns, readRowStart, readRowCount, m_ChunkCacheSize);
 
   if(err < 0)
   {
     setNumFeatures(9);
   }
 
-  ANG_READER_ALLOCATE_AND_READ(SEMSignal, EbsdLib::Ang::SEMSignal, float);
+  ANG_READER_ALLOCATE_AND_READ_ROWS(SEMSignal, EbsdLib::Ang::SEMSignal, float, readColumns, readRowStart, readRowCount, m_ChunkCacheSize);
   if(err < 0)
   {
     setNumFeatures(8);
@@ -637,6 +659,8 @@ int H5OIMReader::readData(hid_t parId)
     err = H5Lite::getDatasetInfo(gid, EbsdLib::Ang::PatternData, dims, type_class, type_size);
     if(err >= 0) // Only read the pattern data if the pattern data is available.
     {
+      // The patterns of the requested scan rows are read, so the first dimension is replaced by the number of points read
+      dims[0] = readColumns * readRowCount;
       totalDataRows = 1; // Calculate the total number of elements to allocate for the pattern data
       for(unsigned long long dim : dims)
       {
@@ -646,10 +670,14 @@ int H5OIMReader::readData(hid_t parId)
       m_PatternDims[0] = static_cast<int>(dims[1]);
       m_PatternDims[1] = static_cast<int>(dims[2]);
 
-      m_PatternData = this->allocateArray<uint8_t>(totalDataRows);
-      err = H5Lite::readPointerDataset(gid, EbsdLib::Ang::PatternData, m_PatternData);
+      m_PatternData = this->allocateArray<uint8_t>(totalDataRows, false);
+      err = H5EbsdChunkedIO::ReadRows(gid, EbsdLib::Ang::PatternData, readColumns, readRowStart, readRowCount, m_ChunkCacheSize, m_PatternData);
     }
   }
+  if(readRowCount != nRows)
+  {
+    setNumRows(static_cast<int>(readRowCount));
+  }
   err = H5Gclose(gid);
 
   return err;
@@ -671,6 +699,19 @@ void H5OIMReader::readAllArrays(bool b)
   m_ReadAllArrays = b;
 }
 
+// -----------------------------------------------------------------------------
+void H5OIMReader::setReadRowRange(size_t rowStart, size_t rowCount)
+{
+  m_ReadRowStart = rowStart;
+  m_ReadRowCount = rowCount;
+}
+
+// -----------------------------------------------------------------------------
+void H5OIMReader::setChunkCacheSize(size_t bytes)
+{
+  m_ChunkCacheSize = bytes;
+}
+
 // -----------------------------------------------------------------------------
 H5OIMReader::Pointer H5OIMReader::NullPointer()
 {
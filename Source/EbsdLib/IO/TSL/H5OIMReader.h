@@ -138,6 +138,12 @@ public:
    */
   int readFile() override;
 
+  /**
+   * @brief Reads the complete slice with readFile() and hands it over in windows of scan rows, see
+   * EbsdReader::readFileInRowWindows().
+   */
+  int readFileInRowWindows(size_t rowsPerWindow, const RowWindowCallback& callback) override;
+
   /**
    * @brief readScanNames
    * @return
@@ -176,6 +182,21 @@ public:
    */
   void readAllArrays(bool b);
 
+  /**
+   * @brief Restricts the data arrays that are read to the scan rows [rowStart, rowStart + rowCount). The rows
+   * are read with a hyperslab so only the chunks that hold them are read from chunked files. After reading,
+   * NumRows holds the number of rows that were read. The pattern data is restricted to the same rows. Hex grid
+   * scans are not supported and are rejected.
+   * @param rowStart The first scan row
+   * @param rowCount The number of scan rows. 0 reads up to the last row.
+   */
+  void setReadRowRange(size_t rowStart, size_t rowCount);
+
+  /**
+   * @brief Sets the size in bytes of the chunk cache used for each data array. 0 keeps the HDF5 default.
+   */
+  void setChunkCacheSize(size_t bytes);
+
 protected:
   H5OIMReader();
 
@@ -198,6 +219,9 @@ private:
 
   std::set<std::string> m_ArrayNames;
   bool m_ReadAllArrays = true;
+  size_t m_ReadRowStart = 0;
+  size_t m_ReadRowCount = 0;
+  size_t m_ChunkCacheSize = 0;
 
 public:
   H5OIMReader(const H5OIMReader&) = delete;            // Copy Constructor Not Implemented
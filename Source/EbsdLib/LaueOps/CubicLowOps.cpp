@@ -49,7 +49,6 @@
 #include "EbsdLib/Core/Orientation.hpp"
 #include "EbsdLib/Math/EbsdLibMath.h"
 #include "EbsdLib/Utilities/ColorTable.h"
-#include "EbsdLib/Utilities/ComputeStereographicProjection.h"
 #include "EbsdLib/Utilities/ModifiedLambertProjection.h"
 
 namespace CubicLow
@@ -69,16 +68,14 @@ static const int symSize2 = 8;
 static const int k_OdfSize = 46656;
 static const int k_MdfSize = 46656;
 static const int k_SymOpsCount = 12;
+static_assert(k_SymOpsCount == CubicLowOps::SymmetryGroupType::k_SymOpsCount, "Symmetry operator count does not match the SymmetryGroup");
 static const int k_NumMdfBins = 18;
 
-static const std::vector<QuatD> QuatSym = {
-    QuatD(0.000000000, 0.000000000, 0.000000000, 1.000000000),   QuatD(1.000000000, 0.000000000, 0.000000000, 0.000000000),   QuatD(0.000000000, 1.000000000, 0.000000000, 0.000000000),
-    QuatD(0.000000000, 0.000000000, 1.000000000, 0.000000000),   QuatD(0.500000000, 0.500000000, 0.500000000, 0.500000000),   QuatD(-0.500000000, -0.500000000, -0.500000000, 0.500000000),
-    QuatD(0.500000000, -0.500000000, 0.500000000, 0.500000000),  QuatD(-0.500000000, 0.500000000, -0.500000000, 0.500000000), QuatD(-0.500000000, 0.500000000, 0.500000000, 0.500000000),
-    QuatD(0.500000000, -0.500000000, -0.500000000, 0.500000000), QuatD(-0.500000000, -0.500000000, 0.500000000, 0.500000000), QuatD(0.500000000, 0.500000000, -0.500000000, 0.500000000)};
+static const std::vector<QuatD> QuatSym = CubicLowOps::SymmetryGroupType::QuatSymVector();
 
-static const std::vector<OrientationD> RodSym = {{0.0, 0.0, 0.0},  {10000000000.0, 0.0, 0.0}, {0.0, 10000000000.0, 0.0}, {0.0, 0.0, 10000000000.0}, {1.0, 1.0, 1.0},   {-1.0, -1.0, -1.0},
-                                                 {1.0, -1.0, 1.0}, {-1.0, 1.0, -1.0},         {-1.0, 1.0, 1.0},          {1.0, -1.0, -1.0},         {-1.0, -1.0, 1.0}, {1.0, 1.0, -1.0}};
+static const QuatSymmetrySoA QuatSymSoA(QuatSym);
+
+static const std::vector<OrientationD> RodSym = CubicLowOps::SymmetryGroupType::RodSymVector();
 
 // static const double CubicLowSlipDirections[12][3] = {{0.0, 1.0, -1.0},
 //  {1.0, 0.0, -1.0},
@@ -108,29 +105,7 @@ static const std::vector<OrientationD> RodSym = {{0.0, 0.0, 0.0},  {10000000000.
 //  { -1.0, 1.0, 1.0}
 //};
 
-static const double MatSym[k_SymOpsCount][3][3] = {{{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}},
-
-                                                   {{1.0, 0.0, 0.0}, {0.0, -1.0, 0.0}, {0.0, 0.0, -1.0}},
-
-                                                   {{-1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, -1.0}},
-
-                                                   {{-1.0, 0.0, 0.0}, {0.0, -1.0, 0.0}, {0.0, 0.0, 1.0}},
-
-                                                   {{0.0, -1.0, 0.0}, {0.0, 0.0, 1.0}, {-1.0, 0.0, 0.0}},
-
-                                                   {{0.0, 0.0, 1.0}, {-1.0, 0.0, 0.0}, {0.0, -1.0, 0.0}},
-
-                                                   {{0.0, -1.0, 0.0}, {0.0, 0.0, -1.0}, {1.0, 0.0, 0.0}},
-
-                                                   {{0.0, 0.0, -1.0}, {1.0, 0.0, 0.0}, {0.0, -1.0, 0.0}},
-
-                                                   {{0.0, 1.0, 0.0}, {0.0, 0.0, -1.0}, {-1.0, 0.0, 0.0}},
-
-                                                   {{0.0, 0.0, -1.0}, {-1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}},
-
-                                                   {{0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}, {1.0, 0.0, 0.0}},
-
-                                                   {{0.0, 0.0, 1.0}, {1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}}};
+static constexpr const std::array<SymMatType, k_SymOpsCount>& MatSym = CubicLowOps::SymmetryGroupType::MatSym;
 } // namespace CubicLow
 
 // -----------------------------------------------------------------------------
@@ -204,19 +179,9 @@ std::string CubicLowOps::getSymmetryName() const
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-OrientationD CubicLowOps::calculateMisorientation(const QuatD& q1, const QuatD& q2) const
+void CubicLowOps::calculateMisorientation(const QuatD& q1, const QuatD& q2, AxisAngleD& axisAngle) const
 {
-  return calculateMisorientationInternal(CubicLow::QuatSym, q1, q2);
-}
-
-// -----------------------------------------------------------------------------
-OrientationF CubicLowOps::calculateMisorientation(const QuatF& q1f, const QuatF& q2f) const
-
-{
-  QuatD q1 = q1f.to<double>();
-  QuatD q2 = q2f.to<double>();
-  OrientationD axisAngle = calculateMisorientationInternal(CubicLow::QuatSym, q1, q2);
-  return axisAngle;
+  axisAngle = calculateMisorientationInternal(CubicLow::QuatSymSoA, q1, q2);
 }
 
 QuatD CubicLowOps::getQuatSymOp(int32_t i) const
@@ -273,7 +238,7 @@ void CubicLowOps::getMatSymOp(int i, float g[3][3]) const
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-OrientationType CubicLowOps::getODFFZRod(const OrientationType& rod) const
+RodriguesD CubicLowOps::getODFFZRod(const RodriguesD& rod) const
 {
   return _calcRodNearestOrigin(CubicLow::RodSym, rod);
 }
@@ -281,13 +246,13 @@ OrientationType CubicLowOps::getODFFZRod(const OrientationType& rod) const
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-OrientationType CubicLowOps::getMDFFZRod(const OrientationType& inRod) const
+RodriguesD CubicLowOps::getMDFFZRod(const RodriguesD& inRod) const
 {
   double w = 0.0, n1 = 0.0, n2 = 0.0, n3 = 0.0;
   double FZn1 = 0.0, FZn2 = 0.0, FZn3 = 0.0, FZw = 0.0;
 
-  OrientationType rod = _calcRodNearestOrigin(CubicLow::RodSym, inRod);
-  OrientationType ax = OrientationTransformation::ro2ax<OrientationType, OrientationType>(rod);
+  RodriguesD rod = _calcRodNearestOrigin(CubicLow::RodSym, inRod);
+  AxisAngleD ax = OrientationTransformation::ro2ax(rod);
 
   n1 = ax[0];
   n2 = ax[1], n3 = ax[2], w = ax[3];
@@ -335,29 +300,43 @@ OrientationType CubicLowOps::getMDFFZRod(const OrientationType& inRod) const
     }
   }
 
-  return OrientationTransformation::ax2ro<OrientationType, OrientationType>(OrientationType(FZn1, FZn2, FZn3, FZw));
+  return OrientationTransformation::ax2ro(AxisAngleD(FZn1, FZn2, FZn3, FZw));
 }
 
 QuatD CubicLowOps::getNearestQuat(const QuatD& q1, const QuatD& q2) const
 {
-  return _calcNearestQuat(CubicLow::QuatSym, q1, q2);
+  return _calcNearestQuat(CubicLow::QuatSymSoA, q1, q2);
 }
 
 QuatF CubicLowOps::getNearestQuat(const QuatF& q1f, const QuatF& q2f) const
 {
-  return _calcNearestQuat(CubicLow::QuatSym, q1f.to<double>(), q2f.to<double>()).to<float>();
+  return _calcNearestQuat(CubicLow::QuatSymSoA, q1f.to<double>(), q2f.to<double>()).to<float>();
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-int CubicLowOps::getMisoBin(const OrientationType& rod) const
+QuatD CubicLowOps::getFZQuat(const QuatD& qr) const
+{
+  return _calcQuatNearestOrigin(CubicLow::QuatSymSoA, qr);
+}
+
+// -----------------------------------------------------------------------------
+const QuatSymmetrySoA& CubicLowOps::getQuatSymmetrySoA() const
+{
+  return CubicLow::QuatSymSoA;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int CubicLowOps::getMisoBin(const RodriguesD& rod) const
 {
   double dim[3];
   double bins[3];
   double step[3];
 
-  OrientationType ho = OrientationTransformation::ro2ho<OrientationType, OrientationType>(rod);
+  HomochoricD ho = OrientationTransformation::ro2ho(rod);
 
   dim[0] = CubicLow::OdfDimInitValue[0];
   dim[1] = CubicLow::OdfDimInitValue[1];
@@ -375,7 +354,7 @@ int CubicLowOps::getMisoBin(const OrientationType& rod) const
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-OrientationType CubicLowOps::determineEulerAngles(double random[3], int choose) const
+void CubicLowOps::determineEulerAngles(double random[3], int choose, EulerD& euler) const
 {
   double init[3];
   double step[3];
@@ -394,28 +373,27 @@ OrientationType CubicLowOps::determineEulerAngles(double random[3], int choose)
 
   _calcDetermineHomochoricValues(random, init, step, phi, h1, h2, h3);
 
-  OrientationType ho(h1, h2, h3);
-  OrientationType ro = OrientationTransformation::ho2ro<OrientationType, OrientationType>(ho);
+  HomochoricD ho(h1, h2, h3);
+  RodriguesD ro = OrientationTransformation::ho2ro(ho);
   ro = getODFFZRod(ro);
-  OrientationType eu = OrientationTransformation::ro2eu<OrientationType, OrientationType>(ro);
-  return eu;
+  euler = OrientationTransformation::ro2eu(ro);
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-OrientationType CubicLowOps::randomizeEulerAngles(const OrientationType& synea) const
+EulerD CubicLowOps::randomizeEulerAngles(const EulerD& synea) const
 {
   size_t symOp = getRandomSymmetryOperatorIndex(CubicLow::k_SymOpsCount);
-  QuatD quat = OrientationTransformation::eu2qu<OrientationType, QuatD>(synea);
+  QuatD quat = OrientationTransformation::eu2qu(synea);
   QuatD qc = CubicLow::QuatSym[symOp] * quat;
-  return OrientationTransformation::qu2eu<QuatD, OrientationType>(qc);
+  return OrientationTransformation::qu2eu(qc);
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-OrientationType CubicLowOps::determineRodriguesVector(double random[3], int choose) const
+void CubicLowOps::determineRodriguesVector(double random[3], int choose, RodriguesD& rod) const
 {
   double init[3];
   double step[3];
@@ -433,22 +411,21 @@ OrientationType CubicLowOps::determineRodriguesVector(double random[3], int choo
   phi[2] = static_cast<int32_t>(choose / (CubicLow::OdfNumBins[0] * CubicLow::OdfNumBins[1]));
 
   _calcDetermineHomochoricValues(random, init, step, phi, h1, h2, h3);
-  OrientationType ho(h1, h2, h3);
-  OrientationType ro = OrientationTransformation::ho2ro<OrientationType, OrientationType>(ho);
-  ro = getMDFFZRod(ro);
-  return ro;
+  HomochoricD ho(h1, h2, h3);
+  RodriguesD ro = OrientationTransformation::ho2ro(ho);
+  rod = getMDFFZRod(ro);
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-int CubicLowOps::getOdfBin(const OrientationType& rod) const
+int CubicLowOps::getOdfBin(const RodriguesD& rod) const
 {
   double dim[3];
   double bins[3];
   double step[3];
 
-  OrientationType ho = OrientationTransformation::ro2ho<OrientationType, OrientationType>(rod);
+  HomochoricD ho = OrientationTransformation::ro2ho(rod);
 
   dim[0] = CubicLow::OdfDimInitValue[0];
   dim[1] = CubicLow::OdfDimInitValue[1];
@@ -567,8 +544,8 @@ public:
 
     for(size_t i = start; i < end; ++i)
     {
-      OrientationType eu(m_Eulers->getValue(i * 3), m_Eulers->getValue(i * 3 + 1), m_Eulers->getValue(i * 3 + 2));
-      EbsdLib::Matrix3X3D g(OrientationTransformation::eu2om<OrientationType, OrientationType>(eu).data());
+      EulerD eu(m_Eulers->getValue(i * 3), m_Eulers->getValue(i * 3 + 1), m_Eulers->getValue(i * 3 + 2));
+      EbsdLib::Matrix3X3D g(OrientationTransformation::eu2om(eu).data());
 
       gTranspose = g.transpose();
 
@@ -881,14 +858,13 @@ EbsdLib::Rgb CubicLowOps::generateIPFColor(double phi1, double phi, double phi2,
   double eta = 0.0f;
   double _rgb[3] = {0.0, 0.0, 0.0};
 
-  OrientationType eu(phi1, phi, phi2);
-  OrientationType om(9); // Reusable for the loop
-  QuatD q1 = OrientationTransformation::eu2qu<OrientationType, QuatD>(eu);
+  EulerD eu(phi1, phi, phi2);
+  QuatD q1 = OrientationTransformation::eu2qu(eu);
 
   for(int j = 0; j < CubicLow::k_SymOpsCount; j++)
   {
     QuatD qu = getQuatSymOp(j) * q1;
-    EbsdLib::Matrix3X3D g(OrientationTransformation::qu2om<QuatD, OrientationType>(qu).data());
+    EbsdLib::Matrix3X3D g(OrientationTransformation::qu2om(qu).data());
     EbsdLib::Matrix3X1D p = (g * refDirection).normalize();
 
     if(!getHasInversion() && p[2] < 0)
@@ -988,48 +964,14 @@ std::vector<EbsdLib::UInt8ArrayType::Pointer> CubicLowOps::generatePoleFigure(Po
     label2 = config.labels.at(2);
   }
 
-  size_t numOrientations = config.eulers->getNumberOfTuples();
-
-  // Create an Array to hold the XYZ Coordinates which are the coords on the sphere.
-  // this is size for CUBIC ONLY, <001> Family
-  std::vector<size_t> dims(1, 3);
-  EbsdLib::FloatArrayType::Pointer xyz001 = EbsdLib::FloatArrayType::CreateArray(numOrientations * CubicLow::symSize0, dims, label0 + std::string("xyzCoords"), true);
-  // this is size for CUBIC ONLY, <011> Family
-  EbsdLib::FloatArrayType::Pointer xyz011 = EbsdLib::FloatArrayType::CreateArray(numOrientations * CubicLow::symSize1, dims, label1 + std::string("xyzCoords"), true);
-  // this is size for CUBIC ONLY, <111> Family
-  EbsdLib::FloatArrayType::Pointer xyz111 = EbsdLib::FloatArrayType::CreateArray(numOrientations * CubicLow::symSize2, dims, label2 + std::string("xyzCoords"), true);
-
   config.sphereRadius = 1.0f;
 
-  // Generate the coords on the sphere **** Parallelized
-  generateSphereCoordsFromEulers(config.eulers, xyz001.get(), xyz011.get(), xyz111.get());
-
-  // These arrays hold the "intensity" images which eventually get converted to an actual Color RGB image
-  // Generate the modified Lambert projection images (Squares, 2 of them, 1 for northern hemisphere, 1 for southern hemisphere
-  EbsdLib::DoubleArrayType::Pointer intensity001 = EbsdLib::DoubleArrayType::CreateArray(config.imageDim * config.imageDim, label0 + "_Intensity_Image", true);
-  EbsdLib::DoubleArrayType::Pointer intensity011 = EbsdLib::DoubleArrayType::CreateArray(config.imageDim * config.imageDim, label1 + "_Intensity_Image", true);
-  EbsdLib::DoubleArrayType::Pointer intensity111 = EbsdLib::DoubleArrayType::CreateArray(config.imageDim * config.imageDim, label2 + "_Intensity_Image", true);
-#ifdef EbsdLib_USE_PARALLEL_ALGORITHMS
-  bool doParallel = true;
-
-  if(doParallel)
-  {
-    std::shared_ptr<tbb::task_group> g(new tbb::task_group);
-    g->run(ComputeStereographicProjection(xyz001.get(), &config, intensity001.get()));
-    g->run(ComputeStereographicProjection(xyz011.get(), &config, intensity011.get()));
-    g->run(ComputeStereographicProjection(xyz111.get(), &config, intensity111.get()));
-    g->wait(); // Wait for all the threads to complete before moving on.
-  }
-  else
-#endif
-  {
-    ComputeStereographicProjection m001(xyz001.get(), &config, intensity001.get());
-    m001();
-    ComputeStereographicProjection m011(xyz011.get(), &config, intensity011.get());
-    m011();
-    ComputeStereographicProjection m111(xyz111.get(), &config, intensity111.get());
-    m111();
-  }
+  // Generate the coords on the sphere block by block and add them straight into the modified Lambert projection
+  // squares, then create the "intensity" images which eventually get converted to an actual Color RGB image **** Parallelized
+  std::array<EbsdLib::DoubleArrayType::Pointer, 3> intensities = generatePoleFigureIntensities(config, {label0 + "_Intensity_Image", label1 + "_Intensity_Image", label2 + "_Intensity_Image"});
+  EbsdLib::DoubleArrayType::Pointer intensity001 = intensities[0];
+  EbsdLib::DoubleArrayType::Pointer intensity011 = intensities[1];
+  EbsdLib::DoubleArrayType::Pointer intensity111 = intensities[2];
 
   // Find the Max and Min values based on ALL 3 arrays so we can color scale them all the same
   double max = std::numeric_limits<double>::min();
@@ -1080,7 +1022,7 @@ std::vector<EbsdLib::UInt8ArrayType::Pointer> CubicLowOps::generatePoleFigure(Po
   config.minScale = min;
   config.maxScale = max;
 
-  dims[0] = 4;
+  std::vector<size_t> dims(1, 4);
   EbsdLib::UInt8ArrayType::Pointer image001 = EbsdLib::UInt8ArrayType::CreateArray(config.imageDim * config.imageDim, dims, label0, true);
   EbsdLib::UInt8ArrayType::Pointer image011 = EbsdLib::UInt8ArrayType::CreateArray(config.imageDim * config.imageDim, dims, label1, true);
   EbsdLib::UInt8ArrayType::Pointer image111 = EbsdLib::UInt8ArrayType::CreateArray(config.imageDim * config.imageDim, dims, label2, true);
@@ -1100,6 +1042,7 @@ std::vector<EbsdLib::UInt8ArrayType::Pointer> CubicLowOps::generatePoleFigure(Po
   }
 
 #ifdef EbsdLib_USE_PARALLEL_ALGORITHMS
+  bool doParallel = true;
 
   if(doParallel)
   {
@@ -50,7 +50,6 @@
 #include "EbsdLib/Math/EbsdLibMath.h"
 #include "EbsdLib/Math/GeometryMath.h"
 #include "EbsdLib/Utilities/ColorUtilities.h"
-#include "EbsdLib/Utilities/ComputeStereographicProjection.h"
 
 namespace CubicHigh
 {
@@ -70,57 +69,14 @@ static const int symSize2 = 8;
 static const int k_OdfSize = 5832;
 static const int k_MdfSize = 5832;
 static const int k_SymOpsCount = 24;
+static_assert(k_SymOpsCount == CubicOps::SymmetryGroupType::k_SymOpsCount, "Symmetry operator count does not match the SymmetryGroup");
 static const int k_NumMdfBins = 13;
 
-static const std::vector<QuatD> QuatSym = {QuatD(0.000000000, 0.000000000, 0.000000000, 1.000000000),
-                                           QuatD(1.000000000, 0.000000000, 0.000000000, 0.000000000),
-                                           QuatD(0.000000000, 1.000000000, 0.000000000, 0.000000000),
-                                           QuatD(0.000000000, 0.000000000, 1.000000000, 0.000000000),
-                                           QuatD(EbsdLib::Constants::k_1OverRoot2D, 0.000000000, 0.000000000, EbsdLib::Constants::k_1OverRoot2D),
-                                           QuatD(0.000000000, EbsdLib::Constants::k_1OverRoot2D, 0.000000000, EbsdLib::Constants::k_1OverRoot2D),
-                                           QuatD(0.000000000, 0.000000000, EbsdLib::Constants::k_1OverRoot2D, EbsdLib::Constants::k_1OverRoot2D),
-                                           QuatD(-EbsdLib::Constants::k_1OverRoot2D, 0.000000000, 0.000000000, EbsdLib::Constants::k_1OverRoot2D),
-                                           QuatD(0.000000000, -EbsdLib::Constants::k_1OverRoot2D, 0.000000000, EbsdLib::Constants::k_1OverRoot2D),
-                                           QuatD(0.000000000, 0.000000000, -EbsdLib::Constants::k_1OverRoot2D, EbsdLib::Constants::k_1OverRoot2D),
-                                           QuatD(EbsdLib::Constants::k_1OverRoot2D, EbsdLib::Constants::k_1OverRoot2D, 0.000000000, 0.000000000),
-                                           QuatD(-EbsdLib::Constants::k_1OverRoot2D, EbsdLib::Constants::k_1OverRoot2D, 0.000000000, 0.000000000),
-                                           QuatD(0.000000000, EbsdLib::Constants::k_1OverRoot2D, EbsdLib::Constants::k_1OverRoot2D, 0.000000000),
-                                           QuatD(0.000000000, -EbsdLib::Constants::k_1OverRoot2D, EbsdLib::Constants::k_1OverRoot2D, 0.000000000),
-                                           QuatD(EbsdLib::Constants::k_1OverRoot2D, 0.000000000, EbsdLib::Constants::k_1OverRoot2D, 0.000000000),
-                                           QuatD(-EbsdLib::Constants::k_1OverRoot2D, 0.000000000, EbsdLib::Constants::k_1OverRoot2D, 0.000000000),
-                                           QuatD(0.500000000, 0.500000000, 0.500000000, 0.500000000),
-                                           QuatD(-0.500000000, -0.500000000, -0.500000000, 0.500000000),
-                                           QuatD(0.500000000, -0.500000000, 0.500000000, 0.500000000),
-                                           QuatD(-0.500000000, 0.500000000, -0.500000000, 0.500000000),
-                                           QuatD(-0.500000000, 0.500000000, 0.500000000, 0.500000000),
-                                           QuatD(0.500000000, -0.500000000, -0.500000000, 0.500000000),
-                                           QuatD(-0.500000000, -0.500000000, 0.500000000, 0.500000000),
-                                           QuatD(0.500000000, 0.500000000, -0.500000000, 0.500000000)};
-
-static const std::vector<OrientationD> RodSym = {{0.0, 0.0, 0.0},
-                                                 {10000000000.0, 0.0, 0.0},
-                                                 {0.0, 10000000000.0, 0.0},
-                                                 {0.0, 0.0, 10000000000.0},
-                                                 {1.0, 0.0, 0.0},
-                                                 {0.0, 1.0, 0.0},
-                                                 {0.0, 0.0, 1.0},
-                                                 {-1.0, 0.0, 0.0},
-                                                 {0.0, -1.0, 0.0},
-                                                 {0.0, 0.0, -1.0},
-                                                 {10000000000.0, 10000000000.0, 0.0},
-                                                 {-10000000000.0, 10000000000.0, 0.0},
-                                                 {0.0, 10000000000.0, 10000000000.0},
-                                                 {0.0, -10000000000.0, 10000000000.0},
-                                                 {10000000000.0, 0.0, 10000000000.0},
-                                                 {-10000000000.0, 0.0, 10000000000.0},
-                                                 {1.0, 1.0, 1.0},
-                                                 {-1.0, -1.0, -1.0},
-                                                 {1.0, -1.0, 1.0},
-                                                 {-1.0, 1.0, -1.0},
-                                                 {-1.0, 1.0, 1.0},
-                                                 {1.0, -1.0, -1.0},
-                                                 {-1.0, -1.0, 1.0},
-                                                 {1.0, 1.0, -1.0}};
+static const std::vector<QuatD> QuatSym = CubicOps::SymmetryGroupType::QuatSymVector();
+
+static const QuatSymmetrySoA QuatSymSoA(QuatSym);
+
+static const std::vector<OrientationD> RodSym = CubicOps::SymmetryGroupType::RodSymVector();
 
 static const double SlipDirections[12][3] = {{0.0, 1.0, -1.0}, {1.0, 0.0, -1.0}, {1.0, -1.0, 0.0}, {1.0, -1.0, 0.0}, {1.0, 0.0, 1.0}, {0.0, 1.0, 1.0},
                                              {1.0, 1.0, 0.0},  {0.0, 1.0, 1.0},  {1.0, 0.0, -1.0}, {1.0, 1.0, 0.0},  {1.0, 0.0, 1.0}, {0.0, 1.0, -1.0}};
@@ -128,53 +84,7 @@ static const double SlipDirections[12][3] = {{0.0, 1.0, -1.0}, {1.0, 0.0, -1.0},
 static const double SlipPlanes[12][3] = {{1.0, 1.0, 1.0},  {1.0, 1.0, 1.0},  {1.0, 1.0, 1.0},  {1.0, 1.0, -1.0}, {1.0, 1.0, -1.0}, {1.0, 1.0, -1.0},
                                          {1.0, -1.0, 1.0}, {1.0, -1.0, 1.0}, {1.0, -1.0, 1.0}, {-1.0, 1.0, 1.0}, {-1.0, 1.0, 1.0}, {-1.0, 1.0, 1.0}};
 
-static const double MatSym[k_SymOpsCount][3][3] = {{{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}},
-
-                                                   {{1.0, 0.0, 0.0}, {0.0, 0.0, -1.0}, {0.0, 1.0, 0.0}},
-
-                                                   {{1.0, 0.0, 0.0}, {0.0, -1.0, 0.0}, {0.0, 0.0, -1.0}},
-
-                                                   {{1.0, 0.0, 0.0}, {0.0, 0.0, 1.0}, {0.0, -1.0, 0.0}},
-
-                                                   {{0.0, 0.0, -1.0}, {0.0, 1.0, 0.0}, {1.0, 0.0, 0.0}},
-
-                                                   {{0.0, 0.0, 1.0}, {0.0, 1.0, 0.0}, {-1.0, 0.0, 0.0}},
-
-                                                   {{-1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, -1.0}},
-
-                                                   {{-1.0, 0.0, 0.0}, {0.0, -1.0, 0.0}, {0.0, 0.0, 1.0}},
-
-                                                   {{0.0, 1.0, 0.0}, {-1.0, 0.0, 0.0}, {0.0, 0.0, 1.0}},
-
-                                                   {{0.0, -1.0, 0.0}, {1.0, 0.0, 0.0}, {0.0, 0.0, 1.0}},
-
-                                                   {{0.0, -1.0, 0.0}, {0.0, 0.0, 1.0}, {-1.0, 0.0, 0.0}},
-
-                                                   {{0.0, 0.0, 1.0}, {-1.0, 0.0, 0.0}, {0.0, -1.0, 0.0}},
-
-                                                   {{0.0, -1.0, 0.0}, {0.0, 0.0, -1.0}, {1.0, 0.0, 0.0}},
-
-                                                   {{0.0, 0.0, -1.0}, {1.0, 0.0, 0.0}, {0.0, -1.0, 0.0}},
-
-                                                   {{0.0, 1.0, 0.0}, {0.0, 0.0, -1.0}, {-1.0, 0.0, 0.0}},
-
-                                                   {{0.0, 0.0, -1.0}, {-1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}},
-
-                                                   {{0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}, {1.0, 0.0, 0.0}},
-
-                                                   {{0.0, 0.0, 1.0}, {1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}},
-
-                                                   {{0.0, 1.0, 0.0}, {1.0, 0.0, 0.0}, {0.0, 0.0, -1.0}},
-
-                                                   {{-1.0, 0.0, 0.0}, {0.0, 0.0, 1.0}, {0.0, 1.0, 0.0}},
-
-                                                   {{0.0, 0.0, 1.0}, {0.0, -1.0, 0.0}, {1.0, 0.0, 0.0}},
-
-                                                   {{-1.0, 0.0, 0.0}, {0.0, 0.0, -1.0}, {0.0, -1.0, 0.0}},
-
-                                                   {{0.0, 0.0, -1.0}, {0.0, -1.0, 0.0}, {-1.0, 0.0, 0.0}},
-
-                                                   {{0.0, -1.0, 0.0}, {-1.0, 0.0, 0.0}, {0.0, 0.0, -1.0}}};
+static constexpr const std::array<SymMatType, k_SymOpsCount>& MatSym = CubicOps::SymmetryGroupType::MatSym;
 
 } // namespace CubicHigh
 
@@ -249,25 +159,23 @@ std::string CubicOps::getSymmetryName() const
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-OrientationD CubicOps::calculateMisorientation(const QuatD& q1, const QuatD& q2) const
+void CubicOps::calculateMisorientation(const QuatD& q1, const QuatD& q2, AxisAngleD& axisAngle) const
 {
-  return calculateMisorientationInternal(CubicHigh::QuatSym, q1, q2);
+  axisAngle = calculateMisorientationInternal(CubicHigh::QuatSymSoA, q1, q2);
 }
 
 // -----------------------------------------------------------------------------
-OrientationF CubicOps::calculateMisorientation(const QuatF& q1f, const QuatF& q2f) const
-
+//
+// -----------------------------------------------------------------------------
+AxisAngleD CubicOps::calculateMisorientationInternal(const QuatSymmetrySoA& /* quatsym */, const QuatD& q1, const QuatD& q2) const
 {
-  QuatD q1 = q1f.to<double>();
-  QuatD q2 = q2f.to<double>();
-  OrientationD axisAngle = calculateMisorientationInternal(CubicHigh::QuatSym, q1, q2);
-  return axisAngle;
+  return MisorientationClosedForm(q1, q2);
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-OrientationD CubicOps::calculateMisorientationInternal(const std::vector<QuatD>& quatsym, const QuatD& q1, const QuatD& q2) const
+AxisAngleD CubicOps::MisorientationClosedForm(const QuatD& q1, const QuatD& q2)
 {
   double wmin = 9999999.0f; //,na,nb,nc;
   QuatD qco;
@@ -517,7 +425,7 @@ OrientationD CubicOps::calculateMisorientationInternal(const std::vector<QuatD>&
   }
   wmin = 2.0f * wmin;
 
-  OrientationD axisAngle(n1, n2, n3, wmin);
+  AxisAngleD axisAngle(n1, n2, n3, wmin);
   return axisAngle;
 }
 
@@ -575,7 +483,7 @@ void CubicOps::getMatSymOp(int i, float g[3][3]) const
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-OrientationType CubicOps::getODFFZRod(const OrientationType& rod) const
+RodriguesD CubicOps::getODFFZRod(const RodriguesD& rod) const
 {
   return _calcRodNearestOrigin(CubicHigh::RodSym, rod);
 }
@@ -583,13 +491,13 @@ OrientationType CubicOps::getODFFZRod(const OrientationType& rod) const
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-OrientationType CubicOps::getMDFFZRod(const OrientationType& inRod) const
+RodriguesD CubicOps::getMDFFZRod(const RodriguesD& inRod) const
 {
   double w, n1, n2, n3;
   double FZw, FZn1, FZn2, FZn3;
 
-  OrientationType rod = _calcRodNearestOrigin(CubicHigh::RodSym, inRod);
-  OrientationType ax = OrientationTransformation::ro2ax<OrientationType, OrientationType>(rod);
+  RodriguesD rod = _calcRodNearestOrigin(CubicHigh::RodSym, inRod);
+  AxisAngleD ax = OrientationTransformation::ro2ax(rod);
 
   n1 = ax[0];
   n2 = ax[1], n3 = ax[2], w = ax[3];
@@ -637,34 +545,40 @@ OrientationType CubicOps::getMDFFZRod(const OrientationType& inRod) const
     }
   }
 
-  return OrientationTransformation::ax2ro<OrientationType, OrientationType>(OrientationType(FZn1, FZn2, FZn3, FZw));
+  return OrientationTransformation::ax2ro(AxisAngleD(FZn1, FZn2, FZn3, FZw));
 }
 
 QuatD CubicOps::getNearestQuat(const QuatD& q1, const QuatD& q2) const
 {
-  return _calcNearestQuat(CubicHigh::QuatSym, q1, q2);
+  return _calcNearestQuat(CubicHigh::QuatSymSoA, q1, q2);
 }
 
 QuatF CubicOps::getNearestQuat(const QuatF& q1f, const QuatF& q2f) const
 {
-  return _calcNearestQuat(CubicHigh::QuatSym, q1f.to<double>(), q2f.to<double>()).to<float>();
+  return _calcNearestQuat(CubicHigh::QuatSymSoA, q1f.to<double>(), q2f.to<double>()).to<float>();
 }
 
 QuatD CubicOps::getFZQuat(const QuatD& qr) const
 {
-  return _calcQuatNearestOrigin(CubicHigh::QuatSym, qr);
+  return _calcQuatNearestOrigin(CubicHigh::QuatSymSoA, qr);
+}
+
+// -----------------------------------------------------------------------------
+const QuatSymmetrySoA& CubicOps::getQuatSymmetrySoA() const
+{
+  return CubicHigh::QuatSymSoA;
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-int CubicOps::getMisoBin(const OrientationType& rod) const
+int CubicOps::getMisoBin(const RodriguesD& rod) const
 {
   double dim[3];
   double bins[3];
   double step[3];
 
-  OrientationType ho = OrientationTransformation::ro2ho<OrientationType, OrientationType>(rod);
+  HomochoricD ho = OrientationTransformation::ro2ho(rod);
 
   dim[0] = CubicHigh::OdfDimInitValue[0];
   dim[1] = CubicHigh::OdfDimInitValue[1];
@@ -682,7 +596,7 @@ int CubicOps::getMisoBin(const OrientationType& rod) const
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-OrientationType CubicOps::determineEulerAngles(double random[3], int choose) const
+void CubicOps::determineEulerAngles(double random[3], int choose, EulerD& euler) const
 {
   double init[3];
   double step[3];
@@ -701,28 +615,27 @@ OrientationType CubicOps::determineEulerAngles(double random[3], int choose) con
 
   _calcDetermineHomochoricValues(random, init, step, phi, h1, h2, h3);
 
-  OrientationType ho(h1, h2, h3);
-  OrientationType ro = OrientationTransformation::ho2ro<OrientationType, OrientationType>(ho);
+  HomochoricD ho(h1, h2, h3);
+  RodriguesD ro = OrientationTransformation::ho2ro(ho);
   ro = getODFFZRod(ro);
-  OrientationType eu = OrientationTransformation::ro2eu<OrientationType, OrientationType>(ro);
-  return eu;
+  euler = OrientationTransformation::ro2eu(ro);
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-OrientationType CubicOps::randomizeEulerAngles(const OrientationType& synea) const
+EulerD CubicOps::randomizeEulerAngles(const EulerD& synea) const
 {
   size_t symOp = getRandomSymmetryOperatorIndex(CubicHigh::k_SymOpsCount);
-  QuatD quat = OrientationTransformation::eu2qu<OrientationType, QuatD>(synea);
+  QuatD quat = OrientationTransformation::eu2qu(synea);
   QuatD qc = CubicHigh::QuatSym[symOp] * quat;
-  return OrientationTransformation::qu2eu<QuatD, OrientationType>(qc);
+  return OrientationTransformation::qu2eu(qc);
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-OrientationType CubicOps::determineRodriguesVector(double random[3], int choose) const
+void CubicOps::determineRodriguesVector(double random[3], int choose, RodriguesD& rod) const
 {
   double init[3];
   double step[3];
@@ -740,22 +653,21 @@ OrientationType CubicOps::determineRodriguesVector(double random[3], int choose)
   phi[2] = static_cast<int32_t>(choose / (CubicHigh::OdfNumBins[0] * CubicHigh::OdfNumBins[1]));
 
   _calcDetermineHomochoricValues(random, init, step, phi, h1, h2, h3);
-  OrientationType ho(h1, h2, h3);
-  OrientationType ro = OrientationTransformation::ho2ro<OrientationType, OrientationType>(ho);
-  ro = getMDFFZRod(ro);
-  return ro;
+  HomochoricD ho(h1, h2, h3);
+  RodriguesD ro = OrientationTransformation::ho2ro(ho);
+  rod = getMDFFZRod(ro);
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-int CubicOps::getOdfBin(const OrientationType& rod) const
+int CubicOps::getOdfBin(const RodriguesD& rod) const
 {
   double dim[3];
   double bins[3];
   double step[3];
 
-  OrientationType ho = OrientationTransformation::ro2ho<OrientationType, OrientationType>(rod);
+  HomochoricD ho = OrientationTransformation::ro2ho(rod);
 
   dim[0] = CubicHigh::OdfDimInitValue[0];
   dim[1] = CubicHigh::OdfDimInitValue[1];
@@ -964,10 +876,10 @@ double CubicOps::getmPrime(const QuatD& q1, const QuatD& q2, double LD[3]) const
   double planeMisalignment = 0, directionMisalignment = 0;
   int ss1 = 0, ss2 = 0;
 
-  EbsdLib::Matrix3X3D g(OrientationTransformation::qu2om<QuatD, OrientationType>(q1).data());
+  EbsdLib::Matrix3X3D g(OrientationTransformation::qu2om(q1).data());
   EbsdLib::Matrix3X3D g1 = g.transpose();
 
-  g = EbsdLib::Matrix3X3D(OrientationTransformation::qu2om<QuatD, OrientationType>(q2).data());
+  g = EbsdLib::Matrix3X3D(OrientationTransformation::qu2om(q2).data());
   EbsdLib::Matrix3X3D g2 = g.transpose();
 
   for(int i = 0; i < 12; i++)
@@ -1065,10 +977,10 @@ double CubicOps::getF1(const QuatD& q1, const QuatD& q2, double LD[3], bool maxS
   double maxF1 = 0.0;
   double F1 = 0.0;
 
-  EbsdLib::Matrix3X3D g(OrientationTransformation::qu2om<QuatD, OrientationType>(q1).data());
+  EbsdLib::Matrix3X3D g(OrientationTransformation::qu2om(q1).data());
   EbsdLib::Matrix3X3D g1 = g.transpose();
 
-  g = EbsdLib::Matrix3X3D(OrientationTransformation::qu2om<QuatD, OrientationType>(q2).data());
+  g = EbsdLib::Matrix3X3D(OrientationTransformation::qu2om(q2).data());
   EbsdLib::Matrix3X3D g2 = g.transpose();
 
   EbsdMatrixMath::Normalize3x1(LD);
@@ -1148,8 +1060,8 @@ double CubicOps::getF1spt(const QuatD& q1, const QuatD& q2, double LD[3], bool m
   // s double directionComponent2 = 0, planeComponent2 = 0;
   double maxF1spt = 0.0;
   double F1spt = 0.0f;
-  OrientationTransformation::qu2om<QuatD, OrientationType>(q1).toGMatrix(g1temp);
-  OrientationTransformation::qu2om<QuatD, OrientationType>(q2).toGMatrix(g2temp);
+  OrientationTransformation::qu2om(q1).toGMatrix(g1temp);
+  OrientationTransformation::qu2om(q2).toGMatrix(g2temp);
   EbsdMatrixMath::Transpose3x3(g1temp, g1);
   EbsdMatrixMath::Transpose3x3(g2temp, g2);
 
@@ -1237,8 +1149,8 @@ double CubicOps::getF7(const QuatD& q1, const QuatD& q2, double LD[3], bool maxS
   double maxF7 = 0.0;
   double F7 = 0.0f;
 
-  OrientationTransformation::qu2om<QuatD, OrientationType>(q1).toGMatrix(g1temp);
-  OrientationTransformation::qu2om<QuatD, OrientationType>(q2).toGMatrix(g2temp);
+  OrientationTransformation::qu2om(q1).toGMatrix(g1temp);
+  OrientationTransformation::qu2om(q2).toGMatrix(g2temp);
   EbsdMatrixMath::Transpose3x3(g1temp, g1);
   EbsdMatrixMath::Transpose3x3(g2temp, g2);
 
@@ -1330,8 +1242,8 @@ public:
 
     for(size_t i = start; i < end; ++i)
     {
-      OrientationType eu(m_Eulers->getValue(i * 3), m_Eulers->getValue(i * 3 + 1), m_Eulers->getValue(i * 3 + 2));
-      EbsdLib::Matrix3X3D g(OrientationTransformation::eu2om<OrientationType, OrientationType>(eu).data());
+      EulerD eu(m_Eulers->getValue(i * 3), m_Eulers->getValue(i * 3 + 1), m_Eulers->getValue(i * 3 + 2));
+      EbsdLib::Matrix3X3D g(OrientationTransformation::eu2om(eu).data());
 
       gTranspose = g.transpose();
 
@@ -1660,14 +1572,13 @@ EbsdLib::Rgb CubicOps::generateIPFColor(double phi1, double phi, double phi2, do
   double chi = 0.0f, eta = 0.0f;
   double _rgb[3] = {0.0, 0.0, 0.0};
 
-  OrientationType eu(phi1, phi, phi2);
-  OrientationType om(9); // Reusable for the loop
-  QuatD q1 = OrientationTransformation::eu2qu<OrientationType, QuatD>(eu);
+  EulerD eu(phi1, phi, phi2);
+  QuatD q1 = OrientationTransformation::eu2qu(eu);
 
   for(int j = 0; j < CubicHigh::k_SymOpsCount; j++)
   {
     QuatD qu = getQuatSymOp(j) * q1;
-    EbsdLib::Matrix3X3D g(OrientationTransformation::qu2om<QuatD, OrientationType>(qu).data());
+    EbsdLib::Matrix3X3D g(OrientationTransformation::qu2om(qu).data());
     EbsdLib::Matrix3X1D p = (g * refDirection).normalize();
 
     if(!getHasInversion() && p[2] < 0)
@@ -1778,49 +1689,14 @@ std::vector<EbsdLib::UInt8ArrayType::Pointer> CubicOps::generatePoleFigure(PoleF
     label2 = config.labels.at(2);
   }
 
-  size_t numOrientations = config.eulers->getNumberOfTuples();
-
-  // Create an Array to hold the XYZ Coordinates which are the coords on the sphere.
-  // this is size for CUBIC ONLY, <001> Family
-  std::vector<size_t> dims(1, 3);
-  EbsdLib::FloatArrayType::Pointer xyz001 = EbsdLib::FloatArrayType::CreateArray(numOrientations * CubicHigh::symSize0, dims, label0 + std::string("xyzCoords"), true);
-  // this is size for CUBIC ONLY, <011> Family
-  EbsdLib::FloatArrayType::Pointer xyz011 = EbsdLib::FloatArrayType::CreateArray(numOrientations * CubicHigh::symSize1, dims, label1 + std::string("xyzCoords"), true);
-  // this is size for CUBIC ONLY, <111> Family
-  EbsdLib::FloatArrayType::Pointer xyz111 = EbsdLib::FloatArrayType::CreateArray(numOrientations * CubicHigh::symSize2, dims, label2 + std::string("xyzCoords"), true);
-
   config.sphereRadius = 1.0f;
 
-  // Generate the coords on the sphere **** Parallelized
-  generateSphereCoordsFromEulers(config.eulers, xyz001.get(), xyz011.get(), xyz111.get());
-
-  // These arrays hold the "intensity" images which eventually get converted to an actual Color RGB image
-  // Generate the modified Lambert projection images (Squares, 2 of them, 1 for northern hemisphere, 1 for southern hemisphere
-  EbsdLib::DoubleArrayType::Pointer intensity001 = EbsdLib::DoubleArrayType::CreateArray(config.imageDim * config.imageDim, label0 + "_Intensity_Image", true);
-  EbsdLib::DoubleArrayType::Pointer intensity011 = EbsdLib::DoubleArrayType::CreateArray(config.imageDim * config.imageDim, label1 + "_Intensity_Image", true);
-  EbsdLib::DoubleArrayType::Pointer intensity111 = EbsdLib::DoubleArrayType::CreateArray(config.imageDim * config.imageDim, label2 + "_Intensity_Image", true);
-
-#ifdef EbsdLib_USE_PARALLEL_ALGORITHMS
-  bool doParallel = true;
-
-  if(doParallel)
-  {
-    std::shared_ptr<tbb::task_group> g(new tbb::task_group);
-    g->run(ComputeStereographicProjection(xyz001.get(), &config, intensity001.get()));
-    g->run(ComputeStereographicProjection(xyz011.get(), &config, intensity011.get()));
-    g->run(ComputeStereographicProjection(xyz111.get(), &config, intensity111.get()));
-    g->wait(); // Wait for all the threads to complete before moving on.
-  }
-  else
-#endif
-  {
-    ComputeStereographicProjection m001(xyz001.get(), &config, intensity001.get());
-    m001();
-    ComputeStereographicProjection m011(xyz011.get(), &config, intensity011.get());
-    m011();
-    ComputeStereographicProjection m111(xyz111.get(), &config, intensity111.get());
-    m111();
-  }
+  // Generate the coords on the sphere block by block and add them straight into the modified Lambert projection
+  // squares, then create the "intensity" images which eventually get converted to an actual Color RGB image **** Parallelized
+  std::array<EbsdLib::DoubleArrayType::Pointer, 3> intensities = generatePoleFigureIntensities(config, {label0 + "_Intensity_Image", label1 + "_Intensity_Image", label2 + "_Intensity_Image"});
+  EbsdLib::DoubleArrayType::Pointer intensity001 = intensities[0];
+  EbsdLib::DoubleArrayType::Pointer intensity011 = intensities[1];
+  EbsdLib::DoubleArrayType::Pointer intensity111 = intensities[2];
 
   // Find the Max and Min values based on ALL 3 arrays so we can color scale them all the same
   double max = std::numeric_limits<double>::min();
@@ -1871,7 +1747,7 @@ std::vector<EbsdLib::UInt8ArrayType::Pointer> CubicOps::generatePoleFigure(PoleF
   config.minScale = min;
   config.maxScale = max;
 
-  dims[0] = 4;
+  std::vector<size_t> dims(1, 4);
   EbsdLib::UInt8ArrayType::Pointer image001 = EbsdLib::UInt8ArrayType::CreateArray(static_cast<size_t>(config.imageDim * config.imageDim), dims, label0, true);
   EbsdLib::UInt8ArrayType::Pointer image011 = EbsdLib::UInt8ArrayType::CreateArray(static_cast<size_t>(config.imageDim * config.imageDim), dims, label1, true);
   EbsdLib::UInt8ArrayType::Pointer image111 = EbsdLib::UInt8ArrayType::CreateArray(static_cast<size_t>(config.imageDim * config.imageDim), dims, label2, true);
@@ -1891,6 +1767,7 @@ std::vector<EbsdLib::UInt8ArrayType::Pointer> CubicOps::generatePoleFigure(PoleF
   }
 
 #ifdef EbsdLib_USE_PARALLEL_ALGORITHMS
+  bool doParallel = true;
 
   if(doParallel)
   {
@@ -1934,81 +1811,95 @@ EbsdLib::UInt8ArrayType::Pointer CubicOps::generateIPFTriangleLegend(int imageDi
   EbsdLib::UInt8ArrayType::Pointer image = EbsdLib::UInt8ArrayType::CreateArray(imageDim * imageDim, dims, getSymmetryName() + " Triangle Legend", true);
   uint32_t* pixelPtr = reinterpret_cast<uint32_t*>(image->getPointer(0));
 
-  double indexConst1 = 0.414f / static_cast<double>(imageDim);
-  double indexConst2 = 0.207f / static_cast<double>(imageDim);
-  double red1 = 0.0f;
-
-  double x = 0.0f;
-  double y = 0.0f;
-  double a = 0.0f;
-  double b = 0.0f;
-  double c = 0.0f;
-
-  double val = 0.0f;
-  double x1 = 0.0f;
-  double y1 = 0.0f;
-  double z1 = 0.0f;
-  double denom = 0.0f;
-  double phi = 0.0f;
-  double x1alt = 0.0f;
-  double theta = 0.0f;
-  double k_RootOfHalf = sqrtf(0.5f);
-  double cd[3];
-
-  EbsdLib::Rgb color;
-  size_t idx = 0;
-  size_t yScanLineIndex = imageDim; // We use this to control where the data is drawn. Otherwise the image will come out flipped vertically
-  // Loop over every pixel in the image and project up to the sphere to get the angle and then figure out the RGB from
-  // there.
-  for(int32_t yIndex = 0; yIndex < imageDim; ++yIndex)
-  {
-    yScanLineIndex--;
-    for(int32_t xIndex = 0; xIndex < imageDim; ++xIndex)
+  // Each call renders the rows [yStart, yEnd) so that the rows can be split across threads
+  auto generateRows = [&](int32_t yStart, int32_t yEnd) {
+    double indexConst1 = 0.414f / static_cast<double>(imageDim);
+    double indexConst2 = 0.207f / static_cast<double>(imageDim);
+    double red1 = 0.0f;
+
+    double x = 0.0f;
+    double y = 0.0f;
+    double a = 0.0f;
+    double b = 0.0f;
+    double c = 0.0f;
+
+    double val = 0.0f;
+    double x1 = 0.0f;
+    double y1 = 0.0f;
+    double z1 = 0.0f;
+    double denom = 0.0f;
+    double phi = 0.0f;
+    double x1alt = 0.0f;
+    double theta = 0.0f;
+    double k_RootOfHalf = sqrtf(0.5f);
+    double cd[3];
+
+    EbsdLib::Rgb color;
+    size_t idx = 0;
+    size_t yScanLineIndex = imageDim - yStart; // We use this to control where the data is drawn. Otherwise the image will come out flipped vertically
+    // Loop over every pixel in the image and project up to the sphere to get the angle and then figure out the RGB from
+    // there.
+    for(int32_t yIndex = yStart; yIndex < yEnd; ++yIndex)
     {
-      idx = (imageDim * yScanLineIndex) + xIndex;
-
-      x = xIndex * indexConst1 + indexConst2;
-      y = yIndex * indexConst1 + indexConst2;
-      //     z = -1.0;
-      a = (x * x + y * y + 1);
-      b = (2 * x * x + 2 * y * y);
-      c = (x * x + y * y - 1);
-
-      val = (-b + std::sqrt(b * b - 4.0f * a * c)) / (2.0f * a);
-      x1 = (1 + val) * x;
-      y1 = (1 + val) * y;
-      z1 = val;
-      denom = (x1 * x1) + (y1 * y1) + (z1 * z1);
-      denom = std::sqrt(denom);
-      x1 = x1 / denom;
-      y1 = y1 / denom;
-      z1 = z1 / denom;
-
-      red1 = x1 * (-k_RootOfHalf) + z1 * k_RootOfHalf;
-      phi = acos(red1);
-      x1alt = x1 / k_RootOfHalf;
-      x1alt = x1alt / sqrt((x1alt * x1alt) + (y1 * y1));
-      theta = acos(x1alt);
-
-      if(phi < (45.0f * EbsdLib::Constants::k_PiOver180D) || phi > (90.0f * EbsdLib::Constants::k_PiOver180D) || theta > (35.26f * EbsdLib::Constants::k_PiOver180D))
+      yScanLineIndex--;
+      for(int32_t xIndex = 0; xIndex < imageDim; ++xIndex)
       {
-        color = 0xFFFFFFFF;
-      }
-      else
-      {
-        // 3) move that direction to a single standard triangle - using the 001-011-111 triangle)
-        cd[0] = std::fabs(x1);
-        cd[1] = std::fabs(y1);
-        cd[2] = std::fabs(z1);
+        idx = (imageDim * yScanLineIndex) + xIndex;
+
+        x = xIndex * indexConst1 + indexConst2;
+        y = yIndex * indexConst1 + indexConst2;
+        //     z = -1.0;
+        a = (x * x + y * y + 1);
+        b = (2 * x * x + 2 * y * y);
+        c = (x * x + y * y - 1);
+
+        val = (-b + std::sqrt(b * b - 4.0f * a * c)) / (2.0f * a);
+        x1 = (1 + val) * x;
+        y1 = (1 + val) * y;
+        z1 = val;
+        denom = (x1 * x1) + (y1 * y1) + (z1 * z1);
+        denom = std::sqrt(denom);
+        x1 = x1 / denom;
+        y1 = y1 / denom;
+        z1 = z1 / denom;
+
+        red1 = x1 * (-k_RootOfHalf) + z1 * k_RootOfHalf;
+        phi = acos(red1);
+        x1alt = x1 / k_RootOfHalf;
+        x1alt = x1alt / sqrt((x1alt * x1alt) + (y1 * y1));
+        theta = acos(x1alt);
+
+        if(phi < (45.0f * EbsdLib::Constants::k_PiOver180D) || phi > (90.0f * EbsdLib::Constants::k_PiOver180D) || theta > (35.26f * EbsdLib::Constants::k_PiOver180D))
+        {
+          color = 0xFFFFFFFF;
+        }
+        else
+        {
+          // 3) move that direction to a single standard triangle - using the 001-011-111 triangle)
+          cd[0] = std::fabs(x1);
+          cd[1] = std::fabs(y1);
+          cd[2] = std::fabs(z1);
 
-        // Sort the cd array from smallest to largest
-        _TripletSort(cd[0], cd[1], cd[2], cd);
+          // Sort the cd array from smallest to largest
+          _TripletSort(cd[0], cd[1], cd[2], cd);
 
-        color = generateIPFColor(0.0, 0.0, 0.0, cd[0], cd[1], cd[2], false);
+          color = generateIPFColor(0.0, 0.0, 0.0, cd[0], cd[1], cd[2], false);
+        }
+        pixelPtr[idx] = color;
       }
-      pixelPtr[idx] = color;
     }
+  };
+
+#ifdef EbsdLib_USE_PARALLEL_ALGORITHMS
+  bool doParallel = true;
+  if(doParallel)
+  {
+    tbb::parallel_for(
+        tbb::blocked_range<int32_t>(0, imageDim), [&](const tbb::blocked_range<int32_t>& r) { generateRows(r.begin(), r.end()); }, tbb::auto_partitioner());
+    return image;
   }
+#endif
+  generateRows(0, imageDim);
   return image;
 }
 
@@ -43,7 +43,6 @@
 #include "EbsdLib/Core/Orientation.hpp"
 #include "EbsdLib/Math/EbsdLibMath.h"
 #include "EbsdLib/Utilities/ColorUtilities.h"
-#include "EbsdLib/Utilities/ComputeStereographicProjection.h"
 #include "EbsdLib/Utilities/PoleFigureUtilities.h"
 
 #ifdef EbsdLib_USE_PARALLEL_ALGORITHMS
@@ -71,49 +70,15 @@ static const int symSize2 = 6;
 static const int k_OdfSize = 15552;
 static const int k_MdfSize = 15552;
 static const int k_SymOpsCount = 12;
+static_assert(k_SymOpsCount == HexagonalOps::SymmetryGroupType::k_SymOpsCount, "Symmetry operator count does not match the SymmetryGroup");
 static const int k_NumMdfBins = 20;
 
-static const std::vector<QuatD> QuatSym = {
-    QuatD(0.000000000, 0.000000000, 0.000000000, 1.000000000), QuatD(0.000000000, 0.000000000, 0.500000000, 0.866025400), QuatD(0.000000000, 0.000000000, 0.866025400, 0.500000000),
-    QuatD(0.000000000, 0.000000000, 1.000000000, 0.000000000), QuatD(0.000000000, 0.000000000, 0.866025400, -0.50000000), QuatD(0.000000000, 0.000000000, 0.500000000, -0.86602540),
-    QuatD(1.000000000, 0.000000000, 0.000000000, 0.000000000), QuatD(0.866025400, 0.500000000, 0.000000000, 0.000000000), QuatD(0.500000000, 0.866025400, 0.000000000, 0.000000000),
-    QuatD(0.000000000, 1.000000000, 0.000000000, 0.000000000), QuatD(-0.50000000, 0.866025400, 0.000000000, 0.000000000), QuatD(-0.86602540, 0.500000000, 0.000000000, 0.000000000)};
+static const std::vector<QuatD> QuatSym = HexagonalOps::SymmetryGroupType::QuatSymVector();
 
-static const std::vector<OrientationD> RodSym = {{0.0, 0.0, 0.0},
-                                                 {0.0, 0.0, 0.57735},
-                                                 {0.0, 0.0, 1.73205},
-                                                 {0.0, 0.0, 1000000000000.0},
-                                                 {0.0, 0.0, -1.73205},
-                                                 {0.0, 0.0, -0.57735},
-                                                 {1000000000000.0, 0.0, 0.0},
-                                                 {8660254000000.0, 5000000000000.0, 0.0},
-                                                 {5000000000000.0, 8660254000000.0, 0.0},
-                                                 {0.0, 1000000000000.0, 0.0},
-                                                 {-5000000000000.0, 8660254000000.0, 0.0},
-                                                 {-8660254000000.0, 5000000000000.0, 0.0}};
-static const double MatSym[k_SymOpsCount][3][3] = {{{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}},
+static const QuatSymmetrySoA QuatSymSoA(QuatSym);
 
-                                                   {{-0.5, EbsdLib::Constants::k_Root3Over2D, 0.0}, {-EbsdLib::Constants::k_Root3Over2D, -0.5, 0.0}, {0.0, 0.0, 1.0}},
-
-                                                   {{-0.5, -EbsdLib::Constants::k_Root3Over2D, 0.0}, {EbsdLib::Constants::k_Root3Over2D, -0.5, 0.0}, {0.0, 0.0, 1.0}},
-
-                                                   {{0.5, EbsdLib::Constants::k_Root3Over2D, 0.0}, {-EbsdLib::Constants::k_Root3Over2D, 0.5, 0.0}, {0.0, 0.0, 1.0}},
-
-                                                   {{-1.0, 0.0, 0.0}, {0.0, -1.0, 0.0}, {0.0, 0.0, 1.0}},
-
-                                                   {{0.5, -EbsdLib::Constants::k_Root3Over2D, 0.0}, {EbsdLib::Constants::k_Root3Over2D, 0.5, 0.0}, {0.0, 0.0, 1.0}},
-
-                                                   {{-0.5, -EbsdLib::Constants::k_Root3Over2D, 0.0}, {-EbsdLib::Constants::k_Root3Over2D, 0.5, 0.0}, {0.0, 0.0, -1.0}},
-
-                                                   {{1.0, 0.0, 0.0}, {0.0, -1.0, 0.0}, {0.0, 0.0, -1.0}},
-
-                                                   {{-0.5, EbsdLib::Constants::k_Root3Over2D, 0.0}, {EbsdLib::Constants::k_Root3Over2D, 0.5, 0.0}, {0.0, 0.0, -1.0}},
-
-                                                   {{0.5, EbsdLib::Constants::k_Root3Over2D, 0.0}, {EbsdLib::Constants::k_Root3Over2D, -0.5, 0.0}, {0.0, 0.0, -1.0}},
-
-                                                   {{-1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, -1.0}},
-
-                                                   {{0.5, -EbsdLib::Constants::k_Root3Over2D, 0.0}, {-EbsdLib::Constants::k_Root3Over2D, -0.5, 0.0}, {0.0, 0.0, -1.0}}};
+static const std::vector<OrientationD> RodSym = HexagonalOps::SymmetryGroupType::RodSymVector();
+static constexpr const std::array<SymMatType, k_SymOpsCount>& MatSym = HexagonalOps::SymmetryGroupType::MatSym;
 
 // Use a namespace for some detail that only this class needs
 } // namespace HexagonalHigh
@@ -188,18 +153,9 @@ std::string HexagonalOps::getSymmetryName() const
 }
 
 // -----------------------------------------------------------------------------
-OrientationD HexagonalOps::calculateMisorientation(const QuatD& q1, const QuatD& q2) const
-{
-  return calculateMisorientationInternal(HexagonalHigh::QuatSym, q1, q2);
-}
-
-// -----------------------------------------------------------------------------
-OrientationF HexagonalOps::calculateMisorientation(const QuatF& q1f, const QuatF& q2f) const
+void HexagonalOps::calculateMisorientation(const QuatD& q1, const QuatD& q2, AxisAngleD& axisAngle) const
 {
-  QuatD q1 = q1f.to<double>();
-  QuatD q2 = q2f.to<double>();
-  OrientationD axisAngle = calculateMisorientationInternal(HexagonalHigh::QuatSym, q1, q2);
-  return axisAngle;
+  axisAngle = calculateMisorientationInternal(HexagonalHigh::QuatSymSoA, q1, q2);
 }
 
 QuatD HexagonalOps::getQuatSymOp(int32_t i) const
@@ -259,7 +215,7 @@ void HexagonalOps::getMatSymOp(int i, float g[3][3]) const
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-OrientationType HexagonalOps::getODFFZRod(const OrientationType& rod) const
+RodriguesD HexagonalOps::getODFFZRod(const RodriguesD& rod) const
 {
   return _calcRodNearestOrigin(HexagonalHigh::RodSym, rod);
 }
@@ -267,15 +223,15 @@ OrientationType HexagonalOps::getODFFZRod(const OrientationType& rod) const
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-OrientationType HexagonalOps::getMDFFZRod(const OrientationType& inRod) const
+RodriguesD HexagonalOps::getMDFFZRod(const RodriguesD& inRod) const
 {
   double w, n1, n2, n3;
   double FZn1 = 0.0, FZn2 = 0.0, FZn3 = 0.0, FZw = 0.0;
   double n1n2mag;
 
-  OrientationType rod = _calcRodNearestOrigin(HexagonalHigh::RodSym, inRod);
+  RodriguesD rod = _calcRodNearestOrigin(HexagonalHigh::RodSym, inRod);
 
-  OrientationType ax = OrientationTransformation::ro2ax<OrientationType, OrientationType>(rod);
+  AxisAngleD ax = OrientationTransformation::ro2ax(rod);
 
   n1 = ax[0];
   n2 = ax[1], n3 = ax[2], w = ax[3];
@@ -317,17 +273,17 @@ OrientationType HexagonalOps::getMDFFZRod(const OrientationType& inRod) const
     }
   }
 
-  return OrientationTransformation::ax2ro<OrientationType, OrientationType>(OrientationType(FZn1, FZn2, FZn3, w));
+  return OrientationTransformation::ax2ro(AxisAngleD(FZn1, FZn2, FZn3, w));
 }
 
 QuatD HexagonalOps::getNearestQuat(const QuatD& q1, const QuatD& q2) const
 {
-  return _calcNearestQuat(HexagonalHigh::QuatSym, q1, q2);
+  return _calcNearestQuat(HexagonalHigh::QuatSymSoA, q1, q2);
 }
 
 QuatF HexagonalOps::getNearestQuat(const QuatF& q1f, const QuatF& q2f) const
 {
-  return _calcNearestQuat(HexagonalHigh::QuatSym, q1f.to<double>(), q2f.to<double>()).to<float>();
+  return _calcNearestQuat(HexagonalHigh::QuatSymSoA, q1f.to<double>(), q2f.to<double>()).to<float>();
 }
 
 // -----------------------------------------------------------------------------
@@ -335,19 +291,25 @@ QuatF HexagonalOps::getNearestQuat(const QuatF& q1f, const QuatF& q2f) const
 // -----------------------------------------------------------------------------
 QuatD HexagonalOps::getFZQuat(const QuatD& qr) const
 {
-  return _calcQuatNearestOrigin(HexagonalHigh::QuatSym, qr);
+  return _calcQuatNearestOrigin(HexagonalHigh::QuatSymSoA, qr);
+}
+
+// -----------------------------------------------------------------------------
+const QuatSymmetrySoA& HexagonalOps::getQuatSymmetrySoA() const
+{
+  return HexagonalHigh::QuatSymSoA;
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-int HexagonalOps::getMisoBin(const OrientationType& rod) const
+int HexagonalOps::getMisoBin(const RodriguesD& rod) const
 {
   double dim[3];
   double bins[3];
   double step[3];
 
-  OrientationType ho = OrientationTransformation::ro2ho<OrientationType, OrientationType>(rod);
+  HomochoricD ho = OrientationTransformation::ro2ho(rod);
 
   dim[0] = HexagonalHigh::OdfDimInitValue[0];
   dim[1] = HexagonalHigh::OdfDimInitValue[1];
@@ -365,7 +327,7 @@ int HexagonalOps::getMisoBin(const OrientationType& rod) const
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-OrientationType HexagonalOps::determineEulerAngles(double random[3], int choose) const
+void HexagonalOps::determineEulerAngles(double random[3], int choose, EulerD& euler) const
 {
   double init[3];
   double step[3];
@@ -384,28 +346,27 @@ OrientationType HexagonalOps::determineEulerAngles(double random[3], int choose)
 
   _calcDetermineHomochoricValues(random, init, step, phi, h1, h2, h3);
 
-  OrientationType ho(h1, h2, h3);
-  OrientationType ro = OrientationTransformation::ho2ro<OrientationType, OrientationType>(ho);
+  HomochoricD ho(h1, h2, h3);
+  RodriguesD ro = OrientationTransformation::ho2ro(ho);
   ro = getODFFZRod(ro);
-  OrientationType eu = OrientationTransformation::ro2eu<OrientationType, OrientationType>(ro);
-  return eu;
+  euler = OrientationTransformation::ro2eu(ro);
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-OrientationType HexagonalOps::randomizeEulerAngles(const OrientationType& synea) const
+EulerD HexagonalOps::randomizeEulerAngles(const EulerD& synea) const
 {
   size_t symOp = getRandomSymmetryOperatorIndex(HexagonalHigh::k_SymOpsCount);
-  QuatD quat = OrientationTransformation::eu2qu<OrientationType, QuatD>(synea);
+  QuatD quat = OrientationTransformation::eu2qu(synea);
   QuatD qc = HexagonalHigh::QuatSym[symOp] * quat;
-  return OrientationTransformation::qu2eu<QuatD, OrientationType>(qc);
+  return OrientationTransformation::qu2eu(qc);
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-OrientationType HexagonalOps::determineRodriguesVector(double random[3], int choose) const
+void HexagonalOps::determineRodriguesVector(double random[3], int choose, RodriguesD& rod) const
 {
   double init[3];
   double step[3];
@@ -423,22 +384,21 @@ OrientationType HexagonalOps::determineRodriguesVector(double random[3], int cho
   phi[2] = static_cast<int32_t>(choose / (HexagonalHigh::OdfNumBins[0] * HexagonalHigh::OdfNumBins[1]));
 
   _calcDetermineHomochoricValues(random, init, step, phi, h1, h2, h3);
-  OrientationType ho(h1, h2, h3);
-  OrientationType ro = OrientationTransformation::ho2ro<OrientationType, OrientationType>(ho);
-  ro = getMDFFZRod(ro);
-  return ro;
+  HomochoricD ho(h1, h2, h3);
+  RodriguesD ro = OrientationTransformation::ho2ro(ho);
+  rod = getMDFFZRod(ro);
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-int HexagonalOps::getOdfBin(const OrientationType& rod) const
+int HexagonalOps::getOdfBin(const RodriguesD& rod) const
 {
   double dim[3];
   double bins[3];
   double step[3];
 
-  OrientationType ho = OrientationTransformation::ro2ho<OrientationType, OrientationType>(rod);
+  HomochoricD ho = OrientationTransformation::ro2ho(rod);
 
   dim[0] = HexagonalHigh::OdfDimInitValue[0];
   dim[1] = HexagonalHigh::OdfDimInitValue[1];
@@ -1100,8 +1060,8 @@ public:
     // Geneate all the Coordinates
     for(size_t i = start; i < end; ++i)
     {
-      OrientationType eu(m_Eulers->getValue(i * 3), m_Eulers->getValue(i * 3 + 1), m_Eulers->getValue(i * 3 + 2));
-      EbsdLib::Matrix3X3D g(OrientationTransformation::eu2om<OrientationType, OrientationType>(eu).data());
+      EulerD eu(m_Eulers->getValue(i * 3), m_Eulers->getValue(i * 3 + 1), m_Eulers->getValue(i * 3 + 2));
+      EbsdLib::Matrix3X3D g(OrientationTransformation::eu2om(eu).data());
 
       gTranspose = g.transpose();
 
@@ -1241,14 +1201,13 @@ EbsdLib::Rgb HexagonalOps::generateIPFColor(double phi1, double phi, double phi2
   double chi = 0.0f, eta = 0.0f;
   double _rgb[3] = {0.0, 0.0, 0.0};
 
-  OrientationType eu(phi1, phi, phi2);
-  OrientationType om(9); // Reusable for the loop
-  QuatD q1 = OrientationTransformation::eu2qu<OrientationType, QuatD>(eu);
+  EulerD eu(phi1, phi, phi2);
+  QuatD q1 = OrientationTransformation::eu2qu(eu);
 
   for(int j = 0; j < HexagonalHigh::k_SymOpsCount; j++)
   {
     QuatD qu = getQuatSymOp(j) * q1;
-    EbsdLib::Matrix3X3D g(OrientationTransformation::qu2om<QuatD, OrientationType>(qu).data());
+    EbsdLib::Matrix3X3D g(OrientationTransformation::qu2om(qu).data());
     EbsdLib::Matrix3X1D p = (g * refDirection).normalize();
 
     if(!getHasInversion() && p[2] < 0)
@@ -1355,48 +1314,14 @@ std::vector<EbsdLib::UInt8ArrayType::Pointer> HexagonalOps::generatePoleFigure(P
     label2 = config.labels.at(2);
   }
 
-  size_t numOrientations = config.eulers->getNumberOfTuples();
-
-  // Create an Array to hold the XYZ Coordinates which are the coords on the sphere.
-  // this is size for CUBIC ONLY, <001> Family
-  std::vector<size_t> dims(1, 3);
-  EbsdLib::FloatArrayType::Pointer xyz001 = EbsdLib::FloatArrayType::CreateArray(numOrientations * HexagonalHigh::symSize0, dims, label0 + std::string("xyzCoords"), true);
-  // this is size for CUBIC ONLY, <011> Family
-  EbsdLib::FloatArrayType::Pointer xyz011 = EbsdLib::FloatArrayType::CreateArray(numOrientations * HexagonalHigh::symSize1, dims, label1 + std::string("xyzCoords"), true);
-  // this is size for CUBIC ONLY, <111> Family
-  EbsdLib::FloatArrayType::Pointer xyz111 = EbsdLib::FloatArrayType::CreateArray(numOrientations * HexagonalHigh::symSize2, dims, label2 + std::string("xyzCoords"), true);
-
   config.sphereRadius = 1.0f;
 
-  // Generate the coords on the sphere **** Parallelized
-  generateSphereCoordsFromEulers(config.eulers, xyz001.get(), xyz011.get(), xyz111.get());
-
-  // These arrays hold the "intensity" images which eventually get converted to an actual Color RGB image
-  // Generate the modified Lambert projection images (Squares, 2 of them, 1 for northern hemisphere, 1 for southern hemisphere
-  EbsdLib::DoubleArrayType::Pointer intensity001 = EbsdLib::DoubleArrayType::CreateArray(config.imageDim * config.imageDim, label0 + "_Intensity_Image", true);
-  EbsdLib::DoubleArrayType::Pointer intensity011 = EbsdLib::DoubleArrayType::CreateArray(config.imageDim * config.imageDim, label1 + "_Intensity_Image", true);
-  EbsdLib::DoubleArrayType::Pointer intensity111 = EbsdLib::DoubleArrayType::CreateArray(config.imageDim * config.imageDim, label2 + "_Intensity_Image", true);
-#ifdef EbsdLib_USE_PARALLEL_ALGORITHMS
-  bool doParallel = true;
-
-  if(doParallel)
-  {
-    std::shared_ptr<tbb::task_group> g(new tbb::task_group);
-    g->run(ComputeStereographicProjection(xyz001.get(), &config, intensity001.get()));
-    g->run(ComputeStereographicProjection(xyz011.get(), &config, intensity011.get()));
-    g->run(ComputeStereographicProjection(xyz111.get(), &config, intensity111.get()));
-    g->wait(); // Wait for all the threads to complete before moving on.
-  }
-  else
-#endif
-  {
-    ComputeStereographicProjection m001(xyz001.get(), &config, intensity001.get());
-    m001();
-    ComputeStereographicProjection m011(xyz011.get(), &config, intensity011.get());
-    m011();
-    ComputeStereographicProjection m111(xyz111.get(), &config, intensity111.get());
-    m111();
-  }
+  // Generate the coords on the sphere block by block and add them straight into the modified Lambert projection
+  // squares, then create the "intensity" images which eventually get converted to an actual Color RGB image **** Parallelized
+  std::array<EbsdLib::DoubleArrayType::Pointer, 3> intensities = generatePoleFigureIntensities(config, {label0 + "_Intensity_Image", label1 + "_Intensity_Image", label2 + "_Intensity_Image"});
+  EbsdLib::DoubleArrayType::Pointer intensity001 = intensities[0];
+  EbsdLib::DoubleArrayType::Pointer intensity011 = intensities[1];
+  EbsdLib::DoubleArrayType::Pointer intensity111 = intensities[2];
 
   // Find the Max and Min values based on ALL 3 arrays so we can color scale them all the same
   double max = std::numeric_limits<double>::min();
@@ -1447,7 +1372,7 @@ std::vector<EbsdLib::UInt8ArrayType::Pointer> HexagonalOps::generatePoleFigure(P
   config.minScale = min;
   config.maxScale = max;
 
-  dims[0] = 4;
+  std::vector<size_t> dims(1, 4);
   EbsdLib::UInt8ArrayType::Pointer image001 = EbsdLib::UInt8ArrayType::CreateArray(config.imageDim * config.imageDim, dims, label0, true);
   EbsdLib::UInt8ArrayType::Pointer image011 = EbsdLib::UInt8ArrayType::CreateArray(config.imageDim * config.imageDim, dims, label1, true);
   EbsdLib::UInt8ArrayType::Pointer image111 = EbsdLib::UInt8ArrayType::CreateArray(config.imageDim * config.imageDim, dims, label2, true);
@@ -1467,6 +1392,7 @@ std::vector<EbsdLib::UInt8ArrayType::Pointer> HexagonalOps::generatePoleFigure(P
   }
 
 #ifdef EbsdLib_USE_PARALLEL_ALGORITHMS
+  bool doParallel = true;
 
   if(doParallel)
   {
@@ -1499,81 +1425,95 @@ EbsdLib::UInt8ArrayType::Pointer HexagonalOps::generateIPFTriangleLegend(int ima
   EbsdLib::UInt8ArrayType::Pointer image = EbsdLib::UInt8ArrayType::CreateArray(imageDim * imageDim, dims, getSymmetryName() + " Triangle Legend", true);
   uint32_t* pixelPtr = reinterpret_cast<uint32_t*>(image->getPointer(0));
 
-  double xInc = 1.0f / static_cast<double>(imageDim);
-  double yInc = 1.0f / static_cast<double>(imageDim);
-  double rad = 1.0f;
-
-  double x = 0.0f;
-  double y = 0.0f;
-  double a = 0.0f;
-  double b = 0.0f;
-  double c = 0.0f;
-
-  double val = 0.0f;
-  double x1 = 0.0f;
-  double y1 = 0.0f;
-  double z1 = 0.0f;
-  double denom = 0.0f;
-
-  // Find the slope of the bounding line.
-  static const double m = std::sin(30.0 * EbsdLib::Constants::k_PiOver180D) / std::cos(30.0 * EbsdLib::Constants::k_PiOver180D);
-
-  EbsdLib::Rgb color;
-  size_t idx = 0;
-  size_t yScanLineIndex = imageDim - 1; // We use this to control where the data
-  // is drawn. Otherwise the image will come out flipped vertically
-  // Loop over every pixel in the image and project up to the sphere to get the angle and then figure out the RGB from
-  // there.
-  for(int32_t yIndex = 0; yIndex < imageDim; ++yIndex)
-  {
-
-    for(int32_t xIndex = 0; xIndex < imageDim; ++xIndex)
+  // Each call renders the rows [yStart, yEnd) so that the rows can be split across threads
+  auto generateRows = [&](int32_t yStart, int32_t yEnd) {
+    double xInc = 1.0f / static_cast<double>(imageDim);
+    double yInc = 1.0f / static_cast<double>(imageDim);
+    double rad = 1.0f;
+
+    double x = 0.0f;
+    double y = 0.0f;
+    double a = 0.0f;
+    double b = 0.0f;
+    double c = 0.0f;
+
+    double val = 0.0f;
+    double x1 = 0.0f;
+    double y1 = 0.0f;
+    double z1 = 0.0f;
+    double denom = 0.0f;
+
+    // Find the slope of the bounding line.
+    static const double m = std::sin(30.0 * EbsdLib::Constants::k_PiOver180D) / std::cos(30.0 * EbsdLib::Constants::k_PiOver180D);
+
+    EbsdLib::Rgb color;
+    size_t idx = 0;
+    size_t yScanLineIndex = imageDim - 1 - yStart; // We use this to control where the data
+    // is drawn. Otherwise the image will come out flipped vertically
+    // Loop over every pixel in the image and project up to the sphere to get the angle and then figure out the RGB from
+    // there.
+    for(int32_t yIndex = yStart; yIndex < yEnd; ++yIndex)
     {
-      idx = (imageDim * yScanLineIndex) + xIndex;
-
-      x = xIndex * xInc;
-      y = yIndex * yInc;
 
-      double sumSquares = (x * x) + (y * y);
-      if(sumSquares > 1.0f || x < y / m) // Outside unit circle
-      {
-        color = 0xFFFFFFFF;
-      }
-      else if(sumSquares > (rad - 2 * xInc) && sumSquares < (rad + 2 * xInc)) // Black Border line
-      {
-        color = 0xFF000000;
-      }
-      else if(x - y / m < 0.001)
-      {
-        color = 0xFF000000;
-      }
-      else if(xIndex == 0 || yIndex == 0)
-      {
-        color = 0xFF000000;
-      }
-      else
+      for(int32_t xIndex = 0; xIndex < imageDim; ++xIndex)
       {
-        a = (x * x + y * y + 1);
-        b = (2 * x * x + 2 * y * y);
-        c = (x * x + y * y - 1);
-
-        val = (-b + std::sqrt(b * b - 4.0 * a * c)) / (2.0 * a);
-        x1 = (1 + val) * x;
-        y1 = (1 + val) * y;
-        z1 = val;
-        denom = (x1 * x1) + (y1 * y1) + (z1 * z1);
-        denom = std::sqrt(denom);
-        x1 = x1 / denom;
-        y1 = y1 / denom;
-        z1 = z1 / denom;
-
-        color = generateIPFColor(0.0, 0.0, 0.0, x1, y1, z1, false);
+        idx = (imageDim * yScanLineIndex) + xIndex;
+
+        x = xIndex * xInc;
+        y = yIndex * yInc;
+
+        double sumSquares = (x * x) + (y * y);
+        if(sumSquares > 1.0f || x < y / m) // Outside unit circle
+        {
+          color = 0xFFFFFFFF;
+        }
+        else if(sumSquares > (rad - 2 * xInc) && sumSquares < (rad + 2 * xInc)) // Black Border line
+        {
+          color = 0xFF000000;
+        }
+        else if(x - y / m < 0.001)
+        {
+          color = 0xFF000000;
+        }
+        else if(xIndex == 0 || yIndex == 0)
+        {
+          color = 0xFF000000;
+        }
+        else
+        {
+          a = (x * x + y * y + 1);
+          b = (2 * x * x + 2 * y * y);
+          c = (x * x + y * y - 1);
+
+          val = (-b + std::sqrt(b * b - 4.0 * a * c)) / (2.0 * a);
+          x1 = (1 + val) * x;
+          y1 = (1 + val) * y;
+          z1 = val;
+          denom = (x1 * x1) + (y1 * y1) + (z1 * z1);
+          denom = std::sqrt(denom);
+          x1 = x1 / denom;
+          y1 = y1 / denom;
+          z1 = z1 / denom;
+
+          color = generateIPFColor(0.0, 0.0, 0.0, x1, y1, z1, false);
+        }
+
+        pixelPtr[idx] = color;
       }
-
-      pixelPtr[idx] = color;
+      yScanLineIndex--;
     }
-    yScanLineIndex--;
+  };
+
+#ifdef EbsdLib_USE_PARALLEL_ALGORITHMS
+  bool doParallel = true;
+  if(doParallel)
+  {
+    tbb::parallel_for(
+        tbb::blocked_range<int32_t>(0, imageDim), [&](const tbb::blocked_range<int32_t>& r) { generateRows(r.begin(), r.end()); }, tbb::auto_partitioner());
+    return image;
   }
+#endif
+  generateRows(0, imageDim);
   return image;
 }
 
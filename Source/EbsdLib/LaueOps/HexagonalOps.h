@@ -39,6 +39,7 @@
 #include "EbsdLib/Core/EbsdDataArray.hpp"
 #include "EbsdLib/EbsdLib.h"
 #include "EbsdLib/LaueOps/LaueOps.h"
+#include "EbsdLib/LaueOps/SymmetryGroup.hpp"
 #include "EbsdLib/Math/Matrix3X1.hpp"
 #include "EbsdLib/Math/Matrix3X3.hpp"
 
@@ -60,6 +61,11 @@ public:
   using ConstWeakPointer = std::weak_ptr<const Self>;
   static Pointer NullPointer();
 
+  /**
+   * @brief The compile time symmetry operators for this Laue class
+   */
+  using SymmetryGroupType = SymmetryGroup<EbsdLib::CrystalStructure::Hexagonal_High>;
+
   /**
    * @brief Returns the name of the class for HexagonalOps
    */
@@ -124,21 +130,22 @@ public:
    */
   std::array<size_t, 3> getOdfNumBins() const override;
 
-  /**
-   * @brief calculateMisorientation Finds the misorientation between 2 quaternions and returns the result as an Axis Angle value
-   * @param q1 Input Quaternion
-   * @param q2 Input Quaternion
-   * @return Axis Angle Representation
-   */
-  virtual OrientationD calculateMisorientation(const QuatD& q1, const QuatD& q2) const override;
+  using LaueOps::calculateMisorientation;
+  using LaueOps::determineEulerAngles;
+  using LaueOps::determineRodriguesVector;
+  using LaueOps::getMDFFZRod;
+  using LaueOps::getMisoBin;
+  using LaueOps::getODFFZRod;
+  using LaueOps::getOdfBin;
+  using LaueOps::randomizeEulerAngles;
 
   /**
-   * @brief calculateMisorientation Finds the misorientation between 2 quaternions and returns the result as an Axis Angle value
+   * @brief calculateMisorientation Finds the misorientation between 2 quaternions and stores the result as an Axis Angle value
    * @param q1 Input Quaternion
    * @param q2 Input Quaternion
-   * @return Axis Angle Representation
+   * @param axisAngle [output] Axis Angle Representation
    */
-  virtual OrientationF calculateMisorientation(const QuatF& q1, const QuatF& q2) const override;
+  void calculateMisorientation(const QuatD& q1, const QuatD& q2, AxisAngleD& axisAngle) const override;
 
   QuatD getQuatSymOp(int i) const override;
   void getRodSymOp(int i, double* r) const override;
@@ -153,19 +160,20 @@ public:
   EbsdLib::Matrix3X3F getMatSymOpF(int i) const override;
   EbsdLib::Matrix3X3D getMatSymOpD(int i) const override;
 
-  OrientationType getODFFZRod(const OrientationType& rod) const override;
-  OrientationType getMDFFZRod(const OrientationType& rod) const override;
+  RodriguesD getODFFZRod(const RodriguesD& rod) const override;
+  RodriguesD getMDFFZRod(const RodriguesD& rod) const override;
 
   QuatD getNearestQuat(const QuatD& q1, const QuatD& q2) const override;
   QuatF getNearestQuat(const QuatF& q1f, const QuatF& q2f) const override;
 
   QuatD getFZQuat(const QuatD& qr) const override;
-  int getMisoBin(const OrientationType& rod) const override;
+  const QuatSymmetrySoA& getQuatSymmetrySoA() const override;
+  int getMisoBin(const RodriguesD& rod) const override;
   bool inUnitTriangle(double eta, double chi) const override;
-  OrientationType determineEulerAngles(double random[3], int choose) const override;
-  OrientationType randomizeEulerAngles(const OrientationType& euler) const override;
-  OrientationType determineRodriguesVector(double random[3], int choose) const override;
-  int getOdfBin(const OrientationType& rod) const override;
+  void determineEulerAngles(double random[3], int choose, EulerD& euler) const override;
+  EulerD randomizeEulerAngles(const EulerD& euler) const override;
+  void determineRodriguesVector(double random[3], int choose, RodriguesD& rod) const override;
+  int getOdfBin(const RodriguesD& rod) const override;
   void getSchmidFactorAndSS(double load[3], double& schmidfactor, double angleComps[2], int& slipsys) const override;
   void getSchmidFactorAndSS(double load[3], double plane[3], double direction[3], double& schmidfactor, double angleComps[2], int& slipsys) const override;
   double getmPrime(const QuatD& q1, const QuatD& q2, double LD[3]) const override;
@@ -228,7 +236,7 @@ public:
    * @brief generateStandardTriangle Generates an RGBA array that is a color "Standard" IPF Triangle Legend used for IPF Color Maps.
    * @return
    */
-  EbsdLib::UInt8ArrayType::Pointer generateIPFTriangleLegend(int imageDim) const;
+  EbsdLib::UInt8ArrayType::Pointer generateIPFTriangleLegend(int imageDim) const override;
 
 protected:
 public:
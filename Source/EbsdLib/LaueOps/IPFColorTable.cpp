@@ -0,0 +1,233 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "IPFColorTable.h"
+
+#include <array>
+#include <cmath>
+#include <utility>
+
+#ifdef EbsdLib_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#endif
+
+#include "EbsdLib/Core/OrientationTransformation.hpp"
+#include "EbsdLib/LaueOps/LaueOps.h"
+#include "EbsdLib/Math/EbsdLibMath.h"
+#include "EbsdLib/Math/Matrix3X1.hpp"
+#include "EbsdLib/Math/Matrix3X3.hpp"
+#include "EbsdLib/Utilities/ColorTable.h"
+#include "EbsdLib/Utilities/SharedObjectCache.hpp"
+
+namespace
+{
+using TableKey = std::pair<std::string, int>;
+using TableCacheType = SharedObjectCache<TableKey, IPFColorTable::Pointer>;
+
+constexpr size_t k_MaxCachedTables = 16;
+
+TableCacheType& Cache()
+{
+  static TableCacheType cache(k_MaxCachedTables);
+  return cache;
+}
+
+/**
+ * @brief Maps a point of a unit sphere Modified Lambert square back onto the sphere. This is the inverse
+ * of ModifiedLambertProjection::getSquareCoord().
+ */
+void squareCoordToSphere(double a, double b, bool northern, double* xyz)
+{
+  if(a == 0.0 && b == 0.0)
+  {
+    xyz[0] = 0.0;
+    xyz[1] = 0.0;
+    xyz[2] = northern ? 1.0 : -1.0;
+    return;
+  }
+  const bool useA = (std::fabs(a) >= std::fabs(b));
+  const double major = useA ? a : b;
+  const double minor = useA ? b : a;
+  const double radius = 2.0 * std::fabs(major) / std::sqrt(EbsdLib::Constants::k_PiD);
+  const double z = std::max(0.0, 1.0 - radius * radius * 0.5);
+  const double rho = std::sqrt(std::max(0.0, 1.0 - z * z));
+  const double angle = EbsdLib::Constants::k_PiOver4D * minor / major;
+  const double sign = (major < 0.0) ? -1.0 : 1.0;
+  const double along = sign * rho * std::cos(angle);
+  const double across = sign * rho * std::sin(angle);
+  xyz[0] = useA ? along : across;
+  xyz[1] = useA ? across : along;
+  xyz[2] = northern ? z : -z;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+IPFColorTable::Pointer IPFColorTable::Get(const LaueOps& ops, int dimension)
+{
+  return Cache().get(TableKey(ops.getNameOfClass(), dimension), [&ops, dimension]() { return std::make_shared<const Self>(ops, dimension); });
+}
+
+// -----------------------------------------------------------------------------
+void IPFColorTable::ClearCache()
+{
+  Cache().clear();
+}
+
+// -----------------------------------------------------------------------------
+IPFColorTable::IPFColorTable(const LaueOps& ops, int dimension)
+: m_Dimension(dimension)
+, m_Lambert(ModifiedLambertProjection::New())
+{
+  m_Lambert->initializeSquares(dimension, 1.0f);
+  const size_t dim = static_cast<size_t>(dimension);
+  m_Colors.resize(2 * dim * dim * 3, 0);
+
+  const double stepSize = m_Lambert->getStepSize();
+  const double halfEdge = stepSize * static_cast<double>(dimension) * 0.5;
+  // Each row of each square is one unit of work
+  auto generate = [&](size_t start, size_t end) {
+    for(size_t row = start; row < end; row++)
+    {
+      const bool northern = (row < dim);
+      const size_t y = row % dim;
+      for(size_t x = 0; x < dim; x++)
+      {
+        std::array<double, 3> xyz = {0.0, 0.0, 0.0};
+        squareCoordToSphere((static_cast<double>(x) + 0.5) * stepSize - halfEdge, (static_cast<double>(y) + 0.5) * stepSize - halfEdge, northern, xyz.data());
+        // With the identity orientation the crystal direction is the reference direction
+        EbsdLib::Rgb argb = ops.generateIPFColor(0.0, 0.0, 0.0, xyz[0], xyz[1], xyz[2], false);
+        uint8_t* rgb = m_Colors.data() + (row * dim + x) * 3;
+        rgb[0] = static_cast<uint8_t>(EbsdLib::RgbColor::dRed(argb));
+        rgb[1] = static_cast<uint8_t>(EbsdLib::RgbColor::dGreen(argb));
+        rgb[2] = static_cast<uint8_t>(EbsdLib::RgbColor::dBlue(argb));
+      }
+    }
+  };
+
+#ifdef EbsdLib_USE_PARALLEL_ALGORITHMS
+  bool doParallel = true;
+  if(doParallel)
+  {
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(0, 2 * dim), [&](const tbb::blocked_range<size_t>& r) { generate(r.begin(), r.end()); }, tbb::auto_partitioner());
+    return;
+  }
+#endif
+  generate(0, 2 * dim);
+}
+
+// -----------------------------------------------------------------------------
+int IPFColorTable::getDimension() const
+{
+  return m_Dimension;
+}
+
+// -----------------------------------------------------------------------------
+EbsdLib::Rgb IPFColorTable::getColor(const float* direction, Interpolation interpolation) const
+{
+  std::array<float, 2> sqCoord = {0.0f, 0.0f};
+  const bool northern = m_Lambert->getSquareCoord(direction, sqCoord.data());
+  const size_t squareSize = static_cast<size_t>(m_Dimension) * static_cast<size_t>(m_Dimension);
+  const uint8_t* colors = m_Colors.data() + (northern ? 0 : squareSize * 3);
+
+  if(interpolation == Interpolation::Nearest)
+  {
+    const float stepSize = m_Lambert->getStepSize();
+    const float halfEdge = stepSize * static_cast<float>(m_Dimension) * 0.5f;
+    int x = static_cast<int>((sqCoord[0] + halfEdge) / stepSize);
+    int y = static_cast<int>((sqCoord[1] + halfEdge) / stepSize);
+    x = std::min(std::max(x, 0), m_Dimension - 1);
+    y = std::min(std::max(y, 0), m_Dimension - 1);
+    const uint8_t* rgb = colors + (static_cast<size_t>(y) * static_cast<size_t>(m_Dimension) + static_cast<size_t>(x)) * 3;
+    return EbsdLib::RgbColor::dRgb(rgb[0], rgb[1], rgb[2], 255);
+  }
+
+  std::array<int32_t, 4> indices = {0, 0, 0, 0};
+  float modX = 0.0f;
+  float modY = 0.0f;
+  m_Lambert->getInterpolationCells(sqCoord.data(), indices, modX, modY);
+  const std::array<float, 4> weights = {(1.0f - modX) * (1.0f - modY), modX * (1.0f - modY), (1.0f - modX) * modY, modX * modY};
+  std::array<float, 3> rgb = {0.0f, 0.0f, 0.0f};
+  for(size_t c = 0; c < 4; c++)
+  {
+    const uint8_t* cell = colors + static_cast<size_t>(indices[c]) * 3;
+    rgb[0] += weights[c] * cell[0];
+    rgb[1] += weights[c] * cell[1];
+    rgb[2] += weights[c] * cell[2];
+  }
+  return EbsdLib::RgbColor::dRgb(static_cast<int>(rgb[0] + 0.5f), static_cast<int>(rgb[1] + 0.5f), static_cast<int>(rgb[2] + 0.5f), 255);
+}
+
+// -----------------------------------------------------------------------------
+void IPFColorTable::generateIPFColors(const float* eulers, size_t numPoints, const double refDir[3], uint8_t* rgbOut, const bool* mask, bool convertDegrees, Interpolation interpolation) const
+{
+  const EbsdLib::Matrix3X1D refDirection(refDir[0], refDir[1], refDir[2]);
+  const double scale = convertDegrees ? EbsdLib::Constants::k_DegToRadD : 1.0;
+
+  auto generate = [&](size_t start, size_t end) {
+    for(size_t i = start; i < end; i++)
+    {
+      uint8_t* rgb = rgbOut + i * 3;
+      if(nullptr != mask && !mask[i])
+      {
+        rgb[0] = 0;
+        rgb[1] = 0;
+        rgb[2] = 0;
+        continue;
+      }
+      EulerD eu(eulers[i * 3] * scale, eulers[i * 3 + 1] * scale, eulers[i * 3 + 2] * scale);
+      EbsdLib::Matrix3X3D g(OrientationTransformation::eu2om(eu).data());
+      EbsdLib::Matrix3X1D p = (g * refDirection).normalize();
+      const std::array<float, 3> direction = {static_cast<float>(p[0]), static_cast<float>(p[1]), static_cast<float>(p[2])};
+      EbsdLib::Rgb argb = getColor(direction.data(), interpolation);
+      rgb[0] = static_cast<uint8_t>(EbsdLib::RgbColor::dRed(argb));
+      rgb[1] = static_cast<uint8_t>(EbsdLib::RgbColor::dGreen(argb));
+      rgb[2] = static_cast<uint8_t>(EbsdLib::RgbColor::dBlue(argb));
+    }
+  };
+
+#ifdef EbsdLib_USE_PARALLEL_ALGORITHMS
+  bool doParallel = true;
+  if(doParallel)
+  {
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(0, numPoints), [&](const tbb::blocked_range<size_t>& r) { generate(r.begin(), r.end()); }, tbb::auto_partitioner());
+    return;
+  }
+#endif
+  generate(0, numPoints);
+}
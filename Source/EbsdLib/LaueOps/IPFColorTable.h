@@ -0,0 +1,131 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "EbsdLib/Core/EbsdLibConstants.h"
+#include "EbsdLib/EbsdLib.h"
+#include "EbsdLib/Utilities/ModifiedLambertProjection.h"
+
+class LaueOps;
+
+/**
+ * @brief The IPFColorTable class holds the IPF colors of one Laue class sampled on a grid of crystal
+ * directions so that coloring an orientation becomes a matrix multiply and a table lookup instead of a
+ * loop over the symmetry operators. The grid is a pair of Modified Lambert squares (one per hemisphere)
+ * that covers the whole sphere, so no symmetry reduction is needed at lookup time and Laue classes
+ * without inversion are handled as well. Each cell holds the exact color of the direction at its center,
+ * computed with LaueOps::generateIPFColor().
+ *
+ * Colors near the edges of the unit triangle, where the IPF coloring is discontinuous, can differ from
+ * the exact colors. LaueOps::generateIPFColor() and LaueOps::generateIPFColors() remain the exact path.
+ */
+class EbsdLib_EXPORT IPFColorTable
+{
+public:
+  using Self = IPFColorTable;
+  using Pointer = std::shared_ptr<const Self>;
+
+  enum class Interpolation : uint32_t
+  {
+    Nearest = 0,
+    Bilinear = 1
+  };
+
+  /**
+   * @brief The default number of cells along each edge of a Lambert square
+   */
+  static constexpr int k_DefaultDimension = 512;
+
+  /**
+   * @brief Returns the shared table for the Laue class and dimension, creating it on first use. The most recently
+   * used tables are kept in a SharedObjectCache.
+   * @param ops The Laue class
+   * @param dimension The number of cells along each edge of a Lambert square
+   */
+  static Pointer Get(const LaueOps& ops, int dimension = k_DefaultDimension);
+
+  /**
+   * @brief Removes all cached tables
+   */
+  static void ClearCache();
+
+  /**
+   * @brief Computes the table. The table does not keep a reference to the LaueOps instance.
+   * @param ops The Laue class
+   * @param dimension The number of cells along each edge of a Lambert square
+   */
+  IPFColorTable(const LaueOps& ops, int dimension);
+  ~IPFColorTable() = default;
+
+  int getDimension() const;
+
+  /**
+   * @brief Returns the color of a crystal direction
+   * @param direction Unit direction in the crystal reference frame
+   * @param interpolation How the color is read from the table
+   */
+  EbsdLib::Rgb getColor(const float* direction, Interpolation interpolation = Interpolation::Bilinear) const;
+
+  /**
+   * @brief generateIPFColors Table based version of LaueOps::generateIPFColors().
+   * @param eulers Input Euler angles, 3 values per point
+   * @param numPoints The number of points
+   * @param refDir The sample reference direction
+   * @param rgbOut [output] RGB values, 3 values per point
+   * @param mask Optional mask. Points whose mask value is false are colored black.
+   * @param convertDegrees Are the Euler angles in degrees
+   * @param interpolation How the colors are read from the table
+   */
+  void generateIPFColors(const float* eulers, size_t numPoints, const double refDir[3], uint8_t* rgbOut, const bool* mask = nullptr, bool convertDegrees = false,
+                         Interpolation interpolation = Interpolation::Bilinear) const;
+
+private:
+  int m_Dimension = 0;
+  ModifiedLambertProjection::Pointer m_Lambert;
+  std::vector<uint8_t> m_Colors; // RGB of each cell of the North square followed by the South square
+
+public:
+  IPFColorTable(const IPFColorTable&) = delete;            // Copy Constructor Not Implemented
+  IPFColorTable(IPFColorTable&&) = delete;                 // Move Constructor Not Implemented
+  IPFColorTable& operator=(const IPFColorTable&) = delete; // Copy Assignment Not Implemented
+  IPFColorTable& operator=(IPFColorTable&&) = delete;      // Move Assignment Not Implemented
+};
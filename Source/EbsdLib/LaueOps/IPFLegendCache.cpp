@@ -0,0 +1,114 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "IPFLegendCache.h"
+
+#include <set>
+#include <vector>
+
+#include "EbsdLib/LaueOps/LaueOps.h"
+#include "EbsdLib/Utilities/ColorTable.h"
+#include "EbsdLib/Utilities/SharedObjectCache.hpp"
+#include "EbsdLib/Utilities/TiffWriter.h"
+
+namespace
+{
+using LegendKey = std::pair<std::string, int>;
+using LegendCacheType = SharedObjectCache<LegendKey, EbsdLib::UInt8ArrayType::Pointer>;
+
+constexpr size_t k_MaxCachedLegends = 32;
+
+LegendCacheType& Cache()
+{
+  static LegendCacheType cache(k_MaxCachedLegends);
+  return cache;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+EbsdLib::UInt8ArrayType::Pointer IPFLegendCache::Get(const LaueOps& ops, int imageDim)
+{
+  return Cache().get(LegendKey(ops.getNameOfClass(), imageDim), [&ops, imageDim]() { return ops.generateIPFTriangleLegend(imageDim); });
+}
+
+// -----------------------------------------------------------------------------
+void IPFLegendCache::ClearCache()
+{
+  Cache().clear();
+}
+
+// -----------------------------------------------------------------------------
+size_t IPFLegendCache::GetCacheSize()
+{
+  return Cache().size();
+}
+
+// -----------------------------------------------------------------------------
+std::string IPFLegendCache::ExportLegendFileName(const LaueOps& ops, int imageDim)
+{
+  return ops.getNameOfClass() + "_IPFLegend_" + std::to_string(imageDim) + ".tiff";
+}
+
+// -----------------------------------------------------------------------------
+std::pair<int32_t, std::string> IPFLegendCache::ExportLegends(const std::string& outputDirectory, int imageDim)
+{
+  std::vector<LaueOps::Pointer> allOps = LaueOps::GetAllOrientationOps();
+  std::set<std::string> written;
+  std::vector<uint8_t> rgba(static_cast<size_t>(imageDim) * static_cast<size_t>(imageDim) * 4);
+  for(const auto& ops : allOps)
+  {
+    // GetAllOrientationOps() lists some Laue classes more than once
+    if(!written.insert(ops->getNameOfClass()).second)
+    {
+      continue;
+    }
+    EbsdLib::UInt8ArrayType::Pointer legend = Get(*ops, imageDim);
+    const uint32_t* pixelPtr = reinterpret_cast<const uint32_t*>(legend->getPointer(0));
+    for(size_t i = 0; i < rgba.size() / 4; i++)
+    {
+      rgba[i * 4 + 0] = static_cast<uint8_t>(EbsdLib::RgbColor::dRed(pixelPtr[i]));
+      rgba[i * 4 + 1] = static_cast<uint8_t>(EbsdLib::RgbColor::dGreen(pixelPtr[i]));
+      rgba[i * 4 + 2] = static_cast<uint8_t>(EbsdLib::RgbColor::dBlue(pixelPtr[i]));
+      rgba[i * 4 + 3] = static_cast<uint8_t>(EbsdLib::RgbColor::dAlpha(pixelPtr[i]));
+    }
+    std::string filepath = outputDirectory + "/" + ExportLegendFileName(*ops, imageDim);
+    std::pair<int32_t, std::string> result = TiffWriter::WriteColorImage(filepath, imageDim, imageDim, 4, rgba.data());
+    if(result.first < 0)
+    {
+      return {result.first, result.second + ": " + filepath};
+    }
+  }
+  return {0, "No Error"};
+}
@@ -0,0 +1,98 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "EbsdLib/Core/EbsdDataArray.hpp"
+#include "EbsdLib/EbsdLib.h"
+
+class LaueOps;
+
+/**
+ * @brief The IPFLegendCache class holds the IPF triangle legends that have already been rendered so that
+ * applications that redraw a legend for every map do not repeat the work. Legends are keyed by the Laue
+ * class and the image size. A legend that is not in the cache is rendered with
+ * LaueOps::generateIPFTriangleLegend(), which splits the rows across threads. The most recently used
+ * legends are kept, see SharedObjectCache.
+ *
+ * The cached arrays are shared between all callers and must not be modified.
+ */
+class EbsdLib_EXPORT IPFLegendCache
+{
+public:
+  /**
+   * @brief Returns the legend of the Laue class at the given size, rendering it on first use. This is thread safe.
+   * @param ops The Laue class
+   * @param imageDim The width and height of the legend in pixels
+   * @return The ARGB legend image, 4 components per pixel
+   */
+  static EbsdLib::UInt8ArrayType::Pointer Get(const LaueOps& ops, int imageDim);
+
+  /**
+   * @brief Removes all cached legends
+   */
+  static void ClearCache();
+
+  /**
+   * @brief Returns the number of cached legends
+   */
+  static size_t GetCacheSize();
+
+  /**
+   * @brief ExportLegends Writes the legend of every Laue class to an RGBA tiff file named
+   * <LaueOps class name>_IPFLegend_<imageDim>.tiff so they can be shipped as prebuilt images.
+   * @param outputDirectory An existing directory
+   * @param imageDim The width and height of the legends in pixels
+   * @return Error code and message. The error code is negative if a file could not be written.
+   */
+  static std::pair<int32_t, std::string> ExportLegends(const std::string& outputDirectory, int imageDim);
+
+  /**
+   * @brief ExportLegendFileName Returns the file name used by ExportLegends() for the Laue class and size
+   */
+  static std::string ExportLegendFileName(const LaueOps& ops, int imageDim);
+
+public:
+  IPFLegendCache() = delete;
+  IPFLegendCache(const IPFLegendCache&) = delete;            // Copy Constructor Not Implemented
+  IPFLegendCache(IPFLegendCache&&) = delete;                 // Move Constructor Not Implemented
+  IPFLegendCache& operator=(const IPFLegendCache&) = delete; // Copy Assignment Not Implemented
+  IPFLegendCache& operator=(IPFLegendCache&&) = delete;      // Move Assignment Not Implemented
+};
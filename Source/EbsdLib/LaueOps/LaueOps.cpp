@@ -35,10 +35,18 @@
 
 #include "LaueOps.h"
 
-#include <chrono>
-#include <limits>
-#include <random>
+#include <algorithm>
 #include <exception>
+#include <functional>
+#include <limits>
+#include <typeinfo>
+
+#ifdef EbsdLib_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#endif
 
 #include "EbsdLib/Core/EbsdLibConstants.h"
 #include "EbsdLib/Core/EbsdMacros.h"
@@ -54,7 +62,9 @@
 #include "EbsdLib/LaueOps/TrigonalLowOps.h"
 #include "EbsdLib/LaueOps/TrigonalOps.h"
 #include "EbsdLib/Math/EbsdLibRandom.h"
+#include "EbsdLib/Math/EbsdLibRandomEngine.h"
 #include "EbsdLib/Utilities/ColorTable.h"
+#include "EbsdLib/Utilities/ModifiedLambertProjection.h"
 
 namespace Detail
 {
@@ -73,6 +83,544 @@ namespace Detail
 // const static double CosOfHalf = cosf(0.5f);
 // const static double SinOfZero = std::sin(0.0f);
 // const static double CosOfZero = cosf(0.0f);
+
+/**
+ * @brief DispatchLaueClass Calls the functor with the concrete Laue class of ops so that the functor can use the
+ * non-virtual per class code below. LaueOps subclasses from outside of EbsdLib are handed over as a LaueOps.
+ */
+template <typename FunctorType>
+void DispatchLaueClass(const LaueOps& ops, FunctorType&& functor)
+{
+  const std::type_info& type = typeid(ops);
+  if(type == typeid(HexagonalOps))
+  {
+    functor(static_cast<const HexagonalOps&>(ops));
+  }
+  else if(type == typeid(CubicOps))
+  {
+    functor(static_cast<const CubicOps&>(ops));
+  }
+  else if(type == typeid(HexagonalLowOps))
+  {
+    functor(static_cast<const HexagonalLowOps&>(ops));
+  }
+  else if(type == typeid(CubicLowOps))
+  {
+    functor(static_cast<const CubicLowOps&>(ops));
+  }
+  else if(type == typeid(TriclinicOps))
+  {
+    functor(static_cast<const TriclinicOps&>(ops));
+  }
+  else if(type == typeid(MonoclinicOps))
+  {
+    functor(static_cast<const MonoclinicOps&>(ops));
+  }
+  else if(type == typeid(OrthoRhombicOps))
+  {
+    functor(static_cast<const OrthoRhombicOps&>(ops));
+  }
+  else if(type == typeid(TetragonalLowOps))
+  {
+    functor(static_cast<const TetragonalLowOps&>(ops));
+  }
+  else if(type == typeid(TetragonalOps))
+  {
+    functor(static_cast<const TetragonalOps&>(ops));
+  }
+  else if(type == typeid(TrigonalLowOps))
+  {
+    functor(static_cast<const TrigonalLowOps&>(ops));
+  }
+  else if(type == typeid(TrigonalOps))
+  {
+    functor(static_cast<const TrigonalOps&>(ops));
+  }
+  else
+  {
+    functor(ops);
+  }
+}
+
+// -----------------------------------------------------------------------------
+// Per class versions of the LaueOps methods that the kernels call. For a concrete Laue class they use the
+// SymmetryGroup of that class or a qualified, non-virtual call and give the same results as the virtual
+// methods. CubicOps keeps its closed form misorientation. The LaueOps overloads are the virtual fallback.
+// -----------------------------------------------------------------------------
+template <typename OpsType>
+void Misorientation(const OpsType& /* ops */, const QuatD& q1, const QuatD& q2, AxisAngleD& axisAngle)
+{
+  axisAngle = OpsType::SymmetryGroupType::Misorientation(q1, q2);
+}
+
+void Misorientation(const CubicOps& /* ops */, const QuatD& q1, const QuatD& q2, AxisAngleD& axisAngle)
+{
+  axisAngle = CubicOps::MisorientationClosedForm(q1, q2);
+}
+
+void Misorientation(const LaueOps& ops, const QuatD& q1, const QuatD& q2, AxisAngleD& axisAngle)
+{
+  ops.calculateMisorientation(q1, q2, axisAngle);
+}
+
+template <typename OpsType>
+double MisorientationAngleFZ(const OpsType& ops, const QuatD& q1, const QuatD& q2)
+{
+  QuatD qr = q1 * (q2.conjugate());
+  double w = std::min(std::abs(qr.w()), 1.0);
+  if(w >= ops.OpsType::getQuatSymmetrySoA().identityScalarThreshold())
+  {
+    return 2.0 * std::acos(w);
+  }
+  AxisAngleD axisAngle;
+  Misorientation(ops, q1, q2, axisAngle);
+  return axisAngle[3];
+}
+
+double MisorientationAngleFZ(const LaueOps& ops, const QuatD& q1, const QuatD& q2)
+{
+  return ops.calculateMisorientationAngleFZ(q1, q2);
+}
+
+template <typename OpsType>
+QuatD FZQuat(const OpsType& /* ops */, const QuatD& q)
+{
+  return OpsType::SymmetryGroupType::FZQuat(q);
+}
+
+QuatD FZQuat(const LaueOps& ops, const QuatD& q)
+{
+  return ops.getFZQuat(q);
+}
+
+template <typename OpsType>
+EbsdLib::Rgb IPFColor(const OpsType& ops, const float* eu, const double* refDir, bool convertDegrees)
+{
+  return ops.OpsType::generateIPFColor(eu[0], eu[1], eu[2], refDir[0], refDir[1], refDir[2], convertDegrees);
+}
+
+EbsdLib::Rgb IPFColor(const LaueOps& ops, const float* eu, const double* refDir, bool convertDegrees)
+{
+  return ops.generateIPFColor(eu[0], eu[1], eu[2], refDir[0], refDir[1], refDir[2], convertDegrees);
+}
+
+template <typename OpsType>
+size_t NumSymOps(const OpsType& /* ops */)
+{
+  return OpsType::SymmetryGroupType::k_SymOpsCount;
+}
+
+size_t NumSymOps(const LaueOps& ops)
+{
+  return static_cast<size_t>(ops.getNumSymOps());
+}
+
+template <typename OpsType>
+QuatD QuatSymOp(const OpsType& /* ops */, size_t i)
+{
+  return OpsType::SymmetryGroupType::QuatSymOp(i);
+}
+
+QuatD QuatSymOp(const LaueOps& ops, size_t i)
+{
+  return ops.getQuatSymOp(static_cast<int>(i));
+}
+
+/**
+ * @brief The LaueOpsBatchImpl class walks a range of points, looks up the LaueOps for each point and hands the
+ * point to the kernel. Consecutive points with the same LaueOps are handed over as one run, so the Laue class is
+ * dispatched once per run and the kernel runs the non-virtual code of that class. Points that are masked out or
+ * have an invalid phase are handed to the kernel's skip() method.
+ */
+template <typename KernelType>
+class LaueOpsBatchImpl
+{
+  const std::vector<const LaueOps*>& m_PhaseOps;
+  const int32_t* m_Phases;
+  const bool* m_Mask;
+  const KernelType& m_Kernel;
+
+public:
+  LaueOpsBatchImpl(const std::vector<const LaueOps*>& phaseOps, const int32_t* phases, const bool* mask, const KernelType& kernel)
+  : m_PhaseOps(phaseOps)
+  , m_Phases(phases)
+  , m_Mask(mask)
+  , m_Kernel(kernel)
+  {
+  }
+  virtual ~LaueOpsBatchImpl() = default;
+
+  void generate(size_t start, size_t end) const
+  {
+    size_t runStart = start;
+    while(runStart < end)
+    {
+      const LaueOps* ops = opsForPoint(runStart);
+      size_t runEnd = runStart + 1;
+      while(runEnd < end && opsForPoint(runEnd) == ops)
+      {
+        runEnd++;
+      }
+      if(nullptr == ops)
+      {
+        for(size_t i = runStart; i < runEnd; i++)
+        {
+          m_Kernel.skip(i);
+        }
+      }
+      else
+      {
+        DispatchLaueClass(*ops, [this, runStart, runEnd](const auto& typedOps) {
+          for(size_t i = runStart; i < runEnd; i++)
+          {
+            m_Kernel(typedOps, i);
+          }
+        });
+      }
+      runStart = runEnd;
+    }
+  }
+
+#ifdef EbsdLib_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    generate(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const LaueOps* opsForPoint(size_t i) const
+  {
+    if(nullptr != m_Mask && !m_Mask[i])
+    {
+      return nullptr;
+    }
+    int32_t phase = (nullptr == m_Phases) ? 0 : m_Phases[i];
+    if(phase < 0 || phase >= static_cast<int32_t>(m_PhaseOps.size()))
+    {
+      return nullptr;
+    }
+    return m_PhaseOps[phase];
+  }
+};
+
+// -----------------------------------------------------------------------------
+template <typename KernelType>
+void RunBatch(const std::vector<const LaueOps*>& phaseOps, const int32_t* phases, const bool* mask, size_t numPoints, const KernelType& kernel)
+{
+  LaueOpsBatchImpl<KernelType> impl(phaseOps, phases, mask, kernel);
+#ifdef EbsdLib_USE_PARALLEL_ALGORITHMS
+  bool doParallel = true;
+  if(doParallel)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numPoints), impl, tbb::auto_partitioner());
+    return;
+  }
+#endif
+  impl.generate(0, numPoints);
+}
+
+// -----------------------------------------------------------------------------
+std::vector<const LaueOps*> PhaseOps(const std::vector<LaueOps::Pointer>& allOps, const uint32_t* crystalStructures, size_t numPhases)
+{
+  std::vector<const LaueOps*> phaseOps(numPhases, nullptr);
+  for(size_t i = 0; i < numPhases; i++)
+  {
+    if(crystalStructures[i] < allOps.size())
+    {
+      phaseOps[i] = allOps[crystalStructures[i]].get();
+    }
+  }
+  return phaseOps;
+}
+
+/**
+ * @brief The MisorientationKernel class computes the misorientation of a single quaternion pair.
+ */
+class MisorientationKernel
+{
+  const float* m_Q1s;
+  const float* m_Q2s;
+  float* m_AxisAngles;
+  bool m_UseCache;
+
+public:
+  MisorientationKernel(const float* q1s, const float* q2s, float* axisAngles, bool useCache)
+  : m_Q1s(q1s)
+  , m_Q2s(q2s)
+  , m_AxisAngles(axisAngles)
+  , m_UseCache(useCache)
+  {
+  }
+
+  template <typename OpsType>
+  void operator()(const OpsType& ops, size_t i) const
+  {
+    const float* q1 = m_Q1s + i * 4;
+    const float* q2 = m_Q2s + i * 4;
+    AxisAngleD axisAngle;
+    if(m_UseCache)
+    {
+      ops.calculateMisorientationCached(QuatD(q1[0], q1[1], q1[2], q1[3]), QuatD(q2[0], q2[1], q2[2], q2[3]), axisAngle);
+    }
+    else
+    {
+      Misorientation(ops, QuatD(q1[0], q1[1], q1[2], q1[3]), QuatD(q2[0], q2[1], q2[2], q2[3]), axisAngle);
+    }
+    for(size_t c = 0; c < 4; c++)
+    {
+      m_AxisAngles[i * 4 + c] = static_cast<float>(axisAngle[c]);
+    }
+  }
+
+  void skip(size_t i) const
+  {
+    std::fill(m_AxisAngles + i * 4, m_AxisAngles + i * 4 + 4, 0.0F);
+  }
+};
+
+/**
+ * @brief The MisorientationAngleFZKernel class computes the misorientation angle of a single pair of quaternions
+ * that are already in the Fundamental Zone.
+ */
+class MisorientationAngleFZKernel
+{
+  const float* m_Q1s;
+  const float* m_Q2s;
+  float* m_Angles;
+
+public:
+  MisorientationAngleFZKernel(const float* q1s, const float* q2s, float* angles)
+  : m_Q1s(q1s)
+  , m_Q2s(q2s)
+  , m_Angles(angles)
+  {
+  }
+
+  template <typename OpsType>
+  void operator()(const OpsType& ops, size_t i) const
+  {
+    const float* q1 = m_Q1s + i * 4;
+    const float* q2 = m_Q2s + i * 4;
+    m_Angles[i] = static_cast<float>(MisorientationAngleFZ(ops, QuatD(q1[0], q1[1], q1[2], q1[3]), QuatD(q2[0], q2[1], q2[2], q2[3])));
+  }
+
+  void skip(size_t i) const
+  {
+    m_Angles[i] = 0.0F;
+  }
+};
+
+/**
+ * @brief The RandomizeEulerKernel class applies a random symmetry operator to a single
+ * Euler angle. Each element draws from its own Philox stream so the result does not
+ * depend on how the elements are split between threads.
+ */
+class RandomizeEulerKernel
+{
+  float* m_Eulers;
+  uint64_t m_Seed;
+
+public:
+  RandomizeEulerKernel(float* eulers, uint64_t seed)
+  : m_Eulers(eulers)
+  , m_Seed(seed)
+  {
+  }
+
+  template <typename OpsType>
+  void operator()(const OpsType& ops, size_t i) const
+  {
+    float* e = m_Eulers + i * 3;
+    PhiloxEngine engine(m_Seed, i);
+    size_t symOp = engine.generateIndex(NumSymOps(ops));
+    QuatD quat = OrientationTransformation::eu2qu(EulerD(e[0], e[1], e[2]));
+    EulerD eu = OrientationTransformation::qu2eu(QuatSymOp(ops, symOp) * quat);
+    for(size_t c = 0; c < 3; c++)
+    {
+      e[c] = static_cast<float>(eu[c]);
+    }
+  }
+
+  void skip(size_t) const
+  {
+  }
+};
+
+/**
+ * @brief The FundamentalZoneKernel class moves a single quaternion into the Fundamental Zone.
+ */
+class FundamentalZoneKernel
+{
+  float* m_Quats;
+
+public:
+  explicit FundamentalZoneKernel(float* quats)
+  : m_Quats(quats)
+  {
+  }
+
+  template <typename OpsType>
+  void operator()(const OpsType& ops, size_t i) const
+  {
+    float* q = m_Quats + i * 4;
+    QuatD fz = FZQuat(ops, QuatD(q[0], q[1], q[2], q[3]));
+    for(size_t c = 0; c < 4; c++)
+    {
+      q[c] = static_cast<float>(fz[c]);
+    }
+  }
+
+  void skip(size_t) const
+  {
+  }
+};
+
+/**
+ * @brief The IPFColorKernel class generates the IPF color of a single Euler angle.
+ */
+class IPFColorKernel
+{
+  const float* m_Eulers;
+  const double* m_RefDir;
+  uint8_t* m_Rgb;
+  bool m_ConvertDegrees;
+
+public:
+  IPFColorKernel(const float* eulers, const double* refDir, uint8_t* rgb, bool convertDegrees)
+  : m_Eulers(eulers)
+  , m_RefDir(refDir)
+  , m_Rgb(rgb)
+  , m_ConvertDegrees(convertDegrees)
+  {
+  }
+
+  template <typename OpsType>
+  void operator()(const OpsType& ops, size_t i) const
+  {
+    EbsdLib::Rgb argb = IPFColor(ops, m_Eulers + i * 3, m_RefDir, m_ConvertDegrees);
+    m_Rgb[i * 3] = static_cast<uint8_t>(EbsdLib::RgbColor::dRed(argb));
+    m_Rgb[i * 3 + 1] = static_cast<uint8_t>(EbsdLib::RgbColor::dGreen(argb));
+    m_Rgb[i * 3 + 2] = static_cast<uint8_t>(EbsdLib::RgbColor::dBlue(argb));
+  }
+
+  void skip(size_t i) const
+  {
+    m_Rgb[i * 3] = 0;
+    m_Rgb[i * 3 + 1] = 0;
+    m_Rgb[i * 3 + 2] = 0;
+  }
+};
+
+/**
+ * @brief The number of orientations whose sphere coordinates are generated together when computing pole figures
+ */
+constexpr size_t k_PoleFigureBlockSize = 4096;
+
+/**
+ * @brief The PoleFigureIntensityImpl class converts blocks of orientations into sphere coordinates for all three
+ * pole figure families and adds them into accumulators that belong to the executing thread. For a continuous
+ * pole figure the accumulators are the North and South Lambert squares of each family, for a discrete pole
+ * figure they are the intensity images themselves.
+ */
+class PoleFigureIntensityImpl
+{
+public:
+  using Accumulators = std::array<std::vector<double>, 3>;
+
+  PoleFigureIntensityImpl(const LaueOps& ops, const PoleFigureConfiguration_t& config, const ModifiedLambertProjection& lambert)
+  : m_Ops(ops)
+  , m_Config(config)
+  , m_Lambert(lambert)
+  , m_NumSymmetry(ops.getNumSymmetry())
+  {
+  }
+  virtual ~PoleFigureIntensityImpl() = default;
+
+  /**
+   * @brief Returns the number of values in each accumulator
+   */
+  size_t getAccumulatorSize() const
+  {
+    if(m_Config.discrete)
+    {
+      return static_cast<size_t>(m_Config.imageDim) * static_cast<size_t>(m_Config.imageDim);
+    }
+    return 2 * static_cast<size_t>(m_Config.lambertDim) * static_cast<size_t>(m_Config.lambertDim);
+  }
+
+  void generate(size_t start, size_t end, Accumulators& accumulators) const
+  {
+    std::vector<size_t> cDims(1, 3);
+    std::array<std::vector<float>, 3> xyz;
+    std::array<EbsdLib::FloatArrayType::Pointer, 3> coords;
+    for(size_t blockStart = start; blockStart < end; blockStart += k_PoleFigureBlockSize)
+    {
+      size_t count = std::min(k_PoleFigureBlockSize, end - blockStart);
+      EbsdLib::FloatArrayType::Pointer eulers = EbsdLib::FloatArrayType::WrapPointer(m_Config.eulers->getPointer(blockStart * 3), count, cDims, "Eulers", false);
+      for(size_t f = 0; f < 3; f++)
+      {
+        size_t numCoords = count * static_cast<size_t>(m_NumSymmetry[f]);
+        xyz[f].resize(numCoords * 3);
+        coords[f] = EbsdLib::FloatArrayType::WrapPointer(xyz[f].data(), numCoords, cDims, "Coords", false);
+      }
+      m_Ops.generateSphereCoordsFromEulers(eulers.get(), coords[0].get(), coords[1].get(), coords[2].get());
+
+      for(size_t f = 0; f < 3; f++)
+      {
+        std::vector<double>& accumulator = accumulators[f];
+        if(accumulator.empty())
+        {
+          accumulator.resize(getAccumulatorSize(), 0.0);
+        }
+        if(m_Config.discrete)
+        {
+          addDiscrete(xyz[f].data(), xyz[f].size() / 3, accumulator.data());
+        }
+        else
+        {
+          m_Lambert.addCoords(xyz[f].data(), xyz[f].size() / 3, accumulator.data(), accumulator.data() + accumulator.size() / 2);
+        }
+      }
+    }
+  }
+
+#ifdef EbsdLib_USE_PARALLEL_ALGORITHMS
+  using ThreadAccumulators = tbb::enumerable_thread_specific<Accumulators>;
+
+  void operator()(const tbb::blocked_range<size_t>& r, ThreadAccumulators& accumulators) const
+  {
+    generate(r.begin(), r.end(), accumulators.local());
+  }
+#endif
+
+private:
+  const LaueOps& m_Ops;
+  const PoleFigureConfiguration_t& m_Config;
+  const ModifiedLambertProjection& m_Lambert;
+  std::array<int32_t, 3> m_NumSymmetry;
+
+  /**
+   * @brief Bins the coordinates into the upper hemisphere of the stereographic image
+   */
+  void addDiscrete(const float* xyzPtr, size_t numCoords, double* intensity) const
+  {
+    int halfDim = m_Config.imageDim / 2;
+    for(size_t i = 0; i < numCoords; i++)
+    {
+      float sign = (xyzPtr[i * 3 + 2] < 0.0f) ? -1.0f : 1.0f;
+      float z = xyzPtr[i * 3 + 2] * sign;
+      float x = (xyzPtr[i * 3] * sign) / (1 + z);
+      float y = (xyzPtr[i * 3 + 1] * sign) / (1 + z);
+
+      int xCoord = static_cast<int>(x * (halfDim - 1)) + halfDim;
+      int yCoord = static_cast<int>(y * (halfDim - 1)) + halfDim;
+
+      intensity[static_cast<size_t>((yCoord * m_Config.imageDim) + xCoord)]++;
+    }
+  }
+};
+
 } // namespace Detail
 
 // -----------------------------------------------------------------------------
@@ -93,36 +641,159 @@ QuatD LaueOps::getFZQuat(const QuatD& qr) const
 }
 
 // -----------------------------------------------------------------------------
-//
+OrientationD LaueOps::calculateMisorientation(const QuatD& q1, const QuatD& q2) const
+{
+  AxisAngleD axisAngle;
+  calculateMisorientation(q1, q2, axisAngle);
+  return axisAngle.toOrientation();
+}
+
+// -----------------------------------------------------------------------------
+OrientationF LaueOps::calculateMisorientation(const QuatF& q1, const QuatF& q2) const
+{
+  AxisAngleF axisAngle;
+  calculateMisorientation(q1, q2, axisAngle);
+  return axisAngle.toOrientation();
+}
+
+// -----------------------------------------------------------------------------
+void LaueOps::calculateMisorientation(const QuatF& q1f, const QuatF& q2f, AxisAngleF& axisAngle) const
+{
+  AxisAngleD axisAngleD;
+  calculateMisorientation(q1f.to<double>(), q2f.to<double>(), axisAngleD);
+  axisAngle = axisAngleD.to<float>();
+}
+
+// -----------------------------------------------------------------------------
+void LaueOps::setMisorientationCache(const MisorientationCache::Pointer& cache)
+{
+  m_MisorientationCache = cache;
+  // Cache keys carry the index of this Laue class so that a shared cache never mixes results of different symmetries
+  std::vector<LaueOps::Pointer> allOps = GetAllOrientationOps();
+  auto iter = std::find_if(allOps.begin(), allOps.end(), [this](const LaueOps::Pointer& ops) { return ops->getNameOfClass() == getNameOfClass(); });
+  m_MisorientationCacheLaueOps = static_cast<uint32_t>(iter - allOps.begin());
+}
+
+// -----------------------------------------------------------------------------
+MisorientationCache::Pointer LaueOps::getMisorientationCache() const
+{
+  return m_MisorientationCache;
+}
+
+// -----------------------------------------------------------------------------
+void LaueOps::calculateMisorientationCached(const QuatD& q1, const QuatD& q2, AxisAngleD& axisAngle) const
+{
+  if(nullptr == m_MisorientationCache)
+  {
+    calculateMisorientation(q1, q2, axisAngle);
+    return;
+  }
+  MisorientationCache::Key key = MisorientationCache::QuaternionKey(m_MisorientationCacheLaueOps, q1, q2);
+  if(!m_MisorientationCache->find(key, axisAngle))
+  {
+    calculateMisorientation(q1, q2, axisAngle);
+    m_MisorientationCache->insert(key, axisAngle);
+  }
+}
+
+// -----------------------------------------------------------------------------
+void LaueOps::calculateFeatureMisorientation(int32_t feature1, int32_t feature2, const QuatD& q1, const QuatD& q2, AxisAngleD& axisAngle) const
+{
+  if(nullptr == m_MisorientationCache)
+  {
+    calculateMisorientation(q1, q2, axisAngle);
+    return;
+  }
+  MisorientationCache::Key key = MisorientationCache::FeatureKey(m_MisorientationCacheLaueOps, feature1, feature2);
+  if(!m_MisorientationCache->find(key, axisAngle))
+  {
+    calculateMisorientation(q1, q2, axisAngle);
+    m_MisorientationCache->insert(key, axisAngle);
+  }
+}
+
 // -----------------------------------------------------------------------------
-OrientationD LaueOps::calculateMisorientationInternal(const std::vector<QuatD>& quatsym, const QuatD& q1, const QuatD& q2) const
+double LaueOps::calculateMisorientationAngleFZ(const QuatD& q1, const QuatD& q2) const
 {
-  OrientationD axisAngleMin(0.0, 0.0, 0.0, std::numeric_limits<double>::max());
-  QuatD qc;
   QuatD qr = q1 * (q2.conjugate());
-  size_t numsym = quatsym.size();
-  for(size_t i = 0; i < numsym; i++)
+  double w = std::min(std::abs(qr.w()), 1.0);
+  if(w >= getQuatSymmetrySoA().identityScalarThreshold())
   {
-    qc = quatsym[i] * qr;
+    return 2.0 * std::acos(w);
+  }
+  AxisAngleD axisAngle;
+  calculateMisorientation(q1, q2, axisAngle);
+  return axisAngle[3];
+}
 
-    if(qc.w() < -1)
-    {
-      qc.w() = -1.0;
-    }
-    else if(qc.w() > 1)
-    {
-      qc.w() = 1.0;
-    }
+// -----------------------------------------------------------------------------
+OrientationType LaueOps::getODFFZRod(const OrientationType& rod) const
+{
+  return getODFFZRod(RodriguesD(rod)).toOrientation();
+}
 
-    OrientationD axisAngle = OrientationTransformation::qu2ax<QuatD, OrientationType>(qc);
-    if(axisAngle[3] > EbsdLib::Constants::k_PiD)
-    {
-      axisAngle[3] = EbsdLib::Constants::k_2PiD - axisAngle[3];
-    }
-    if(axisAngle[3] < axisAngleMin[3])
-    {
-      axisAngleMin = axisAngle;
-    }
+// -----------------------------------------------------------------------------
+OrientationType LaueOps::getMDFFZRod(const OrientationType& rod) const
+{
+  return getMDFFZRod(RodriguesD(rod)).toOrientation();
+}
+
+// -----------------------------------------------------------------------------
+int LaueOps::getMisoBin(const OrientationType& rod) const
+{
+  return getMisoBin(RodriguesD(rod));
+}
+
+// -----------------------------------------------------------------------------
+OrientationType LaueOps::determineEulerAngles(double random[3], int choose) const
+{
+  EulerD euler;
+  determineEulerAngles(random, choose, euler);
+  return euler.toOrientation();
+}
+
+// -----------------------------------------------------------------------------
+OrientationType LaueOps::randomizeEulerAngles(const OrientationType& euler) const
+{
+  return randomizeEulerAngles(EulerD(euler)).toOrientation();
+}
+
+// -----------------------------------------------------------------------------
+OrientationType LaueOps::determineRodriguesVector(double random[3], int choose) const
+{
+  RodriguesD rod;
+  determineRodriguesVector(random, choose, rod);
+  return rod.toOrientation();
+}
+
+// -----------------------------------------------------------------------------
+int LaueOps::getOdfBin(const OrientationType& rod) const
+{
+  return getOdfBin(RodriguesD(rod));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+AxisAngleD LaueOps::calculateMisorientationInternal(const QuatSymmetrySoA& quatsym, const QuatD& q1, const QuatD& q2) const
+{
+  QuatD qr = q1 * (q2.conjugate());
+
+  // The operator giving the smallest angle is the one with the largest |w|, so only that one gets converted.
+  QuatD qc = quatsym.multiply(quatsym.findMaxAbsScalar(qr), qr);
+  if(qc.w() < -1)
+  {
+    qc.w() = -1.0;
+  }
+  else if(qc.w() > 1)
+  {
+    qc.w() = 1.0;
+  }
+
+  AxisAngleD axisAngleMin = OrientationTransformation::qu2ax(qc);
+  if(axisAngleMin[3] > EbsdLib::Constants::k_PiD)
+  {
+    axisAngleMin[3] = EbsdLib::Constants::k_2PiD - axisAngleMin[3];
   }
   double denom = sqrt((axisAngleMin[0] * axisAngleMin[0] + axisAngleMin[1] * axisAngleMin[1] + axisAngleMin[2] * axisAngleMin[2]));
   axisAngleMin[0] = axisAngleMin[0] / denom;
@@ -141,14 +812,14 @@ OrientationD LaueOps::calculateMisorientationInternal(const std::vector<QuatD>&
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-OrientationType LaueOps::_calcRodNearestOrigin(const std::vector<OrientationD>& rodsym, const OrientationType& inRod) const
+RodriguesD LaueOps::_calcRodNearestOrigin(const std::vector<OrientationD>& rodsym, const RodriguesD& inRod) const
 {
   double denom = 0.0f, dist = 0.0f;
   double smallestdist = 100000000.0f;
   double rc1 = 0.0f, rc2 = 0.0f, rc3 = 0.0f;
-  OrientationType outRod(4, 0.0f);
+  RodriguesD outRod;
   // Turn into an actual 3 Comp Rodrigues Vector
-  OrientationType rod = inRod;
+  RodriguesD rod = inRod;
   rod[0] *= rod[3];
   rod[1] *= rod[3];
   rod[2] *= rod[3];
@@ -186,28 +857,9 @@ OrientationType LaueOps::_calcRodNearestOrigin(const std::vector<OrientationD>&
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-QuatD LaueOps::_calcNearestQuat(const std::vector<QuatD>& quatsym, const QuatD& q1, const QuatD& q2) const
+QuatD LaueOps::_calcNearestQuat(const QuatSymmetrySoA& quatsym, const QuatD& q1, const QuatD& q2) const
 {
-  QuatD out;
-  double dist = 0.0;
-  double smallestdist = 1000000.0f;
-  QuatD qmax;
-  size_t numsym = quatsym.size();
-  for(size_t i = 0; i < numsym; i++)
-  {
-    QuatD qc = quatsym[i] * q2;
-    if(qc.w() < 0)
-    {
-      qc.negate();
-    }
-    dist = static_cast<double>(1 - (qc.w() * q1.w() + qc.x() * q1.x() + qc.y() * q1.y() + qc.z() * q1.z()));
-    if(dist < smallestdist)
-    {
-      smallestdist = dist;
-      qmax = qc;
-    }
-  }
-  out = qmax;
+  QuatD out = quatsym.multiply(quatsym.findNearest(q1, q2), q2);
   if(out.w() < 0)
   {
     out.negate();
@@ -215,25 +867,9 @@ QuatD LaueOps::_calcNearestQuat(const std::vector<QuatD>& quatsym, const QuatD&
   return out;
 }
 
-QuatD LaueOps::_calcQuatNearestOrigin(const std::vector<QuatD>& quatsym, const QuatD& qr) const
+QuatD LaueOps::_calcQuatNearestOrigin(const QuatSymmetrySoA& quatsym, const QuatD& qr) const
 {
-  double dist = 0.0;
-  double smallestdist = 1000000.0f;
-  QuatD qmax;
-  size_t numsym = quatsym.size();
-  for(size_t i = 0; i < numsym; i++)
-  {
-    QuatD qc = quatsym[i] * qr;
-
-    dist = 1 - (qc.w() * qc.w());
-    if(dist < smallestdist)
-    {
-      smallestdist = dist;
-      qmax = qc;
-    }
-  }
-  QuatD out = qmax;
-
+  QuatD out = quatsym.multiply(quatsym.findMaxAbsScalar(qr), qr);
   if(out.w() < 0)
   {
     out.negate();
@@ -241,7 +877,7 @@ QuatD LaueOps::_calcQuatNearestOrigin(const std::vector<QuatD>& quatsym, const Q
   return out;
 }
 
-int LaueOps::_calcMisoBin(double dim[3], double bins[3], double step[3], const OrientationType& ho) const
+int LaueOps::_calcMisoBin(double dim[3], double bins[3], double step[3], const HomochoricD& ho) const
 {
   int miso1bin = int((ho[0] + dim[0]) / step[0]);
   int miso2bin = int((ho[1] + dim[1]) / step[1]);
@@ -283,7 +919,7 @@ void LaueOps::_calcDetermineHomochoricValues(double random[3], double init[3], d
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-int LaueOps::_calcODFBin(double dim[3], double bins[3], double step[3], const OrientationType& ho) const
+int LaueOps::_calcODFBin(double dim[3], double bins[3], double step[3], const HomochoricD& ho) const
 {
   int g1euler1bin;
   int g1euler2bin;
@@ -416,20 +1052,7 @@ std::vector<std::string> LaueOps::GetLaueNames()
 // -----------------------------------------------------------------------------
 size_t LaueOps::getRandomSymmetryOperatorIndex(int numSymOps) const
 {
-
-  using SizeTDistributionType = std::uniform_int_distribution<size_t>;
-
-  const SizeTDistributionType::result_type rangeMin = 0;
-  const SizeTDistributionType::result_type rangeMax = static_cast<SizeTDistributionType::result_type>(numSymOps - 1);
-
-  std::random_device randomDevice;           // Will be used to obtain a seed for the random number engine
-  std::mt19937_64 generator(randomDevice()); // Standard mersenne_twister_engine seeded with rd()
-  std::mt19937_64::result_type seed = static_cast<std::mt19937_64::result_type>(std::chrono::steady_clock::now().time_since_epoch().count());
-  generator.seed(seed);
-  SizeTDistributionType distribution(rangeMin, rangeMax);
-
-  size_t symOp = distribution(generator); // Random remaining position.
-  return symOp;
+  return EbsdLibRandomEngine::ThreadLocal().generateIndex(static_cast<size_t>(numSymOps));
 }
 
 // -----------------------------------------------------------------------------
@@ -456,3 +1079,131 @@ EbsdLib::Rgb LaueOps::generateMisorientationColor(const QuatD& q, const QuatD& r
   throw std::runtime_error("LaueOps::generateMisorientationColor is not implemented.");
 }
 
+// -----------------------------------------------------------------------------
+void LaueOps::calculateMisorientations(const float* q1s, const float* q2s, size_t numQuats, float* axisAngles, const bool* mask, bool useCache) const
+{
+  std::vector<const LaueOps*> phaseOps = {this};
+  Detail::RunBatch(phaseOps, nullptr, mask, numQuats, Detail::MisorientationKernel(q1s, q2s, axisAngles, useCache));
+}
+
+// -----------------------------------------------------------------------------
+void LaueOps::toFundamentalZone(float* quats, size_t numQuats, const bool* mask) const
+{
+  std::vector<const LaueOps*> phaseOps = {this};
+  Detail::RunBatch(phaseOps, nullptr, mask, numQuats, Detail::FundamentalZoneKernel(quats));
+}
+
+// -----------------------------------------------------------------------------
+void LaueOps::generateIPFColors(const float* eulers, size_t numPoints, const double refDir[3], uint8_t* rgbOut, const bool* mask, bool convertDegrees) const
+{
+  std::vector<const LaueOps*> phaseOps = {this};
+  Detail::RunBatch(phaseOps, nullptr, mask, numPoints, Detail::IPFColorKernel(eulers, refDir, rgbOut, convertDegrees));
+}
+
+// -----------------------------------------------------------------------------
+void LaueOps::calculateMisorientationAnglesFZ(const float* q1s, const float* q2s, size_t numQuats, float* angles, const bool* mask) const
+{
+  std::vector<const LaueOps*> phaseOps = {this};
+  Detail::RunBatch(phaseOps, nullptr, mask, numQuats, Detail::MisorientationAngleFZKernel(q1s, q2s, angles));
+}
+
+// -----------------------------------------------------------------------------
+std::array<EbsdLib::DoubleArrayType::Pointer, 3> LaueOps::generatePoleFigureIntensities(const PoleFigureConfiguration_t& config, const std::array<std::string, 3>& names) const
+{
+  size_t numOrientations = config.eulers->getNumberOfTuples();
+  size_t numPixels = static_cast<size_t>(config.imageDim) * static_cast<size_t>(config.imageDim);
+
+  ModifiedLambertProjection::Pointer lambert = ModifiedLambertProjection::New();
+  lambert->initializeSquares(config.lambertDim, config.sphereRadius);
+
+  Detail::PoleFigureIntensityImpl serial(*this, config, *lambert);
+  Detail::PoleFigureIntensityImpl::Accumulators accumulators;
+  for(auto& accumulator : accumulators)
+  {
+    accumulator.resize(serial.getAccumulatorSize(), 0.0);
+  }
+
+#ifdef EbsdLib_USE_PARALLEL_ALGORITHMS
+  bool doParallel = true;
+  if(doParallel)
+  {
+    Detail::PoleFigureIntensityImpl::ThreadAccumulators threadAccumulators;
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(0, numOrientations, Detail::k_PoleFigureBlockSize), [&](const tbb::blocked_range<size_t>& r) { serial(r, threadAccumulators); }, tbb::auto_partitioner());
+    for(const auto& local : threadAccumulators)
+    {
+      for(size_t f = 0; f < 3; f++)
+      {
+        if(!local[f].empty())
+        {
+          std::transform(local[f].begin(), local[f].end(), accumulators[f].begin(), accumulators[f].begin(), std::plus<>());
+        }
+      }
+    }
+  }
+  else
+#endif
+  {
+    serial.generate(0, numOrientations, accumulators);
+  }
+
+  std::array<EbsdLib::DoubleArrayType::Pointer, 3> intensities;
+  for(size_t f = 0; f < 3; f++)
+  {
+    intensities[f] = EbsdLib::DoubleArrayType::CreateArray(numPixels, names[f], true);
+    intensities[f]->initializeWithZeros();
+    if(config.discrete)
+    {
+      std::copy(accumulators[f].begin(), accumulators[f].end(), intensities[f]->begin());
+      continue;
+    }
+    size_t squareSize = accumulators[f].size() / 2;
+    std::copy(accumulators[f].begin(), accumulators[f].begin() + squareSize, lambert->getNorthSquare()->begin());
+    std::copy(accumulators[f].begin() + squareSize, accumulators[f].end(), lambert->getSouthSquare()->begin());
+    lambert->normalizeSquaresToMRD();
+    lambert->createStereographicProjection(config.imageDim, *intensities[f]);
+  }
+  return intensities;
+}
+
+// -----------------------------------------------------------------------------
+void LaueOps::randomizeEulerAngles(float* eulers, size_t numEulers, uint64_t seed, const bool* mask) const
+{
+  std::vector<const LaueOps*> phaseOps = {this};
+  Detail::RunBatch(phaseOps, nullptr, mask, numEulers, Detail::RandomizeEulerKernel(eulers, seed));
+}
+
+// -----------------------------------------------------------------------------
+void LaueOps::CalculateMisorientations(const float* q1s, const float* q2s, const int32_t* phases, const uint32_t* crystalStructures, size_t numPhases, size_t numQuats, float* axisAngles,
+                                       const bool* mask)
+{
+  std::vector<LaueOps::Pointer> allOps = GetAllOrientationOps();
+  std::vector<const LaueOps*> phaseOps = Detail::PhaseOps(allOps, crystalStructures, numPhases);
+  Detail::RunBatch(phaseOps, phases, mask, numQuats, Detail::MisorientationKernel(q1s, q2s, axisAngles, false));
+}
+
+// -----------------------------------------------------------------------------
+void LaueOps::ToFundamentalZone(float* quats, const int32_t* phases, const uint32_t* crystalStructures, size_t numPhases, size_t numQuats, const bool* mask)
+{
+  std::vector<LaueOps::Pointer> allOps = GetAllOrientationOps();
+  std::vector<const LaueOps*> phaseOps = Detail::PhaseOps(allOps, crystalStructures, numPhases);
+  Detail::RunBatch(phaseOps, phases, mask, numQuats, Detail::FundamentalZoneKernel(quats));
+}
+
+// -----------------------------------------------------------------------------
+void LaueOps::GenerateIPFColors(const float* eulers, const int32_t* phases, const uint32_t* crystalStructures, size_t numPhases, size_t numPoints, const double refDir[3], uint8_t* rgbOut,
+                                const bool* mask, bool convertDegrees)
+{
+  std::vector<LaueOps::Pointer> allOps = GetAllOrientationOps();
+  std::vector<const LaueOps*> phaseOps = Detail::PhaseOps(allOps, crystalStructures, numPhases);
+  Detail::RunBatch(phaseOps, phases, mask, numPoints, Detail::IPFColorKernel(eulers, refDir, rgbOut, convertDegrees));
+}
+
+// -----------------------------------------------------------------------------
+void LaueOps::CalculateMisorientationAnglesFZ(const float* q1s, const float* q2s, const int32_t* phases, const uint32_t* crystalStructures, size_t numPhases, size_t numQuats, float* angles,
+                                              const bool* mask)
+{
+  std::vector<LaueOps::Pointer> allOps = GetAllOrientationOps();
+  std::vector<const LaueOps*> phaseOps = Detail::PhaseOps(allOps, crystalStructures, numPhases);
+  Detail::RunBatch(phaseOps, phases, mask, numQuats, Detail::MisorientationAngleFZKernel(q1s, q2s, angles));
+}
@@ -34,15 +34,19 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #pragma once
 
+#include <array>
 #include <memory>
 #include <string>
 #include <vector>
 
 #include "EbsdLib/Core/EbsdDataArray.hpp"
+#include "EbsdLib/Core/FixedOrientation.hpp"
 #include "EbsdLib/Core/Orientation.hpp"
 #include "EbsdLib/Core/OrientationTransformation.hpp"
 #include "EbsdLib/Core/Quaternion.hpp"
 #include "EbsdLib/EbsdLib.h"
+#include "EbsdLib/LaueOps/MisorientationCache.h"
+#include "EbsdLib/LaueOps/QuatSymmetrySoA.hpp"
 #include "EbsdLib/Math/Matrix3X1.hpp"
 #include "EbsdLib/Math/Matrix3X3.hpp"
 #include "EbsdLib/Utilities/PoleFigureUtilities.h"
@@ -146,7 +150,7 @@ public:
    * @param q2 Input Quaternion
    * @return Axis Angle Representation
    */
-  virtual OrientationD calculateMisorientation(const QuatD& q1, const QuatD& q2) const = 0;
+  virtual OrientationD calculateMisorientation(const QuatD& q1, const QuatD& q2) const;
 
   /**
    * @brief calculateMisorientation Finds the misorientation between 2 quaternions and returns the result as an Axis Angle value
@@ -154,7 +158,74 @@ public:
    * @param q2 Input Quaternion
    * @return Axis Angle Representation
    */
-  virtual OrientationF calculateMisorientation(const QuatF& q1, const QuatF& q2) const = 0;
+  virtual OrientationF calculateMisorientation(const QuatF& q1, const QuatF& q2) const;
+
+  /**
+   * @brief calculateMisorientation Finds the misorientation between 2 quaternions and stores the result as an Axis Angle value.
+   * This version does not allocate any memory.
+   * @param q1 Input Quaternion
+   * @param q2 Input Quaternion
+   * @param axisAngle [output] Axis Angle Representation
+   */
+  virtual void calculateMisorientation(const QuatD& q1, const QuatD& q2, AxisAngleD& axisAngle) const = 0;
+
+  /**
+   * @brief calculateMisorientation Finds the misorientation between 2 quaternions and stores the result as an Axis Angle value.
+   * This version does not allocate any memory.
+   * @param q1 Input Quaternion
+   * @param q2 Input Quaternion
+   * @param axisAngle [output] Axis Angle Representation
+   */
+  virtual void calculateMisorientation(const QuatF& q1, const QuatF& q2, AxisAngleF& axisAngle) const;
+
+  /**
+   * @brief setMisorientationCache Attaches a cache that calculateMisorientationCached() and
+   * calculateFeatureMisorientation() use. Pass a null pointer to detach the cache. The cache must not be changed
+   * while other threads are computing misorientations with this object.
+   * @param cache
+   */
+  void setMisorientationCache(const MisorientationCache::Pointer& cache);
+
+  /**
+   * @brief getMisorientationCache Returns the attached cache, which may be a null pointer
+   */
+  MisorientationCache::Pointer getMisorientationCache() const;
+
+  /**
+   * @brief calculateMisorientationCached Same as calculateMisorientation() except that the result is looked up in
+   * the attached cache first using the quantized relative rotation of the pair as the key, so a hit skips the
+   * symmetry search. Cached angles can differ from the exact ones by up to about 1.25E-4 radians and the cached
+   * axis is only defined up to a symmetry operator (see MisorientationCache). Without a cache this simply calls
+   * calculateMisorientation().
+   * @param q1 Input Quaternion
+   * @param q2 Input Quaternion
+   * @param axisAngle [output] Axis Angle Representation
+   */
+  void calculateMisorientationCached(const QuatD& q1, const QuatD& q2, AxisAngleD& axisAngle) const;
+
+  /**
+   * @brief calculateFeatureMisorientation Same as calculateMisorientation() except that the result is looked up in
+   * the attached cache first using the pair of feature ids as the key. The caller is responsible for the
+   * quaternions belonging to those features.
+   * @param feature1 Feature id of q1
+   * @param feature2 Feature id of q2
+   * @param q1 Input Quaternion
+   * @param q2 Input Quaternion
+   * @param axisAngle [output] Axis Angle Representation
+   */
+  void calculateFeatureMisorientation(int32_t feature1, int32_t feature2, const QuatD& q1, const QuatD& q2, AxisAngleD& axisAngle) const;
+
+  /**
+   * @brief calculateMisorientationAngleFZ Returns the misorientation angle (Radians) between two quaternions that
+   * were already moved into the Fundamental Zone with getFZQuat(). Neighboring points of the same grain then sit
+   * in the same symmetric copy, so when their relative rotation is small enough the identity operator is known to
+   * be the closest one and the symmetry search is skipped. Any other pair falls back to calculateMisorientation(),
+   * so the angle is always the same as the one calculateMisorientation() returns.
+   * @param q1 Input Quaternion, already in the Fundamental Zone
+   * @param q2 Input Quaternion, already in the Fundamental Zone
+   * @return Misorientation angle in Radians
+   */
+  double calculateMisorientationAngleFZ(const QuatD& q1, const QuatD& q2) const;
 
   /**
    * @brief getQuatSymOp Returns the symmetry operator at index i
@@ -185,14 +256,16 @@ public:
    * @param rod
    * @return
    */
-  virtual OrientationType getODFFZRod(const OrientationType& rod) const = 0;
+  virtual OrientationType getODFFZRod(const OrientationType& rod) const;
+  virtual RodriguesD getODFFZRod(const RodriguesD& rod) const = 0;
 
   /**
    * @brief getMDFFZRod
    * @param rod
    * @return
    */
-  virtual OrientationType getMDFFZRod(const OrientationType& rod) const = 0;
+  virtual OrientationType getMDFFZRod(const OrientationType& rod) const;
+  virtual RodriguesD getMDFFZRod(const RodriguesD& rod) const = 0;
 
   virtual QuatD getNearestQuat(const QuatD& q1, const QuatD& q2) const = 0;
   virtual QuatF getNearestQuat(const QuatF& q1f, const QuatF& q2f) const = 0;
@@ -204,24 +277,53 @@ public:
    */
   virtual QuatD getFZQuat(const QuatD& qr) const;
 
+  /**
+   * @brief getQuatSymmetrySoA Returns the symmetry quaternions of this Laue class in the SIMD friendly layout
+   */
+  virtual const QuatSymmetrySoA& getQuatSymmetrySoA() const = 0;
+
   /**
    * @brief getMisoBin Returns the misorientation bin that the input Rodregues vector lies in.
    * @param rod
    * @return
    */
-  virtual int getMisoBin(const OrientationType& rod) const = 0;
+  virtual int getMisoBin(const OrientationType& rod) const;
+  virtual int getMisoBin(const RodriguesD& rod) const = 0;
 
   virtual bool inUnitTriangle(double eta, double chi) const = 0;
 
-  virtual OrientationType determineEulerAngles(double random[3], int choose) const = 0;
+  virtual OrientationType determineEulerAngles(double random[3], int choose) const;
 
-  virtual OrientationType randomizeEulerAngles(const OrientationType& euler) const = 0;
+  /**
+   * @brief determineEulerAngles Picks a random orientation inside the ODF bin `choose`
+   * @param random 3 random values in the range [0, 1)
+   * @param choose The ODF bin
+   * @param euler [output] The Euler angles of the orientation
+   */
+  virtual void determineEulerAngles(double random[3], int choose, EulerD& euler) const = 0;
 
+  virtual OrientationType randomizeEulerAngles(const OrientationType& euler) const;
+  virtual EulerD randomizeEulerAngles(const EulerD& euler) const = 0;
+
+  /**
+   * @brief getRandomSymmetryOperatorIndex Returns a random index in [0, numSymOps) drawn from the
+   * engine of the calling thread (see EbsdLibRandomEngine).
+   * @param numSymOps The number of symmetry operators
+   */
   virtual size_t getRandomSymmetryOperatorIndex(int numSymOps) const;
 
-  virtual OrientationType determineRodriguesVector(double random[3], int choose) const = 0;
+  virtual OrientationType determineRodriguesVector(double random[3], int choose) const;
+
+  /**
+   * @brief determineRodriguesVector Picks a random orientation inside the MDF bin `choose`
+   * @param random 3 random values in the range [0, 1)
+   * @param choose The MDF bin
+   * @param rod [output] The Rodrigues vector of the orientation
+   */
+  virtual void determineRodriguesVector(double random[3], int choose, RodriguesD& rod) const = 0;
 
-  virtual int getOdfBin(const OrientationType& rod) const = 0;
+  virtual int getOdfBin(const OrientationType& rod) const;
+  virtual int getOdfBin(const RodriguesD& rod) const = 0;
 
   virtual void getSchmidFactorAndSS(double load[3], double& schmidfactor, double angleComps[2], int& slipsys) const = 0;
 
@@ -287,34 +389,165 @@ public:
    */
   virtual std::vector<EbsdLib::UInt8ArrayType::Pointer> generatePoleFigure(PoleFigureConfiguration_t& config) const = 0;
 
+  /**
+   * @brief generatePoleFigureIntensities Computes the stereographic intensity images of the three pole figure
+   * families. Blocks of orientations are converted to sphere coordinates with generateSphereCoordsFromEulers()
+   * and added straight into per thread Lambert squares (or discrete images) so the coordinates of all the
+   * orientations are never held in memory at the same time.
+   * @param config The pole figure configuration. The eulers, imageDim, lambertDim, sphereRadius and discrete members are used.
+   * @param names The names of the 3 intensity arrays
+   * @return The 3 intensity images, imageDim * imageDim values each
+   */
+  std::array<EbsdLib::DoubleArrayType::Pointer, 3> generatePoleFigureIntensities(const PoleFigureConfiguration_t& config, const std::array<std::string, 3>& names) const;
+
   /**
    * @brief Returns the names for each of the three standard pole figures that are generated. For example
    *<001>, <011> and <111> for a cubic system
    */
   virtual std::array<std::string, 3> getDefaultPoleFigureNames() const = 0;
 
+  /**
+   * @brief generateIPFTriangleLegend Generates an ARGB image of the standard IPF triangle legend for this Laue class.
+   * The rows are rendered in parallel when parallel algorithms are enabled. Use IPFLegendCache to reuse legends.
+   * @param imageDim The width and height of the image in pixels
+   * @return The legend image, 4 components per pixel
+   */
+  virtual EbsdLib::UInt8ArrayType::Pointer generateIPFTriangleLegend(int imageDim) const = 0;
+
+  /**
+   * @brief calculateMisorientations Finds the misorientation between each pair of quaternions in the two input
+   * arrays. The work is split across threads when parallel algorithms are enabled.
+   * @param q1s Input Quaternions, 4 values per orientation in <XYZ>W order
+   * @param q2s Input Quaternions, 4 values per orientation in <XYZ>W order
+   * @param numQuats The number of quaternion pairs
+   * @param axisAngles [output] Axis Angle values, 4 values per pair in <XYZ>W order
+   * @param mask Optional mask. Pairs whose mask value is false are set to zero.
+   * @param useCache Look each pair up in the attached MisorientationCache with calculateMisorientationCached(). The
+   * results are then quantized and can differ from the exact ones by up to about 1.25E-4 radians. The default computes
+   * every pair exactly, even if a cache is attached.
+   */
+  void calculateMisorientations(const float* q1s, const float* q2s, size_t numQuats, float* axisAngles, const bool* mask = nullptr, bool useCache = false) const;
+
+  /**
+   * @brief toFundamentalZone Moves each quaternion in the array into the Fundamental Zone, in place.
+   * @param quats Quaternions, 4 values per orientation in <XYZ>W order
+   * @param numQuats The number of quaternions
+   * @param mask Optional mask. Quaternions whose mask value is false are left untouched.
+   */
+  void toFundamentalZone(float* quats, size_t numQuats, const bool* mask = nullptr) const;
+
+  /**
+   * @brief generateIPFColors Generates the IPF color for each Euler angle in the array.
+   * @param eulers Euler angles, 3 values per orientation
+   * @param numPoints The number of orientations
+   * @param refDir The 3 Component Reference Direction
+   * @param rgbOut [output] RGB values, 3 bytes per orientation
+   * @param mask Optional mask. Points whose mask value is false are colored black.
+   * @param convertDegrees Are the input angles in Degrees
+   */
+  void generateIPFColors(const float* eulers, size_t numPoints, const double refDir[3], uint8_t* rgbOut, const bool* mask = nullptr, bool convertDegrees = false) const;
+
+  /**
+   * @brief calculateMisorientationAnglesFZ Batch version of calculateMisorientationAngleFZ().
+   * @param q1s Input Quaternions in the Fundamental Zone, 4 values per orientation in <XYZ>W order
+   * @param q2s Input Quaternions in the Fundamental Zone, 4 values per orientation in <XYZ>W order
+   * @param numQuats The number of quaternion pairs
+   * @param angles [output] Misorientation angle in Radians, 1 value per pair
+   * @param mask Optional mask. Pairs whose mask value is false are set to zero.
+   */
+  void calculateMisorientationAnglesFZ(const float* q1s, const float* q2s, size_t numQuats, float* angles, const bool* mask = nullptr) const;
+
+  /**
+   * @brief randomizeEulerAngles Batch version of randomizeEulerAngles(). Each orientation is
+   * rotated by a random symmetry operator drawn from its own stream of the seed so the output
+   * is reproducible for a given seed regardless of the number of threads.
+   * @param eulers [input/output] Euler angles in Radians, 3 values per orientation
+   * @param numEulers The number of orientations
+   * @param seed The random seed
+   * @param mask Optional mask. Orientations whose mask value is false are left unchanged.
+   */
+  void randomizeEulerAngles(float* eulers, size_t numEulers, uint64_t seed, const bool* mask = nullptr) const;
+
+  /**
+   * @brief CalculateMisorientations Multi-phase version of calculateMisorientations(). The LaueOps for each pair
+   * is looked up through the phase of the pair and the crystal structure of that phase.
+   * @param q1s Input Quaternions, 4 values per orientation in <XYZ>W order
+   * @param q2s Input Quaternions, 4 values per orientation in <XYZ>W order
+   * @param phases The phase of each pair
+   * @param crystalStructures The crystal structure (EbsdLib::CrystalStructure) of each phase
+   * @param numPhases The number of values in crystalStructures
+   * @param numQuats The number of quaternion pairs
+   * @param axisAngles [output] Axis Angle values, 4 values per pair in <XYZ>W order
+   * @param mask Optional mask. Masked pairs and pairs with an invalid phase are set to zero.
+   */
+  static void CalculateMisorientations(const float* q1s, const float* q2s, const int32_t* phases, const uint32_t* crystalStructures, size_t numPhases, size_t numQuats, float* axisAngles,
+                                       const bool* mask = nullptr);
+
+  /**
+   * @brief ToFundamentalZone Multi-phase version of toFundamentalZone().
+   * @param quats Quaternions, 4 values per orientation in <XYZ>W order
+   * @param phases The phase of each quaternion
+   * @param crystalStructures The crystal structure (EbsdLib::CrystalStructure) of each phase
+   * @param numPhases The number of values in crystalStructures
+   * @param numQuats The number of quaternions
+   * @param mask Optional mask. Masked quaternions and quaternions with an invalid phase are left untouched.
+   */
+  static void ToFundamentalZone(float* quats, const int32_t* phases, const uint32_t* crystalStructures, size_t numPhases, size_t numQuats, const bool* mask = nullptr);
+
+  /**
+   * @brief GenerateIPFColors Multi-phase version of generateIPFColors().
+   * @param eulers Euler angles, 3 values per orientation
+   * @param phases The phase of each orientation
+   * @param crystalStructures The crystal structure (EbsdLib::CrystalStructure) of each phase
+   * @param numPhases The number of values in crystalStructures
+   * @param numPoints The number of orientations
+   * @param refDir The 3 Component Reference Direction
+   * @param rgbOut [output] RGB values, 3 bytes per orientation
+   * @param mask Optional mask. Masked points and points with an invalid phase are colored black.
+   * @param convertDegrees Are the input angles in Degrees
+   */
+  static void GenerateIPFColors(const float* eulers, const int32_t* phases, const uint32_t* crystalStructures, size_t numPhases, size_t numPoints, const double refDir[3], uint8_t* rgbOut,
+                                const bool* mask = nullptr, bool convertDegrees = false);
+
+  /**
+   * @brief CalculateMisorientationAnglesFZ Multi-phase version of calculateMisorientationAnglesFZ().
+   * @param q1s Input Quaternions in the Fundamental Zone, 4 values per orientation in <XYZ>W order
+   * @param q2s Input Quaternions in the Fundamental Zone, 4 values per orientation in <XYZ>W order
+   * @param phases The phase of each pair
+   * @param crystalStructures The crystal structure (EbsdLib::CrystalStructure) of each phase
+   * @param numPhases The number of values in crystalStructures
+   * @param numQuats The number of quaternion pairs
+   * @param angles [output] Misorientation angle in Radians, 1 value per pair
+   * @param mask Optional mask. Masked pairs and pairs with an invalid phase are set to zero.
+   */
+  static void CalculateMisorientationAnglesFZ(const float* q1s, const float* q2s, const int32_t* phases, const uint32_t* crystalStructures, size_t numPhases, size_t numQuats, float* angles,
+                                              const bool* mask = nullptr);
+
 protected:
   LaueOps();
 
   /**
    * @brief calculateMisorientationInternal
    * @param quatsym The Symmetry Quarternions from the specific Laue class
-   * @param numsym The number of Symmetry Quaternions
    * @param q1 Input Quaternion 1
    * @param q2 Input Quaternion 2
    * @return Returns Axis-Angle <XYZ>W form.
    */
-  virtual OrientationD calculateMisorientationInternal(const std::vector<QuatD>& quatsym, const QuatD& q1, const QuatD& q2) const;
+  virtual AxisAngleD calculateMisorientationInternal(const QuatSymmetrySoA& quatsym, const QuatD& q1, const QuatD& q2) const;
 
-  OrientationType _calcRodNearestOrigin(const std::vector<OrientationD>& rodsym, const OrientationType& rod) const;
+  RodriguesD _calcRodNearestOrigin(const std::vector<OrientationD>& rodsym, const RodriguesD& rod) const;
 
-  QuatD _calcNearestQuat(const std::vector<QuatD>& quatsym, const QuatD& q1, const QuatD& q2) const;
+  QuatD _calcNearestQuat(const QuatSymmetrySoA& quatsym, const QuatD& q1, const QuatD& q2) const;
 
-  QuatD _calcQuatNearestOrigin(const std::vector<QuatD>& quatsym, const QuatD& qr) const;
+  QuatD _calcQuatNearestOrigin(const QuatSymmetrySoA& quatsym, const QuatD& qr) const;
 
-  int _calcMisoBin(double dim[3], double bins[3], double step[3], const OrientationType& homochoric) const;
+  int _calcMisoBin(double dim[3], double bins[3], double step[3], const HomochoricD& homochoric) const;
   void _calcDetermineHomochoricValues(double random[3], double init[3], double step[3], int32_t phi[3], double& r1, double& r2, double& r3) const;
-  int _calcODFBin(double dim[3], double bins[3], double step[3], const OrientationType& homochoric) const;
+  int _calcODFBin(double dim[3], double bins[3], double step[3], const HomochoricD& homochoric) const;
+
+private:
+  MisorientationCache::Pointer m_MisorientationCache;
+  uint32_t m_MisorientationCacheLaueOps = 0;
 
 public:
   LaueOps(const LaueOps&) = delete;            // Copy Constructor Not Implemented
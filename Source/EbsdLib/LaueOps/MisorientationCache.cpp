@@ -0,0 +1,212 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#include "MisorientationCache.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace
+{
+// -----------------------------------------------------------------------------
+uint64_t MixBits(uint64_t value)
+{
+  // splitmix64 finalizer
+  value ^= value >> 30;
+  value *= 0xbf58476d1ce4e5b9ULL;
+  value ^= value >> 27;
+  value *= 0x94d049bb133111ebULL;
+  value ^= value >> 31;
+  return value;
+}
+
+// -----------------------------------------------------------------------------
+uint64_t QuantizeQuaternion(const QuatD& q)
+{
+  // q and -q are the same rotation so always use the northern hemisphere. The largest quantized value is
+  // 65534 so that a quaternion key can never collide with a feature key.
+  double sign = (q.w() < 0.0) ? -1.0 : 1.0;
+  uint64_t packed = 0;
+  for(size_t i = 0; i < 4; i++)
+  {
+    double value = std::clamp(sign * q[i], -1.0, 1.0);
+    uint64_t bits = static_cast<uint64_t>(std::lround((value + 1.0) * 0.5 * 65534.0));
+    packed = (packed << 16) | bits;
+  }
+  return packed;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+MisorientationCache::MisorientationCache(size_t maxEntries)
+: m_MaxEntries(maxEntries)
+, m_ShardCapacity(std::max<size_t>(1, (maxEntries + k_NumShards - 1) / k_NumShards))
+{
+}
+
+// -----------------------------------------------------------------------------
+MisorientationCache::~MisorientationCache() = default;
+
+// -----------------------------------------------------------------------------
+size_t MisorientationCache::KeyHash::operator()(const Key& key) const
+{
+  return static_cast<size_t>(MixBits(key.first ^ MixBits(key.second ^ MixBits(key.laueOps))));
+}
+
+// -----------------------------------------------------------------------------
+MisorientationCache::Key MisorientationCache::QuaternionKey(uint32_t laueOps, const QuatD& q1, const QuatD& q2)
+{
+  return {QuantizeQuaternion(q1 * (q2.conjugate())), 0, laueOps};
+}
+
+// -----------------------------------------------------------------------------
+MisorientationCache::Key MisorientationCache::FeatureKey(uint32_t laueOps, int32_t feature1, int32_t feature2)
+{
+  uint64_t packed = (static_cast<uint64_t>(static_cast<uint32_t>(feature1)) << 32) | static_cast<uint64_t>(static_cast<uint32_t>(feature2));
+  return {packed, std::numeric_limits<uint64_t>::max(), laueOps};
+}
+
+// -----------------------------------------------------------------------------
+MisorientationCache::Shard& MisorientationCache::shardForKey(const Key& key)
+{
+  return m_Shards[KeyHash()(key) % k_NumShards];
+}
+
+// -----------------------------------------------------------------------------
+bool MisorientationCache::find(const Key& key, AxisAngleD& axisAngle)
+{
+  Shard& shard = shardForKey(key);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  auto iter = shard.current.find(key);
+  if(iter != shard.current.end())
+  {
+    axisAngle = iter->second;
+    m_Hits++;
+    return true;
+  }
+  iter = shard.previous.find(key);
+  if(iter != shard.previous.end())
+  {
+    axisAngle = iter->second;
+    shard.previous.erase(iter);
+    // Promote the entry. A full current generation is rotated first, exactly as insert() does, so the hot entry
+    // is never dropped.
+    if(shard.current.size() >= m_ShardCapacity)
+    {
+      m_Evictions += shard.previous.size();
+      shard.previous = std::move(shard.current);
+      shard.current = MapType();
+    }
+    shard.current.emplace(key, axisAngle);
+    m_Hits++;
+    return true;
+  }
+  m_Misses++;
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+void MisorientationCache::insert(const Key& key, const AxisAngleD& axisAngle)
+{
+  Shard& shard = shardForKey(key);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  if(shard.current.size() >= m_ShardCapacity)
+  {
+    m_Evictions += shard.previous.size();
+    shard.previous = std::move(shard.current);
+    shard.current = MapType();
+  }
+  shard.current.insert_or_assign(key, axisAngle);
+}
+
+// -----------------------------------------------------------------------------
+void MisorientationCache::clear()
+{
+  for(auto& shard : m_Shards)
+  {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    shard.current.clear();
+    shard.previous.clear();
+  }
+  m_Hits = 0;
+  m_Misses = 0;
+  m_Evictions = 0;
+}
+
+// -----------------------------------------------------------------------------
+MisorientationCache::Statistics MisorientationCache::getStatistics() const
+{
+  Statistics stats;
+  stats.hits = m_Hits;
+  stats.misses = m_Misses;
+  stats.evictions = m_Evictions;
+  for(const auto& shard : m_Shards)
+  {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    stats.size += shard.current.size() + shard.previous.size();
+  }
+  return stats;
+}
+
+// -----------------------------------------------------------------------------
+size_t MisorientationCache::getMaxEntries() const
+{
+  return m_MaxEntries;
+}
+
+// -----------------------------------------------------------------------------
+MisorientationCache::Pointer MisorientationCache::NullPointer()
+{
+  return Pointer(static_cast<Self*>(nullptr));
+}
+
+// -----------------------------------------------------------------------------
+MisorientationCache::Pointer MisorientationCache::New(size_t maxEntries)
+{
+  Pointer sharedPtr(new MisorientationCache(maxEntries));
+  return sharedPtr;
+}
+
+// -----------------------------------------------------------------------------
+std::string MisorientationCache::getNameOfClass() const
+{
+  return std::string("MisorientationCache");
+}
+
+// -----------------------------------------------------------------------------
+std::string MisorientationCache::ClassName()
+{
+  return std::string("MisorientationCache");
+}
@@ -0,0 +1,207 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "EbsdLib/Core/FixedOrientation.hpp"
+#include "EbsdLib/Core/Quaternion.hpp"
+#include "EbsdLib/EbsdLib.h"
+
+/**
+ * @brief The MisorientationCache class is a bounded, thread safe cache of misorientation results. Entries are
+ * keyed either by a pair of quantized quaternions or by a pair of feature ids, together with the index of the
+ * LaueOps that computed the result so that one cache can be shared between Laue classes. The cache is split into
+ * shards that each have their own lock so that parallel neighbor sweeps do not serialize on a single mutex.
+ *
+ * Each shard keeps two generations of entries. New entries go into the current generation; when it is full the
+ * current generation becomes the previous one and the old previous generation is dropped. Hits in the previous
+ * generation are moved back into the current one. The memory use is therefore bounded by twice the capacity while
+ * entries that are still being used survive an eviction.
+ *
+ * Quaternion keys quantize each component of the relative rotation q1 * q2^-1 of a pair to 16 bits after moving
+ * it into the northern hemisphere. The misorientation only depends on that relative rotation, so building a key
+ * costs one quaternion product and no symmetry reduction. Two pairs that round to the same key share a result.
+ * Each component of their relative rotations then differs by less than one 2/65534 step, so the cached
+ * misorientation angle differs from the exact one by at most about 1.25E-4 radians. The cached axis is the one
+ * of the pair that was inserted first. It is only defined up to a symmetry operator: close to a tie between two
+ * operators the exact axis of another pair with the same key can be a symmetrically equivalent one. Feature id
+ * keys are exact.
+ */
+class EbsdLib_EXPORT MisorientationCache
+{
+public:
+  using Self = MisorientationCache;
+  using Pointer = std::shared_ptr<Self>;
+  using ConstPointer = std::shared_ptr<const Self>;
+  using WeakPointer = std::weak_ptr<Self>;
+  using ConstWeakPointer = std::weak_ptr<const Self>;
+  static Pointer NullPointer();
+
+  /**
+   * @brief New Creates a cache that holds at least maxEntries results.
+   * @param maxEntries The number of entries that are kept before older entries are evicted.
+   */
+  static Pointer New(size_t maxEntries);
+
+  /**
+   * @brief Returns the name of the class for MisorientationCache
+   */
+  virtual std::string getNameOfClass() const;
+
+  /**
+   * @brief Returns the name of the class for MisorientationCache
+   */
+  static std::string ClassName();
+
+  virtual ~MisorientationCache();
+
+  /**
+   * @brief The Key struct is the 128 bit key of a cache entry
+   */
+  struct Key
+  {
+    uint64_t first = 0;
+    uint64_t second = 0;
+    uint32_t laueOps = 0;
+
+    bool operator==(const Key& rhs) const
+    {
+      return first == rhs.first && second == rhs.second && laueOps == rhs.laueOps;
+    }
+  };
+
+  /**
+   * @brief The Statistics struct reports how well the cache is doing
+   */
+  struct Statistics
+  {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+    size_t size = 0;
+
+    double hitRate() const
+    {
+      uint64_t total = hits + misses;
+      return total == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(total);
+    }
+  };
+
+  /**
+   * @brief QuaternionKey Builds the key for a pair of quaternions
+   * @param laueOps Index of the LaueOps that computes the misorientation
+   * @param q1 First quaternion
+   * @param q2 Second quaternion
+   */
+  static Key QuaternionKey(uint32_t laueOps, const QuatD& q1, const QuatD& q2);
+
+  /**
+   * @brief FeatureKey Builds the key for a pair of feature ids
+   * @param laueOps Index of the LaueOps that computes the misorientation
+   * @param feature1
+   * @param feature2
+   */
+  static Key FeatureKey(uint32_t laueOps, int32_t feature1, int32_t feature2);
+
+  /**
+   * @brief find Looks up a key
+   * @param key
+   * @param axisAngle [output] The cached value if the key was found
+   * @return true if the key was found
+   */
+  bool find(const Key& key, AxisAngleD& axisAngle);
+
+  /**
+   * @brief insert Stores a value, evicting older entries if the shard is full
+   */
+  void insert(const Key& key, const AxisAngleD& axisAngle);
+
+  /**
+   * @brief clear Removes all entries and resets the statistics
+   */
+  void clear();
+
+  /**
+   * @brief getStatistics Returns the hit/miss counts and the current number of entries
+   */
+  Statistics getStatistics() const;
+
+  /**
+   * @brief getMaxEntries Returns the capacity that was requested when the cache was created
+   */
+  size_t getMaxEntries() const;
+
+protected:
+  explicit MisorientationCache(size_t maxEntries);
+
+private:
+  struct KeyHash
+  {
+    size_t operator()(const Key& key) const;
+  };
+
+  using MapType = std::unordered_map<Key, AxisAngleD, KeyHash>;
+
+  struct Shard
+  {
+    mutable std::mutex mutex;
+    MapType current;
+    MapType previous;
+  };
+
+  static constexpr size_t k_NumShards = 64;
+
+  size_t m_MaxEntries = 0;
+  size_t m_ShardCapacity = 0;
+  std::array<Shard, k_NumShards> m_Shards;
+  std::atomic<uint64_t> m_Hits = {0};
+  std::atomic<uint64_t> m_Misses = {0};
+  std::atomic<uint64_t> m_Evictions = {0};
+
+  Shard& shardForKey(const Key& key);
+
+public:
+  MisorientationCache(const MisorientationCache&) = delete;            // Copy Constructor Not Implemented
+  MisorientationCache(MisorientationCache&&) = delete;                 // Move Constructor Not Implemented
+  MisorientationCache& operator=(const MisorientationCache&) = delete; // Copy Assignment Not Implemented
+  MisorientationCache& operator=(MisorientationCache&&) = delete;      // Move Assignment Not Implemented
+};
@@ -49,7 +49,6 @@
 #include "EbsdLib/Core/Orientation.hpp"
 #include "EbsdLib/Math/EbsdLibMath.h"
 #include "EbsdLib/Utilities/ColorTable.h"
-#include "EbsdLib/Utilities/ComputeStereographicProjection.h"
 
 namespace Monoclinic
 {
@@ -69,15 +68,16 @@ static const int symSize2 = 2;
 static const int k_OdfSize = 186624;
 static const int k_MdfSize = 186624;
 static const int k_SymOpsCount = 2;
+static_assert(k_SymOpsCount == MonoclinicOps::SymmetryGroupType::k_SymOpsCount, "Symmetry operator count does not match the SymmetryGroup");
 static const int k_NumMdfBins = 36;
 
-static const std::vector<QuatD> QuatSym = {QuatD(0.000000000, 0.000000000, 0.000000000, 1.000000000), QuatD(0.000000000, 1.000000000, 0.000000000, 0.000000000)};
+static const std::vector<QuatD> QuatSym = MonoclinicOps::SymmetryGroupType::QuatSymVector();
 
-static const std::vector<OrientationD> RodSym = {{0.0, 0.0, 0.0}, {0.0, 10000000000.0, 0.0}};
+static const QuatSymmetrySoA QuatSymSoA(QuatSym);
 
-static const double MatSym[k_SymOpsCount][3][3] = {{{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}},
+static const std::vector<OrientationD> RodSym = MonoclinicOps::SymmetryGroupType::RodSymVector();
 
-                                                   {{-1.0, 0.0, 0.0}, {0.0, -1.0, 0.0}, {0.0, 0.0, 1.0}}};
+static constexpr const std::array<SymMatType, k_SymOpsCount>& MatSym = MonoclinicOps::SymmetryGroupType::MatSym;
 
 } // namespace Monoclinic
 
@@ -153,19 +153,9 @@ std::string MonoclinicOps::getSymmetryName() const
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-OrientationD MonoclinicOps::calculateMisorientation(const QuatD& q1, const QuatD& q2) const
+void MonoclinicOps::calculateMisorientation(const QuatD& q1, const QuatD& q2, AxisAngleD& axisAngle) const
 {
-  return calculateMisorientationInternal(Monoclinic::QuatSym, q1, q2);
-}
-
-// -----------------------------------------------------------------------------
-OrientationF MonoclinicOps::calculateMisorientation(const QuatF& q1f, const QuatF& q2f) const
-
-{
-  QuatD q1 = q1f.to<double>();
-  QuatD q2 = q2f.to<double>();
-  OrientationD axisAngle = calculateMisorientationInternal(Monoclinic::QuatSym, q1, q2);
-  return axisAngle;
+  axisAngle = calculateMisorientationInternal(Monoclinic::QuatSymSoA, q1, q2);
 }
 
 QuatD MonoclinicOps::getQuatSymOp(int32_t i) const
@@ -222,7 +212,7 @@ void MonoclinicOps::getMatSymOp(int i, float g[3][3]) const
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-OrientationType MonoclinicOps::getODFFZRod(const OrientationType& rod) const
+RodriguesD MonoclinicOps::getODFFZRod(const RodriguesD& rod) const
 {
   return _calcRodNearestOrigin(Monoclinic::RodSym, rod);
 }
@@ -230,21 +220,21 @@ OrientationType MonoclinicOps::getODFFZRod(const OrientationType& rod) const
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-OrientationType MonoclinicOps::getMDFFZRod(const OrientationType& inRod) const
+RodriguesD MonoclinicOps::getMDFFZRod(const RodriguesD& inRod) const
 {
   throw EbsdLib::method_not_implemented("MonoclinicOps::getMDFFZRod not implemented");
 
   double w = 0.0, n1 = 0.0, n2 = 0.0, n3 = 0.0;
   double FZw = 0.0, FZn1 = 0.0, FZn2 = 0.0, FZn3 = 0.0;
 
-  OrientationType rod = LaueOps::_calcRodNearestOrigin(Monoclinic::RodSym, inRod);
-  OrientationType ax = OrientationTransformation::ro2ax<OrientationType, OrientationType>(rod);
+  RodriguesD rod = LaueOps::_calcRodNearestOrigin(Monoclinic::RodSym, inRod);
+  AxisAngleD ax = OrientationTransformation::ro2ax(rod);
   n1 = ax[0];
   n2 = ax[1], n3 = ax[2], w = ax[3];
 
   /// FIXME: Are we missing code for MonoclinicOps MDF FZ Rodrigues calculation?
 
-  return OrientationTransformation::ax2ro<OrientationType, OrientationType>(OrientationType(FZn1, FZn2, FZn3, FZw));
+  return OrientationTransformation::ax2ro(AxisAngleD(FZn1, FZn2, FZn3, FZw));
 }
 
 // -----------------------------------------------------------------------------
@@ -252,24 +242,38 @@ OrientationType MonoclinicOps::getMDFFZRod(const OrientationType& inRod) const
 // -----------------------------------------------------------------------------
 QuatD MonoclinicOps::getNearestQuat(const QuatD& q1, const QuatD& q2) const
 {
-  return _calcNearestQuat(Monoclinic::QuatSym, q1, q2);
+  return _calcNearestQuat(Monoclinic::QuatSymSoA, q1, q2);
 }
 
 QuatF MonoclinicOps::getNearestQuat(const QuatF& q1f, const QuatF& q2f) const
 {
-  return _calcNearestQuat(Monoclinic::QuatSym, q1f.to<double>(), q2f.to<double>()).to<float>();
+  return _calcNearestQuat(Monoclinic::QuatSymSoA, q1f.to<double>(), q2f.to<double>()).to<float>();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QuatD MonoclinicOps::getFZQuat(const QuatD& qr) const
+{
+  return _calcQuatNearestOrigin(Monoclinic::QuatSymSoA, qr);
+}
+
+// -----------------------------------------------------------------------------
+const QuatSymmetrySoA& MonoclinicOps::getQuatSymmetrySoA() const
+{
+  return Monoclinic::QuatSymSoA;
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-int MonoclinicOps::getMisoBin(const OrientationType& rod) const
+int MonoclinicOps::getMisoBin(const RodriguesD& rod) const
 {
   double dim[3];
   double bins[3];
   double step[3];
 
-  OrientationType ho = OrientationTransformation::ro2ho<OrientationType, OrientationType>(rod);
+  HomochoricD ho = OrientationTransformation::ro2ho(rod);
 
   dim[0] = Monoclinic::OdfDimInitValue[0];
   dim[1] = Monoclinic::OdfDimInitValue[1];
@@ -287,7 +291,7 @@ int MonoclinicOps::getMisoBin(const OrientationType& rod) const
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-OrientationType MonoclinicOps::determineEulerAngles(double random[3], int choose) const
+void MonoclinicOps::determineEulerAngles(double random[3], int choose, EulerD& euler) const
 {
   double init[3];
   double step[3];
@@ -307,28 +311,27 @@ OrientationType MonoclinicOps::determineEulerAngles(double random[3], int choose
 
   _calcDetermineHomochoricValues(random, init, step, phi, h1, h2, h3);
 
-  OrientationType ho(h1, h2, h3);
-  OrientationType ro = OrientationTransformation::ho2ro<OrientationType, OrientationType>(ho);
+  HomochoricD ho(h1, h2, h3);
+  RodriguesD ro = OrientationTransformation::ho2ro(ho);
   ro = getODFFZRod(ro);
-  OrientationType eu = OrientationTransformation::ro2eu<OrientationType, OrientationType>(ro);
-  return eu;
+  euler = OrientationTransformation::ro2eu(ro);
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-OrientationType MonoclinicOps::randomizeEulerAngles(const OrientationType& synea) const
+EulerD MonoclinicOps::randomizeEulerAngles(const EulerD& synea) const
 {
   size_t symOp = getRandomSymmetryOperatorIndex(Monoclinic::k_SymOpsCount);
-  QuatD quat = OrientationTransformation::eu2qu<OrientationType, QuatD>(synea);
+  QuatD quat = OrientationTransformation::eu2qu(synea);
   QuatD qc = Monoclinic::QuatSym[symOp] * quat;
-  return OrientationTransformation::qu2eu<QuatD, OrientationType>(qc);
+  return OrientationTransformation::qu2eu(qc);
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-OrientationType MonoclinicOps::determineRodriguesVector(double random[3], int choose) const
+void MonoclinicOps::determineRodriguesVector(double random[3], int choose, RodriguesD& rod) const
 {
   double init[3];
   double step[3];
@@ -346,22 +349,21 @@ OrientationType MonoclinicOps::determineRodriguesVector(double random[3], int ch
   phi[2] = static_cast<int32_t>(choose / (Monoclinic::OdfNumBins[0] * Monoclinic::OdfNumBins[1]));
 
   _calcDetermineHomochoricValues(random, init, step, phi, h1, h2, h3);
-  OrientationType ho(h1, h2, h3);
-  OrientationType ro = OrientationTransformation::ho2ro<OrientationType, OrientationType>(ho);
-  ro = getMDFFZRod(ro);
-  return ro;
+  HomochoricD ho(h1, h2, h3);
+  RodriguesD ro = OrientationTransformation::ho2ro(ho);
+  rod = getMDFFZRod(ro);
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-int MonoclinicOps::getOdfBin(const OrientationType& rod) const
+int MonoclinicOps::getOdfBin(const RodriguesD& rod) const
 {
   double dim[3];
   double bins[3];
   double step[3];
 
-  OrientationType ho = OrientationTransformation::ro2ho<OrientationType, OrientationType>(rod);
+  HomochoricD ho = OrientationTransformation::ro2ho(rod);
 
   dim[0] = Monoclinic::OdfDimInitValue[0];
   dim[1] = Monoclinic::OdfDimInitValue[1];
@@ -479,8 +481,8 @@ public:
 
     for(size_t i = start; i < end; ++i)
     {
-      OrientationType eu(m_Eulers->getValue(i * 3), m_Eulers->getValue(i * 3 + 1), m_Eulers->getValue(i * 3 + 2));
-      EbsdLib::Matrix3X3D g(OrientationTransformation::eu2om<OrientationType, OrientationType>(eu).data());
+      EulerD eu(m_Eulers->getValue(i * 3), m_Eulers->getValue(i * 3 + 1), m_Eulers->getValue(i * 3 + 2));
+      EbsdLib::Matrix3X3D g(OrientationTransformation::eu2om(eu).data());
 
       gTranspose = g.transpose();
 
@@ -586,14 +588,13 @@ EbsdLib::Rgb MonoclinicOps::generateIPFColor(double phi1, double phi, double phi
   double chi = 0.0f, eta = 0.0f;
   double _rgb[3] = {0.0, 0.0, 0.0};
 
-  OrientationType eu(phi1, phi, phi2);
-  OrientationType om(9); // Reusable for the loop
-  QuatD q1 = OrientationTransformation::eu2qu<OrientationType, QuatD>(eu);
+  EulerD eu(phi1, phi, phi2);
+  QuatD q1 = OrientationTransformation::eu2qu(eu);
 
   for(int j = 0; j < Monoclinic::k_SymOpsCount; j++)
   {
     QuatD qu = getQuatSymOp(j) * q1;
-    EbsdLib::Matrix3X3D g(OrientationTransformation::qu2om<QuatD, OrientationType>(qu).data());
+    EbsdLib::Matrix3X3D g(OrientationTransformation::qu2om(qu).data());
     EbsdLib::Matrix3X1D p = (g * refDirection).normalize();
 
     if(!getHasInversion() && p[2] < 0)
@@ -700,48 +701,14 @@ std::vector<EbsdLib::UInt8ArrayType::Pointer> MonoclinicOps::generatePoleFigure(
     label2 = config.labels.at(2);
   }
 
-  size_t numOrientations = config.eulers->getNumberOfTuples();
-
-  // Create an Array to hold the XYZ Coordinates which are the coords on the sphere.
-  // this is size for CUBIC ONLY, <001> Family
-  std::vector<size_t> dims(1, 3);
-  EbsdLib::FloatArrayType::Pointer xyz001 = EbsdLib::FloatArrayType::CreateArray(numOrientations * Monoclinic::symSize0, dims, label0 + std::string("xyzCoords"), true);
-  // this is size for CUBIC ONLY, <011> Family
-  EbsdLib::FloatArrayType::Pointer xyz011 = EbsdLib::FloatArrayType::CreateArray(numOrientations * Monoclinic::symSize1, dims, label1 + std::string("xyzCoords"), true);
-  // this is size for CUBIC ONLY, <111> Family
-  EbsdLib::FloatArrayType::Pointer xyz111 = EbsdLib::FloatArrayType::CreateArray(numOrientations * Monoclinic::symSize2, dims, label2 + std::string("xyzCoords"), true);
-
   config.sphereRadius = 1.0f;
 
-  // Generate the coords on the sphere **** Parallelized
-  generateSphereCoordsFromEulers(config.eulers, xyz001.get(), xyz011.get(), xyz111.get());
-
-  // These arrays hold the "intensity" images which eventually get converted to an actual Color RGB image
-  // Generate the modified Lambert projection images (Squares, 2 of them, 1 for northern hemisphere, 1 for southern hemisphere
-  EbsdLib::DoubleArrayType::Pointer intensity001 = EbsdLib::DoubleArrayType::CreateArray(config.imageDim * config.imageDim, label0 + "_Intensity_Image", true);
-  EbsdLib::DoubleArrayType::Pointer intensity011 = EbsdLib::DoubleArrayType::CreateArray(config.imageDim * config.imageDim, label1 + "_Intensity_Image", true);
-  EbsdLib::DoubleArrayType::Pointer intensity111 = EbsdLib::DoubleArrayType::CreateArray(config.imageDim * config.imageDim, label2 + "_Intensity_Image", true);
-#ifdef EbsdLib_USE_PARALLEL_ALGORITHMS
-  bool doParallel = true;
-
-  if(doParallel)
-  {
-    std::shared_ptr<tbb::task_group> g(new tbb::task_group);
-    g->run(ComputeStereographicProjection(xyz001.get(), &config, intensity001.get()));
-    g->run(ComputeStereographicProjection(xyz011.get(), &config, intensity011.get()));
-    g->run(ComputeStereographicProjection(xyz111.get(), &config, intensity111.get()));
-    g->wait(); // Wait for all the threads to complete before moving on.
-  }
-  else
-#endif
-  {
-    ComputeStereographicProjection m001(xyz001.get(), &config, intensity001.get());
-    m001();
-    ComputeStereographicProjection m011(xyz011.get(), &config, intensity011.get());
-    m011();
-    ComputeStereographicProjection m111(xyz111.get(), &config, intensity111.get());
-    m111();
-  }
+  // Generate the coords on the sphere block by block and add them straight into the modified Lambert projection
+  // squares, then create the "intensity" images which eventually get converted to an actual Color RGB image **** Parallelized
+  std::array<EbsdLib::DoubleArrayType::Pointer, 3> intensities = generatePoleFigureIntensities(config, {label0 + "_Intensity_Image", label1 + "_Intensity_Image", label2 + "_Intensity_Image"});
+  EbsdLib::DoubleArrayType::Pointer intensity001 = intensities[0];
+  EbsdLib::DoubleArrayType::Pointer intensity011 = intensities[1];
+  EbsdLib::DoubleArrayType::Pointer intensity111 = intensities[2];
 
   // Find the Max and Min values based on ALL 3 arrays so we can color scale them all the same
   double max = std::numeric_limits<double>::min();
@@ -792,7 +759,7 @@ std::vector<EbsdLib::UInt8ArrayType::Pointer> MonoclinicOps::generatePoleFigure(
   config.minScale = min;
   config.maxScale = max;
 
-  dims[0] = 4;
+  std::vector<size_t> dims(1, 4);
   EbsdLib::UInt8ArrayType::Pointer image001 = EbsdLib::UInt8ArrayType::CreateArray(config.imageDim * config.imageDim, dims, label0, true);
   EbsdLib::UInt8ArrayType::Pointer image011 = EbsdLib::UInt8ArrayType::CreateArray(config.imageDim * config.imageDim, dims, label1, true);
   EbsdLib::UInt8ArrayType::Pointer image111 = EbsdLib::UInt8ArrayType::CreateArray(config.imageDim * config.imageDim, dims, label2, true);
@@ -812,6 +779,7 @@ std::vector<EbsdLib::UInt8ArrayType::Pointer> MonoclinicOps::generatePoleFigure(
   }
 
 #ifdef EbsdLib_USE_PARALLEL_ALGORITHMS
+  bool doParallel = true;
 
   if(doParallel)
   {
@@ -845,74 +813,88 @@ EbsdLib::UInt8ArrayType::Pointer MonoclinicOps::generateIPFTriangleLegend(int im
   EbsdLib::UInt8ArrayType::Pointer image = EbsdLib::UInt8ArrayType::CreateArray(imageDim * imageDim, dims, getSymmetryName() + " Triangle Legend", true);
   uint32_t* pixelPtr = reinterpret_cast<uint32_t*>(image->getPointer(0));
 
-  double xInc = 1.0f / static_cast<double>(imageDim);
-  double yInc = 1.0f / static_cast<double>(imageDim);
-  double rad = 1.0f;
-
-  double x = 0.0f;
-  double y = 0.0f;
-  double a = 0.0f;
-  double b = 0.0f;
-  double c = 0.0f;
-
-  double val = 0.0f;
-  double x1 = 0.0f;
-  double y1 = 0.0f;
-  double z1 = 0.0f;
-  double denom = 0.0f;
-
-  EbsdLib::Rgb color;
-  size_t idx = 0;
-  size_t yScanLineIndex = 0; // We use this to control where the data is drawn. Otherwise the image will come out flipped vertically
-  // Loop over every pixel in the image and project up to the sphere to get the angle and then figure out the RGB from
-  // there.
-  for(int32_t yIndex = 0; yIndex < imageDim; ++yIndex)
-  {
-
-    for(int32_t xIndex = 0; xIndex < imageDim; ++xIndex)
+  // Each call renders the rows [yStart, yEnd) so that the rows can be split across threads
+  auto generateRows = [&](int32_t yStart, int32_t yEnd) {
+    double xInc = 1.0f / static_cast<double>(imageDim);
+    double yInc = 1.0f / static_cast<double>(imageDim);
+    double rad = 1.0f;
+
+    double x = 0.0f;
+    double y = 0.0f;
+    double a = 0.0f;
+    double b = 0.0f;
+    double c = 0.0f;
+
+    double val = 0.0f;
+    double x1 = 0.0f;
+    double y1 = 0.0f;
+    double z1 = 0.0f;
+    double denom = 0.0f;
+
+    EbsdLib::Rgb color;
+    size_t idx = 0;
+    size_t yScanLineIndex = yStart; // We use this to control where the data is drawn. Otherwise the image will come out flipped vertically
+    // Loop over every pixel in the image and project up to the sphere to get the angle and then figure out the RGB from
+    // there.
+    for(int32_t yIndex = yStart; yIndex < yEnd; ++yIndex)
     {
-      idx = (imageDim * yScanLineIndex) + xIndex;
-
-      x = -1.0f + 2.0f * xIndex * xInc;
-      y = 2.0f * yIndex * yInc;
-
-      double sumSquares = (x * x) + (y * y);
-      if(sumSquares > 1.0) // Outside unit circle
-      {
-        color = 0xFFFFFFFF;
-      }
-      else if(sumSquares > (rad - 2 * xInc) && sumSquares < (rad + 2 * xInc)) // Black Border line
-      {
-        color = 0xFF000000;
-      }
 
-      else if(xIndex == 0) // Black Border line
+      for(int32_t xIndex = 0; xIndex < imageDim; ++xIndex)
       {
-        color = 0xFF000000;
+        idx = (imageDim * yScanLineIndex) + xIndex;
+
+        x = -1.0f + 2.0f * xIndex * xInc;
+        y = 2.0f * yIndex * yInc;
+
+        double sumSquares = (x * x) + (y * y);
+        if(sumSquares > 1.0) // Outside unit circle
+        {
+          color = 0xFFFFFFFF;
+        }
+        else if(sumSquares > (rad - 2 * xInc) && sumSquares < (rad + 2 * xInc)) // Black Border line
+        {
+          color = 0xFF000000;
+        }
+
+        else if(xIndex == 0) // Black Border line
+        {
+          color = 0xFF000000;
+        }
+        else
+        {
+          a = (x * x + y * y + 1);
+          b = (2 * x * x + 2 * y * y);
+          c = (x * x + y * y - 1);
+
+          val = (-b + std::sqrt(b * b - 4.0 * a * c)) / (2.0 * a);
+          x1 = (1 + val) * x;
+          y1 = (1 + val) * y;
+          z1 = val;
+          denom = (x1 * x1) + (y1 * y1) + (z1 * z1);
+          denom = std::sqrt(denom);
+          x1 = x1 / denom;
+          y1 = y1 / denom;
+          z1 = z1 / denom;
+
+          color = generateIPFColor(0.0, 0.0, 0.0, x1, y1, z1, false);
+        }
+
+        pixelPtr[idx] = color;
       }
-      else
-      {
-        a = (x * x + y * y + 1);
-        b = (2 * x * x + 2 * y * y);
-        c = (x * x + y * y - 1);
-
-        val = (-b + std::sqrt(b * b - 4.0 * a * c)) / (2.0 * a);
-        x1 = (1 + val) * x;
-        y1 = (1 + val) * y;
-        z1 = val;
-        denom = (x1 * x1) + (y1 * y1) + (z1 * z1);
-        denom = std::sqrt(denom);
-        x1 = x1 / denom;
-        y1 = y1 / denom;
-        z1 = z1 / denom;
-
-        color = generateIPFColor(0.0, 0.0, 0.0, x1, y1, z1, false);
-      }
-
-      pixelPtr[idx] = color;
+      yScanLineIndex++;
     }
-    yScanLineIndex++;
+  };
+
+#ifdef EbsdLib_USE_PARALLEL_ALGORITHMS
+  bool doParallel = true;
+  if(doParallel)
+  {
+    tbb::parallel_for(
+        tbb::blocked_range<int32_t>(0, imageDim), [&](const tbb::blocked_range<int32_t>& r) { generateRows(r.begin(), r.end()); }, tbb::auto_partitioner());
+    return image;
   }
+#endif
+  generateRows(0, imageDim);
   return image;
 }
 
@@ -48,7 +48,6 @@
 #include "EbsdLib/Core/Orientation.hpp"
 #include "EbsdLib/Math/EbsdLibMath.h"
 #include "EbsdLib/Utilities/ColorTable.h"
-#include "EbsdLib/Utilities/ComputeStereographicProjection.h"
 #include "EbsdLib/Utilities/PoleFigureUtilities.h"
 
 namespace OrthoRhombic
@@ -68,20 +67,16 @@ static const int symSize2 = 2;
 static const int k_OdfSize = 46656;
 static const int k_MdfSize = 46656;
 static const int k_SymOpsCount = 4;
+static_assert(k_SymOpsCount == OrthoRhombicOps::SymmetryGroupType::k_SymOpsCount, "Symmetry operator count does not match the SymmetryGroup");
 static const int k_NumMdfBins = 36;
 
-static const std::vector<QuatD> QuatSym = {QuatD(0.000000000, 0.000000000, 0.000000000, 1.000000000), QuatD(1.000000000, 0.000000000, 0.000000000, 0.000000000),
-                                           QuatD(0.000000000, 1.000000000, 0.000000000, 0.000000000), QuatD(0.000000000, 0.000000000, 1.000000000, 0.000000000)};
+static const std::vector<QuatD> QuatSym = OrthoRhombicOps::SymmetryGroupType::QuatSymVector();
 
-static const std::vector<OrientationD> RodSym = {{0.0, 0.0, 0.0}, {10000000000.0, 0.0, 0.0}, {0.0, 10000000000.0, 0.0}, {0.0, 0.0, 10000000000.0}};
+static const QuatSymmetrySoA QuatSymSoA(QuatSym);
 
-static const double MatSym[k_SymOpsCount][3][3] = {{{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}},
+static const std::vector<OrientationD> RodSym = OrthoRhombicOps::SymmetryGroupType::RodSymVector();
 
-                                                   {{1.0, 0.0, 0.0}, {0.0, -1.0, 0.0}, {0.0, 0.0, -1.0}},
-
-                                                   {{-1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, -1.0}},
-
-                                                   {{-1.0, 0.0, 0.0}, {0.0, -1.0, 0.0}, {0.0, 0.0, 1.0}}};
+static constexpr const std::array<SymMatType, k_SymOpsCount>& MatSym = OrthoRhombicOps::SymmetryGroupType::MatSym;
 
 } // namespace OrthoRhombic
 
@@ -153,19 +148,9 @@ std::string OrthoRhombicOps::getSymmetryName() const
   return "OrthoRhombic mmm";
 }
 
-OrientationD OrthoRhombicOps::calculateMisorientation(const QuatD& q1, const QuatD& q2) const
-{
-  return calculateMisorientationInternal(OrthoRhombic::QuatSym, q1, q2);
-}
-
-// -----------------------------------------------------------------------------
-OrientationF OrthoRhombicOps::calculateMisorientation(const QuatF& q1f, const QuatF& q2f) const
-
+void OrthoRhombicOps::calculateMisorientation(const QuatD& q1, const QuatD& q2, AxisAngleD& axisAngle) const
 {
-  QuatD q1 = q1f.to<double>();
-  QuatD q2 = q2f.to<double>();
-  OrientationD axisAngle = calculateMisorientationInternal(OrthoRhombic::QuatSym, q1, q2);
-  return axisAngle;
+  axisAngle = calculateMisorientationInternal(OrthoRhombic::QuatSymSoA, q1, q2);
 }
 
 QuatD OrthoRhombicOps::getQuatSymOp(int32_t i) const
@@ -222,7 +207,7 @@ void OrthoRhombicOps::getMatSymOp(int i, float g[3][3]) const
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-OrientationType OrthoRhombicOps::getODFFZRod(const OrientationType& rod) const
+RodriguesD OrthoRhombicOps::getODFFZRod(const RodriguesD& rod) const
 {
   return _calcRodNearestOrigin(OrthoRhombic::RodSym, rod);
 }
@@ -230,14 +215,14 @@ OrientationType OrthoRhombicOps::getODFFZRod(const OrientationType& rod) const
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-OrientationType OrthoRhombicOps::getMDFFZRod(const OrientationType& inRod) const
+RodriguesD OrthoRhombicOps::getMDFFZRod(const RodriguesD& inRod) const
 {
   throw EbsdLib::method_not_implemented("OrthoRhombicOps::getMDFFZRod not implemented");
 
   double FZn1 = 0.0f, FZn2 = 0.0f, FZn3 = 0.0f, FZw = 0.0f;
 
-  OrientationType rod = _calcRodNearestOrigin(OrthoRhombic::RodSym, inRod);
-  OrientationType ax = OrientationTransformation::ro2ax<OrientationType, OrientationType>(rod);
+  RodriguesD rod = _calcRodNearestOrigin(OrthoRhombic::RodSym, inRod);
+  AxisAngleD ax = OrientationTransformation::ro2ax(rod);
   //  double n1 = ax[0];
   //  double n2 = ax[1];
   //  double n3 = ax[2];
@@ -245,7 +230,7 @@ OrientationType OrthoRhombicOps::getMDFFZRod(const OrientationType& inRod) const
 
   /// FIXME: Are we missing code for OrthoRhombic MDF FZ Rodrigues calculation?
 
-  return OrientationTransformation::ax2ro<OrientationType, OrientationType>(OrientationType(FZn1, FZn2, FZn3, FZw));
+  return OrientationTransformation::ax2ro(AxisAngleD(FZn1, FZn2, FZn3, FZw));
 }
 
 // -----------------------------------------------------------------------------
@@ -253,28 +238,34 @@ OrientationType OrthoRhombicOps::getMDFFZRod(const OrientationType& inRod) const
 // -----------------------------------------------------------------------------
 QuatD OrthoRhombicOps::getNearestQuat(const QuatD& q1, const QuatD& q2) const
 {
-  return _calcNearestQuat(OrthoRhombic::QuatSym, q1, q2);
+  return _calcNearestQuat(OrthoRhombic::QuatSymSoA, q1, q2);
 }
 
 QuatF OrthoRhombicOps::getNearestQuat(const QuatF& q1f, const QuatF& q2f) const
 {
-  return _calcNearestQuat(OrthoRhombic::QuatSym, q1f.to<double>(), q2f.to<double>()).to<float>();
+  return _calcNearestQuat(OrthoRhombic::QuatSymSoA, q1f.to<double>(), q2f.to<double>()).to<float>();
 }
 
 QuatD OrthoRhombicOps::getFZQuat(const QuatD& qr) const
 {
-  return _calcQuatNearestOrigin(OrthoRhombic::QuatSym, qr);
+  return _calcQuatNearestOrigin(OrthoRhombic::QuatSymSoA, qr);
+}
+
+// -----------------------------------------------------------------------------
+const QuatSymmetrySoA& OrthoRhombicOps::getQuatSymmetrySoA() const
+{
+  return OrthoRhombic::QuatSymSoA;
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-int OrthoRhombicOps::getMisoBin(const OrientationType& rod) const
+int OrthoRhombicOps::getMisoBin(const RodriguesD& rod) const
 {
   double dim[3];
   double bins[3];
   double step[3];
-  OrientationType ho = OrientationTransformation::ro2ho<OrientationType, OrientationType>(rod);
+  HomochoricD ho = OrientationTransformation::ro2ho(rod);
 
   dim[0] = OrthoRhombic::OdfDimInitValue[0];
   dim[1] = OrthoRhombic::OdfDimInitValue[1];
@@ -292,7 +283,7 @@ int OrthoRhombicOps::getMisoBin(const OrientationType& rod) const
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-OrientationType OrthoRhombicOps::determineEulerAngles(double random[3], int choose) const
+void OrthoRhombicOps::determineEulerAngles(double random[3], int choose, EulerD& euler) const
 {
   double init[3];
   double step[3];
@@ -311,28 +302,27 @@ OrientationType OrthoRhombicOps::determineEulerAngles(double random[3], int choo
 
   _calcDetermineHomochoricValues(random, init, step, phi, h1, h2, h3);
 
-  OrientationType ho(h1, h2, h3);
-  OrientationType ro = OrientationTransformation::ho2ro<OrientationType, OrientationType>(ho);
+  HomochoricD ho(h1, h2, h3);
+  RodriguesD ro = OrientationTransformation::ho2ro(ho);
   ro = getODFFZRod(ro);
-  OrientationType eu = OrientationTransformation::ro2eu<OrientationType, OrientationType>(ro);
-  return eu;
+  euler = OrientationTransformation::ro2eu(ro);
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-OrientationType OrthoRhombicOps::randomizeEulerAngles(const OrientationType& synea) const
+EulerD OrthoRhombicOps::randomizeEulerAngles(const EulerD& synea) const
 {
   size_t symOp = getRandomSymmetryOperatorIndex(OrthoRhombic::k_SymOpsCount);
-  QuatD quat = OrientationTransformation::eu2qu<OrientationType, QuatD>(synea);
+  QuatD quat = OrientationTransformation::eu2qu(synea);
   QuatD qc = OrthoRhombic::QuatSym[symOp] * quat;
-  return OrientationTransformation::qu2eu<QuatD, OrientationType>(qc);
+  return OrientationTransformation::qu2eu(qc);
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-OrientationType OrthoRhombicOps::determineRodriguesVector(double random[3], int choose) const
+void OrthoRhombicOps::determineRodriguesVector(double random[3], int choose, RodriguesD& rod) const
 {
   double init[3];
   double step[3];
@@ -350,22 +340,21 @@ OrientationType OrthoRhombicOps::determineRodriguesVector(double random[3], int
   phi[2] = static_cast<int32_t>(choose / (OrthoRhombic::OdfNumBins[0] * OrthoRhombic::OdfNumBins[1]));
 
   _calcDetermineHomochoricValues(random, init, step, phi, h1, h2, h3);
-  OrientationType ho(h1, h2, h3);
-  OrientationType ro = OrientationTransformation::ho2ro<OrientationType, OrientationType>(ho);
-  ro = getMDFFZRod(ro);
-  return ro;
+  HomochoricD ho(h1, h2, h3);
+  RodriguesD ro = OrientationTransformation::ho2ro(ho);
+  rod = getMDFFZRod(ro);
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-int OrthoRhombicOps::getOdfBin(const OrientationType& rod) const
+int OrthoRhombicOps::getOdfBin(const RodriguesD& rod) const
 {
   double dim[3];
   double bins[3];
   double step[3];
 
-  OrientationType ho = OrientationTransformation::ro2ho<OrientationType, OrientationType>(rod);
+  HomochoricD ho = OrientationTransformation::ro2ho(rod);
 
   dim[0] = OrthoRhombic::OdfDimInitValue[0];
   dim[1] = OrthoRhombic::OdfDimInitValue[1];
@@ -482,8 +471,8 @@ public:
 
     for(size_t i = start; i < end; ++i)
     {
-      OrientationType eu(m_Eulers->getValue(i * 3), m_Eulers->getValue(i * 3 + 1), m_Eulers->getValue(i * 3 + 2));
-      EbsdLib::Matrix3X3D g(OrientationTransformation::eu2om<OrientationType, OrientationType>(eu).data());
+      EulerD eu(m_Eulers->getValue(i * 3), m_Eulers->getValue(i * 3 + 1), m_Eulers->getValue(i * 3 + 2));
+      EbsdLib::Matrix3X3D g(OrientationTransformation::eu2om(eu).data());
 
       gTranspose = g.transpose();
 
@@ -589,14 +578,13 @@ EbsdLib::Rgb OrthoRhombicOps::generateIPFColor(double phi1, double phi, double p
   double chi = 0.0f, eta = 0.0f;
   double _rgb[3] = {0.0, 0.0, 0.0};
 
-  OrientationType eu(phi1, phi, phi2);
-  OrientationType om(9); // Reusable for the loop
-  QuatD q1 = OrientationTransformation::eu2qu<OrientationType, QuatD>(eu);
+  EulerD eu(phi1, phi, phi2);
+  QuatD q1 = OrientationTransformation::eu2qu(eu);
 
   for(int j = 0; j < OrthoRhombic::k_SymOpsCount; j++)
   {
     QuatD qu = getQuatSymOp(j) * q1;
-    EbsdLib::Matrix3X3D g(OrientationTransformation::qu2om<QuatD, OrientationType>(qu).data());
+    EbsdLib::Matrix3X3D g(OrientationTransformation::qu2om(qu).data());
     EbsdLib::Matrix3X1D p = (g * refDirection).normalize();
 
     if(!getHasInversion() && p[2] < 0)
@@ -703,46 +691,14 @@ std::vector<EbsdLib::UInt8ArrayType::Pointer> OrthoRhombicOps::generatePoleFigur
     label2 = config.labels.at(2);
   }
 
-  size_t numOrientations = config.eulers->getNumberOfTuples();
-
-  // Create an Array to hold the XYZ Coordinates which are the coords on the sphere.
-  std::vector<size_t> dims(1, 3);
-  std::vector<EbsdLib::FloatArrayType::Pointer> coords(3);
-  coords[0] = EbsdLib::FloatArrayType::CreateArray(numOrientations * OrthoRhombic::symSize0, dims, label0 + std::string("001_Coords"), true);
-  coords[1] = EbsdLib::FloatArrayType::CreateArray(numOrientations * OrthoRhombic::symSize1, dims, label1 + std::string("100_Coords"), true);
-  coords[2] = EbsdLib::FloatArrayType::CreateArray(numOrientations * OrthoRhombic::symSize2, dims, label2 + std::string("010_Coords"), true);
-
   config.sphereRadius = 1.0;
 
-  // Generate the coords on the sphere **** Parallelized
-  generateSphereCoordsFromEulers(config.eulers, coords[0].get(), coords[1].get(), coords[2].get());
-
-  // These arrays hold the "intensity" images which eventually get converted to an actual Color RGB image
-  // Generate the modified Lambert projection images (Squares, 2 of them, 1 for northern hemisphere, 1 for southern hemisphere
-  EbsdLib::DoubleArrayType::Pointer intensity001 = EbsdLib::DoubleArrayType::CreateArray(config.imageDim * config.imageDim, label0 + "_Intensity_Image", true);
-  EbsdLib::DoubleArrayType::Pointer intensity100 = EbsdLib::DoubleArrayType::CreateArray(config.imageDim * config.imageDim, label1 + "_Intensity_Image", true);
-  EbsdLib::DoubleArrayType::Pointer intensity010 = EbsdLib::DoubleArrayType::CreateArray(config.imageDim * config.imageDim, label2 + "_Intensity_Image", true);
-#ifdef EbsdLib_USE_PARALLEL_ALGORITHMS
-  bool doParallel = true;
-
-  if(doParallel)
-  {
-    std::shared_ptr<tbb::task_group> g(new tbb::task_group);
-    g->run(ComputeStereographicProjection(coords[0].get(), &config, intensity001.get()));
-    g->run(ComputeStereographicProjection(coords[1].get(), &config, intensity100.get()));
-    g->run(ComputeStereographicProjection(coords[2].get(), &config, intensity010.get()));
-    g->wait(); // Wait for all the threads to complete before moving on.
-  }
-  else
-#endif
-  {
-    ComputeStereographicProjection m001(coords[0].get(), &config, intensity001.get());
-    m001();
-    ComputeStereographicProjection m011(coords[1].get(), &config, intensity100.get());
-    m011();
-    ComputeStereographicProjection m111(coords[2].get(), &config, intensity010.get());
-    m111();
-  }
+  // Generate the coords on the sphere block by block and add them straight into the modified Lambert projection
+  // squares, then create the "intensity" images which eventually get converted to an actual Color RGB image **** Parallelized
+  std::array<EbsdLib::DoubleArrayType::Pointer, 3> intensities = generatePoleFigureIntensities(config, {label0 + "_Intensity_Image", label1 + "_Intensity_Image", label2 + "_Intensity_Image"});
+  EbsdLib::DoubleArrayType::Pointer intensity001 = intensities[0];
+  EbsdLib::DoubleArrayType::Pointer intensity100 = intensities[1];
+  EbsdLib::DoubleArrayType::Pointer intensity010 = intensities[2];
 
   // Find the Max and Min values based on ALL 3 arrays so we can color scale them all the same
   double max = std::numeric_limits<double>::min();
@@ -793,7 +749,7 @@ std::vector<EbsdLib::UInt8ArrayType::Pointer> OrthoRhombicOps::generatePoleFigur
   config.minScale = min;
   config.maxScale = max;
 
-  dims[0] = 4;
+  std::vector<size_t> dims(1, 4);
   EbsdLib::UInt8ArrayType::Pointer image001 = EbsdLib::UInt8ArrayType::CreateArray(config.imageDim * config.imageDim, dims, label0, true);
   EbsdLib::UInt8ArrayType::Pointer image100 = EbsdLib::UInt8ArrayType::CreateArray(config.imageDim * config.imageDim, dims, label1, true);
   EbsdLib::UInt8ArrayType::Pointer image010 = EbsdLib::UInt8ArrayType::CreateArray(config.imageDim * config.imageDim, dims, label2, true);
@@ -813,6 +769,7 @@ std::vector<EbsdLib::UInt8ArrayType::Pointer> OrthoRhombicOps::generatePoleFigur
   }
 
 #ifdef EbsdLib_USE_PARALLEL_ALGORITHMS
+  bool doParallel = true;
   if(doParallel)
   {
     std::shared_ptr<tbb::task_group> g(new tbb::task_group);
@@ -845,73 +802,87 @@ EbsdLib::UInt8ArrayType::Pointer OrthoRhombicOps::generateIPFTriangleLegend(int
   EbsdLib::UInt8ArrayType::Pointer image = EbsdLib::UInt8ArrayType::CreateArray(imageDim * imageDim, dims, getSymmetryName() + " Triangle Legend", true);
   uint32_t* pixelPtr = reinterpret_cast<uint32_t*>(image->getPointer(0));
 
-  double xInc = 1.0f / static_cast<double>(imageDim);
-  double yInc = 1.0f / static_cast<double>(imageDim);
-  double rad = 1.0;
-
-  double x = 0.0;
-  double y = 0.0;
-  double a = 0.0;
-  double b = 0.0;
-  double c = 0.0;
-
-  double val = 0.0;
-  double x1 = 0.0;
-  double y1 = 0.0;
-  double z1 = 0.0;
-  double denom = 0.0;
-
-  EbsdLib::Rgb color;
-  size_t idx = 0;
-  size_t yScanLineIndex = 0; // We use this to control where the data is drawn. Otherwise the image will come out flipped vertically
-  // Loop over every pixel in the image and project up to the sphere to get the angle and then figure out the RGB from
-  // there.
-  for(int32_t yIndex = 0; yIndex < imageDim; ++yIndex)
-  {
-
-    for(int32_t xIndex = 0; xIndex < imageDim; ++xIndex)
+  // Each call renders the rows [yStart, yEnd) so that the rows can be split across threads
+  auto generateRows = [&](int32_t yStart, int32_t yEnd) {
+    double xInc = 1.0f / static_cast<double>(imageDim);
+    double yInc = 1.0f / static_cast<double>(imageDim);
+    double rad = 1.0;
+
+    double x = 0.0;
+    double y = 0.0;
+    double a = 0.0;
+    double b = 0.0;
+    double c = 0.0;
+
+    double val = 0.0;
+    double x1 = 0.0;
+    double y1 = 0.0;
+    double z1 = 0.0;
+    double denom = 0.0;
+
+    EbsdLib::Rgb color;
+    size_t idx = 0;
+    size_t yScanLineIndex = yStart; // We use this to control where the data is drawn. Otherwise the image will come out flipped vertically
+    // Loop over every pixel in the image and project up to the sphere to get the angle and then figure out the RGB from
+    // there.
+    for(int32_t yIndex = yStart; yIndex < yEnd; ++yIndex)
     {
-      idx = (imageDim * yScanLineIndex) + xIndex;
 
-      x = xIndex * xInc;
-      y = yIndex * yInc;
-
-      double sumSquares = (x * x) + (y * y);
-      if(sumSquares > 1.0) // Outside unit circle
-      {
-        color = 0xFFFFFFFF;
-      }
-      else if(sumSquares > (rad - 2 * xInc) && sumSquares < (rad + 2 * xInc))
+      for(int32_t xIndex = 0; xIndex < imageDim; ++xIndex)
       {
-        color = 0xFF000000;
+        idx = (imageDim * yScanLineIndex) + xIndex;
+
+        x = xIndex * xInc;
+        y = yIndex * yInc;
+
+        double sumSquares = (x * x) + (y * y);
+        if(sumSquares > 1.0) // Outside unit circle
+        {
+          color = 0xFFFFFFFF;
+        }
+        else if(sumSquares > (rad - 2 * xInc) && sumSquares < (rad + 2 * xInc))
+        {
+          color = 0xFF000000;
+        }
+        else if(xIndex == 0 || yIndex == 0)
+        {
+          color = 0xFF000000;
+        }
+        else
+        {
+          a = (x * x + y * y + 1);
+          b = (2 * x * x + 2 * y * y);
+          c = (x * x + y * y - 1);
+
+          val = (-b + std::sqrt(b * b - 4.0 * a * c)) / (2.0 * a);
+          x1 = (1 + val) * x;
+          y1 = (1 + val) * y;
+          z1 = val;
+          denom = (x1 * x1) + (y1 * y1) + (z1 * z1);
+          denom = std::sqrt(denom);
+          x1 = x1 / denom;
+          y1 = y1 / denom;
+          z1 = z1 / denom;
+
+          color = generateIPFColor(0.0, 0.0, 0.0, x1, y1, z1, false);
+        }
+
+        pixelPtr[idx] = color;
       }
-      else if(xIndex == 0 || yIndex == 0)
-      {
-        color = 0xFF000000;
-      }
-      else
-      {
-        a = (x * x + y * y + 1);
-        b = (2 * x * x + 2 * y * y);
-        c = (x * x + y * y - 1);
-
-        val = (-b + std::sqrt(b * b - 4.0 * a * c)) / (2.0 * a);
-        x1 = (1 + val) * x;
-        y1 = (1 + val) * y;
-        z1 = val;
-        denom = (x1 * x1) + (y1 * y1) + (z1 * z1);
-        denom = std::sqrt(denom);
-        x1 = x1 / denom;
-        y1 = y1 / denom;
-        z1 = z1 / denom;
-
-        color = generateIPFColor(0.0, 0.0, 0.0, x1, y1, z1, false);
-      }
-
-      pixelPtr[idx] = color;
+      yScanLineIndex++;
     }
-    yScanLineIndex++;
+  };
+
+#ifdef EbsdLib_USE_PARALLEL_ALGORITHMS
+  bool doParallel = true;
+  if(doParallel)
+  {
+    tbb::parallel_for(
+        tbb::blocked_range<int32_t>(0, imageDim), [&](const tbb::blocked_range<int32_t>& r) { generateRows(r.begin(), r.end()); }, tbb::auto_partitioner());
+    return image;
   }
+#endif
+  generateRows(0, imageDim);
   return image;
 }
 
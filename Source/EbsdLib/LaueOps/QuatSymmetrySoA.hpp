@@ -0,0 +1,213 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#include "EbsdLib/Core/Quaternion.hpp"
+#include "EbsdLib/EbsdLib.h"
+
+/**
+ * @brief The QuatSymmetrySoA class stores the symmetry quaternions of a Laue class in a Structure of Arrays
+ * layout. The products between an orientation and every symmetry operator are computed in straight loops over
+ * the padded component arrays which the compiler turns into SIMD code. Only the scalar part (or the dot
+ * product) of each product is needed to pick the winning operator so the full product, and any trig function,
+ * is only evaluated for that one operator.
+ */
+class QuatSymmetrySoA
+{
+public:
+  /**
+   * @brief The largest number of symmetry operators of any Laue class (m-3m)
+   */
+  static constexpr size_t k_Capacity = 24;
+
+  explicit QuatSymmetrySoA(const std::vector<QuatD>& quatsym)
+  : m_Size(quatsym.size())
+  {
+    if(m_Size > k_Capacity)
+    {
+      throw std::out_of_range("QuatSymmetrySoA: Too many symmetry operators");
+    }
+    for(size_t i = 0; i < m_Size; i++)
+    {
+      m_X[i] = quatsym[i].x();
+      m_Y[i] = quatsym[i].y();
+      m_Z[i] = quatsym[i].z();
+      m_W[i] = quatsym[i].w();
+    }
+
+    // The smallest rotation angle of any operator other than the identity bounds how far apart two symmetric
+    // copies of an orientation can be. See identityScalarThreshold().
+    double maxOperatorScalar = -1.0;
+    for(size_t i = 0; i < m_Size; i++)
+    {
+      double w = std::abs(m_W[i]);
+      if(w < 1.0 - k_IdentityTolerance)
+      {
+        maxOperatorScalar = std::max(maxOperatorScalar, w);
+      }
+    }
+    m_IdentityScalarThreshold = (maxOperatorScalar < 0.0) ? 0.0 : std::sqrt((1.0 + maxOperatorScalar) * 0.5);
+  }
+
+  ~QuatSymmetrySoA() = default;
+
+  QuatSymmetrySoA(const QuatSymmetrySoA&) = default;
+  QuatSymmetrySoA(QuatSymmetrySoA&&) noexcept = default;
+  QuatSymmetrySoA& operator=(const QuatSymmetrySoA&) = default;
+  QuatSymmetrySoA& operator=(QuatSymmetrySoA&&) noexcept = default;
+
+  /**
+   * @brief Returns the number of symmetry operators
+   */
+  size_t size() const
+  {
+    return m_Size;
+  }
+
+  /**
+   * @brief Returns the i'th symmetry operator
+   */
+  QuatD operator[](size_t i) const
+  {
+    return {m_X[i], m_Y[i], m_Z[i], m_W[i]};
+  }
+
+  /**
+   * @brief identityScalarThreshold Returns the smallest |w| a relative rotation q1 * q2^-1 needs so that the identity is
+   * guaranteed to be the operator giving the smallest misorientation angle. If the rotation angle is at most half of the
+   * smallest operator angle then by the triangle inequality every other symmetric copy is at least as far away, so the
+   * operator search can be skipped. Laue classes with only the identity operator return 0.
+   */
+  double identityScalarThreshold() const
+  {
+    return m_IdentityScalarThreshold;
+  }
+
+  /**
+   * @brief multiply Computes the product of the i'th symmetry operator and q. This gives the same result as
+   * quatsym[i] * q.
+   * @param i Index of the symmetry operator
+   * @param q Input Quaternion
+   * @return
+   */
+  QuatD multiply(size_t i, const QuatD& q) const
+  {
+    return {q.x() * m_W[i] + q.w() * m_X[i] + q.z() * m_Y[i] - q.y() * m_Z[i], q.y() * m_W[i] + q.w() * m_Y[i] + q.x() * m_Z[i] - q.z() * m_X[i],
+            q.z() * m_W[i] + q.w() * m_Z[i] + q.y() * m_X[i] - q.x() * m_Y[i], q.w() * m_W[i] - q.x() * m_X[i] - q.y() * m_Y[i] - q.z() * m_Z[i]};
+  }
+
+  /**
+   * @brief findMaxAbsScalar Finds the symmetry operator whose product with q has the largest absolute scalar
+   * part, i.e., the smallest rotation angle. The scalar part is clamped to 1 so that round off can not change
+   * which operator wins. Ties go to the lowest index.
+   * @param q Input Quaternion
+   * @return Index of the symmetry operator
+   */
+  size_t findMaxAbsScalar(const QuatD& q) const
+  {
+    alignas(32) std::array<double, k_Capacity> w;
+    const double qx = q.x();
+    const double qy = q.y();
+    const double qz = q.z();
+    const double qw = q.w();
+    for(size_t i = 0; i < k_Capacity; i++)
+    {
+      w[i] = std::min(std::abs(qw * m_W[i] - qx * m_X[i] - qy * m_Y[i] - qz * m_Z[i]), 1.0);
+    }
+    return argMax(w);
+  }
+
+  /**
+   * @brief findNearest Finds the symmetry operator that moves q2 closest to q1. The product of each operator and
+   * q2 is flipped into the northern hemisphere before its distance to q1 is measured. Ties go to the lowest index.
+   * @param q1 Reference Quaternion
+   * @param q2 Quaternion that is moved by the symmetry operators
+   * @return Index of the symmetry operator
+   */
+  size_t findNearest(const QuatD& q1, const QuatD& q2) const
+  {
+    alignas(32) std::array<double, k_Capacity> dot;
+    const double qx = q2.x();
+    const double qy = q2.y();
+    const double qz = q2.z();
+    const double qw = q2.w();
+    for(size_t i = 0; i < k_Capacity; i++)
+    {
+      double x = qx * m_W[i] + qw * m_X[i] + qz * m_Y[i] - qy * m_Z[i];
+      double y = qy * m_W[i] + qw * m_Y[i] + qx * m_Z[i] - qz * m_X[i];
+      double z = qz * m_W[i] + qw * m_Z[i] + qy * m_X[i] - qx * m_Y[i];
+      double w = qw * m_W[i] - qx * m_X[i] - qy * m_Y[i] - qz * m_Z[i];
+      double d = w * q1.w() + x * q1.x() + y * q1.y() + z * q1.z();
+      dot[i] = (w < 0.0) ? -d : d;
+    }
+    return argMax(dot);
+  }
+
+private:
+  alignas(32) std::array<double, k_Capacity> m_X = {};
+  alignas(32) std::array<double, k_Capacity> m_Y = {};
+  alignas(32) std::array<double, k_Capacity> m_Z = {};
+  alignas(32) std::array<double, k_Capacity> m_W = {};
+  size_t m_Size = 0;
+  double m_IdentityScalarThreshold = 0.0;
+
+  static constexpr double k_IdentityTolerance = 1.0E-12;
+
+  /**
+   * @brief Returns the index of the largest of the first m_Size values. The comparison is done on 1 - value to
+   * match the distance metric that the scalar symmetry loops have always used.
+   */
+  size_t argMax(const std::array<double, k_Capacity>& values) const
+  {
+    size_t index = 0;
+    double smallestdist = 1.0 - values[0];
+    for(size_t i = 1; i < m_Size; i++)
+    {
+      double dist = 1.0 - values[i];
+      if(dist < smallestdist)
+      {
+        smallestdist = dist;
+        index = i;
+      }
+    }
+    return index;
+  }
+};
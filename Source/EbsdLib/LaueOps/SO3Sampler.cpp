@@ -440,15 +440,15 @@ SO3Sampler::OrientationListArrayType SO3Sampler::SampleRFZ(int nsteps, int pgnum
         z = static_cast<double>(k) * delta;
 
         // convert to Rodrigues representation
-        OrientationType cu(x, y, z);
-        OrientationType rod = OrientationTransformation::cu2ro<OrientationType, OrientationType>(cu);
+        CubochoricD cu(x, y, z);
+        RodriguesD rod = OrientationTransformation::cu2ro(cu);
 
         // If insideFZ=true, then add this point to the linked list FZlist and keep
         // track of how many points there are on this list
         bool b = IsinsideFZ(rod.data(), FZtype, FZorder);
         if(b)
         {
-          FZlist.push_back(rod);
+          FZlist.push_back(rod.toOrientation());
         }
       }
     }
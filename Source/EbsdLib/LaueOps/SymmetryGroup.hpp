@@ -0,0 +1,625 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "EbsdLib/Core/EbsdLibConstants.h"
+#include "EbsdLib/Core/FixedOrientation.hpp"
+#include "EbsdLib/Core/Orientation.hpp"
+#include "EbsdLib/Core/OrientationTransformation.hpp"
+#include "EbsdLib/Core/Quaternion.hpp"
+#include "EbsdLib/Math/EbsdLibMath.h"
+
+using SymQuatType = std::array<double, 4>; // <XYZ>W
+using SymRodType = std::array<double, 3>;
+using SymMatType = std::array<std::array<double, 3>, 3>;
+
+/**
+ * @brief The SymmetryGroupTables struct holds the symmetry operators of a single Laue class as constexpr tables of
+ * plain doubles. There is a specialization for each of the EbsdLib::CrystalStructure Laue classes. The LaueOps
+ * subclasses build their run time tables from these so there is only one copy of the values.
+ */
+template <uint32_t LaueClass>
+struct SymmetryGroupTables;
+
+// -----------------------------------------------------------------------------
+// Hexagonal-High 6/mmm
+template <>
+struct SymmetryGroupTables<EbsdLib::CrystalStructure::Hexagonal_High>
+{
+  static constexpr std::array<SymQuatType, 12> QuatSym = {{
+      {0.000000000, 0.000000000, 0.000000000, 1.000000000},
+      {0.000000000, 0.000000000, 0.500000000, 0.866025400},
+      {0.000000000, 0.000000000, 0.866025400, 0.500000000},
+      {0.000000000, 0.000000000, 1.000000000, 0.000000000},
+      {0.000000000, 0.000000000, 0.866025400, -0.50000000},
+      {0.000000000, 0.000000000, 0.500000000, -0.86602540},
+      {1.000000000, 0.000000000, 0.000000000, 0.000000000},
+      {0.866025400, 0.500000000, 0.000000000, 0.000000000},
+      {0.500000000, 0.866025400, 0.000000000, 0.000000000},
+      {0.000000000, 1.000000000, 0.000000000, 0.000000000},
+      {-0.50000000, 0.866025400, 0.000000000, 0.000000000},
+      {-0.86602540, 0.500000000, 0.000000000, 0.000000000}}};
+
+  static constexpr std::array<SymRodType, 12> RodSym = {{
+      {0.0, 0.0, 0.0},
+      {0.0, 0.0, 0.57735},
+      {0.0, 0.0, 1.73205},
+      {0.0, 0.0, 1000000000000.0},
+      {0.0, 0.0, -1.73205},
+      {0.0, 0.0, -0.57735},
+      {1000000000000.0, 0.0, 0.0},
+      {8660254000000.0, 5000000000000.0, 0.0},
+      {5000000000000.0, 8660254000000.0, 0.0},
+      {0.0, 1000000000000.0, 0.0},
+      {-5000000000000.0, 8660254000000.0, 0.0},
+      {-8660254000000.0, 5000000000000.0, 0.0}}};
+
+  static constexpr std::array<SymMatType, 12> MatSym = {{
+      {{{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}}},
+      {{{-0.5, EbsdLib::Constants::k_Root3Over2D, 0.0}, {-EbsdLib::Constants::k_Root3Over2D, -0.5, 0.0}, {0.0, 0.0, 1.0}}},
+      {{{-0.5, -EbsdLib::Constants::k_Root3Over2D, 0.0}, {EbsdLib::Constants::k_Root3Over2D, -0.5, 0.0}, {0.0, 0.0, 1.0}}},
+      {{{0.5, EbsdLib::Constants::k_Root3Over2D, 0.0}, {-EbsdLib::Constants::k_Root3Over2D, 0.5, 0.0}, {0.0, 0.0, 1.0}}},
+      {{{-1.0, 0.0, 0.0}, {0.0, -1.0, 0.0}, {0.0, 0.0, 1.0}}},
+      {{{0.5, -EbsdLib::Constants::k_Root3Over2D, 0.0}, {EbsdLib::Constants::k_Root3Over2D, 0.5, 0.0}, {0.0, 0.0, 1.0}}},
+      {{{-0.5, -EbsdLib::Constants::k_Root3Over2D, 0.0}, {-EbsdLib::Constants::k_Root3Over2D, 0.5, 0.0}, {0.0, 0.0, -1.0}}},
+      {{{1.0, 0.0, 0.0}, {0.0, -1.0, 0.0}, {0.0, 0.0, -1.0}}},
+      {{{-0.5, EbsdLib::Constants::k_Root3Over2D, 0.0}, {EbsdLib::Constants::k_Root3Over2D, 0.5, 0.0}, {0.0, 0.0, -1.0}}},
+      {{{0.5, EbsdLib::Constants::k_Root3Over2D, 0.0}, {EbsdLib::Constants::k_Root3Over2D, -0.5, 0.0}, {0.0, 0.0, -1.0}}},
+      {{{-1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, -1.0}}},
+      {{{0.5, -EbsdLib::Constants::k_Root3Over2D, 0.0}, {-EbsdLib::Constants::k_Root3Over2D, -0.5, 0.0}, {0.0, 0.0, -1.0}}}}};
+};
+
+// -----------------------------------------------------------------------------
+// Cubic-High m-3m
+template <>
+struct SymmetryGroupTables<EbsdLib::CrystalStructure::Cubic_High>
+{
+  static constexpr std::array<SymQuatType, 24> QuatSym = {{
+      {0.000000000, 0.000000000, 0.000000000, 1.000000000},
+      {1.000000000, 0.000000000, 0.000000000, 0.000000000},
+      {0.000000000, 1.000000000, 0.000000000, 0.000000000},
+      {0.000000000, 0.000000000, 1.000000000, 0.000000000},
+      {EbsdLib::Constants::k_1OverRoot2D, 0.000000000, 0.000000000, EbsdLib::Constants::k_1OverRoot2D},
+      {0.000000000, EbsdLib::Constants::k_1OverRoot2D, 0.000000000, EbsdLib::Constants::k_1OverRoot2D},
+      {0.000000000, 0.000000000, EbsdLib::Constants::k_1OverRoot2D, EbsdLib::Constants::k_1OverRoot2D},
+      {-EbsdLib::Constants::k_1OverRoot2D, 0.000000000, 0.000000000, EbsdLib::Constants::k_1OverRoot2D},
+      {0.000000000, -EbsdLib::Constants::k_1OverRoot2D, 0.000000000, EbsdLib::Constants::k_1OverRoot2D},
+      {0.000000000, 0.000000000, -EbsdLib::Constants::k_1OverRoot2D, EbsdLib::Constants::k_1OverRoot2D},
+      {EbsdLib::Constants::k_1OverRoot2D, EbsdLib::Constants::k_1OverRoot2D, 0.000000000, 0.000000000},
+      {-EbsdLib::Constants::k_1OverRoot2D, EbsdLib::Constants::k_1OverRoot2D, 0.000000000, 0.000000000},
+      {0.000000000, EbsdLib::Constants::k_1OverRoot2D, EbsdLib::Constants::k_1OverRoot2D, 0.000000000},
+      {0.000000000, -EbsdLib::Constants::k_1OverRoot2D, EbsdLib::Constants::k_1OverRoot2D, 0.000000000},
+      {EbsdLib::Constants::k_1OverRoot2D, 0.000000000, EbsdLib::Constants::k_1OverRoot2D, 0.000000000},
+      {-EbsdLib::Constants::k_1OverRoot2D, 0.000000000, EbsdLib::Constants::k_1OverRoot2D, 0.000000000},
+      {0.500000000, 0.500000000, 0.500000000, 0.500000000},
+      {-0.500000000, -0.500000000, -0.500000000, 0.500000000},
+      {0.500000000, -0.500000000, 0.500000000, 0.500000000},
+      {-0.500000000, 0.500000000, -0.500000000, 0.500000000},
+      {-0.500000000, 0.500000000, 0.500000000, 0.500000000},
+      {0.500000000, -0.500000000, -0.500000000, 0.500000000},
+      {-0.500000000, -0.500000000, 0.500000000, 0.500000000},
+      {0.500000000, 0.500000000, -0.500000000, 0.500000000}}};
+
+  static constexpr std::array<SymRodType, 24> RodSym = {{
+      {0.0, 0.0, 0.0},
+      {10000000000.0, 0.0, 0.0},
+      {0.0, 10000000000.0, 0.0},
+      {0.0, 0.0, 10000000000.0},
+      {1.0, 0.0, 0.0},
+      {0.0, 1.0, 0.0},
+      {0.0, 0.0, 1.0},
+      {-1.0, 0.0, 0.0},
+      {0.0, -1.0, 0.0},
+      {0.0, 0.0, -1.0},
+      {10000000000.0, 10000000000.0, 0.0},
+      {-10000000000.0, 10000000000.0, 0.0},
+      {0.0, 10000000000.0, 10000000000.0},
+      {0.0, -10000000000.0, 10000000000.0},
+      {10000000000.0, 0.0, 10000000000.0},
+      {-10000000000.0, 0.0, 10000000000.0},
+      {1.0, 1.0, 1.0},
+      {-1.0, -1.0, -1.0},
+      {1.0, -1.0, 1.0},
+      {-1.0, 1.0, -1.0},
+      {-1.0, 1.0, 1.0},
+      {1.0, -1.0, -1.0},
+      {-1.0, -1.0, 1.0},
+      {1.0, 1.0, -1.0}}};
+
+  static constexpr std::array<SymMatType, 24> MatSym = {{
+      {{{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}}},
+      {{{1.0, 0.0, 0.0}, {0.0, 0.0, -1.0}, {0.0, 1.0, 0.0}}},
+      {{{1.0, 0.0, 0.0}, {0.0, -1.0, 0.0}, {0.0, 0.0, -1.0}}},
+      {{{1.0, 0.0, 0.0}, {0.0, 0.0, 1.0}, {0.0, -1.0, 0.0}}},
+      {{{0.0, 0.0, -1.0}, {0.0, 1.0, 0.0}, {1.0, 0.0, 0.0}}},
+      {{{0.0, 0.0, 1.0}, {0.0, 1.0, 0.0}, {-1.0, 0.0, 0.0}}},
+      {{{-1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, -1.0}}},
+      {{{-1.0, 0.0, 0.0}, {0.0, -1.0, 0.0}, {0.0, 0.0, 1.0}}},
+      {{{0.0, 1.0, 0.0}, {-1.0, 0.0, 0.0}, {0.0, 0.0, 1.0}}},
+      {{{0.0, -1.0, 0.0}, {1.0, 0.0, 0.0}, {0.0, 0.0, 1.0}}},
+      {{{0.0, -1.0, 0.0}, {0.0, 0.0, 1.0}, {-1.0, 0.0, 0.0}}},
+      {{{0.0, 0.0, 1.0}, {-1.0, 0.0, 0.0}, {0.0, -1.0, 0.0}}},
+      {{{0.0, -1.0, 0.0}, {0.0, 0.0, -1.0}, {1.0, 0.0, 0.0}}},
+      {{{0.0, 0.0, -1.0}, {1.0, 0.0, 0.0}, {0.0, -1.0, 0.0}}},
+      {{{0.0, 1.0, 0.0}, {0.0, 0.0, -1.0}, {-1.0, 0.0, 0.0}}},
+      {{{0.0, 0.0, -1.0}, {-1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}}},
+      {{{0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}, {1.0, 0.0, 0.0}}},
+      {{{0.0, 0.0, 1.0}, {1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}}},
+      {{{0.0, 1.0, 0.0}, {1.0, 0.0, 0.0}, {0.0, 0.0, -1.0}}},
+      {{{-1.0, 0.0, 0.0}, {0.0, 0.0, 1.0}, {0.0, 1.0, 0.0}}},
+      {{{0.0, 0.0, 1.0}, {0.0, -1.0, 0.0}, {1.0, 0.0, 0.0}}},
+      {{{-1.0, 0.0, 0.0}, {0.0, 0.0, -1.0}, {0.0, -1.0, 0.0}}},
+      {{{0.0, 0.0, -1.0}, {0.0, -1.0, 0.0}, {-1.0, 0.0, 0.0}}},
+      {{{0.0, -1.0, 0.0}, {-1.0, 0.0, 0.0}, {0.0, 0.0, -1.0}}}}};
+};
+
+// -----------------------------------------------------------------------------
+// Hexagonal-Low 6/m
+template <>
+struct SymmetryGroupTables<EbsdLib::CrystalStructure::Hexagonal_Low>
+{
+  static constexpr std::array<SymQuatType, 6> QuatSym = {{
+      {0.000000000, 0.000000000, 0.000000000, 1.000000000},
+      {0.000000000, 0.000000000, 0.500000000, 0.866025400},
+      {0.000000000, 0.000000000, 0.866025400, 0.500000000},
+      {0.000000000, 0.000000000, 1.000000000, 0.000000000},
+      {0.000000000, 0.000000000, 0.866025400, -0.50000000},
+      {0.000000000, 0.000000000, 0.500000000, -0.86602540}}};
+
+  static constexpr std::array<SymRodType, 6> RodSym = {{
+      {0.0, 0.0, 0.0},
+      {0.0, 0.0, 0.57735},
+      {0.0, 0.0, 1.73205},
+      {0.0, 0.0, 1000000000000.0},
+      {0.0, 0.0, -1.73205},
+      {0.0, 0.0, -0.57735}}};
+
+  static constexpr std::array<SymMatType, 6> MatSym = {{
+      {{{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}}},
+      {{{-0.5, EbsdLib::Constants::k_Root3Over2D, 0.0}, {-EbsdLib::Constants::k_Root3Over2D, -0.5, 0.0}, {0.0, 0.0, 1.0}}},
+      {{{-0.5, -EbsdLib::Constants::k_Root3Over2D, 0.0}, {EbsdLib::Constants::k_Root3Over2D, -0.5, 0.0}, {0.0, 0.0, 1.0}}},
+      {{{0.0, EbsdLib::Constants::k_Root3Over2D, 0.0}, {-EbsdLib::Constants::k_Root3Over2D, 0.5, 0.0}, {0.0, 0.0, 1.0}}},
+      {{{-1.0, 0.0, 0.0}, {0.0, -1.0, 0.0}, {0.0, 0.0, 1.0}}},
+      {{{0.5, -EbsdLib::Constants::k_Root3Over2D, 0.0}, {EbsdLib::Constants::k_Root3Over2D, 0.5, 0.0}, {0.0, 0.0, 1.0}}}}};
+};
+
+// -----------------------------------------------------------------------------
+// Cubic-Low m-3
+template <>
+struct SymmetryGroupTables<EbsdLib::CrystalStructure::Cubic_Low>
+{
+  static constexpr std::array<SymQuatType, 12> QuatSym = {{
+      {0.000000000, 0.000000000, 0.000000000, 1.000000000},
+      {1.000000000, 0.000000000, 0.000000000, 0.000000000},
+      {0.000000000, 1.000000000, 0.000000000, 0.000000000},
+      {0.000000000, 0.000000000, 1.000000000, 0.000000000},
+      {0.500000000, 0.500000000, 0.500000000, 0.500000000},
+      {-0.500000000, -0.500000000, -0.500000000, 0.500000000},
+      {0.500000000, -0.500000000, 0.500000000, 0.500000000},
+      {-0.500000000, 0.500000000, -0.500000000, 0.500000000},
+      {-0.500000000, 0.500000000, 0.500000000, 0.500000000},
+      {0.500000000, -0.500000000, -0.500000000, 0.500000000},
+      {-0.500000000, -0.500000000, 0.500000000, 0.500000000},
+      {0.500000000, 0.500000000, -0.500000000, 0.500000000}}};
+
+  static constexpr std::array<SymRodType, 12> RodSym = {{
+      {0.0, 0.0, 0.0},
+      {10000000000.0, 0.0, 0.0},
+      {0.0, 10000000000.0, 0.0},
+      {0.0, 0.0, 10000000000.0},
+      {1.0, 1.0, 1.0},
+      {-1.0, -1.0, -1.0},
+      {1.0, -1.0, 1.0},
+      {-1.0, 1.0, -1.0},
+      {-1.0, 1.0, 1.0},
+      {1.0, -1.0, -1.0},
+      {-1.0, -1.0, 1.0},
+      {1.0, 1.0, -1.0}}};
+
+  static constexpr std::array<SymMatType, 12> MatSym = {{
+      {{{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}}},
+      {{{1.0, 0.0, 0.0}, {0.0, -1.0, 0.0}, {0.0, 0.0, -1.0}}},
+      {{{-1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, -1.0}}},
+      {{{-1.0, 0.0, 0.0}, {0.0, -1.0, 0.0}, {0.0, 0.0, 1.0}}},
+      {{{0.0, -1.0, 0.0}, {0.0, 0.0, 1.0}, {-1.0, 0.0, 0.0}}},
+      {{{0.0, 0.0, 1.0}, {-1.0, 0.0, 0.0}, {0.0, -1.0, 0.0}}},
+      {{{0.0, -1.0, 0.0}, {0.0, 0.0, -1.0}, {1.0, 0.0, 0.0}}},
+      {{{0.0, 0.0, -1.0}, {1.0, 0.0, 0.0}, {0.0, -1.0, 0.0}}},
+      {{{0.0, 1.0, 0.0}, {0.0, 0.0, -1.0}, {-1.0, 0.0, 0.0}}},
+      {{{0.0, 0.0, -1.0}, {-1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}}},
+      {{{0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}, {1.0, 0.0, 0.0}}},
+      {{{0.0, 0.0, 1.0}, {1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}}}}};
+};
+
+// -----------------------------------------------------------------------------
+// Triclinic -1
+template <>
+struct SymmetryGroupTables<EbsdLib::CrystalStructure::Triclinic>
+{
+  static constexpr std::array<SymQuatType, 1> QuatSym = {{
+      {0.000000000, 0.000000000, 0.000000000, 1.000000000}}};
+
+  static constexpr std::array<SymRodType, 1> RodSym = {{
+      {0.0, 0.0, 0.0}}};
+
+  static constexpr std::array<SymMatType, 1> MatSym = {{
+      {{{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}}}}};
+};
+
+// -----------------------------------------------------------------------------
+// Monoclinic 2/m
+template <>
+struct SymmetryGroupTables<EbsdLib::CrystalStructure::Monoclinic>
+{
+  static constexpr std::array<SymQuatType, 2> QuatSym = {{
+      {0.000000000, 0.000000000, 0.000000000, 1.000000000},
+      {0.000000000, 1.000000000, 0.000000000, 0.000000000}}};
+
+  static constexpr std::array<SymRodType, 2> RodSym = {{
+      {0.0, 0.0, 0.0},
+      {0.0, 10000000000.0, 0.0}}};
+
+  static constexpr std::array<SymMatType, 2> MatSym = {{
+      {{{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}}},
+      {{{-1.0, 0.0, 0.0}, {0.0, -1.0, 0.0}, {0.0, 0.0, 1.0}}}}};
+};
+
+// -----------------------------------------------------------------------------
+// Orthorhombic mmm
+template <>
+struct SymmetryGroupTables<EbsdLib::CrystalStructure::OrthoRhombic>
+{
+  static constexpr std::array<SymQuatType, 4> QuatSym = {{
+      {0.000000000, 0.000000000, 0.000000000, 1.000000000},
+      {1.000000000, 0.000000000, 0.000000000, 0.000000000},
+      {0.000000000, 1.000000000, 0.000000000, 0.000000000},
+      {0.000000000, 0.000000000, 1.000000000, 0.000000000}}};
+
+  static constexpr std::array<SymRodType, 4> RodSym = {{
+      {0.0, 0.0, 0.0},
+      {10000000000.0, 0.0, 0.0},
+      {0.0, 10000000000.0, 0.0},
+      {0.0, 0.0, 10000000000.0}}};
+
+  static constexpr std::array<SymMatType, 4> MatSym = {{
+      {{{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}}},
+      {{{1.0, 0.0, 0.0}, {0.0, -1.0, 0.0}, {0.0, 0.0, -1.0}}},
+      {{{-1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, -1.0}}},
+      {{{-1.0, 0.0, 0.0}, {0.0, -1.0, 0.0}, {0.0, 0.0, 1.0}}}}};
+};
+
+// -----------------------------------------------------------------------------
+// Tetragonal-Low 4/m
+template <>
+struct SymmetryGroupTables<EbsdLib::CrystalStructure::Tetragonal_Low>
+{
+  static constexpr std::array<SymQuatType, 4> QuatSym = {{
+      {0.000000000, 0.000000000, 0.000000000, 1.000000000},
+      {0.000000000, 0.000000000, 1.000000000, 0.000000000},
+      {0.000000000, 0.000000000, EbsdLib::Constants::k_1OverRoot2D, -EbsdLib::Constants::k_1OverRoot2D},
+      {0.000000000, 0.000000000, EbsdLib::Constants::k_1OverRoot2D, EbsdLib::Constants::k_1OverRoot2D}}};
+
+  static constexpr std::array<SymRodType, 4> RodSym = {{
+      {0.0, 0.0, 0.0},
+      {0.0, 0.0, 10000000000.0},
+      {0.0, 0.0, -1.0},
+      {0.0, 0.0, 1.0}}};
+
+  static constexpr std::array<SymMatType, 4> MatSym = {{
+      {{{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}}},
+      {{{-1.0, 0.0, 0.0}, {0.0, -1.0, 0.0}, {0.0, 0.0, 1.0}}},
+      {{{0.0, 1.0, 0.0}, {-1.0, 0.0, 0.0}, {0.0, 0.0, 1.0}}},
+      {{{0.0, -1.0, 0.0}, {1.0, 0.0, 0.0}, {0.0, 0.0, 1.0}}}}};
+};
+
+// -----------------------------------------------------------------------------
+// Tetragonal-High 4/mmm
+template <>
+struct SymmetryGroupTables<EbsdLib::CrystalStructure::Tetragonal_High>
+{
+  static constexpr std::array<SymQuatType, 8> QuatSym = {{
+      {0.000000000, 0.000000000, 0.000000000, 1.000000000},
+      {1.000000000, 0.000000000, 0.000000000, 0.000000000},
+      {0.000000000, 1.000000000, 0.000000000, 0.000000000},
+      {0.000000000, 0.000000000, 1.000000000, 0.000000000},
+      {0.000000000, 0.000000000, EbsdLib::Constants::k_1OverRoot2D, -EbsdLib::Constants::k_1OverRoot2D},
+      {0.000000000, 0.000000000, EbsdLib::Constants::k_1OverRoot2D, EbsdLib::Constants::k_1OverRoot2D},
+      {EbsdLib::Constants::k_1OverRoot2D, EbsdLib::Constants::k_1OverRoot2D, 0.000000000, 0.000000000},
+      {-EbsdLib::Constants::k_1OverRoot2D, EbsdLib::Constants::k_1OverRoot2D, 0.000000000, 0.000000000}}};
+
+  static constexpr std::array<SymRodType, 8> RodSym = {{
+      {0.0, 0.0, 0.0},
+      {10000000000.0, 0.0, 0.0},
+      {0.0, 10000000000.0, 0.0},
+      {0.0, 0.0, 10000000000.0},
+      {0.0, 0.0, -1.0},
+      {0.0, 0.0, 1.0},
+      {10000000000.0, 10000000000.0, 0.0},
+      {-10000000000.0, 10000000000.0, 0.0}}};
+
+  static constexpr std::array<SymMatType, 8> MatSym = {{
+      {{{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}}},
+      {{{1.0, 0.0, 0.0}, {0.0, -1.0, 0.0}, {0.0, 0.0, -1.0}}},
+      {{{-1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, -1.0}}},
+      {{{-1.0, 0.0, 0.0}, {0.0, -1.0, 0.0}, {0.0, 0.0, 1.0}}},
+      {{{0.0, 1.0, 0.0}, {-1.0, 0.0, 0.0}, {0.0, 0.0, 1.0}}},
+      {{{0.0, -1.0, 0.0}, {1.0, 0.0, 0.0}, {0.0, 0.0, 1.0}}},
+      {{{0.0, 1.0, 0.0}, {1.0, 0.0, 0.0}, {0.0, 0.0, -1.0}}},
+      {{{0.0, -1.0, 0.0}, {-1.0, 0.0, 0.0}, {0.0, 0.0, -1.0}}}}};
+};
+
+// -----------------------------------------------------------------------------
+// Trigonal-Low -3
+template <>
+struct SymmetryGroupTables<EbsdLib::CrystalStructure::Trigonal_Low>
+{
+  static constexpr std::array<SymQuatType, 3> QuatSym = {{
+      {0.000000000, 0.000000000, 0.000000000, 1.000000000},
+      {0.000000000, 0.000000000, 0.866025400, 0.500000000},
+      {0.000000000, 0.000000000, 0.866025400, -0.50000000}}};
+
+  static constexpr std::array<SymRodType, 3> RodSym = {{
+      {0.0, 0.0, 0.0},
+      {0.0, 0.0, 1.73205},
+      {0.0, 0.0, -1.73205}}};
+
+  static constexpr std::array<SymMatType, 3> MatSym = {{
+      {{{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}}},
+      {{{-0.5, EbsdLib::Constants::k_Root3Over2D, 0.0}, {-EbsdLib::Constants::k_Root3Over2D, -0.5, 0.0}, {0.0, 0.0, 1.0}}},
+      {{{-0.5, -EbsdLib::Constants::k_Root3Over2D, 0.0}, {EbsdLib::Constants::k_Root3Over2D, -0.5, 0.0}, {0.0, 0.0, 1.0}}}}};
+};
+
+// -----------------------------------------------------------------------------
+// Trigonal-High -3m
+template <>
+struct SymmetryGroupTables<EbsdLib::CrystalStructure::Trigonal_High>
+{
+  static constexpr std::array<SymQuatType, 6> QuatSym = {{
+      {0.000000000, 0.000000000, 0.000000000, 1.000000000},
+      {0.000000000, 0.000000000, 0.866025400, 0.500000000},
+      {0.000000000, 0.000000000, 0.866025400, -0.50000000},
+      {1.000000000, 0.000000000, 0.000000000, 0.000000000},
+      {-0.500000000, 0.86602540, 0.000000000, 0.000000000},
+      {-0.500000000, -0.866025400, 0.000000000, 0.000000000}}};
+
+  static constexpr std::array<SymRodType, 6> RodSym = {{
+      {0.0, 0.0, 0.0},
+      {0.0, 0.0, 1.73205},
+      {0.0, 0.0, -1.73205},
+      {8660254000000.0, 5000000000000.0, 0.0},
+      {0.0, 1000000000000.0, 0.0},
+      {-8660254000000.0, 5000000000000.0, 0.0}}};
+
+  static constexpr std::array<SymMatType, 6> MatSym = {{
+      {{{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}}},
+      {{{-0.5, EbsdLib::Constants::k_Root3Over2D, 0.0}, {-EbsdLib::Constants::k_Root3Over2D, -0.5, 0.0}, {0.0, 0.0, 1.0}}},
+      {{{-0.5, -EbsdLib::Constants::k_Root3Over2D, 0.0}, {EbsdLib::Constants::k_Root3Over2D, -0.5, 0.0}, {0.0, 0.0, 1.0}}},
+      {{{0.5, EbsdLib::Constants::k_Root3Over2D, 0.0}, {EbsdLib::Constants::k_Root3Over2D, -0.5, 0.0}, {0.0, 0.0, -1.0}}},
+      {{{-1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, -1.0}}},
+      {{{0.5, -EbsdLib::Constants::k_Root3Over2D, 0.0}, {-EbsdLib::Constants::k_Root3Over2D, -0.5, 0.0}, {0.0, 0.0, -1.0}}}}};
+};
+
+/**
+ * @brief The SymmetryGroup class is a non-virtual, compile time interface to the symmetry operators of a Laue
+ * class. The number of operators is a compile time constant so the loops below are fully unrolled and the
+ * operators can be kept in registers. Callers that know the crystal structure at compile time can use these
+ * directly instead of going through a LaueOps instance, e.g.:
+ * @code
+ *   QuatD fz = SymmetryGroup<EbsdLib::CrystalStructure::Cubic_High>::FZQuat(q);
+ *   QuatD fz2 = CubicOps::SymmetryGroupType::FZQuat(q);
+ * @endcode
+ */
+template <uint32_t LaueClass>
+class SymmetryGroup : public SymmetryGroupTables<LaueClass>
+{
+public:
+  using Tables = SymmetryGroupTables<LaueClass>;
+
+  static constexpr uint32_t k_LaueClass = LaueClass;
+  static constexpr size_t k_SymOpsCount = Tables::QuatSym.size();
+
+  SymmetryGroup() = delete;
+
+  /**
+   * @brief QuatSymOp Returns the i'th symmetry operator as a Quaternion
+   */
+  template <typename T = double>
+  static Quaternion<T> QuatSymOp(size_t i)
+  {
+    const SymQuatType& s = Tables::QuatSym[i];
+    return {static_cast<T>(s[0]), static_cast<T>(s[1]), static_cast<T>(s[2]), static_cast<T>(s[3])};
+  }
+
+  /**
+   * @brief Multiply Computes the product of the i'th symmetry operator and q. This gives the same result as
+   * QuatSymOp(i) * q.
+   */
+  template <typename T>
+  static Quaternion<T> Multiply(size_t i, const Quaternion<T>& q)
+  {
+    const T sx = static_cast<T>(Tables::QuatSym[i][0]);
+    const T sy = static_cast<T>(Tables::QuatSym[i][1]);
+    const T sz = static_cast<T>(Tables::QuatSym[i][2]);
+    const T sw = static_cast<T>(Tables::QuatSym[i][3]);
+    return {q.x() * sw + q.w() * sx + q.z() * sy - q.y() * sz, q.y() * sw + q.w() * sy + q.x() * sz - q.z() * sx, q.z() * sw + q.w() * sz + q.y() * sx - q.x() * sy,
+            q.w() * sw - q.x() * sx - q.y() * sy - q.z() * sz};
+  }
+
+  /**
+   * @brief FindMaxAbsScalar Finds the symmetry operator whose product with q has the largest absolute scalar part,
+   * i.e., the smallest rotation angle. Ties go to the lowest index.
+   * @return Index of the symmetry operator
+   */
+  template <typename T>
+  static size_t FindMaxAbsScalar(const Quaternion<T>& q)
+  {
+    size_t index = 0;
+    T smallestdist = static_cast<T>(2.0);
+    for(size_t i = 0; i < k_SymOpsCount; i++)
+    {
+      T w = q.w() * static_cast<T>(Tables::QuatSym[i][3]) - q.x() * static_cast<T>(Tables::QuatSym[i][0]) - q.y() * static_cast<T>(Tables::QuatSym[i][1]) -
+            q.z() * static_cast<T>(Tables::QuatSym[i][2]);
+      T dist = static_cast<T>(1.0) - std::min(std::abs(w), static_cast<T>(1.0));
+      if(dist < smallestdist)
+      {
+        smallestdist = dist;
+        index = i;
+      }
+    }
+    return index;
+  }
+
+  /**
+   * @brief FindNearest Finds the symmetry operator that moves q2 closest to q1. Ties go to the lowest index.
+   * @return Index of the symmetry operator
+   */
+  template <typename T>
+  static size_t FindNearest(const Quaternion<T>& q1, const Quaternion<T>& q2)
+  {
+    size_t index = 0;
+    T smallestdist = static_cast<T>(1000000.0);
+    for(size_t i = 0; i < k_SymOpsCount; i++)
+    {
+      Quaternion<T> qc = Multiply(i, q2);
+      if(qc.w() < 0)
+      {
+        qc.negate();
+      }
+      T dist = static_cast<T>(1.0) - (qc.w() * q1.w() + qc.x() * q1.x() + qc.y() * q1.y() + qc.z() * q1.z());
+      if(dist < smallestdist)
+      {
+        smallestdist = dist;
+        index = i;
+      }
+    }
+    return index;
+  }
+
+  /**
+   * @brief FZQuat Returns the symmetric equivalent of q that lies in the Fundamental Zone
+   */
+  template <typename T>
+  static Quaternion<T> FZQuat(const Quaternion<T>& q)
+  {
+    Quaternion<T> out = Multiply(FindMaxAbsScalar(q), q);
+    if(out.w() < 0)
+    {
+      out.negate();
+    }
+    return out;
+  }
+
+  /**
+   * @brief NearestQuat Returns the symmetric equivalent of q2 that is closest to q1
+   */
+  template <typename T>
+  static Quaternion<T> NearestQuat(const Quaternion<T>& q1, const Quaternion<T>& q2)
+  {
+    Quaternion<T> out = Multiply(FindNearest(q1, q2), q2);
+    if(out.w() < 0)
+    {
+      out.negate();
+    }
+    return out;
+  }
+
+  /**
+   * @brief Misorientation Finds the misorientation between 2 quaternions by applying every symmetry operator to
+   * q1 * q2^-1. This is the generic reduction that LaueOps uses. CubicOps has its own closed form version for the
+   * m-3m group which gives the same angle.
+   * @return Axis Angle Representation
+   */
+  template <typename T>
+  static AxisAngleType<T> Misorientation(const Quaternion<T>& q1, const Quaternion<T>& q2)
+  {
+    Quaternion<T> qr = q1 * (q2.conjugate());
+    Quaternion<T> qc = Multiply(FindMaxAbsScalar(qr), qr);
+    qc.w() = std::max(std::min(qc.w(), static_cast<T>(1.0)), static_cast<T>(-1.0));
+
+    AxisAngleType<T> axisAngle = OrientationTransformation::qu2ax(qc);
+    if(axisAngle[3] > EbsdLib::Constants::k_PiD)
+    {
+      axisAngle[3] = static_cast<T>(EbsdLib::Constants::k_2PiD - axisAngle[3]);
+    }
+    T denom = std::sqrt(axisAngle[0] * axisAngle[0] + axisAngle[1] * axisAngle[1] + axisAngle[2] * axisAngle[2]);
+    if(denom == 0.0 || axisAngle[3] == 0.0)
+    {
+      axisAngle[0] = 0.0;
+      axisAngle[1] = 0.0;
+      axisAngle[2] = 1.0;
+    }
+    else
+    {
+      axisAngle[0] = axisAngle[0] / denom;
+      axisAngle[1] = axisAngle[1] / denom;
+      axisAngle[2] = axisAngle[2] / denom;
+    }
+    return axisAngle;
+  }
+
+  /**
+   * @brief QuatSymVector Returns the symmetry operators as a vector of Quaternions
+   */
+  static std::vector<QuatD> QuatSymVector()
+  {
+    std::vector<QuatD> quatsym;
+    quatsym.reserve(k_SymOpsCount);
+    for(size_t i = 0; i < k_SymOpsCount; i++)
+    {
+      quatsym.push_back(QuatSymOp<double>(i));
+    }
+    return quatsym;
+  }
+
+  /**
+   * @brief RodSymVector Returns the symmetry operators as a vector of Rodrigues vectors
+   */
+  static std::vector<OrientationD> RodSymVector()
+  {
+    std::vector<OrientationD> rodsym;
+    rodsym.reserve(k_SymOpsCount);
+    for(const SymRodType& r : Tables::RodSym)
+    {
+      rodsym.emplace_back(r[0], r[1], r[2]);
+    }
+    return rodsym;
+  }
+};
@@ -0,0 +1,83 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "EbsdLibRandomEngine.h"
+
+#include <atomic>
+#include <mutex>
+#include <random>
+
+namespace
+{
+std::mutex s_SeedMutex;
+uint64_t s_Seed = (static_cast<uint64_t>(std::random_device{}()) << 32) | std::random_device{}();
+std::atomic<uint64_t> s_Generation = {1};
+uint64_t s_NextStream = 0;
+
+struct ThreadEngine
+{
+  PhiloxEngine engine;
+  uint64_t generation = 0;
+};
+} // namespace
+
+// -----------------------------------------------------------------------------
+void EbsdLibRandomEngine::SetSeed(uint64_t seed)
+{
+  std::lock_guard<std::mutex> lock(s_SeedMutex);
+  s_Seed = seed;
+  s_NextStream = 0;
+  s_Generation++;
+}
+
+// -----------------------------------------------------------------------------
+uint64_t EbsdLibRandomEngine::GetSeed()
+{
+  std::lock_guard<std::mutex> lock(s_SeedMutex);
+  return s_Seed;
+}
+
+// -----------------------------------------------------------------------------
+PhiloxEngine& EbsdLibRandomEngine::ThreadLocal()
+{
+  thread_local ThreadEngine threadEngine;
+  if(threadEngine.generation != s_Generation.load(std::memory_order_acquire))
+  {
+    std::lock_guard<std::mutex> lock(s_SeedMutex);
+    threadEngine.engine.seed(s_Seed, s_NextStream++);
+    threadEngine.generation = s_Generation.load();
+  }
+  return threadEngine.engine;
+}
@@ -0,0 +1,190 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#include "EbsdLib/EbsdLib.h"
+
+/**
+ * @brief The PhiloxEngine class is a counter based Philox4x32-10 random number engine
+ * (Salmon et al., "Parallel Random Numbers: As Easy as 1, 2, 3", SC 2011). The whole
+ * state is a 64 bit key (the seed), a 64 bit stream and a 64 bit block counter so an
+ * engine is cheap to construct and engines with different streams are independent.
+ * Constructing an engine per element with the element index as the stream gives
+ * results that do not depend on how the work is split between threads.
+ *
+ * The class satisfies the UniformRandomBitGenerator requirements so it can be used
+ * with the std:: distributions.
+ */
+class PhiloxEngine
+{
+public:
+  using result_type = uint32_t;
+
+  PhiloxEngine() = default;
+  explicit PhiloxEngine(uint64_t seed, uint64_t stream = 0)
+  {
+    this->seed(seed, stream);
+  }
+  ~PhiloxEngine() = default;
+
+  PhiloxEngine(const PhiloxEngine&) = default;
+  PhiloxEngine(PhiloxEngine&&) noexcept = default;
+  PhiloxEngine& operator=(const PhiloxEngine&) = default;
+  PhiloxEngine& operator=(PhiloxEngine&&) noexcept = default;
+
+  static constexpr result_type min()
+  {
+    return 0;
+  }
+  static constexpr result_type max()
+  {
+    return std::numeric_limits<result_type>::max();
+  }
+
+  /**
+   * @brief Restarts the engine at the first block of the given seed and stream
+   */
+  void seed(uint64_t seed, uint64_t stream = 0)
+  {
+    m_Key = {static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32)};
+    m_Stream = stream;
+    m_Counter = 0;
+    m_Index = k_BlockSize;
+  }
+
+  /**
+   * @brief Returns the next 32 bit random value
+   */
+  result_type operator()()
+  {
+    if(m_Index == k_BlockSize)
+    {
+      m_Block = Generate(m_Key, m_Counter, m_Stream);
+      m_Counter++;
+      m_Index = 0;
+    }
+    return m_Block[m_Index++];
+  }
+
+  /**
+   * @brief Returns a random value in the range [0, 1) with 53 bit resolution
+   */
+  double generateDouble()
+  {
+    uint32_t a = operator()() >> 5;
+    uint32_t b = operator()() >> 6;
+    return (a * 67108864.0 + b) * (1.0 / 9007199254740992.0);
+  }
+
+  /**
+   * @brief Returns a random index in the range [0, count)
+   */
+  size_t generateIndex(size_t count)
+  {
+    return static_cast<size_t>((static_cast<uint64_t>(operator()()) * static_cast<uint64_t>(count)) >> 32);
+  }
+
+  /**
+   * @brief Computes a single Philox4x32-10 block
+   * @param key The 64 bit key as 2 words
+   * @param counter Low 64 bits of the counter
+   * @param stream High 64 bits of the counter
+   */
+  static std::array<uint32_t, 4> Generate(std::array<uint32_t, 2> key, uint64_t counter, uint64_t stream)
+  {
+    std::array<uint32_t, 4> ctr = {static_cast<uint32_t>(counter), static_cast<uint32_t>(counter >> 32), static_cast<uint32_t>(stream), static_cast<uint32_t>(stream >> 32)};
+    for(int round = 0; round < 10; round++)
+    {
+      uint64_t p0 = static_cast<uint64_t>(k_Multiplier0) * ctr[0];
+      uint64_t p1 = static_cast<uint64_t>(k_Multiplier1) * ctr[2];
+      ctr = {static_cast<uint32_t>(p1 >> 32) ^ ctr[1] ^ key[0], static_cast<uint32_t>(p1), static_cast<uint32_t>(p0 >> 32) ^ ctr[3] ^ key[1], static_cast<uint32_t>(p0)};
+      key[0] += k_Weyl0;
+      key[1] += k_Weyl1;
+    }
+    return ctr;
+  }
+
+private:
+  static constexpr uint32_t k_Multiplier0 = 0xD2511F53;
+  static constexpr uint32_t k_Multiplier1 = 0xCD9E8D57;
+  static constexpr uint32_t k_Weyl0 = 0x9E3779B9;
+  static constexpr uint32_t k_Weyl1 = 0xBB67AE85;
+  static constexpr size_t k_BlockSize = 4;
+
+  std::array<uint32_t, 2> m_Key = {0, 0};
+  uint64_t m_Stream = 0;
+  uint64_t m_Counter = 0;
+  std::array<uint32_t, 4> m_Block = {0, 0, 0, 0};
+  size_t m_Index = k_BlockSize;
+};
+
+/**
+ * @brief The EbsdLibRandomEngine class hands out one PhiloxEngine per thread so that
+ * random sampling does not construct and seed a new generator for every value. Every
+ * thread draws from its own stream of the library wide seed. Calling SetSeed() makes
+ * the sequences reproducible: each thread restarts on its next call and streams are
+ * handed out in the order that threads first use their engine after the reseed.
+ */
+class EbsdLib_EXPORT EbsdLibRandomEngine
+{
+public:
+  /**
+   * @brief Sets the library wide seed. Until this is called the seed is taken from std::random_device.
+   */
+  static void SetSeed(uint64_t seed);
+
+  /**
+   * @brief Returns the library wide seed
+   */
+  static uint64_t GetSeed();
+
+  /**
+   * @brief Returns the engine of the calling thread
+   */
+  static PhiloxEngine& ThreadLocal();
+
+public:
+  EbsdLibRandomEngine() = delete;
+  EbsdLibRandomEngine(const EbsdLibRandomEngine&) = delete;            // Copy Constructor Not Implemented
+  EbsdLibRandomEngine(EbsdLibRandomEngine&&) = delete;                 // Move Constructor Not Implemented
+  EbsdLibRandomEngine& operator=(const EbsdLibRandomEngine&) = delete; // Copy Assignment Not Implemented
+  EbsdLibRandomEngine& operator=(EbsdLibRandomEngine&&) = delete;      // Move Assignment Not Implemented
+};
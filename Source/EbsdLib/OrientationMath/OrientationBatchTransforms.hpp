@@ -0,0 +1,671 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+
+#include "EbsdLib/Core/OrientationRepresentation.h"
+#include "EbsdLib/Core/OrientationTransformation.hpp"
+#include "EbsdLib/EbsdLib.h"
+#include "EbsdLib/Math/BatchMath.hpp"
+
+#ifdef EbsdLib_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#endif
+
+/**
+ * @brief The OrientationBatch namespace holds Structure of Arrays (SoA) conversion kernels for the Euler,
+ * orientation matrix, quaternion, axis-angle and Rodrigues representations. A kernel takes one pointer per
+ * component, e.g. phi1[], Phi[] and phi2[] for Euler angles, and converts numTuples values in a straight loop.
+ * The per tuple math follows the OrientationTransformation functions of the same name, including their
+ * thresholds and special cases, but every branch is written as a select and the trig functions come from
+ * BatchMath so the loops vectorize. Quaternions are stored as x, y, z, w component arrays.
+ *
+ * Compared to the scalar conversions most components agree to within a few rounding errors. Angles computed from
+ * acos of a value near +-1, e.g. a small rotation angle or Phi close to 0, amplify the rounding of that value and
+ * agree to within 1.0E-4 (float) and 1.0E-11 (double). The Rodrigues length tan(w/2) has the same relative error
+ * as w/2 near w = Pi. A value that lies within rounding distance of one of the thresholds may pick a different
+ * special case than the scalar conversion.
+ *
+ * ConvertAoS() runs the same kernels over interleaved tuples by transposing blocks of k_BlockSize tuples into
+ * stack buffers, which is what OrientationConverter uses for EbsdDataArray input.
+ */
+namespace OrientationBatch
+{
+/**
+ * @brief Number of tuples transposed into SoA form at a time by ConvertAoS()
+ */
+inline constexpr size_t k_BlockSize = 128;
+
+namespace Tuple
+{
+// The functions in this namespace convert a single tuple held in small local arrays. They are only meant to be
+// inlined into the loops below, so every special case is computed and then picked with BatchMath::Select.
+using BatchMath::Select;
+
+template <typename T>
+inline void eu2om(const T* e, T* om)
+{
+  const T eps = static_cast<T>(1.0E-7);
+  T s1 = 0;
+  T c1 = 0;
+  T s = 0;
+  T c = 0;
+  T s2 = 0;
+  T c2 = 0;
+  BatchMath::SinCos(e[0], s1, c1);
+  BatchMath::SinCos(e[1], s, c);
+  BatchMath::SinCos(e[2], s2, c2);
+  T res[9] = {c1 * c2 - s1 * s2 * c, s1 * c2 + c1 * s2 * c, s2 * s, -c1 * s2 - s1 * c2 * c, -s1 * s2 + c1 * c2 * c, c2 * s, s1 * s, -c1 * s, c};
+  for(size_t i = 0; i < 9; i++)
+  {
+    om[i] = Select(std::fabs(res[i]) < eps, static_cast<T>(0.0), res[i]);
+  }
+}
+
+template <typename T>
+inline void eu2qu(const T* e, T* q)
+{
+  const T epsijk = static_cast<T>(Rotations::Constants::epsijk);
+  T ee0 = static_cast<T>(0.5) * e[0];
+  T ee1 = static_cast<T>(0.5) * e[1];
+  T ee2 = static_cast<T>(0.5) * e[2];
+  T sPhi = 0;
+  T cPhi = 0;
+  T sm = 0;
+  T cm = 0;
+  T sp = 0;
+  T cp = 0;
+  BatchMath::SinCos(ee1, sPhi, cPhi);
+  BatchMath::SinCos(ee0 - ee2, sm, cm);
+  BatchMath::SinCos(ee0 + ee2, sp, cp);
+  T w = cPhi * cp;
+  T sign = Select(w < static_cast<T>(0.0), static_cast<T>(-1.0), static_cast<T>(1.0));
+  q[0] = sign * (-epsijk * sPhi * cm);
+  q[1] = sign * (-epsijk * sPhi * sm);
+  q[2] = sign * (-epsijk * cPhi * sp);
+  q[3] = sign * w;
+}
+
+template <typename T>
+inline void eu2ax(const T* e, T* res)
+{
+  const T epsijk = static_cast<T>(Rotations::Constants::epsijkd);
+  T sHalf = 0;
+  T cHalf = 0;
+  BatchMath::SinCos(e[1] * static_cast<T>(0.5), sHalf, cHalf);
+  T t = sHalf / cHalf;
+  T sig = static_cast<T>(0.5) * (e[0] + e[2]);
+  T del = static_cast<T>(0.5) * (e[0] - e[2]);
+  T sSig = 0;
+  T cSig = 0;
+  T sDel = 0;
+  T cDel = 0;
+  BatchMath::SinCos(sig, sSig, cSig);
+  BatchMath::SinCos(del, sDel, cDel);
+  T tau = std::sqrt(t * t + sSig * sSig);
+  bool sigIsHalfPi = std::fabs(sig - static_cast<T>(EbsdLib::Constants::k_PiOver2D)) < static_cast<T>(1.0E-6);
+  T alpha = Select(sigIsHalfPi, static_cast<T>(EbsdLib::Constants::k_PiD), static_cast<T>(2.0) * BatchMath::Atan(tau / cSig));
+  bool identity = std::fabs(alpha) < static_cast<T>(1.0E-6);
+  //! passive axis-angle pair so a minus sign in front
+  T sign = Select(alpha < static_cast<T>(0.0), static_cast<T>(-1.0), static_cast<T>(1.0));
+  res[0] = Select(identity, static_cast<T>(0.0), sign * (-epsijk * t * cDel / tau));
+  res[1] = Select(identity, static_cast<T>(0.0), sign * (-epsijk * t * sDel / tau));
+  res[2] = Select(identity, static_cast<T>(1.0), sign * (-epsijk * sSig / tau));
+  res[3] = Select(identity, static_cast<T>(0.0), sign * alpha);
+}
+
+template <typename T>
+inline void ax2ro(const T* ax, T* res)
+{
+  const T thr = static_cast<T>(1.0E-7);
+  bool isZero = std::fabs(ax[3]) < thr;
+  bool isPi = std::fabs(ax[3] - static_cast<T>(EbsdLib::Constants::k_PiD)) < thr;
+  T s = 0;
+  T c = 0;
+  BatchMath::SinCos(ax[3] * static_cast<T>(0.5), s, c);
+  T t = Select(isPi, std::numeric_limits<T>::infinity(), s / c);
+  res[0] = Select(isZero, static_cast<T>(0.0), ax[0]);
+  res[1] = Select(isZero, static_cast<T>(0.0), ax[1]);
+  res[2] = Select(isZero, static_cast<T>(Rotations::Constants::epsijk), ax[2]);
+  res[3] = Select(isZero, static_cast<T>(0.0), t);
+}
+
+template <typename T>
+inline void eu2ro(const T* e, T* res)
+{
+  const T thr = static_cast<T>(1.0E-6);
+  T ax[4];
+  eu2ax(e, ax);
+  T t = ax[3];
+  bool isPi = std::fabs(t - static_cast<T>(EbsdLib::Constants::k_PiD)) < thr;
+  bool isZero = !isPi & (std::fabs(t) < thr);
+  T s = 0;
+  T c = 0;
+  BatchMath::SinCos(t * static_cast<T>(0.5), s, c);
+  res[0] = Select(isZero, static_cast<T>(0.0), ax[0]);
+  res[1] = Select(isZero, static_cast<T>(0.0), ax[1]);
+  res[2] = Select(isZero, static_cast<T>(Rotations::Constants::epsijk), ax[2]);
+  res[3] = Select(isPi, std::numeric_limits<T>::infinity(), Select(isZero, static_cast<T>(0.0), s / c));
+}
+
+template <typename T>
+inline void om2eu(const T* o, T* res)
+{
+  const T twoPi = static_cast<T>(EbsdLib::Constants::k_2PiD);
+  T o8 = o[8];
+  bool nearPole = std::fabs(std::fabs(o8) - static_cast<T>(1.0)) < static_cast<T>(1.0E-6);
+  bool nearNorthPole = std::fabs(o8 - static_cast<T>(1.0)) < static_cast<T>(1.0E-6);
+  T zeta = static_cast<T>(1.0) / std::sqrt(static_cast<T>(1.0) - o8 * o8);
+  T phi1General = BatchMath::Atan2(o[6] * zeta, -o[7] * zeta);
+  T phi2General = BatchMath::Atan2(o[2] * zeta, o[5] * zeta);
+  T PhiGeneral = BatchMath::Acos(o8);
+  // Both poles use atan2(o[1], o[0]); the south pole form -atan2(-o[1], o[0]) is the same value
+  T phi1Pole = BatchMath::Atan2(o[1], o[0]);
+
+  T phi1 = Select(nearPole, phi1Pole, phi1General);
+  T Phi = Select(nearPole, Select(nearNorthPole, static_cast<T>(0.0), static_cast<T>(EbsdLib::Constants::k_PiD)), PhiGeneral);
+  T phi2 = Select(nearPole, static_cast<T>(0.0), phi2General);
+  res[0] = Select(phi1 < static_cast<T>(0.0), phi1 + twoPi, phi1);
+  res[1] = Phi;
+  res[2] = Select(phi2 < static_cast<T>(0.0), phi2 + twoPi, phi2);
+}
+
+template <typename T>
+inline void ax2om(const T* a, T* res)
+{
+  T s = 0;
+  T c = 0;
+  BatchMath::SinCos(a[3], s, c);
+  T omc = static_cast<T>(1.0) - c;
+  T a0 = a[0];
+  T a1 = a[1];
+  T a2 = a[2];
+  // The passive convention stores the transpose
+  const bool passive = (Rotations::Constants::epsijk == 1.0f);
+  T q01 = omc * a0 * a1;
+  T q12 = omc * a1 * a2;
+  T q20 = omc * a2 * a0;
+  res[0] = a0 * a0 * omc + c;
+  res[4] = a1 * a1 * omc + c;
+  res[8] = a2 * a2 * omc + c;
+  res[passive ? 3 : 1] = q01 + s * a2;
+  res[passive ? 1 : 3] = q01 - s * a2;
+  res[passive ? 7 : 5] = q12 + s * a0;
+  res[passive ? 5 : 7] = q12 - s * a0;
+  res[passive ? 6 : 2] = q20 - s * a1;
+  res[passive ? 2 : 6] = q20 + s * a1;
+}
+
+template <typename T>
+inline void ax2qu(const T* r, T* q)
+{
+  bool isZero = (r[3] == static_cast<T>(0.0));
+  T s = 0;
+  T c = 0;
+  BatchMath::SinCos(r[3] * static_cast<T>(0.5), s, c);
+  q[0] = Select(isZero, static_cast<T>(0.0), r[0] * s);
+  q[1] = Select(isZero, static_cast<T>(0.0), r[1] * s);
+  q[2] = Select(isZero, static_cast<T>(0.0), r[2] * s);
+  q[3] = Select(isZero, static_cast<T>(1.0), c);
+}
+
+template <typename T>
+inline void qu2om(const T* q, T* om)
+{
+  T x = q[0];
+  T y = q[1];
+  T z = q[2];
+  T w = q[3];
+  T qq = w * w - (x * x + y * y + z * z);
+  om[0] = qq + static_cast<T>(2.0) * x * x;
+  om[4] = qq + static_cast<T>(2.0) * y * y;
+  om[8] = qq + static_cast<T>(2.0) * z * z;
+  om[1] = static_cast<T>(2.0) * (x * y - w * z);
+  om[5] = static_cast<T>(2.0) * (y * z - w * x);
+  om[6] = static_cast<T>(2.0) * (z * x - w * y);
+  om[3] = static_cast<T>(2.0) * (y * x + w * z);
+  om[7] = static_cast<T>(2.0) * (z * y + w * x);
+  om[2] = static_cast<T>(2.0) * (x * z + w * y);
+}
+
+template <typename T>
+inline void qu2eu(const T* q, T* res)
+{
+  const T twoPi = static_cast<T>(EbsdLib::Constants::k_2PiD);
+  const bool passive = (Rotations::Constants::epsijk == 1.0f);
+  T x = q[0];
+  T y = q[1];
+  T z = q[2];
+  T w = q[3];
+  T q03 = w * w + z * z;
+  T q12 = x * x + y * y;
+  T chi = std::sqrt(q03 * q12);
+  bool chiZero = (chi == static_cast<T>(0.0));
+  bool q12Zero = (q12 == static_cast<T>(0.0));
+
+  // Degenerate cases, phi2 is arbitrarily 0
+  T phi1NoTilt = BatchMath::Atan2((passive ? static_cast<T>(-2.0) : static_cast<T>(2.0)) * w * z, w * w - z * z);
+  T phi1Flip = BatchMath::Atan2(static_cast<T>(2.0) * x * y, x * x - y * y);
+
+  T PhiGeneral = BatchMath::Atan2(static_cast<T>(2.0) * chi, q03 - q12);
+  T chiInv = static_cast<T>(1.0) / chi;
+  T phi1General = 0;
+  T phi2General = 0;
+  if(passive)
+  {
+    phi1General = BatchMath::Atan2((-w * y + x * z) * chiInv, (-w * x - y * z) * chiInv);
+    phi2General = BatchMath::Atan2((w * y + x * z) * chiInv, (-w * x + y * z) * chiInv);
+  }
+  else
+  {
+    phi1General = BatchMath::Atan2((w * y + x * z) * chiInv, (w * x - y * z) * chiInv);
+    phi2General = BatchMath::Atan2((-w * y + x * z) * chiInv, (w * x + y * z) * chiInv);
+  }
+
+  T phi1 = Select(chiZero, Select(q12Zero, phi1NoTilt, phi1Flip), phi1General);
+  T Phi = Select(chiZero, Select(q12Zero, static_cast<T>(0.0), static_cast<T>(EbsdLib::Constants::k_PiD)), PhiGeneral);
+  T phi2 = Select(chiZero, static_cast<T>(0.0), phi2General);
+  res[0] = Select(phi1 < static_cast<T>(0.0), phi1 + twoPi, phi1);
+  res[1] = Phi;
+  res[2] = Select(phi2 < static_cast<T>(0.0), phi2 + twoPi, phi2);
+}
+
+template <typename T>
+inline void qu2ax(const T* q, T* res)
+{
+  T x = q[0];
+  T y = q[1];
+  T z = q[2];
+  T w = q[3];
+  // The angle uses the quaternion with w >= 0; the axis is taken from the quaternion as it was passed in
+  T omega = static_cast<T>(2.0) * BatchMath::Acos(std::fabs(w));
+  bool identity = omega < static_cast<T>(1.0E-12);
+  T mag = static_cast<T>(1.0) / std::sqrt(x * x + y * y + z * z);
+  res[0] = Select(identity, static_cast<T>(0.0), x * mag);
+  res[1] = Select(identity, static_cast<T>(0.0), y * mag);
+  res[2] = Select(identity, static_cast<T>(Rotations::Constants::epsijkd), z * mag);
+  res[3] = Select(identity, static_cast<T>(0.0), omega);
+}
+
+template <typename T>
+inline void qu2ro(const T* q, T* res)
+{
+  const T thr = static_cast<T>(1.0E-8);
+  T x = q[0];
+  T y = q[1];
+  T z = q[2];
+  T w = q[3];
+  bool wSmall = w < thr;
+  T s = std::sqrt(x * x + y * y + z * z);
+  bool sSmall = s < thr;
+  // tan(acos(w)) without the trig
+  T t = std::sqrt((static_cast<T>(1.0) - w) * (static_cast<T>(1.0) + w)) / w;
+  res[0] = Select(wSmall, x, Select(sSmall, static_cast<T>(0.0), x / s));
+  res[1] = Select(wSmall, y, Select(sSmall, static_cast<T>(0.0), y / s));
+  res[2] = Select(wSmall, z, Select(sSmall, static_cast<T>(Rotations::Constants::epsijk), z / s));
+  res[3] = Select(wSmall, std::numeric_limits<T>::infinity(), Select(sSmall, static_cast<T>(0.0), t));
+}
+
+template <typename T>
+inline void om2qu(const T* om, T* res)
+{
+  const T thr = static_cast<T>(sizeof(T) == 4 ? 1.0E-6 : 1.0E-10);
+  const T epsijk = static_cast<T>(Rotations::Constants::epsijk);
+  auto clampedSqrt = [thr](T v) { return std::sqrt(Select(std::fabs(v) < thr, static_cast<T>(0.0), v)); };
+  T w = static_cast<T>(0.5) * clampedSqrt(om[0] + om[4] + om[8] + static_cast<T>(1.0));
+  T x = static_cast<T>(0.5) * clampedSqrt(om[0] - om[4] - om[8] + static_cast<T>(1.0));
+  T y = static_cast<T>(0.5) * clampedSqrt(-om[0] + om[4] - om[8] + static_cast<T>(1.0));
+  T z = static_cast<T>(0.5) * clampedSqrt(-om[0] - om[4] + om[8] + static_cast<T>(1.0));
+
+  // verify the signs (q0 always positive)
+  x = Select(om[7] < om[5], -epsijk * x, x);
+  y = Select(om[2] < om[6], -epsijk * y, y);
+  z = Select(om[3] < om[1], -epsijk * z, z);
+  T mag = std::sqrt(x * x + y * y + z * z + w * w);
+  T scale = Select(mag != static_cast<T>(0.0), static_cast<T>(1.0) / mag, static_cast<T>(1.0));
+  x = x * scale;
+  y = y * scale;
+  z = z * scale;
+  w = w * scale;
+
+  // The vector part takes the signs of the axis-angle pair, see om2qu in OrientationTransformation
+  T eu[3];
+  T ax[4];
+  om2eu(om, eu);
+  eu2ax(eu, ax);
+  res[0] = Select(ax[0] * x < static_cast<T>(0.0), -x, x);
+  res[1] = Select(ax[1] * y < static_cast<T>(0.0), -y, y);
+  res[2] = Select(ax[2] * z < static_cast<T>(0.0), -z, z);
+  res[3] = w;
+}
+
+template <typename T>
+inline void ro2ax(const T* r, T* res)
+{
+  T ta = r[3];
+  bool isZero = std::fabs(ta) < static_cast<T>(1.0E-6);
+  bool isInf = (ta == std::numeric_limits<T>::infinity());
+  T angle = static_cast<T>(2.0) * BatchMath::Atan(ta);
+  T n = static_cast<T>(1.0) / std::sqrt(r[0] * r[0] + r[1] * r[1] + r[2] * r[2]);
+  res[0] = Select(isZero, static_cast<T>(0.0), Select(isInf, r[0], r[0] * n));
+  res[1] = Select(isZero, static_cast<T>(0.0), Select(isInf, r[1], r[1] * n));
+  res[2] = Select(isZero, static_cast<T>(Rotations::Constants::epsijk), Select(isInf, r[2], r[2] * n));
+  res[3] = Select(isZero, static_cast<T>(0.0), Select(isInf, static_cast<T>(EbsdLib::Constants::k_PiD), angle));
+}
+
+// Conversions that go through an intermediate representation, following OrientationTransformation
+template <typename T>
+inline void om2ax(const T* om, T* res)
+{
+  T qu[4];
+  om2qu(om, qu);
+  qu2ax(qu, res);
+}
+
+template <typename T>
+inline void om2ro(const T* om, T* res)
+{
+  T eu[3];
+  om2eu(om, eu);
+  eu2ro(eu, res);
+}
+
+template <typename T>
+inline void ax2eu(const T* ax, T* res)
+{
+  T om[9];
+  ax2om(ax, om);
+  om2eu(om, res);
+}
+
+template <typename T>
+inline void ro2om(const T* ro, T* res)
+{
+  T ax[4];
+  ro2ax(ro, ax);
+  ax2om(ax, res);
+}
+
+template <typename T>
+inline void ro2eu(const T* ro, T* res)
+{
+  T om[9];
+  ro2om(ro, om);
+  om2eu(om, res);
+}
+
+template <typename T>
+inline void ro2qu(const T* ro, T* res)
+{
+  T ax[4];
+  ro2ax(ro, ax);
+  ax2qu(ax, res);
+}
+} // namespace Tuple
+
+/**
+ * @brief Converts count tuples held in SoA stack blocks. The blocks cannot alias each other which lets the compiler
+ * vectorize the loop without runtime overlap checks.
+ */
+template <typename T, size_t InComps, size_t OutComps, void (*Kernel)(const T*, T*)>
+inline void ConvertBlock(const T (&inBlock)[InComps][k_BlockSize], T (&outBlock)[OutComps][k_BlockSize], size_t count)
+{
+  for(size_t i = 0; i < count; i++)
+  {
+    T in[InComps];
+    T out[OutComps];
+    for(size_t c = 0; c < InComps; c++)
+    {
+      in[c] = inBlock[c][i];
+    }
+    Kernel(in, out);
+    for(size_t c = 0; c < OutComps; c++)
+    {
+      outBlock[c][i] = out[c];
+    }
+  }
+}
+
+/**
+ * @brief Runs a per tuple kernel over SoA component arrays, k_BlockSize tuples at a time
+ * @param input InComps pointers, one per input component
+ * @param output OutComps pointers, one per output component
+ * @param numTuples Number of tuples
+ */
+template <typename T, size_t InComps, size_t OutComps, void (*Kernel)(const T*, T*)>
+void RunSoA(const T* const* input, T* const* output, size_t numTuples)
+{
+  alignas(64) T inBlock[InComps][k_BlockSize];
+  alignas(64) T outBlock[OutComps][k_BlockSize];
+  for(size_t start = 0; start < numTuples; start += k_BlockSize)
+  {
+    size_t count = std::min(k_BlockSize, numTuples - start);
+    for(size_t c = 0; c < InComps; c++)
+    {
+      std::copy(input[c] + start, input[c] + start + count, inBlock[c]);
+    }
+    ConvertBlock<T, InComps, OutComps, Kernel>(inBlock, outBlock, count);
+    for(size_t c = 0; c < OutComps; c++)
+    {
+      std::copy(outBlock[c], outBlock[c] + count, output[c] + start);
+    }
+  }
+}
+
+/**
+ * @brief Runs a per tuple kernel over interleaved (AoS) tuples. Blocks of k_BlockSize tuples are transposed into
+ * stack buffers, converted and transposed back. A whole block is read before any of it is written, so the output
+ * may be the input itself as long as outStride <= inStride.
+ */
+template <typename T, size_t InComps, size_t OutComps, void (*Kernel)(const T*, T*)>
+void RunAoS(const T* input, size_t inStride, T* output, size_t outStride, size_t numTuples)
+{
+  alignas(64) T inBlock[InComps][k_BlockSize];
+  alignas(64) T outBlock[OutComps][k_BlockSize];
+  for(size_t start = 0; start < numTuples; start += k_BlockSize)
+  {
+    size_t count = std::min(k_BlockSize, numTuples - start);
+    const T* inPtr = input + start * inStride;
+    for(size_t i = 0; i < count; i++)
+    {
+      for(size_t c = 0; c < InComps; c++)
+      {
+        inBlock[c][i] = inPtr[i * inStride + c];
+      }
+    }
+    ConvertBlock<T, InComps, OutComps, Kernel>(inBlock, outBlock, count);
+    T* outPtr = output + start * outStride;
+    for(size_t i = 0; i < count; i++)
+    {
+      for(size_t c = 0; c < OutComps; c++)
+      {
+        outPtr[i * outStride + c] = outBlock[c][i];
+      }
+    }
+  }
+}
+
+/**
+ * @brief The Kernel class bundles a per tuple kernel with its component counts so it can be passed as a single
+ * template argument.
+ */
+template <typename T, size_t InComps, size_t OutComps, void (*TupleKernel)(const T*, T*)>
+struct Kernel
+{
+  static constexpr size_t k_InComponents = InComps;
+  static constexpr size_t k_OutComponents = OutComps;
+
+  static void ConvertSoA(const T* const* input, T* const* output, size_t numTuples)
+  {
+    RunSoA<T, InComps, OutComps, TupleKernel>(input, output, numTuples);
+  }
+
+  static void ConvertAoS(const T* input, size_t inStride, T* output, size_t outStride, size_t numTuples)
+  {
+    RunAoS<T, InComps, OutComps, TupleKernel>(input, inStride, output, outStride, numTuples);
+  }
+};
+
+// clang-format off
+template <typename T> using Eu2Om = Kernel<T, 3, 9, Tuple::eu2om<T>>;
+template <typename T> using Eu2Qu = Kernel<T, 3, 4, Tuple::eu2qu<T>>;
+template <typename T> using Eu2Ax = Kernel<T, 3, 4, Tuple::eu2ax<T>>;
+template <typename T> using Eu2Ro = Kernel<T, 3, 4, Tuple::eu2ro<T>>;
+template <typename T> using Om2Eu = Kernel<T, 9, 3, Tuple::om2eu<T>>;
+template <typename T> using Om2Qu = Kernel<T, 9, 4, Tuple::om2qu<T>>;
+template <typename T> using Om2Ax = Kernel<T, 9, 4, Tuple::om2ax<T>>;
+template <typename T> using Om2Ro = Kernel<T, 9, 4, Tuple::om2ro<T>>;
+template <typename T> using Qu2Eu = Kernel<T, 4, 3, Tuple::qu2eu<T>>;
+template <typename T> using Qu2Om = Kernel<T, 4, 9, Tuple::qu2om<T>>;
+template <typename T> using Qu2Ax = Kernel<T, 4, 4, Tuple::qu2ax<T>>;
+template <typename T> using Qu2Ro = Kernel<T, 4, 4, Tuple::qu2ro<T>>;
+template <typename T> using Ax2Eu = Kernel<T, 4, 3, Tuple::ax2eu<T>>;
+template <typename T> using Ax2Om = Kernel<T, 4, 9, Tuple::ax2om<T>>;
+template <typename T> using Ax2Qu = Kernel<T, 4, 4, Tuple::ax2qu<T>>;
+template <typename T> using Ax2Ro = Kernel<T, 4, 4, Tuple::ax2ro<T>>;
+template <typename T> using Ro2Eu = Kernel<T, 4, 3, Tuple::ro2eu<T>>;
+template <typename T> using Ro2Om = Kernel<T, 4, 9, Tuple::ro2om<T>>;
+template <typename T> using Ro2Qu = Kernel<T, 4, 4, Tuple::ro2qu<T>>;
+template <typename T> using Ro2Ax = Kernel<T, 4, 4, Tuple::ro2ax<T>>;
+// clang-format on
+
+/**
+ * @brief Returns true if there is a batch kernel for the conversion. Conversions between the same
+ * representation are not counted.
+ */
+inline bool IsSupported(OrientationRepresentation::Type fromType, OrientationRepresentation::Type toType)
+{
+  auto inFamily = [](OrientationRepresentation::Type type) {
+    return type == OrientationRepresentation::Type::Euler || type == OrientationRepresentation::Type::OrientationMatrix || type == OrientationRepresentation::Type::Quaternion ||
+           type == OrientationRepresentation::Type::AxisAngle || type == OrientationRepresentation::Type::Rodrigues;
+  };
+  return fromType != toType && inFamily(fromType) && inFamily(toType);
+}
+
+/**
+ * @brief Calls func with the Kernel type for the conversion. Returns false if the conversion is not supported.
+ */
+template <typename T, typename Func>
+bool DispatchKernel(OrientationRepresentation::Type fromType, OrientationRepresentation::Type toType, Func&& func)
+{
+  using Type = OrientationRepresentation::Type;
+#define OB_DISPATCH(FROM, TO, KERNEL)                                                                                                                                                                  \
+  if(fromType == Type::FROM && toType == Type::TO)                                                                                                                                                     \
+  {                                                                                                                                                                                                    \
+    func(KERNEL<T>());                                                                                                                                                                                 \
+    return true;                                                                                                                                                                                       \
+  }
+  OB_DISPATCH(Euler, OrientationMatrix, Eu2Om)
+  OB_DISPATCH(Euler, Quaternion, Eu2Qu)
+  OB_DISPATCH(Euler, AxisAngle, Eu2Ax)
+  OB_DISPATCH(Euler, Rodrigues, Eu2Ro)
+  OB_DISPATCH(OrientationMatrix, Euler, Om2Eu)
+  OB_DISPATCH(OrientationMatrix, Quaternion, Om2Qu)
+  OB_DISPATCH(OrientationMatrix, AxisAngle, Om2Ax)
+  OB_DISPATCH(OrientationMatrix, Rodrigues, Om2Ro)
+  OB_DISPATCH(Quaternion, Euler, Qu2Eu)
+  OB_DISPATCH(Quaternion, OrientationMatrix, Qu2Om)
+  OB_DISPATCH(Quaternion, AxisAngle, Qu2Ax)
+  OB_DISPATCH(Quaternion, Rodrigues, Qu2Ro)
+  OB_DISPATCH(AxisAngle, Euler, Ax2Eu)
+  OB_DISPATCH(AxisAngle, OrientationMatrix, Ax2Om)
+  OB_DISPATCH(AxisAngle, Quaternion, Ax2Qu)
+  OB_DISPATCH(AxisAngle, Rodrigues, Ax2Ro)
+  OB_DISPATCH(Rodrigues, Euler, Ro2Eu)
+  OB_DISPATCH(Rodrigues, OrientationMatrix, Ro2Om)
+  OB_DISPATCH(Rodrigues, Quaternion, Ro2Qu)
+  OB_DISPATCH(Rodrigues, AxisAngle, Ro2Ax)
+#undef OB_DISPATCH
+  return false;
+}
+
+/**
+ * @brief Converts SoA input, one array per component, into SoA output. The work is split over threads when
+ * parallel algorithms are enabled.
+ * @param fromType Input representation
+ * @param toType Output representation
+ * @param input One pointer per input component
+ * @param output One pointer per output component
+ * @param numTuples Number of tuples
+ * @return false if the conversion is not one of the batch conversions, in which case nothing is converted
+ */
+template <typename T>
+bool ConvertSoA(OrientationRepresentation::Type fromType, OrientationRepresentation::Type toType, const T* const* input, T* const* output, size_t numTuples)
+{
+  return DispatchKernel<T>(fromType, toType, [&](auto kernel) {
+    using KernelType = decltype(kernel);
+    auto convertRange = [&](size_t start, size_t end) {
+      const T* in[KernelType::k_InComponents];
+      T* out[KernelType::k_OutComponents];
+      for(size_t c = 0; c < KernelType::k_InComponents; c++)
+      {
+        in[c] = input[c] + start;
+      }
+      for(size_t c = 0; c < KernelType::k_OutComponents; c++)
+      {
+        out[c] = output[c] + start;
+      }
+      KernelType::ConvertSoA(in, out, end - start);
+    };
+#ifdef EbsdLib_USE_PARALLEL_ALGORITHMS
+    bool doParallel = true;
+    if(doParallel)
+    {
+      tbb::parallel_for(
+          tbb::blocked_range<size_t>(0, numTuples, k_BlockSize), [&](const tbb::blocked_range<size_t>& r) { convertRange(r.begin(), r.end()); }, tbb::auto_partitioner());
+      return;
+    }
+#endif
+    convertRange(0, numTuples);
+  });
+}
+
+/**
+ * @brief Converts interleaved (AoS) tuples, transposing blocks of k_BlockSize tuples to run the SoA kernels.
+ * This is serial; OrientationConverter splits the tuples over threads.
+ * @return false if the conversion is not one of the batch conversions, in which case nothing is converted
+ */
+template <typename T>
+bool ConvertAoS(OrientationRepresentation::Type fromType, OrientationRepresentation::Type toType, const T* input, size_t inStride, T* output, size_t outStride, size_t numTuples)
+{
+  return DispatchKernel<T>(fromType, toType, [&](auto kernel) { decltype(kernel)::ConvertAoS(input, inStride, output, outStride, numTuples); });
+}
+} // namespace OrientationBatch
@@ -35,6 +35,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <iostream>
 #include <memory>
 #include <vector>
@@ -47,6 +48,7 @@
 #include "EbsdLib/Core/OrientationTransformation.hpp"
 #include "EbsdLib/EbsdLib.h"
 #include "EbsdLib/Math/EbsdLibMath.h"
+#include "EbsdLib/OrientationMath/OrientationBatchTransforms.hpp"
 
 #ifdef EbsdLib_USE_PARALLEL_ALGORITHMS
 #include <tbb/blocked_range.h>
@@ -137,6 +139,80 @@ public:
     }
   }
 
+  /**
+   * @brief convertRepresentationTo Converts the data into a caller supplied buffer instead of allocating a new
+   * output array. The output data is then a non-owning array over the buffer with outputStride components. The
+   * buffer may be the input array itself, which converts in place, when outputStride is not larger than the
+   * number of components of the input.
+   * @param repType The type of representation to convert to.
+   * @param output Buffer of at least numTuples * outputStride values
+   * @param outputStride Number of values between the starts of consecutive output tuples. Must be at least the
+   * number of components of repType.
+   * @return false if the arguments are not valid, in which case nothing is converted
+   */
+  bool convertRepresentationTo(OrientationRepresentation::Type repType, T* output, size_t outputStride)
+  {
+    DataArrayPointerType input = getInputData();
+    int repIndex = static_cast<int>(repType);
+    if(input == nullptr || output == nullptr || repIndex < GetMinIndex() || repIndex > GetMaxIndex())
+    {
+      return false;
+    }
+    std::vector<size_t> counts = GetComponentCounts<std::vector<size_t>>();
+    size_t numTuples = input->getNumberOfTuples();
+    size_t inStride = input->getNumberOfComponents();
+    if(outputStride < counts[repIndex])
+    {
+      return false;
+    }
+    // A buffer that overlaps the input must start at the input and must not grow the tuples
+    const T* inBegin = input->getPointer(0);
+    const T* inEnd = inBegin + numTuples * inStride;
+    const T* outEnd = output + numTuples * outputStride;
+    bool overlaps = (output < inEnd && inBegin < outEnd);
+    if(overlaps && (output != inBegin || outputStride > inStride))
+    {
+      return false;
+    }
+
+    m_OutputBuffer = output;
+    m_OutputBufferStride = outputStride;
+    convertRepresentationTo(repType);
+    m_OutputBuffer = nullptr;
+    m_OutputBufferStride = 0;
+    return true;
+  }
+
+  /**
+   * @brief ConvertSoA Converts orientations stored as one array per component, e.g. separate phi1, Phi and phi2
+   * arrays, with the vectorized batch kernels. Only conversions between the Euler, orientation matrix, quaternion,
+   * axis-angle and Rodrigues representations are supported.
+   * @param fromType Input representation
+   * @param toType Output representation
+   * @param input One array per input component
+   * @param output One array per output component
+   * @param numTuples Number of tuples in each array
+   * @return false if there is no batch kernel for the conversion, in which case nothing is converted
+   */
+  static bool ConvertSoA(OrientationRepresentation::Type fromType, OrientationRepresentation::Type toType, const T* const* input, T* const* output, size_t numTuples)
+  {
+    return OrientationBatch::ConvertSoA<T>(fromType, toType, input, output, numTuples);
+  }
+
+  /**
+   * @brief Sets/Gets whether conversions between the Euler, orientation matrix, quaternion, axis-angle and
+   * Rodrigues representations use the vectorized batch kernels from OrientationBatchTransforms.hpp. This is on by
+   * default. When it is off every tuple goes through the scalar OrientationTransformation functions.
+   */
+  void setUseBatchTransforms(bool value)
+  {
+    m_UseBatchTransforms = value;
+  }
+  bool getUseBatchTransforms() const
+  {
+    return m_UseBatchTransforms;
+  }
+
   /**
    * @brief toEulers Converts the input orientations to Euler Angles
    */
@@ -294,6 +370,50 @@ public:
 protected:
   OrientationConverter() = default;
 
+  /**
+   * @brief createOutputData Creates the array that a conversion writes into. This wraps the caller supplied
+   * buffer when there is one. The new array is not zeroed again because every tuple is written by the conversion.
+   * @param numTuples Number of tuples
+   * @param numComponents Number of components of the representation
+   * @param name Name of the array
+   */
+  DataArrayPointerType createOutputData(size_t numTuples, size_t numComponents, const std::string& name) const
+  {
+    if(m_OutputBuffer != nullptr)
+    {
+      return DataArrayType::WrapPointer(m_OutputBuffer, numTuples, {m_OutputBufferStride}, name, false);
+    }
+    return DataArrayType::CreateArray(numTuples, {numComponents}, name, true);
+  }
+
+  /**
+   * @brief copyInputData Sets the output to a copy of the input. This is used when the input already is in the
+   * requested representation.
+   */
+  void copyInputData()
+  {
+    DataArrayPointerType input = getInputData();
+    if(m_OutputBuffer == nullptr)
+    {
+      DataArrayPointerType output = std::dynamic_pointer_cast<DataArrayType>(input->deepCopy());
+      setOutputData(output);
+      return;
+    }
+    size_t numTuples = input->getNumberOfTuples();
+    size_t inStride = input->getNumberOfComponents();
+    DataArrayPointerType output = createOutputData(numTuples, inStride, input->getName());
+    const T* inPtr = input->getPointer(0);
+    // Ascending order is also correct in place, where the output stride is never larger than the input stride
+    if(m_OutputBuffer != inPtr || m_OutputBufferStride != inStride)
+    {
+      for(size_t i = 0; i < numTuples; i++)
+      {
+        std::copy(inPtr + i * inStride, inPtr + (i + 1) * inStride, m_OutputBuffer + i * m_OutputBufferStride);
+      }
+    }
+    setOutputData(output);
+  }
+
 public:
   OrientationConverter(const OrientationConverter&) = delete;            // Copy Constructor Not Implemented
   OrientationConverter(OrientationConverter&&) = delete;                 // Move Constructor Not Implemented
@@ -303,6 +423,9 @@ public:
 private:
   DataArrayPointerType m_InputData;
   DataArrayPointerType m_OutputData;
+  T* m_OutputBuffer = nullptr;
+  size_t m_OutputBufferStride = 0;
+  bool m_UseBatchTransforms = true;
 };
 
 /**
@@ -356,6 +479,23 @@ private:
     }                                                                                                                                                                                                  \
   };
 
+/**
+ * @brief This macro wraps one of the OrientationTransformation::Fused kernels. The
+ * kernels work directly on the input and output tuples so no Orientation objects
+ * are created for the conversion or any of its intermediate representations.
+ */
+#define OC_FUSED_CONVERTOR_FUNCTOR(CLASSNAME, INSTRIDE, OUTSTRIDE, CONVERSION_METHOD)                                                                                                                  \
+  template <typename NumericType>                                                                                                                                                                      \
+  class CLASSNAME                                                                                                                                                                                      \
+  {                                                                                                                                                                                                    \
+  public:                                                                                                                                                                                              \
+    CLASSNAME() = default;                                                                                                                                                                             \
+    void operator()(NumericType* input, NumericType* output)                                                                                                                                           \
+    {                                                                                                                                                                                                  \
+      OrientationTransformation::Fused::CONVERSION_METHOD<NumericType>(input, output);                                                                                                                 \
+    }                                                                                                                                                                                                  \
+  };
+
 /**
  * @brief This contains all the functors that represent all possible conversion routines
  * between orientation representations
@@ -363,16 +503,16 @@ private:
 namespace Convertors
 {
 /* Euler Functors  */
-OC_CONVERTOR_FUNCTOR(Eu2Om, 3, 9, eu2om)
-OC_CONVERTOR_FUNCTOR_2QU(Eu2Qu, 3, 4, eu2qu)
-OC_CONVERTOR_FUNCTOR(Eu2Ax, 3, 4, eu2ax)
+OC_FUSED_CONVERTOR_FUNCTOR(Eu2Om, 3, 9, eu2om)
+OC_FUSED_CONVERTOR_FUNCTOR(Eu2Qu, 3, 4, eu2qu)
+OC_FUSED_CONVERTOR_FUNCTOR(Eu2Ax, 3, 4, eu2ax)
 OC_CONVERTOR_FUNCTOR(Eu2Ro, 3, 4, eu2ro)
-OC_CONVERTOR_FUNCTOR(Eu2Ho, 3, 3, eu2ho)
-OC_CONVERTOR_FUNCTOR(Eu2Cu, 3, 3, eu2cu)
+OC_FUSED_CONVERTOR_FUNCTOR(Eu2Ho, 3, 3, eu2ho)
+OC_FUSED_CONVERTOR_FUNCTOR(Eu2Cu, 3, 3, eu2cu)
 OC_CONVERTOR_FUNCTOR(Eu2St, 3, 3, eu2st)
 
 /* OrientationMatrix Functors */
-OC_CONVERTOR_FUNCTOR(Om2Eu, 9, 3, om2eu)
+OC_FUSED_CONVERTOR_FUNCTOR(Om2Eu, 9, 3, om2eu)
 OC_CONVERTOR_FUNCTOR_2QU(Om2Qu, 9, 4, om2qu)
 OC_CONVERTOR_FUNCTOR(Om2Ax, 9, 4, om2ax)
 OC_CONVERTOR_FUNCTOR(Om2Ro, 9, 4, om2ro)
@@ -382,7 +522,7 @@ OC_CONVERTOR_FUNCTOR(Om2St, 9, 3, om2st)
 
 /* Quaterion Functors */
 OC_QU2_CONVERTOR_FUNCTOR(Qu2Eu, 4, 3, qu2eu)
-OC_QU2_CONVERTOR_FUNCTOR(Qu2Om, 4, 9, qu2om)
+OC_FUSED_CONVERTOR_FUNCTOR(Qu2Om, 4, 9, qu2om)
 OC_QU2_CONVERTOR_FUNCTOR(Qu2Ax, 4, 4, qu2ax)
 OC_QU2_CONVERTOR_FUNCTOR(Qu2Ro, 4, 4, qu2ro)
 OC_QU2_CONVERTOR_FUNCTOR(Qu2Ho, 4, 3, qu2ho)
@@ -391,38 +531,38 @@ OC_QU2_CONVERTOR_FUNCTOR(Qu2St, 4, 3, qu2st)
 
 /* AxisAngles Functors */
 OC_CONVERTOR_FUNCTOR(Ax2Eu, 4, 3, ax2eu)
-OC_CONVERTOR_FUNCTOR(Ax2Om, 4, 9, ax2om)
-OC_CONVERTOR_FUNCTOR_2QU(Ax2Qu, 4, 4, ax2qu)
+OC_FUSED_CONVERTOR_FUNCTOR(Ax2Om, 4, 9, ax2om)
+OC_FUSED_CONVERTOR_FUNCTOR(Ax2Qu, 4, 4, ax2qu)
 OC_CONVERTOR_FUNCTOR(Ax2Ro, 4, 4, ax2ro)
-OC_CONVERTOR_FUNCTOR(Ax2Ho, 4, 3, ax2ho)
+OC_FUSED_CONVERTOR_FUNCTOR(Ax2Ho, 4, 3, ax2ho)
 OC_CONVERTOR_FUNCTOR(Ax2Cu, 4, 3, ax2cu)
 OC_CONVERTOR_FUNCTOR(Ax2St, 4, 3, ax2st)
 
 /* Rodrigues Functors */
 OC_CONVERTOR_FUNCTOR(Ro2Eu, 4, 3, ro2eu)
 OC_CONVERTOR_FUNCTOR(Ro2Om, 4, 9, ro2om)
-OC_CONVERTOR_FUNCTOR_2QU(Ro2Qu, 4, 4, ro2qu)
-OC_CONVERTOR_FUNCTOR(Ro2Ax, 4, 4, ro2ax)
+OC_FUSED_CONVERTOR_FUNCTOR(Ro2Qu, 4, 4, ro2qu)
+OC_FUSED_CONVERTOR_FUNCTOR(Ro2Ax, 4, 4, ro2ax)
 OC_CONVERTOR_FUNCTOR(Ro2Ho, 4, 3, ro2ho)
 OC_CONVERTOR_FUNCTOR(Ro2Cu, 4, 3, ro2cu)
 OC_CONVERTOR_FUNCTOR(Ro2St, 4, 3, ro2st)
 
 /* Homochoric Functors */
-OC_CONVERTOR_FUNCTOR(Ho2Eu, 3, 3, ho2eu)
+OC_FUSED_CONVERTOR_FUNCTOR(Ho2Eu, 3, 3, ho2eu)
 OC_CONVERTOR_FUNCTOR(Ho2Om, 3, 9, ho2om)
-OC_CONVERTOR_FUNCTOR_2QU(Ho2Qu, 3, 4, ho2qu)
-OC_CONVERTOR_FUNCTOR(Ho2Ax, 3, 4, ho2ax)
+OC_FUSED_CONVERTOR_FUNCTOR(Ho2Qu, 3, 4, ho2qu)
+OC_FUSED_CONVERTOR_FUNCTOR(Ho2Ax, 3, 4, ho2ax)
 OC_CONVERTOR_FUNCTOR(Ho2Ro, 3, 4, ho2ro)
-OC_CONVERTOR_FUNCTOR(Ho2Cu, 3, 3, ho2cu)
+OC_FUSED_CONVERTOR_FUNCTOR(Ho2Cu, 3, 3, ho2cu)
 OC_CONVERTOR_FUNCTOR(Ho2St, 3, 3, ho2st)
 
 /* Cubochoric Functors */
-OC_CONVERTOR_FUNCTOR(Cu2Eu, 3, 3, cu2eu)
+OC_FUSED_CONVERTOR_FUNCTOR(Cu2Eu, 3, 3, cu2eu)
 OC_CONVERTOR_FUNCTOR(Cu2Om, 3, 9, cu2om)
-OC_CONVERTOR_FUNCTOR_2QU(Cu2Qu, 3, 4, cu2qu)
+OC_FUSED_CONVERTOR_FUNCTOR(Cu2Qu, 3, 4, cu2qu)
 OC_CONVERTOR_FUNCTOR(Cu2Ax, 3, 4, cu2ax)
 OC_CONVERTOR_FUNCTOR(Cu2Ro, 3, 4, cu2ro)
-OC_CONVERTOR_FUNCTOR(Cu2Ho, 3, 3, cu2ho)
+OC_FUSED_CONVERTOR_FUNCTOR(Cu2Ho, 3, 3, cu2ho)
 OC_CONVERTOR_FUNCTOR(Cu2St, 3, 3, cu2st)
 
 /* Stereographic Functors */
@@ -487,43 +627,134 @@ private:
 };
 
 /**
- * @brief OC_CONVERT_BODY Generates the body of method that will perform the conversion
+ * @brief This templated class is the ConvertRepresentation counterpart for the batch kernels in
+ * OrientationBatchTransforms.hpp. A range of interleaved tuples is handed to the kernel in one call, which
+ * transposes it in blocks and converts each block with SIMD code.
  */
+template <typename T, class BatchKernel>
+class ConvertRepresentationBatch
+{
+public:
+  ConvertRepresentationBatch(T* inPtr, T* outPtr, size_t inStride, size_t outStride)
+  : m_InPtr(inPtr)
+  , m_OutPtr(outPtr)
+  , m_InStride(inStride)
+  , m_OutStride(outStride)
+  {
+  }
+  virtual ~ConvertRepresentationBatch() = default;
+
+  /**
+   * @brief This is the main conversion routine
+   * @param start Starting index
+   * @param end Ending index
+   */
+  void convert(size_t start, size_t end) const
+  {
+    BatchKernel::ConvertAoS(m_InPtr + (start * m_InStride), m_InStride, m_OutPtr + (start * m_OutStride), m_OutStride, end - start);
+  }
+
 #ifdef EbsdLib_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    convert(r.begin(), r.end());
+  }
+#endif
+
+private:
+  T* m_InPtr = nullptr;
+  T* m_OutPtr = nullptr;
+  size_t m_InStride = 0;
+  size_t m_OutStride = 0;
+};
 
+/**
+ * @brief ConvertTuples Runs a conversion over all of the tuples. When the output is the input array (in place) and
+ * the output stride is smaller than the input stride, the tuples are converted in blocks of increasing size so that
+ * a block only writes over input values of blocks that have already been converted.
+ * @param inPtr Input tuples
+ * @param inStride Number of values between consecutive input tuples
+ * @param outPtr Output tuples. May be inPtr when outStride <= inStride
+ * @param outStride Number of values between consecutive output tuples
+ * @param numTuples Number of tuples
+ */
+template <typename T, class Converter, template <typename, class> class RangeConverter = ConvertRepresentation>
+void ConvertTuples(T* inPtr, size_t inStride, T* outPtr, size_t outStride, size_t numTuples)
+{
+  RangeConverter<T, Converter> converter(inPtr, outPtr, inStride, outStride);
+  bool shrinkInPlace = (inPtr == outPtr && outStride < inStride);
+#ifdef EbsdLib_USE_PARALLEL_ALGORITHMS
+  bool doParallel = true;
+  if(doParallel && !shrinkInPlace)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numTuples), converter, tbb::auto_partitioner());
+    return;
+  }
+#endif
+  if(!shrinkInPlace)
+  {
+    converter.convert(0, numTuples);
+    return;
+  }
+
+  // The first tuples only overlap themselves and earlier tuples, so they are converted serially in order.
+  size_t start = std::min<size_t>(numTuples, 4096);
+  converter.convert(0, start);
+  while(start < numTuples)
+  {
+    // Every output value of [start, end) lands below start * inStride, which is already converted
+    size_t end = std::min(numTuples, start * inStride / outStride);
+#ifdef EbsdLib_USE_PARALLEL_ALGORITHMS
+    if(doParallel)
+    {
+      tbb::parallel_for(tbb::blocked_range<size_t>(start, end), converter, tbb::auto_partitioner());
+    }
+    else
+#endif
+    {
+      converter.convert(start, end);
+    }
+    start = end;
+  }
+}
+
+/**
+ * @brief OC_CONVERT_BODY Generates the body of method that will perform the conversion
+ */
 #define OC_CONVERT_BODY(OUTSTRIDE, OUT_ARRAY_NAME, CONVERSION_METHOD, FUNCTOR)                                                                                                                         \
   sanityCheckInputData();                                                                                                                                                                              \
   DataArrayPointerType input = this->getInputData();                                                                                                                                                   \
   T* inPtr = input->getPointer(0);                                                                                                                                                                     \
-  size_t nTuples = this->getInputData()->getNumberOfTuples();                                                                                                                                          \
-  int inStride = input->getNumberOfComponents();                                                                                                                                                       \
-  size_t outStride = OUTSTRIDE;                                                                                                                                                                        \
-  std::vector<size_t> cDims = {outStride};                                                                                                                                                             \
-  DataArrayPointerType output = DataArrayType::CreateArray(nTuples, cDims, #OUT_ARRAY_NAME, true);                                                                                                     \
-  output->initializeWithZeros(); /* Intialize the array with Zeros */                                                                                                                                  \
+  size_t nTuples = input->getNumberOfTuples();                                                                                                                                                         \
+  size_t inStride = input->getNumberOfComponents();                                                                                                                                                    \
+  DataArrayPointerType output = this->createOutputData(nTuples, OUTSTRIDE, #OUT_ARRAY_NAME);                                                                                                           \
   T* outPtr = output->getPointer(0);                                                                                                                                                                   \
-  tbb::parallel_for(tbb::blocked_range<size_t>(0, nTuples), ConvertRepresentation<T, Convertors::FUNCTOR<T>>(inPtr, outPtr, inStride, outStride), tbb::auto_partitioner());                            \
+  ConvertTuples<T, Convertors::FUNCTOR<T>>(inPtr, inStride, outPtr, output->getNumberOfComponents(), nTuples);                                                                                         \
   this->setOutputData(output);
 
-#else
-
-#define OC_CONVERT_BODY(OUTSTRIDE, OUT_ARRAY_NAME, CONVERSION_METHOD, FUNCTOR)                                                                                                                         \
+/**
+ * @brief OC_BATCH_CONVERT_BODY Generates the body of a conversion that has a vectorized batch kernel in
+ * OrientationBatchTransforms.hpp. The scalar FUNCTOR from the Convertors namespace is used when batch transforms
+ * are turned off.
+ */
+#define OC_BATCH_CONVERT_BODY(OUTSTRIDE, OUT_ARRAY_NAME, CONVERSION_METHOD, FUNCTOR)                                                                                                                  \
   sanityCheckInputData();                                                                                                                                                                              \
   DataArrayPointerType input = this->getInputData();                                                                                                                                                   \
   T* inPtr = input->getPointer(0);                                                                                                                                                                     \
-  size_t nTuples = this->getInputData()->getNumberOfTuples();                                                                                                                                          \
-  int inStride = input->getNumberOfComponents();                                                                                                                                                       \
-  size_t outStride = OUTSTRIDE;                                                                                                                                                                        \
-  std::vector<size_t> cDims = {outStride}; /* Create the n component (nx1) based array.*/                                                                                                              \
-  DataArrayPointerType output = DataArrayType::CreateArray(nTuples, cDims, #OUT_ARRAY_NAME, true);                                                                                                     \
-  output->initializeWithZeros(); /* Intialize the array with Zeros */                                                                                                                                  \
+  size_t nTuples = input->getNumberOfTuples();                                                                                                                                                         \
+  size_t inStride = input->getNumberOfComponents();                                                                                                                                                    \
+  DataArrayPointerType output = this->createOutputData(nTuples, OUTSTRIDE, #OUT_ARRAY_NAME);                                                                                                           \
   T* outPtr = output->getPointer(0);                                                                                                                                                                   \
-  ConvertRepresentation<T, Convertors::FUNCTOR<T>> serial(inPtr, outPtr, inStride, outStride);                                                                                                         \
-  serial.convert(0, nTuples);                                                                                                                                                                          \
+  if(this->getUseBatchTransforms())                                                                                                                                                                    \
+  {                                                                                                                                                                                                    \
+    ConvertTuples<T, OrientationBatch::FUNCTOR<T>, ConvertRepresentationBatch>(inPtr, inStride, outPtr, output->getNumberOfComponents(), nTuples);                                                     \
+  }                                                                                                                                                                                                    \
+  else                                                                                                                                                                                                 \
+  {                                                                                                                                                                                                    \
+    ConvertTuples<T, Convertors::FUNCTOR<T>>(inPtr, inStride, outPtr, output->getNumberOfComponents(), nTuples);                                                                                       \
+  }                                                                                                                                                                                                    \
   this->setOutputData(output);
 
-#endif
-
 /* =============================================================================
  *
  * ===========================================================================*/
@@ -596,29 +827,27 @@ public:
 
   void toEulers() override
   {
-    DataArrayPointerType input = this->getInputData();
-    DataArrayPointerType output = std::dynamic_pointer_cast<DataArrayType>(input->deepCopy());
-    this->setOutputData(output);
+    this->copyInputData();
   }
 
   void toOrientationMatrix() override
   {
-    OC_CONVERT_BODY(9, OrientationMatrix, eu2om, Eu2Om)
+    OC_BATCH_CONVERT_BODY(9, OrientationMatrix, eu2om, Eu2Om)
   }
 
   void toQuaternion() override
   {
-    OC_CONVERT_BODY(4, Quaternion, eu2qu, Eu2Qu)
+    OC_BATCH_CONVERT_BODY(4, Quaternion, eu2qu, Eu2Qu)
   }
 
   void toAxisAngle() override
   {
-    OC_CONVERT_BODY(4, AxisAngle, eu2ax, Eu2Ax)
+    OC_BATCH_CONVERT_BODY(4, AxisAngle, eu2ax, Eu2Ax)
   }
 
   void toRodrigues() override
   {
-    OC_CONVERT_BODY(4, Rodrigues, eu2ro, Eu2Ro)
+    OC_BATCH_CONVERT_BODY(4, Rodrigues, eu2ro, Eu2Ro)
   }
 
   void toHomochoric() override
@@ -787,32 +1016,30 @@ public:
   void toEulers() override
   {
     sanityCheckInputData();
-    OC_CONVERT_BODY(3, Eulers, om2eu, Om2Eu)
+    OC_BATCH_CONVERT_BODY(3, Eulers, om2eu, Om2Eu)
   }
 
   void toOrientationMatrix() override
   {
-    DataArrayPointerType input = this->getInputData();
-    DataArrayPointerType output = std::dynamic_pointer_cast<DataArrayType>(input->deepCopy());
-    this->setOutputData(output);
+    this->copyInputData();
   }
 
   void toQuaternion() override
   {
     sanityCheckInputData();
-    OC_CONVERT_BODY(4, Quaternion, om2qu, Om2Qu)
+    OC_BATCH_CONVERT_BODY(4, Quaternion, om2qu, Om2Qu)
   }
 
   void toAxisAngle() override
   {
     sanityCheckInputData();
-    OC_CONVERT_BODY(4, AxisAngle, om2ax, Om2Ax)
+    OC_BATCH_CONVERT_BODY(4, AxisAngle, om2ax, Om2Ax)
   }
 
   void toRodrigues() override
   {
     sanityCheckInputData();
-    OC_CONVERT_BODY(4, Rodrigues, om2ro, Om2Ro)
+    OC_BATCH_CONVERT_BODY(4, Rodrigues, om2ro, Om2Ro)
   }
 
   void toHomochoric() override
@@ -957,30 +1184,27 @@ public:
 
   void toEulers() override
   {
-    OC_CONVERT_BODY(3, Eulers, qu2eu, Qu2Eu)
+    OC_BATCH_CONVERT_BODY(3, Eulers, qu2eu, Qu2Eu)
   }
 
   void toOrientationMatrix() override
   {
-    OC_CONVERT_BODY(9, OrientationMatrix, qu2om, Qu2Om)
+    OC_BATCH_CONVERT_BODY(9, OrientationMatrix, qu2om, Qu2Om)
   }
 
   void toQuaternion() override
   {
-    using PointerType = DataArrayPointerType;
-    PointerType input = this->getInputData();
-    PointerType output = std::dynamic_pointer_cast<DataArrayType>(input->deepCopy());
-    this->setOutputData(output);
+    this->copyInputData();
   }
 
   void toAxisAngle() override
   {
-    OC_CONVERT_BODY(4, AxisAngle, qu2ax, Qu2Ax)
+    OC_BATCH_CONVERT_BODY(4, AxisAngle, qu2ax, Qu2Ax)
   }
 
   void toRodrigues() override
   {
-    OC_CONVERT_BODY(4, Rodrigues, qu2ro, Qu2Ro)
+    OC_BATCH_CONVERT_BODY(4, Rodrigues, qu2ro, Qu2Ro)
   }
 
   void toHomochoric() override
@@ -1120,30 +1344,27 @@ public:
 
   void toEulers() override
   {
-    OC_CONVERT_BODY(3, Eulers, ax2eu, Ax2Eu)
+    OC_BATCH_CONVERT_BODY(3, Eulers, ax2eu, Ax2Eu)
   }
 
   void toOrientationMatrix() override
   {
-    OC_CONVERT_BODY(9, OrientationMatrix, ax2om, Ax2Om)
+    OC_BATCH_CONVERT_BODY(9, OrientationMatrix, ax2om, Ax2Om)
   }
 
   void toQuaternion() override
   {
-    OC_CONVERT_BODY(4, Quaternions, ax2qu, Ax2Qu)
+    OC_BATCH_CONVERT_BODY(4, Quaternions, ax2qu, Ax2Qu)
   }
 
   void toAxisAngle() override
   {
-    using PointerType = DataArrayPointerType;
-    PointerType input = this->getInputData();
-    PointerType output = std::dynamic_pointer_cast<DataArrayType>(input->deepCopy());
-    this->setOutputData(output);
+    this->copyInputData();
   }
 
   void toRodrigues() override
   {
-    OC_CONVERT_BODY(4, Rodrigues, ax2ro, Ax2Ro)
+    OC_BATCH_CONVERT_BODY(4, Rodrigues, ax2ro, Ax2Ro)
   }
 
   void toHomochoric() override
@@ -1284,30 +1505,27 @@ public:
 
   void toEulers() override
   {
-    OC_CONVERT_BODY(3, Eulers, ro2eu, Ro2Eu)
+    OC_BATCH_CONVERT_BODY(3, Eulers, ro2eu, Ro2Eu)
   }
 
   void toOrientationMatrix() override
   {
-    OC_CONVERT_BODY(9, OrientationMatrix, ro2om, Ro2Om)
+    OC_BATCH_CONVERT_BODY(9, OrientationMatrix, ro2om, Ro2Om)
   }
 
   void toQuaternion() override
   {
-    OC_CONVERT_BODY(4, Quaternions, ro2qu, Ro2Qu)
+    OC_BATCH_CONVERT_BODY(4, Quaternions, ro2qu, Ro2Qu)
   }
 
   void toAxisAngle() override
   {
-    OC_CONVERT_BODY(4, AxisAngle, ro2ax, Ro2Ax)
+    OC_BATCH_CONVERT_BODY(4, AxisAngle, ro2ax, Ro2Ax)
   }
 
   void toRodrigues() override
   {
-    using PointerType = DataArrayPointerType;
-    PointerType input = this->getInputData();
-    PointerType output = std::dynamic_pointer_cast<DataArrayType>(input->deepCopy());
-    this->setOutputData(output);
+    this->copyInputData();
   }
 
   void toHomochoric() override
@@ -1473,10 +1691,7 @@ public:
 
   void toHomochoric() override
   {
-    using PointerType = DataArrayPointerType;
-    PointerType input = this->getInputData();
-    PointerType output = std::dynamic_pointer_cast<DataArrayType>(input->deepCopy());
-    this->setOutputData(output);
+    this->copyInputData();
   }
 
   void toCubochoric() override
@@ -1643,10 +1858,7 @@ public:
 
   void toCubochoric() override
   {
-    using PointerType = DataArrayPointerType;
-    PointerType input = this->getInputData();
-    PointerType output = std::dynamic_pointer_cast<DataArrayType>(input->deepCopy());
-    this->setOutputData(output);
+    this->copyInputData();
   }
 
   void toStereographic() override
@@ -1812,10 +2024,7 @@ public:
 
   void toStereographic() override
   {
-    using PointerType = DataArrayPointerType;
-    PointerType input = this->getInputData();
-    PointerType output = std::dynamic_pointer_cast<DataArrayType>(input->deepCopy());
-    this->setOutputData(output);
+    this->copyInputData();
   }
 
   void sanityCheckInputData() override
@@ -2,6 +2,7 @@ set(DIR_NAME OrientationMath)
 
 set(EbsdLib_${DIR_NAME}_HDRS
   ${EbsdLibProj_SOURCE_DIR}/Source/EbsdLib/${DIR_NAME}/OrientationConverter.hpp
+  ${EbsdLibProj_SOURCE_DIR}/Source/EbsdLib/${DIR_NAME}/OrientationBatchTransforms.hpp
 )
 
 set(EbsdLib_${DIR_NAME}_SRCS
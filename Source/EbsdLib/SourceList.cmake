@@ -171,6 +171,15 @@ target_compile_options( ${PROJECT_NAME} PUBLIC
   $<$<CXX_COMPILER_ID:GNU,Clang,AppleClang,Intel>: "-ffp-contract=off">
  )
 
+# --------------------------------------------------------------------
+# std::sqrt sets errno for negative arguments by default, which adds a
+# branch to every call and keeps the loops in OrientationBatchTransforms.hpp
+# from vectorizing. Nothing in EbsdLib reads errno after a math call.
+# PRIVATE so targets that link EbsdLib keep their own errno behavior.
+target_compile_options( ${PROJECT_NAME} PRIVATE
+  $<$<CXX_COMPILER_ID:GNU,Clang,AppleClang,Intel>:-fno-math-errno>
+ )
+
 LibraryProperties(${PROJECT_NAME} ${EXE_DEBUG_EXTENSION})
 
 if(EbsdLib_USE_PARALLEL_ALGORITHMS)
@@ -0,0 +1,316 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "ODFBuilder.h"
+
+#include <array>
+#include <cmath>
+
+#ifdef EbsdLib_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#endif
+
+#include "EbsdLib/Core/OrientationTransformation.hpp"
+#include "EbsdLib/LaueOps/LaueOps.h"
+
+namespace
+{
+struct KernelOffset
+{
+  int dx;
+  int dy;
+  int dz;
+  double weight;
+};
+
+/**
+ * @brief Returns the offsets and weights of the spherical kernel with the given radius. The
+ * weight falls off as 1 - (d / radius)^2 and a radius of zero only covers the center bin.
+ */
+std::vector<KernelOffset> CreateKernel(int radius)
+{
+  std::vector<KernelOffset> kernel;
+  if(radius == 0)
+  {
+    kernel.push_back({0, 0, 0, 1.0});
+    return kernel;
+  }
+  for(int j = -radius; j <= radius; j++)
+  {
+    for(int k = -radius; k <= radius; k++)
+    {
+      for(int l = -radius; l <= radius; l++)
+      {
+        double dist = std::sqrt(static_cast<double>(j * j + k * k + l * l));
+        if(dist <= radius)
+        {
+          double ratio = dist / radius;
+          kernel.push_back({j, k, l, 1.0 - ratio * ratio});
+        }
+      }
+    }
+  }
+  return kernel;
+}
+
+/**
+ * @brief The ComputeODFBinsImpl class finds the ODF bin of each orientation
+ */
+class ComputeODFBinsImpl
+{
+  const LaueOps& m_Ops;
+  const float* m_Eulers;
+  const bool* m_Mask;
+  int32_t* m_Bins;
+
+public:
+  ComputeODFBinsImpl(const LaueOps& ops, const float* eulers, const bool* mask, int32_t* bins)
+  : m_Ops(ops)
+  , m_Eulers(eulers)
+  , m_Mask(mask)
+  , m_Bins(bins)
+  {
+  }
+  virtual ~ComputeODFBinsImpl() = default;
+
+  void generate(size_t start, size_t end) const
+  {
+    for(size_t i = start; i < end; i++)
+    {
+      if(nullptr != m_Mask && !m_Mask[i])
+      {
+        m_Bins[i] = -1;
+        continue;
+      }
+      const float* e = m_Eulers + i * 3;
+      RodriguesD rod = OrientationTransformation::eu2ro<EulerD, RodriguesD>(EulerD(e[0], e[1], e[2]));
+      m_Bins[i] = m_Ops.getOdfBin(m_Ops.getODFFZRod(rod));
+    }
+  }
+
+#ifdef EbsdLib_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    generate(r.begin(), r.end());
+  }
+#endif
+};
+
+/**
+ * @brief The SpreadHistogramImpl class adds the kernel weighted histogram around each
+ * ODF bin. The kernel is symmetric so gathering from the neighbors of a bin gives the
+ * same result as scattering every histogram entry onto its neighbors.
+ */
+class SpreadHistogramImpl
+{
+  const std::vector<double>& m_Histogram;
+  const std::vector<KernelOffset>& m_Kernel;
+  std::array<int, 3> m_NumBins;
+  double* m_ODF;
+
+public:
+  SpreadHistogramImpl(const std::vector<double>& histogram, const std::vector<KernelOffset>& kernel, const std::array<size_t, 3>& numBins, double* odf)
+  : m_Histogram(histogram)
+  , m_Kernel(kernel)
+  , m_NumBins({static_cast<int>(numBins[0]), static_cast<int>(numBins[1]), static_cast<int>(numBins[2])})
+  , m_ODF(odf)
+  {
+  }
+  virtual ~SpreadHistogramImpl() = default;
+
+  void generate(size_t start, size_t end) const
+  {
+    const int planeSize = m_NumBins[0] * m_NumBins[1];
+    for(size_t bin = start; bin < end; bin++)
+    {
+      const int x = static_cast<int>(bin) % m_NumBins[0];
+      const int y = (static_cast<int>(bin) / m_NumBins[0]) % m_NumBins[1];
+      const int z = static_cast<int>(bin) / planeSize;
+      double sum = 0.0;
+      for(const auto& offset : m_Kernel)
+      {
+        const int sx = x + offset.dx;
+        const int sy = y + offset.dy;
+        const int sz = z + offset.dz;
+        if(sx < 0 || sx >= m_NumBins[0] || sy < 0 || sy >= m_NumBins[1] || sz < 0 || sz >= m_NumBins[2])
+        {
+          continue;
+        }
+        sum += m_Histogram[sz * planeSize + sy * m_NumBins[0] + sx] * offset.weight;
+      }
+      m_ODF[bin] += sum;
+    }
+  }
+
+#ifdef EbsdLib_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    generate(r.begin(), r.end());
+  }
+#endif
+};
+} // namespace
+
+// -----------------------------------------------------------------------------
+ODFBuilder::ODFBuilder(const LaueOps& ops)
+: m_Ops(ops)
+{
+}
+
+// -----------------------------------------------------------------------------
+void ODFBuilder::addOrientations(const float* eulers, const float* weights, const float* sigmas, size_t numEntries, const bool* mask)
+{
+  addOrientations(eulers, weights, 0.0f, sigmas, 0.0f, numEntries, mask);
+}
+
+// -----------------------------------------------------------------------------
+void ODFBuilder::addOrientations(const float* eulers, size_t numEntries, float weight, float sigma, const bool* mask)
+{
+  addOrientations(eulers, nullptr, weight, nullptr, sigma, numEntries, mask);
+}
+
+// -----------------------------------------------------------------------------
+void ODFBuilder::addOrientations(const float* eulers, const float* weights, float weight, const float* sigmas, float sigma, size_t numEntries, const bool* mask)
+{
+  std::vector<int32_t> bins(numEntries);
+  ComputeODFBinsImpl serial(m_Ops, eulers, mask, bins.data());
+#ifdef EbsdLib_USE_PARALLEL_ALGORITHMS
+  bool doParallel = true;
+  if(doParallel)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numEntries), serial, tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    serial.generate(0, numEntries);
+  }
+
+  const size_t odfSize = static_cast<size_t>(m_Ops.getODFSize());
+  std::vector<double>* histogram = nullptr;
+  int currentRadius = -1;
+  for(size_t i = 0; i < numEntries; i++)
+  {
+    // A negative sigma adds nothing, a sigma below one only adds to the center bin
+    const float entrySigma = (nullptr != sigmas ? sigmas[i] : sigma);
+    if(bins[i] < 0 || entrySigma < 0.0f)
+    {
+      continue;
+    }
+    const int radius = static_cast<int>(entrySigma);
+    if(radius != currentRadius)
+    {
+      histogram = &m_Histograms[radius];
+      histogram->resize(odfSize, 0.0);
+      currentRadius = radius;
+    }
+    (*histogram)[bins[i]] += (nullptr != weights ? weights[i] : weight);
+  }
+}
+
+// -----------------------------------------------------------------------------
+void ODFBuilder::merge(const ODFBuilder& other)
+{
+  for(const auto& radiusHistogram : other.m_Histograms)
+  {
+    std::vector<double>& histogram = m_Histograms[radiusHistogram.first];
+    histogram.resize(radiusHistogram.second.size(), 0.0);
+    for(size_t i = 0; i < histogram.size(); i++)
+    {
+      histogram[i] += radiusHistogram.second[i];
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+void ODFBuilder::clear()
+{
+  m_Histograms.clear();
+}
+
+// -----------------------------------------------------------------------------
+std::vector<float> ODFBuilder::getODF(bool normalize) const
+{
+  const size_t odfSize = static_cast<size_t>(m_Ops.getODFSize());
+  const std::array<size_t, 3> numBins = m_Ops.getOdfNumBins();
+  std::vector<double> odf(odfSize, 0.0);
+  for(const auto& radiusHistogram : m_Histograms)
+  {
+    std::vector<KernelOffset> kernel = CreateKernel(radiusHistogram.first);
+    SpreadHistogramImpl serial(radiusHistogram.second, kernel, numBins, odf.data());
+#ifdef EbsdLib_USE_PARALLEL_ALGORITHMS
+    bool doParallel = true;
+    if(doParallel)
+    {
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, odfSize), serial, tbb::auto_partitioner());
+      continue;
+    }
+#endif
+    serial.generate(0, odfSize);
+  }
+
+  double totalAddWeight = 0.0;
+  for(double value : odf)
+  {
+    totalAddWeight += value;
+  }
+  const double totalWeight = static_cast<double>(odfSize);
+  if(totalAddWeight > totalWeight)
+  {
+    const double scale = totalAddWeight / totalWeight;
+    for(auto& value : odf)
+    {
+      value /= scale;
+    }
+  }
+  else
+  {
+    const double background = (totalWeight - totalAddWeight) / totalWeight;
+    for(auto& value : odf)
+    {
+      value += background;
+    }
+  }
+
+  std::vector<float> result(odfSize);
+  const double divisor = normalize ? totalWeight : 1.0;
+  for(size_t i = 0; i < odfSize; i++)
+  {
+    result[i] = static_cast<float>(odf[i] / divisor);
+  }
+  return result;
+}
@@ -0,0 +1,116 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <vector>
+
+#include "EbsdLib/EbsdLib.h"
+
+class LaueOps;
+
+/**
+ * @brief The ODFBuilder class computes an ODF with the same spherical kernel that
+ * Texture::CalculateODFData uses but scales to millions of orientations so an ODF can
+ * be built directly from a measured scan.
+ *
+ * The ODF bin of every orientation is computed in parallel and its weight is added to
+ * a histogram, one histogram per kernel radius. The kernel weights are computed once
+ * per radius and each histogram is spread by gathering over the kernel for every ODF
+ * bin in parallel, so the cost no longer grows with (number of entries) x (kernel size).
+ * The LaueOps instance must outlive the builder.
+ */
+class EbsdLib_EXPORT ODFBuilder
+{
+public:
+  explicit ODFBuilder(const LaueOps& ops);
+  ~ODFBuilder() = default;
+
+  /**
+   * @brief Adds orientations that each carry their own weight and sigma
+   * @param eulers Euler angles in Radians, 3 values per orientation
+   * @param weights The weight of each orientation
+   * @param sigmas The kernel radius (in ODF bins) of each orientation
+   * @param numEntries The number of orientations
+   * @param mask Optional mask. Orientations whose mask value is false are skipped.
+   */
+  void addOrientations(const float* eulers, const float* weights, const float* sigmas, size_t numEntries, const bool* mask = nullptr);
+
+  /**
+   * @brief Adds orientations that all share the same weight and sigma, such as the
+   * points of a measured EBSD scan. Adding orientations again with the negated weight
+   * removes them.
+   * @param eulers Euler angles in Radians, 3 values per orientation
+   * @param numEntries The number of orientations
+   * @param weight The weight of every orientation
+   * @param sigma The kernel radius (in ODF bins) of every orientation
+   * @param mask Optional mask. Orientations whose mask value is false are skipped.
+   */
+  void addOrientations(const float* eulers, size_t numEntries, float weight, float sigma, const bool* mask = nullptr);
+
+  /**
+   * @brief Adds all the orientations of another builder. Both builders must use the same Laue class.
+   * @param other The builder to add
+   */
+  void merge(const ODFBuilder& other);
+
+  /**
+   * @brief Removes all the orientations that were added
+   */
+  void clear();
+
+  /**
+   * @brief Computes the ODF of all the orientations added so far. The added weight is
+   * rescaled or padded with a uniform background exactly as Texture::CalculateODFData does.
+   * @param normalize Should the ODF be normalized so that it sums to one
+   * @return The ODF, LaueOps::getODFSize() values
+   */
+  std::vector<float> getODF(bool normalize) const;
+
+private:
+  const LaueOps& m_Ops;
+  std::map<int, std::vector<double>> m_Histograms;
+
+  void addOrientations(const float* eulers, const float* weights, float weight, const float* sigmas, float sigma, size_t numEntries, const bool* mask);
+
+public:
+  ODFBuilder(const ODFBuilder&) = delete;            // Copy Constructor Not Implemented
+  ODFBuilder(ODFBuilder&&) = delete;                 // Move Constructor Not Implemented
+  ODFBuilder& operator=(const ODFBuilder&) = delete; // Copy Assignment Not Implemented
+  ODFBuilder& operator=(ODFBuilder&&) = delete;      // Move Assignment Not Implemented
+};
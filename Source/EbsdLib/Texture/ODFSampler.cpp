@@ -0,0 +1,217 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "ODFSampler.h"
+
+#include <algorithm>
+#include <array>
+
+#ifdef EbsdLib_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#endif
+
+#include "EbsdLib/LaueOps/LaueOps.h"
+#include "EbsdLib/Math/EbsdLibRandomEngine.h"
+
+namespace
+{
+/**
+ * @brief The GenerateEulerAnglesImpl class samples one Euler angle per element
+ */
+template <typename T>
+class GenerateEulerAnglesImpl
+{
+  const ODFSampler& m_Sampler;
+  const LaueOps& m_Ops;
+  T* m_Eulers;
+  uint64_t m_Seed;
+
+public:
+  GenerateEulerAnglesImpl(const ODFSampler& sampler, const LaueOps& ops, T* eulers, uint64_t seed)
+  : m_Sampler(sampler)
+  , m_Ops(ops)
+  , m_Eulers(eulers)
+  , m_Seed(seed)
+  {
+  }
+  virtual ~GenerateEulerAnglesImpl() = default;
+
+  void generate(size_t start, size_t end) const
+  {
+    EulerD eu;
+    for(size_t i = start; i < end; i++)
+    {
+      PhiloxEngine engine(m_Seed, i);
+      size_t bin = m_Sampler.sample(engine.generateDouble());
+      std::array<double, 3> randx3 = {engine.generateDouble(), engine.generateDouble(), engine.generateDouble()};
+      m_Ops.determineEulerAngles(randx3.data(), static_cast<int>(bin), eu);
+      m_Eulers[3 * i + 0] = static_cast<T>(eu[0]);
+      m_Eulers[3 * i + 1] = static_cast<T>(eu[1]);
+      m_Eulers[3 * i + 2] = static_cast<T>(eu[2]);
+    }
+  }
+
+#ifdef EbsdLib_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    generate(r.begin(), r.end());
+  }
+#endif
+};
+
+// -----------------------------------------------------------------------------
+template <typename T>
+void GenerateEulerAngles(const ODFSampler& sampler, const LaueOps& ops, T* eulers, size_t numSamples, uint64_t seed)
+{
+  if(sampler.size() == 0)
+  {
+    return;
+  }
+  GenerateEulerAnglesImpl<T> serial(sampler, ops, eulers, seed);
+#ifdef EbsdLib_USE_PARALLEL_ALGORITHMS
+  bool doParallel = true;
+  if(doParallel)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numSamples), serial, tbb::auto_partitioner());
+    return;
+  }
+#endif
+  serial.generate(0, numSamples);
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+void ODFSampler::build(std::vector<double>& weights)
+{
+  const size_t numBins = weights.size();
+  m_Probability.assign(numBins, 1.0);
+  m_Alias.resize(numBins);
+  m_TotalWeight = 0.0;
+  for(auto& weight : weights)
+  {
+    weight = std::max(weight, 0.0);
+    m_TotalWeight += weight;
+  }
+  for(size_t i = 0; i < numBins; i++)
+  {
+    m_Alias[i] = static_cast<uint32_t>(i);
+  }
+  if(numBins == 0 || m_TotalWeight <= 0.0)
+  {
+    return;
+  }
+
+  // Scale so the average bin holds exactly 1 then pair every underfull bin with an overfull one (Vose)
+  std::vector<uint32_t> small;
+  std::vector<uint32_t> large;
+  small.reserve(numBins);
+  large.reserve(numBins);
+  const double scale = static_cast<double>(numBins) / m_TotalWeight;
+  for(size_t i = 0; i < numBins; i++)
+  {
+    weights[i] *= scale;
+    if(weights[i] < 1.0)
+    {
+      small.push_back(static_cast<uint32_t>(i));
+    }
+    else
+    {
+      large.push_back(static_cast<uint32_t>(i));
+    }
+  }
+  while(!small.empty() && !large.empty())
+  {
+    uint32_t less = small.back();
+    small.pop_back();
+    uint32_t more = large.back();
+    m_Probability[less] = weights[less];
+    m_Alias[less] = more;
+    weights[more] = (weights[more] + weights[less]) - 1.0;
+    if(weights[more] < 1.0)
+    {
+      large.pop_back();
+      small.push_back(more);
+    }
+  }
+  // Whatever is left over only differs from 1 by round off
+  for(uint32_t i : large)
+  {
+    m_Probability[i] = 1.0;
+  }
+  for(uint32_t i : small)
+  {
+    m_Probability[i] = 1.0;
+  }
+}
+
+// -----------------------------------------------------------------------------
+size_t ODFSampler::size() const
+{
+  return m_Probability.size();
+}
+
+// -----------------------------------------------------------------------------
+double ODFSampler::getTotalWeight() const
+{
+  return m_TotalWeight;
+}
+
+// -----------------------------------------------------------------------------
+size_t ODFSampler::sample(double random) const
+{
+  const size_t numBins = m_Probability.size();
+  if(numBins == 0)
+  {
+    return 0;
+  }
+  double scaled = random * static_cast<double>(numBins);
+  size_t column = std::min(static_cast<size_t>(scaled), numBins - 1);
+  double fraction = scaled - static_cast<double>(column);
+  return fraction < m_Probability[column] ? column : m_Alias[column];
+}
+
+// -----------------------------------------------------------------------------
+void ODFSampler::generateEulerAngles(const LaueOps& ops, float* eulers, size_t numSamples, uint64_t seed) const
+{
+  GenerateEulerAngles(*this, ops, eulers, numSamples, seed);
+}
+
+// -----------------------------------------------------------------------------
+void ODFSampler::generateEulerAngles(const LaueOps& ops, double* eulers, size_t numSamples, uint64_t seed) const
+{
+  GenerateEulerAngles(*this, ops, eulers, numSamples, seed);
+}
@@ -0,0 +1,121 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "EbsdLib/EbsdLib.h"
+
+class LaueOps;
+
+/**
+ * @brief The ODFSampler class draws bin indices from a discrete ODF or MDF with a
+ * Walker/Vose alias table. The table is built once in O(bins) and each draw is O(1)
+ * no matter how many bins the Laue class has. The bin weights do not need to sum
+ * to one; bins are drawn in proportion to their weight and negative weights are
+ * treated as zero.
+ */
+class EbsdLib_EXPORT ODFSampler
+{
+public:
+  ODFSampler() = default;
+
+  /**
+   * @param weights The weight of each bin
+   * @param numBins The number of bins
+   */
+  template <typename T>
+  ODFSampler(const T* weights, size_t numBins)
+  {
+    std::vector<double> values(weights, weights + numBins);
+    build(values);
+  }
+
+  /**
+   * @param weights The weight of each bin
+   */
+  template <typename T>
+  explicit ODFSampler(const std::vector<T>& weights)
+  : ODFSampler(weights.data(), weights.size())
+  {
+  }
+
+  ~ODFSampler() = default;
+
+  ODFSampler(const ODFSampler&) = default;
+  ODFSampler(ODFSampler&&) noexcept = default;
+  ODFSampler& operator=(const ODFSampler&) = default;
+  ODFSampler& operator=(ODFSampler&&) noexcept = default;
+
+  /**
+   * @brief Returns the number of bins
+   */
+  size_t size() const;
+
+  /**
+   * @brief Returns the sum of all the (non negative) bin weights
+   */
+  double getTotalWeight() const;
+
+  /**
+   * @brief Returns the bin that the uniform random value falls in. The integer part of
+   * random * size() picks a column of the table and the fractional part decides between
+   * that column and its alias.
+   * @param random Uniform random value in the range [0, 1)
+   */
+  size_t sample(double random) const;
+
+  /**
+   * @brief Draws numSamples bins and picks a random orientation inside each of them with
+   * LaueOps::determineEulerAngles(). Sample i always uses stream i of the seed so the
+   * output is reproducible regardless of the number of threads.
+   * @param ops The Laue class the ODF was computed for
+   * @param eulers [output] Euler angles in Radians, 3 values per sample
+   * @param numSamples The number of samples
+   * @param seed The random seed
+   */
+  void generateEulerAngles(const LaueOps& ops, float* eulers, size_t numSamples, uint64_t seed) const;
+  void generateEulerAngles(const LaueOps& ops, double* eulers, size_t numSamples, uint64_t seed) const;
+
+private:
+  std::vector<double> m_Probability;
+  std::vector<uint32_t> m_Alias;
+  double m_TotalWeight = 0.0;
+
+  void build(std::vector<double>& weights);
+};
@@ -39,7 +39,6 @@
 #define WIN32_LEAN_AND_MEAN // Exclude rarely-used stuff from Windows headers
 #endif
 
-#include <chrono>
 #include <random>
 
 #include "EbsdLib/Core/EbsdLibConstants.h"
@@ -47,6 +46,8 @@
 #include "EbsdLib/LaueOps/LaueOps.h"
 #include "EbsdLib/Math/EbsdLibMath.h"
 #include "EbsdLib/Math/EbsdLibRandom.h"
+#include "EbsdLib/Math/EbsdLibRandomEngine.h"
+#include "EbsdLib/Texture/ODFSampler.h"
 #include "EbsdLib/Texture/Texture.hpp"
 
 /**
@@ -244,45 +245,12 @@ public:
   template <typename T, class LaueOpsType, class ContainerType>
   static int GenODFPlotData(const ContainerType& odf, T* eulers, size_t npoints)
   {
-    std::random_device randomDevice;           // Will be used to obtain a seed for the random number engine
-    std::mt19937_64 generator(randomDevice()); // Standard mersenne_twister_engine seeded with rd()
-    std::mt19937_64::result_type seed = static_cast<std::mt19937_64::result_type>(std::chrono::steady_clock::now().time_since_epoch().count());
-    generator.seed(seed);
-    std::uniform_real_distribution<> distribution(0.0, 1.0);
-    std::array<double, 3> randx3;
-
-    int err = 0;
-    int choose = 0;
-    T totaldensity;
-    T random, density;
-
     LaueOpsType ops;
-    T td1;
-    for(size_t i = 0; i < npoints; i++)
-    {
-      random = distribution(generator);
-      choose = 0;
-      totaldensity = 0;
-      for(int j = 0; j < ops.getODFSize(); j++)
-      {
-        density = odf[j];
-        td1 = totaldensity;
-        totaldensity = totaldensity + density;
-        if(random < totaldensity && random >= td1)
-        {
-          choose = static_cast<int>(j);
-          break;
-        }
-      }
-      randx3[0] = distribution(generator);
-      randx3[1] = distribution(generator);
-      randx3[2] = distribution(generator);
-      OrientationD eu = ops.determineEulerAngles(randx3.data(), choose);
-      eulers[3 * i + 0] = eu[0];
-      eulers[3 * i + 1] = eu[1];
-      eulers[3 * i + 2] = eu[2];
-    }
-    return err;
+    ODFSampler sampler(odf.data(), static_cast<size_t>(ops.getODFSize()));
+    PhiloxEngine& generator = EbsdLibRandomEngine::ThreadLocal();
+    uint64_t seed = (static_cast<uint64_t>(generator()) << 32) | generator();
+    sampler.generateEulerAngles(ops, eulers, npoints, seed);
+    return 0;
   }
 #if 0
 
@@ -448,46 +416,12 @@ public:
   template <typename T>
   static int GenAxisODFPlotData(T* odf, T* eulers, int npoints)
   {
-
-    std::random_device randomDevice;           // Will be used to obtain a seed for the random number engine
-    std::mt19937_64 generator(randomDevice()); // Standard mersenne_twister_engine seeded with rd()
-    std::mt19937_64::result_type seed = static_cast<std::mt19937_64::result_type>(std::chrono::steady_clock::now().time_since_epoch().count());
-    generator.seed(seed);
-    std::uniform_real_distribution<> distribution(0.0, 1.0);
-    std::array<double, 3> randx3;
-
-    int err = 0;
-    int choose;
-    float totaldensity;
-    float random, density;
     OrthoRhombicOps ops;
-
-    float td1;
-    for(int i = 0; i < npoints; i++)
-    {
-      random = distribution(generator);
-      choose = 0;
-      totaldensity = 0;
-      for(int j = 0; j < ops.getODFSize(); j++)
-      {
-        density = odf[j];
-        td1 = totaldensity;
-        totaldensity = totaldensity + density;
-        if(random < totaldensity && random >= td1)
-        {
-          choose = static_cast<int>(j);
-          break;
-        }
-      }
-      randx3[0] = distribution(generator);
-      randx3[1] = distribution(generator);
-      randx3[2] = distribution(generator);
-      OrientationD eu = ops.determineEulerAngles(randx3.data(), choose);
-      eulers[3 * i + 0] = eu[0];
-      eulers[3 * i + 1] = eu[1];
-      eulers[3 * i + 2] = eu[2];
-    }
-    return err;
+    ODFSampler sampler(odf, static_cast<size_t>(ops.getODFSize()));
+    PhiloxEngine& generator = EbsdLibRandomEngine::ThreadLocal();
+    uint64_t seed = (static_cast<uint64_t>(generator()) << 32) | generator();
+    sampler.generateEulerAngles(ops, eulers, static_cast<size_t>(npoints), seed);
+    return 0;
   }
 
   /**
@@ -504,22 +438,16 @@ public:
   {
     float radtodeg = 180.0f / static_cast<float>(M_PI);
 
-    std::random_device randomDevice;           // Will be used to obtain a seed for the random number engine
-    std::mt19937_64 generator(randomDevice()); // Standard mersenne_twister_engine seeded with rd()
-    std::mt19937_64::result_type seed = static_cast<std::mt19937_64::result_type>(std::chrono::steady_clock::now().time_since_epoch().count());
-    generator.seed(seed);
+    PhiloxEngine& generator = EbsdLibRandomEngine::ThreadLocal();
     std::uniform_real_distribution<> distribution(0.0, 1.0);
 
     int err = 0;
-    float density = 0.0f;
-    float totaldensity = 0.0f;
     int choose = 0;
-    float random = 0.0f;
 
     LaueOpsType ops;
     xval.resize(ops.getMdfPlotBins());
     yval.resize(ops.getMdfPlotBins());
-    int32_t opsMdfSize = ops.getMDFSize();
+    ODFSampler mdfSampler(mdf.data(), static_cast<size_t>(ops.getMDFSize()));
     std::array<double, 3> randx3;
 
     for(int i = 0; i < yval.size(); i++)
@@ -527,23 +455,9 @@ public:
       yval[i] = 0.0f;
     }
 
-    float td1 = 0.0f;
     for(int i = 0; i < size; i++)
     {
-      random = static_cast<float>(distribution(generator));
-      choose = 0;
-      totaldensity = 0;
-      for(int j = 0; j < opsMdfSize; j++)
-      {
-        density = mdf[j];
-        td1 = totaldensity;
-        totaldensity = totaldensity + density;
-        if(random < totaldensity && random >= td1)
-        {
-          choose = static_cast<int>(j);
-          break;
-        }
-      }
+      choose = static_cast<int>(mdfSampler.sample(distribution(generator)));
 
       // Create a random rod vector
       randx3 = {distribution(generator), distribution(generator), distribution(generator)};
@@ -35,7 +35,6 @@
 
 #pragma once
 
-#include <chrono>
 #include <fstream>
 #include <random>
 #include <vector>
@@ -53,6 +52,9 @@
 #include "EbsdLib/LaueOps/OrthoRhombicOps.h"
 #include "EbsdLib/Math/EbsdLibMath.h"
 #include "EbsdLib/Math/EbsdLibRandom.h"
+#include "EbsdLib/Math/EbsdLibRandomEngine.h"
+#include "EbsdLib/Texture/ODFBuilder.h"
+#include "EbsdLib/Texture/ODFSampler.h"
 
 /**
  * @brief This class holds default data for Orientation Distribution Function (ODF)
@@ -71,7 +73,9 @@ public:
    * passed in and a Hexagonal Crystal Structure. This is templated on the container
    * type that holds the data. Containers that adhere to the STL Vector API
    * should be usable. std::vector falls into this category. The input data for the
-   * euler angles is in Columnar fashion instead of row major format.
+   * euler angles is in Columnar fashion instead of row major format. The ODF is
+   * computed by ODFBuilder which can also be used directly to build an ODF from
+   * all the points of a scan.
    * @param e1s The first euler angles
    * @param e2s The second euler angles
    * @param e3s The third euler angles
@@ -86,120 +90,26 @@ public:
   static void CalculateODFData(Container& e1s, Container& e2s, Container& e3s, Container& weights, Container& sigmas, bool normalize, Container& odf, size_t numEntries)
   {
     LaueOps ops;
-    std::array<size_t, 3> odfNumBins = ops.getOdfNumBins();
     odf.resize(ops.getODFSize());
-    EbsdLib::Int32ArrayType::Pointer textureBins = EbsdLib::Int32ArrayType::CreateArray(numEntries, "TextureBins", true);
-    int32_t* TextureBins = textureBins->getPointer(0);
 
-    float addweight = 0;
-    float totaladdweight = 0;
-    float totalweight = float(ops.getODFSize());
-    int bin, addbin;
-    int bin1, bin2, bin3;
-    int addbin1, addbin2, addbin3;
-    float dist, fraction;
-    // Use double precision for the calculations
+    std::vector<float> eulers(numEntries * 3);
+    std::vector<float> entryWeights(numEntries);
+    std::vector<float> entrySigmas(numEntries);
     for(size_t i = 0; i < numEntries; i++)
     {
-      OrientationF eu(e1s[i], e2s[i], e3s[i]);
-      OrientationD rod = OrientationTransformation::eu2ro<OrientationF, OrientationD>(eu);
-
-      rod = ops.getODFFZRod(rod);
-      bin = ops.getOdfBin(rod);
-      TextureBins[i] = static_cast<int>(bin);
+      eulers[i * 3] = static_cast<float>(e1s[i]);
+      eulers[i * 3 + 1] = static_cast<float>(e2s[i]);
+      eulers[i * 3 + 2] = static_cast<float>(e3s[i]);
+      entryWeights[i] = static_cast<float>(weights[i]);
+      entrySigmas[i] = static_cast<float>(sigmas[i]);
     }
 
-    for(int i = 0; i < ops.getODFSize(); i++)
-    {
-      odf[i] = 0;
-    }
-    for(size_t i = 0; i < numEntries; i++)
+    ODFBuilder builder(ops);
+    builder.addOrientations(eulers.data(), entryWeights.data(), entrySigmas.data(), numEntries);
+    std::vector<float> values = builder.getODF(normalize);
+    for(size_t i = 0; i < values.size(); i++)
     {
-      bin = TextureBins[i];
-      bin1 = bin % odfNumBins[0];
-      bin2 = static_cast<int32_t>((bin / odfNumBins[0]) % odfNumBins[1]);
-      bin3 = bin / static_cast<int32_t>((odfNumBins[0] * odfNumBins[1]));
-      for(int j = static_cast<int>(-sigmas[i]); j <= sigmas[i]; j++)
-      {
-        int jsqrd = j * j;
-        for(int k = static_cast<int>(-sigmas[i]); k <= sigmas[i]; k++)
-        {
-          int ksqrd = k * k;
-          for(int l = static_cast<int>(-sigmas[i]); l <= sigmas[i]; l++)
-          {
-            int lsqrd = l * l;
-            addbin1 = bin1 + int(j);
-            addbin2 = bin2 + int(k);
-            addbin3 = bin3 + int(l);
-            int good = 1;
-            if(addbin1 < 0)
-            {
-              good = 0;
-            }
-            if(addbin1 >= odfNumBins[0])
-            {
-              good = 0;
-            }
-            if(addbin2 < 0)
-            {
-              good = 0;
-            }
-            if(addbin2 >= odfNumBins[1])
-            {
-              good = 0;
-            }
-            if(addbin3 < 0)
-            {
-              good = 0;
-            }
-            if(addbin3 >= odfNumBins[2])
-            {
-              good = 0;
-            }
-            addbin = static_cast<int>((addbin3 * odfNumBins[0] * odfNumBins[1]) + (addbin2 * odfNumBins[0]) + (addbin1));
-            dist = static_cast<float>(std::pow(static_cast<float>(jsqrd + ksqrd + lsqrd), 0.5));
-            fraction = static_cast<float>(1.0 - (double(dist / int(sigmas[i])) * double(dist / int(sigmas[i]))));
-            if(dist <= int(sigmas[i]) && good == 1)
-            {
-              addweight = (weights[i] * fraction);
-              if(sigmas[i] == 0.0)
-              {
-                addweight = weights[i];
-              }
-              odf[addbin] = odf[addbin] + addweight;
-              totaladdweight = totaladdweight + addweight;
-            }
-          }
-        }
-      }
-    }
-    // These next loops *look* like they can be parallelized but the arrays are not large enough
-    // to see any benefit so don't go down that road. std::transform is also slower than the
-    // manual loops that are coded.
-    if(totaladdweight > totalweight)
-    {
-      float scale = (totaladdweight / totalweight);
-      for(int i = 0; i < ops.getODFSize(); i++)
-      {
-        odf[i] = odf[i] / scale;
-      }
-    }
-    else
-    {
-      float remainingweight = totalweight - totaladdweight;
-      float background = remainingweight / static_cast<float>(ops.getODFSize());
-      for(int i = 0; i < ops.getODFSize(); i++)
-      {
-        odf[i] += background;
-      }
-    }
-    if(normalize)
-    {
-      // Normalize the odf
-      for(int i = 0; i < ops.getODFSize(); i++)
-      {
-        odf[i] = odf[i] / totalweight;
-      }
+      odf[i] = static_cast<T>(values[i]);
     }
   }
 
@@ -224,16 +134,15 @@ public:
     mdf.resize(orientationOps.getMDFSize());
 
     // Create a Random Number generator
-    std::random_device randomDevice;           // Will be used to obtain a seed for the random number engine
-    std::mt19937_64 generator(randomDevice()); // Standard mersenne_twister_engine seeded with rd()
-    std::mt19937_64::result_type seed = static_cast<std::mt19937_64::result_type>(std::chrono::steady_clock::now().time_since_epoch().count());
-    generator.seed(seed);
+    PhiloxEngine& generator = EbsdLibRandomEngine::ThreadLocal();
     std::uniform_real_distribution<> distribution(0.0, 1.0);
 
+    // Draw the ODF bins from an alias table instead of scanning every bin per sample
+    ODFSampler odfSampler(odf.data(), odfsize);
+
     int mbin;
     int choose1, choose2;
-    float totaldensity;
-    float random1, random2, density;
+    double random1, random2;
 
     for(int i = 0; i < mdfsize; i++)
     {
@@ -254,25 +163,10 @@ public:
 
     for(int i = 0; i < remainingcount; i++)
     {
-      random1 = static_cast<float>(distribution(generator));
-      random2 = static_cast<float>(distribution(generator));
-      choose1 = 0;
-      choose2 = 0;
-      totaldensity = 0;
-      for(size_t j = 0; j < odfsize; j++)
-      {
-        density = odf[j];
-        float d = totaldensity;
-        totaldensity = totaldensity + density;
-        if(random1 >= d && random1 < totaldensity)
-        {
-          choose1 = static_cast<int>(j);
-        }
-        if(random2 >= d && random2 < totaldensity)
-        {
-          choose2 = static_cast<int>(j);
-        }
-      }
+      random1 = distribution(generator);
+      random2 = distribution(generator);
+      choose1 = static_cast<int>(odfSampler.sample(random1));
+      choose2 = static_cast<int>(odfSampler.sample(random2));
       // This is used to create a random Homochoric vector
       std::array<double, 3> randx3 = {distribution(generator), distribution(generator), distribution(generator)};
       OrientationD eu = orientationOps.determineEulerAngles(randx3.data(), choose1);
@@ -0,0 +1,235 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "TextureAccumulator.h"
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <memory>
+
+#ifdef EbsdLib_USE_PARALLEL_ALGORITHMS
+#include <tbb/task_group.h>
+#endif
+
+#include "EbsdLib/LaueOps/LaueOps.h"
+
+namespace
+{
+/**
+ * @brief The number of orientations whose sphere coordinates are generated together
+ */
+constexpr size_t k_BlockSize = 4096;
+} // namespace
+
+// -----------------------------------------------------------------------------
+TextureAccumulator::TextureAccumulator(const LaueOps& ops, int lambertDim, float odfSigma)
+: m_Ops(ops)
+, m_LambertDim(lambertDim)
+, m_ODFSigma(odfSigma)
+, m_Lambert(ModifiedLambertProjection::New())
+, m_ODF(ops)
+{
+  m_Lambert->initializeSquares(lambertDim, 1.0f);
+  clear();
+}
+
+// -----------------------------------------------------------------------------
+void TextureAccumulator::add(const float* eulers, size_t numOrientations)
+{
+  accumulate(eulers, numOrientations, 1.0);
+}
+
+// -----------------------------------------------------------------------------
+void TextureAccumulator::remove(const float* eulers, size_t numOrientations)
+{
+  accumulate(eulers, numOrientations, -1.0);
+}
+
+// -----------------------------------------------------------------------------
+void TextureAccumulator::accumulate(const float* eulers, size_t numOrientations, double value)
+{
+  const std::array<int32_t, 3> numSymmetry = m_Ops.getNumSymmetry();
+  const size_t squareSize = static_cast<size_t>(m_LambertDim) * static_cast<size_t>(m_LambertDim);
+  std::vector<size_t> cDims(1, 3);
+  std::array<std::vector<float>, 3> xyz;
+  std::array<EbsdLib::FloatArrayType::Pointer, 3> coords;
+
+  for(size_t blockStart = 0; blockStart < numOrientations; blockStart += k_BlockSize)
+  {
+    size_t count = std::min(k_BlockSize, numOrientations - blockStart);
+    // The eulers are only read so the const_cast is safe
+    EbsdLib::FloatArrayType::Pointer blockEulers = EbsdLib::FloatArrayType::WrapPointer(const_cast<float*>(eulers + blockStart * 3), count, cDims, "Eulers", false);
+    for(size_t f = 0; f < 3; f++)
+    {
+      size_t numCoords = count * static_cast<size_t>(numSymmetry[f]);
+      xyz[f].resize(numCoords * 3);
+      coords[f] = EbsdLib::FloatArrayType::WrapPointer(xyz[f].data(), numCoords, cDims, "Coords", false);
+    }
+    m_Ops.generateSphereCoordsFromEulers(blockEulers.get(), coords[0].get(), coords[1].get(), coords[2].get());
+
+    auto addFamily = [&](size_t f) { m_Lambert->addCoords(xyz[f].data(), xyz[f].size() / 3, m_Squares[f].data(), m_Squares[f].data() + squareSize, value); };
+#ifdef EbsdLib_USE_PARALLEL_ALGORITHMS
+    bool doParallel = true;
+    if(doParallel)
+    {
+      std::shared_ptr<tbb::task_group> g(new tbb::task_group);
+      g->run([&]() { addFamily(0); });
+      g->run([&]() { addFamily(1); });
+      g->run([&]() { addFamily(2); });
+      g->wait(); // Wait for all the threads to complete before moving on.
+    }
+    else
+#endif
+    {
+      addFamily(0);
+      addFamily(1);
+      addFamily(2);
+    }
+  }
+
+  m_ODF.addOrientations(eulers, numOrientations, static_cast<float>(value), m_ODFSigma);
+  m_NumOrientations += (value > 0.0 ? 1 : -1) * static_cast<int64_t>(numOrientations);
+}
+
+// -----------------------------------------------------------------------------
+bool TextureAccumulator::merge(const TextureAccumulator& other)
+{
+  if(other.m_Ops.getNameOfClass() != m_Ops.getNameOfClass() || other.m_LambertDim != m_LambertDim || other.m_ODFSigma != m_ODFSigma)
+  {
+    return false;
+  }
+  for(size_t f = 0; f < 3; f++)
+  {
+    std::transform(other.m_Squares[f].begin(), other.m_Squares[f].end(), m_Squares[f].begin(), m_Squares[f].begin(), std::plus<>());
+  }
+  m_ODF.merge(other.m_ODF);
+  m_NumOrientations += other.m_NumOrientations;
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+void TextureAccumulator::clear()
+{
+  const size_t squareSize = static_cast<size_t>(m_LambertDim) * static_cast<size_t>(m_LambertDim);
+  for(auto& squares : m_Squares)
+  {
+    squares.assign(2 * squareSize, 0.0);
+  }
+  m_ODF.clear();
+  m_NumOrientations = 0;
+}
+
+// -----------------------------------------------------------------------------
+int64_t TextureAccumulator::getNumberOfOrientations() const
+{
+  return m_NumOrientations;
+}
+
+// -----------------------------------------------------------------------------
+int TextureAccumulator::getLambertDimension() const
+{
+  return m_LambertDim;
+}
+
+// -----------------------------------------------------------------------------
+float TextureAccumulator::getODFSigma() const
+{
+  return m_ODFSigma;
+}
+
+// -----------------------------------------------------------------------------
+std::array<EbsdLib::DoubleArrayType::Pointer, 3> TextureAccumulator::getIntensities(int imageDim, const std::array<std::string, 3>& names) const
+{
+  const size_t squareSize = static_cast<size_t>(m_LambertDim) * static_cast<size_t>(m_LambertDim);
+  std::array<EbsdLib::DoubleArrayType::Pointer, 3> intensities;
+  ModifiedLambertProjection::Pointer lambert = ModifiedLambertProjection::New();
+  lambert->initializeSquares(m_LambertDim, 1.0f);
+  for(size_t f = 0; f < 3; f++)
+  {
+    intensities[f] = EbsdLib::DoubleArrayType::CreateArray(static_cast<size_t>(imageDim) * static_cast<size_t>(imageDim), names[f], true);
+    intensities[f]->initializeWithZeros();
+    if(m_NumOrientations <= 0)
+    {
+      continue;
+    }
+    std::copy(m_Squares[f].begin(), m_Squares[f].begin() + squareSize, lambert->getNorthSquare()->begin());
+    std::copy(m_Squares[f].begin() + squareSize, m_Squares[f].end(), lambert->getSouthSquare()->begin());
+    lambert->normalizeSquaresToMRD();
+    lambert->createStereographicProjection(imageDim, *intensities[f]);
+  }
+  return intensities;
+}
+
+// -----------------------------------------------------------------------------
+std::vector<EbsdLib::UInt8ArrayType::Pointer> TextureAccumulator::snapshot(PoleFigureConfiguration_t& config) const
+{
+  std::array<std::string, 3> labels = m_Ops.getDefaultPoleFigureNames();
+  for(size_t i = 0; i < config.labels.size() && i < labels.size(); i++)
+  {
+    labels[i] = config.labels[i];
+  }
+
+  std::array<EbsdLib::DoubleArrayType::Pointer, 3> intensities = getIntensities(config.imageDim, {labels[0] + "_Intensity_Image", labels[1] + "_Intensity_Image", labels[2] + "_Intensity_Image"});
+
+  // Find the Max and Min values based on ALL 3 arrays so we can color scale them all the same
+  double max = std::numeric_limits<double>::min();
+  double min = std::numeric_limits<double>::max();
+  for(const auto& intensity : intensities)
+  {
+    const double* dPtr = intensity->getPointer(0);
+    const auto minMax = std::minmax_element(dPtr, dPtr + intensity->getNumberOfTuples());
+    min = std::min(min, *minMax.first);
+    max = std::max(max, *minMax.second);
+  }
+  config.minScale = min;
+  config.maxScale = max;
+
+  std::vector<size_t> dims(1, 4);
+  std::vector<EbsdLib::UInt8ArrayType::Pointer> poleFigures(3);
+  for(size_t f = 0; f < 3; f++)
+  {
+    EbsdLib::UInt8ArrayType::Pointer image = EbsdLib::UInt8ArrayType::CreateArray(static_cast<size_t>(config.imageDim * config.imageDim), dims, labels[f], true);
+    PoleFigureUtilities::CreateColorImage(intensities[f].get(), config, image.get());
+    poleFigures[config.order.size() == 3 ? static_cast<size_t>(config.order[f]) : f] = image;
+  }
+  return poleFigures;
+}
+
+// -----------------------------------------------------------------------------
+std::vector<float> TextureAccumulator::getODF(bool normalize) const
+{
+  return m_ODF.getODF(normalize);
+}
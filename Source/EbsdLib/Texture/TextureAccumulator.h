@@ -0,0 +1,145 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "EbsdLib/Core/EbsdDataArray.hpp"
+#include "EbsdLib/EbsdLib.h"
+#include "EbsdLib/Texture/ODFBuilder.h"
+#include "EbsdLib/Utilities/ModifiedLambertProjection.h"
+#include "EbsdLib/Utilities/PoleFigureUtilities.h"
+
+class LaueOps;
+
+/**
+ * @brief The TextureAccumulator class keeps running pole figure and ODF totals for orientations
+ * that arrive over time, such as the rows of a scan that is still being acquired. Each of the
+ * three pole figure families is held as a pair of Modified Lambert squares and the ODF as an
+ * ODFBuilder, so adding or removing orientations only costs time for those orientations.
+ * Accumulators that use the same Laue class and dimensions can be merged which lets separate
+ * workers or slices each fill their own accumulator. The LaueOps instance must outlive the accumulator.
+ */
+class EbsdLib_EXPORT TextureAccumulator
+{
+public:
+  /**
+   * @param ops The Laue class of the orientations
+   * @param lambertDim The dimension of the Modified Lambert squares
+   * @param odfSigma The kernel radius (in ODF bins) each orientation is spread over in the ODF
+   */
+  TextureAccumulator(const LaueOps& ops, int lambertDim, float odfSigma);
+  ~TextureAccumulator() = default;
+
+  /**
+   * @brief Adds orientations to the pole figures and the ODF
+   * @param eulers Euler angles in Radians, 3 values per orientation
+   * @param numOrientations The number of orientations
+   */
+  void add(const float* eulers, size_t numOrientations);
+
+  /**
+   * @brief Removes orientations that were previously added
+   * @param eulers Euler angles in Radians, 3 values per orientation
+   * @param numOrientations The number of orientations
+   */
+  void remove(const float* eulers, size_t numOrientations);
+
+  /**
+   * @brief Adds the totals of another accumulator
+   * @param other The accumulator to add
+   * @return false if the other accumulator uses a different Laue class, Lambert dimension or ODF sigma. Nothing is merged in that case.
+   */
+  bool merge(const TextureAccumulator& other);
+
+  /**
+   * @brief Removes all the orientations
+   */
+  void clear();
+
+  /**
+   * @brief Returns the number of orientations currently held
+   */
+  int64_t getNumberOfOrientations() const;
+
+  int getLambertDimension() const;
+  float getODFSigma() const;
+
+  /**
+   * @brief Computes the stereographic intensity image of each pole figure family from the current
+   * Lambert squares, normalized to multiples of random. The images are zero when the accumulator is empty.
+   * @param imageDim The width and height of the images
+   * @param names The names of the 3 intensity arrays
+   */
+  std::array<EbsdLib::DoubleArrayType::Pointer, 3> getIntensities(int imageDim, const std::array<std::string, 3>& names) const;
+
+  /**
+   * @brief Creates the color pole figure images of the current orientations the same way
+   * LaueOps::generatePoleFigure() does, using one color scale for all three images.
+   * @param config The imageDim, numColors, labels and order members are used. The
+   * minScale and maxScale members are set to the range of the intensities.
+   * @return The 3 RGBA images
+   */
+  std::vector<EbsdLib::UInt8ArrayType::Pointer> snapshot(PoleFigureConfiguration_t& config) const;
+
+  /**
+   * @brief Computes the ODF of the current orientations. See ODFBuilder::getODF().
+   * @param normalize Should the ODF be normalized so that it sums to one
+   */
+  std::vector<float> getODF(bool normalize) const;
+
+private:
+  const LaueOps& m_Ops;
+  int m_LambertDim = 0;
+  float m_ODFSigma = 0.0f;
+  int64_t m_NumOrientations = 0;
+
+  ModifiedLambertProjection::Pointer m_Lambert;
+  std::array<std::vector<double>, 3> m_Squares; // North square followed by the South square of each family
+  ODFBuilder m_ODF;
+
+  void accumulate(const float* eulers, size_t numOrientations, double value);
+
+public:
+  TextureAccumulator(const TextureAccumulator&) = delete;            // Copy Constructor Not Implemented
+  TextureAccumulator(TextureAccumulator&&) = delete;                 // Move Constructor Not Implemented
+  TextureAccumulator& operator=(const TextureAccumulator&) = delete; // Copy Assignment Not Implemented
+  TextureAccumulator& operator=(TextureAccumulator&&) = delete;      // Move Assignment Not Implemented
+};
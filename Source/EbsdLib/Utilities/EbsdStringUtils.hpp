@@ -33,6 +33,10 @@
 
 #include <array>
 #include <cctype>
+#include <charconv>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
 #include <regex>
 #include <sstream>
 #include <string>
@@ -218,4 +222,81 @@ inline std::string simplified(const std::string& text)
   return finalString;
 }
 
+/**
+ * @brief Returns true if the character is one of the white space characters that separate
+ * values on a line of data. The newline character is NOT included as it terminates a line.
+ */
+inline bool isBlank(char c)
+{
+  return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+/**
+ * @brief Parses a float value from the character range [first, last) without allocating any memory.
+ * Like std::stof() a valid leading portion of the range is accepted.
+ * @param first The first character of the token
+ * @param last One past the last character of the token
+ * @param value The parsed value. Only modified on success.
+ * @return true if a value was parsed
+ */
+inline bool parseValue(const char* first, const char* last, float& value)
+{
+  if(first != last && *first == '+')
+  {
+    ++first;
+  }
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+  float temp = 0.0f;
+  std::from_chars_result result = std::from_chars(first, last, temp);
+  if(result.ec != std::errc() || result.ptr == first)
+  {
+    return false;
+  }
+  value = temp;
+  return true;
+#else
+  // This standard library does not have the floating point overloads of std::from_chars so
+  // copy the token into a small buffer so that it is NULL terminated and use strtof().
+  std::array<char, 64> buffer = {};
+  size_t length = static_cast<size_t>(last - first);
+  if(length == 0 || length >= buffer.size())
+  {
+    return false;
+  }
+  std::memcpy(buffer.data(), first, length);
+  char* end = nullptr;
+  float temp = std::strtof(buffer.data(), &end);
+  if(end == buffer.data())
+  {
+    return false;
+  }
+  value = temp;
+  return true;
+#endif
+}
+
+/**
+ * @brief Parses an int32_t value from the character range [first, last) without allocating any memory.
+ * Like std::stoi() a valid leading portion of the range is accepted.
+ * @param first The first character of the token
+ * @param last One past the last character of the token
+ * @param value The parsed value. Only modified on success.
+ * @return true if a value was parsed
+ */
+inline bool parseValue(const char* first, const char* last, int32_t& value)
+{
+  if(first != last && *first == '+')
+  {
+    ++first;
+  }
+  int32_t temp = 0;
+  std::from_chars_result result = std::from_chars(first, last, temp);
+  if(result.ec != std::errc() || result.ptr == first)
+  {
+    return false;
+  }
+  value = temp;
+  return true;
+}
+
 } // namespace EbsdStringUtils
@@ -0,0 +1,307 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "MemoryMappedFile.h"
+
+#include <algorithm>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// -----------------------------------------------------------------------------
+MemoryMappedFile::MemoryMappedFile() = default;
+
+// -----------------------------------------------------------------------------
+MemoryMappedFile::~MemoryMappedFile()
+{
+  close();
+}
+
+// -----------------------------------------------------------------------------
+bool MemoryMappedFile::open(const std::string& filePath)
+{
+  close();
+#if defined(_WIN32)
+  HANDLE fileHandle = CreateFileW(fs::path(filePath).wstring().c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+  if(fileHandle == INVALID_HANDLE_VALUE)
+  {
+    return false;
+  }
+  LARGE_INTEGER fileSize;
+  if(GetFileSizeEx(fileHandle, &fileSize) == 0 || fileSize.QuadPart == 0)
+  {
+    CloseHandle(fileHandle);
+    return false;
+  }
+  HANDLE mappingHandle = CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if(mappingHandle == nullptr)
+  {
+    CloseHandle(fileHandle);
+    return false;
+  }
+  void* view = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+  if(view == nullptr)
+  {
+    CloseHandle(mappingHandle);
+    CloseHandle(fileHandle);
+    return false;
+  }
+  m_FileHandle = fileHandle;
+  m_MappingHandle = mappingHandle;
+  m_Data = static_cast<char*>(view);
+  m_Size = static_cast<size_t>(fileSize.QuadPart);
+#else
+  int fd = ::open(filePath.c_str(), O_RDONLY);
+  if(fd < 0)
+  {
+    return false;
+  }
+  struct stat fileInfo = {};
+  // mmap() will not map a zero length file so those are reported as a failure
+  if(::fstat(fd, &fileInfo) != 0 || fileInfo.st_size <= 0)
+  {
+    ::close(fd);
+    return false;
+  }
+  void* view = ::mmap(nullptr, static_cast<size_t>(fileInfo.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+  if(view == MAP_FAILED)
+  {
+    ::close(fd);
+    return false;
+  }
+  // The ASCII readers walk the file front to back so let the kernel read ahead aggressively
+  ::madvise(view, static_cast<size_t>(fileInfo.st_size), MADV_SEQUENTIAL);
+  m_FileDescriptor = fd;
+  m_Data = static_cast<char*>(view);
+  m_Size = static_cast<size_t>(fileInfo.st_size);
+#endif
+  m_MapBase = m_Data;
+  m_MapLength = m_Size;
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+bool MemoryMappedFile::openRegion(const std::string& filePath, size_t offset, size_t length, Access access)
+{
+  close();
+  bool readWrite = (access == Access::ReadWrite);
+#if defined(_WIN32)
+  DWORD desiredAccess = readWrite ? (GENERIC_READ | GENERIC_WRITE) : GENERIC_READ;
+  DWORD creation = readWrite ? OPEN_ALWAYS : OPEN_EXISTING;
+  HANDLE fileHandle = CreateFileW(fs::path(filePath).wstring().c_str(), desiredAccess, FILE_SHARE_READ, nullptr, creation, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if(fileHandle == INVALID_HANDLE_VALUE)
+  {
+    return false;
+  }
+  LARGE_INTEGER fileSize;
+  if(GetFileSizeEx(fileHandle, &fileSize) == 0)
+  {
+    CloseHandle(fileHandle);
+    return false;
+  }
+  size_t fileBytes = static_cast<size_t>(fileSize.QuadPart);
+#else
+  int fd = readWrite ? ::open(filePath.c_str(), O_RDWR | O_CREAT, 0644) : ::open(filePath.c_str(), O_RDONLY);
+  if(fd < 0)
+  {
+    return false;
+  }
+  struct stat fileInfo = {};
+  if(::fstat(fd, &fileInfo) != 0)
+  {
+    ::close(fd);
+    return false;
+  }
+  size_t fileBytes = static_cast<size_t>(fileInfo.st_size);
+#endif
+
+  if(length == 0)
+  {
+    length = (offset < fileBytes) ? fileBytes - offset : 0;
+  }
+  // Regions past the end of the file can only be created when the file is writable
+  bool valid = length != 0 && (offset + length <= fileBytes || readWrite);
+
+#if defined(_WIN32)
+  SYSTEM_INFO systemInfo;
+  GetSystemInfo(&systemInfo);
+  size_t granularity = static_cast<size_t>(systemInfo.dwAllocationGranularity);
+  size_t mapOffset = offset / granularity * granularity;
+  size_t mapLength = length + (offset - mapOffset);
+  // A read/write mapping that is larger than the file extends the file
+  uint64_t mappingSize = readWrite ? static_cast<uint64_t>(std::max(fileBytes, offset + length)) : 0;
+  HANDLE mappingHandle = nullptr;
+  if(valid)
+  {
+    mappingHandle = CreateFileMappingW(fileHandle, nullptr, readWrite ? PAGE_READWRITE : PAGE_WRITECOPY, static_cast<DWORD>(mappingSize >> 32), static_cast<DWORD>(mappingSize & 0xFFFFFFFF), nullptr);
+  }
+  if(mappingHandle == nullptr)
+  {
+    CloseHandle(fileHandle);
+    return false;
+  }
+  uint64_t viewOffset = static_cast<uint64_t>(mapOffset);
+  void* view = MapViewOfFile(mappingHandle, readWrite ? FILE_MAP_WRITE : FILE_MAP_COPY, static_cast<DWORD>(viewOffset >> 32), static_cast<DWORD>(viewOffset & 0xFFFFFFFF), mapLength);
+  if(view == nullptr)
+  {
+    CloseHandle(mappingHandle);
+    CloseHandle(fileHandle);
+    return false;
+  }
+  m_FileHandle = fileHandle;
+  m_MappingHandle = mappingHandle;
+#else
+  if(valid && offset + length > fileBytes)
+  {
+    // The new part of the file reads as zeros and does not use any disk space until it is written
+    valid = ::ftruncate(fd, static_cast<off_t>(offset + length)) == 0;
+  }
+  if(!valid)
+  {
+    ::close(fd);
+    return false;
+  }
+  size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  size_t mapOffset = offset / pageSize * pageSize;
+  size_t mapLength = length + (offset - mapOffset);
+  void* view = ::mmap(nullptr, mapLength, PROT_READ | PROT_WRITE, readWrite ? MAP_SHARED : MAP_PRIVATE, fd, static_cast<off_t>(mapOffset));
+  if(view == MAP_FAILED)
+  {
+    ::close(fd);
+    return false;
+  }
+  m_FileDescriptor = fd;
+#endif
+  m_MapBase = static_cast<char*>(view);
+  m_MapLength = mapLength;
+  m_Data = m_MapBase + (offset - mapOffset);
+  m_Size = length;
+  m_Writable = true;
+  m_Access = access;
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+bool MemoryMappedFile::flush()
+{
+  if(m_MapBase == nullptr || !m_Writable || m_Access != Access::ReadWrite)
+  {
+    return true;
+  }
+#if defined(_WIN32)
+  return FlushViewOfFile(m_MapBase, m_MapLength) != 0 && FlushFileBuffers(m_FileHandle) != 0;
+#else
+  return ::msync(m_MapBase, m_MapLength, MS_SYNC) == 0;
+#endif
+}
+
+// -----------------------------------------------------------------------------
+void MemoryMappedFile::close()
+{
+#if defined(_WIN32)
+  if(m_MapBase != nullptr)
+  {
+    UnmapViewOfFile(m_MapBase);
+  }
+  if(m_MappingHandle != nullptr)
+  {
+    CloseHandle(m_MappingHandle);
+  }
+  if(m_FileHandle != nullptr)
+  {
+    CloseHandle(m_FileHandle);
+  }
+  m_MappingHandle = nullptr;
+  m_FileHandle = nullptr;
+#else
+  if(m_MapBase != nullptr)
+  {
+    ::munmap(m_MapBase, m_MapLength);
+  }
+  if(m_FileDescriptor >= 0)
+  {
+    ::close(m_FileDescriptor);
+  }
+  m_FileDescriptor = -1;
+#endif
+  m_Data = nullptr;
+  m_Size = 0;
+  m_MapBase = nullptr;
+  m_MapLength = 0;
+  m_Writable = false;
+  m_Access = Access::CopyOnWrite;
+}
+
+// -----------------------------------------------------------------------------
+bool MemoryMappedFile::isOpen() const
+{
+  return m_Data != nullptr;
+}
+
+// -----------------------------------------------------------------------------
+const char* MemoryMappedFile::data() const
+{
+  return m_Data;
+}
+
+// -----------------------------------------------------------------------------
+char* MemoryMappedFile::writableData() const
+{
+  return m_Writable ? m_Data : nullptr;
+}
+
+// -----------------------------------------------------------------------------
+size_t MemoryMappedFile::size() const
+{
+  return m_Size;
+}
+
+// -----------------------------------------------------------------------------
+MemoryMappedFile::Access MemoryMappedFile::access() const
+{
+  return m_Access;
+}
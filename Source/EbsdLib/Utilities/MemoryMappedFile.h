@@ -0,0 +1,144 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "EbsdLib/EbsdLib.h"
+
+/**
+ * @class MemoryMappedFile MemoryMappedFile.h EbsdLib/Utilities/MemoryMappedFile.h
+ * @brief This class maps the complete contents of a file into the address space of the
+ * process as read-only memory. The operating system pages the contents in on demand
+ * which allows the ASCII readers to tokenize the file in place without first copying
+ * each line into a std::string. The mapping is released when the object goes out of scope.
+ *
+ * openRegion() maps part of a file as writable storage for a data array (see EbsdDataArray::MapFile()) so that
+ * arrays larger than the physical memory are paged in and out by the operating system.
+ */
+class EbsdLib_EXPORT MemoryMappedFile
+{
+public:
+  MemoryMappedFile();
+  ~MemoryMappedFile();
+
+  /**
+   * @brief How openRegion() maps the file
+   */
+  enum class Access : uint8_t
+  {
+    CopyOnWrite = 0, //!< The memory is writable but the changes never reach the file
+    ReadWrite = 1    //!< Changes are written back to the file
+  };
+
+  /**
+   * @brief Maps the file at the given path into memory. Any previously mapped file is closed first.
+   * @param filePath The path to the file
+   * @return true if the file was opened and mapped.
+   */
+  bool open(const std::string& filePath);
+
+  /**
+   * @brief Maps length bytes of a file starting at offset. Nothing is read until a page is first accessed. With
+   * ReadWrite access the file is created if needed and extended with zeros when it is shorter than
+   * offset + length. Any previously mapped file is closed first.
+   * @param filePath The path to the file
+   * @param offset Byte offset of the region in the file, it does not need to be page aligned
+   * @param length Number of bytes to map. 0 maps from offset to the end of the file.
+   * @param access
+   * @return true if the region was mapped.
+   */
+  bool openRegion(const std::string& filePath, size_t offset, size_t length, Access access);
+
+  /**
+   * @brief Writes the modified pages of a ReadWrite region to the file and waits until they are stored.
+   * @return true on success or if there is nothing to write
+   */
+  bool flush();
+
+  /**
+   * @brief Unmaps the file and closes any underlying file handles.
+   */
+  void close();
+
+  /**
+   * @brief Returns true if a file is currently mapped.
+   */
+  bool isOpen() const;
+
+  /**
+   * @brief Returns a pointer to the first byte of the mapped file or nullptr if nothing is mapped.
+   */
+  const char* data() const;
+
+  /**
+   * @brief Returns a writable pointer to the first byte of a region mapped with openRegion() or nullptr if the
+   * file was mapped read-only with open().
+   */
+  char* writableData() const;
+
+  /**
+   * @brief Returns the number of bytes that are mapped.
+   */
+  size_t size() const;
+
+  /**
+   * @brief Returns the access of a region mapped with openRegion()
+   */
+  Access access() const;
+
+private:
+  char* m_Data = nullptr;
+  size_t m_Size = 0;
+  char* m_MapBase = nullptr; // The mapping starts on a page boundary at or before m_Data
+  size_t m_MapLength = 0;
+  bool m_Writable = false;
+  Access m_Access = Access::CopyOnWrite;
+#if defined(_WIN32)
+  void* m_FileHandle = nullptr;
+  void* m_MappingHandle = nullptr;
+#else
+  int m_FileDescriptor = -1;
+#endif
+
+public:
+  MemoryMappedFile(const MemoryMappedFile&) = delete;            // Copy Constructor Not Implemented
+  MemoryMappedFile(MemoryMappedFile&&) = delete;                 // Move Constructor Not Implemented
+  MemoryMappedFile& operator=(const MemoryMappedFile&) = delete; // Copy Assignment Not Implemented
+  MemoryMappedFile& operator=(MemoryMappedFile&&) = delete;      // Move Assignment Not Implemented
+};
@@ -35,10 +35,19 @@
 
 #include "ModifiedLambertProjection.h"
 
+#include <algorithm>
 #include <array>
 
+#ifdef EbsdLib_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#endif
+
 #include "EbsdLib/Core/EbsdMacros.h"
 #include "EbsdLib/Math/EbsdLibMath.h"
+#include "EbsdLib/Utilities/StereographicLambertTable.h"
 
 #define WRITE_LAMBERT_SQUARE_COORD_VTK 0
 
@@ -58,6 +67,89 @@ double calcInterpolatedValue(const ModifiedLambertProjection& self, const std::a
     return self.getInterpolatedValue(ModifiedLambertProjection::Square::SouthSquare, sqCoord.data());
   }
 };
+
+/**
+ * @brief The number of coordinates whose square coordinates are computed together before they are accumulated
+ */
+constexpr size_t k_CoordBlockSize = 2048;
+
+/**
+ * @brief Computes the Lambert square coordinate of a single point. Both branches of the
+ * projection are evaluated and selected afterwards so loops over this function carry no
+ * data dependent branches.
+ */
+inline bool calcSquareCoord(float x, float y, float z, float sphereRadius, float maxCoord, float& sqCoord0, float& sqCoord1)
+{
+  const bool nhCheck = (z >= 0.0f);
+  const float adjust = nhCheck ? -1.0f : 1.0f;
+  const bool useX = (std::fabs(x) >= std::fabs(y));
+  const float numerator = useX ? y : x;
+  const float denominator = useX ? x : y;
+  const float sign = denominator / std::fabs(denominator);
+  const double radius = std::sqrt(2.0 * sphereRadius * (sphereRadius + (z * adjust)));
+  const double halfCoord = sign * radius * EbsdLib::Constants::k_HalfOfSqrtPiD;
+  const double angleCoord = sign * radius * ((EbsdLib::Constants::k_2OverSqrtPiD)*std::atan(numerator / denominator));
+  const bool atPole = (x == 0 && y == 0);
+  float coord0 = atPole ? 0.0f : static_cast<float>(useX ? halfCoord : angleCoord);
+  float coord1 = atPole ? 0.0f : static_cast<float>(useX ? angleCoord : halfCoord);
+  sqCoord0 = (coord0 >= maxCoord) ? maxCoord - 0.0001f : coord0;
+  sqCoord1 = (coord1 >= maxCoord) ? maxCoord - 0.0001f : coord1;
+  return nhCheck;
+}
+
+/**
+ * @brief Computes the square coordinates of a block of points and adds them into the north and
+ * south squares
+ */
+void accumulateBlock(const ModifiedLambertProjection& projection, const float* xyz, size_t numCoords, double* northSquare, double* southSquare, double value = 1.0)
+{
+  std::array<float, 2 * k_CoordBlockSize> sqCoords;
+  std::array<uint8_t, k_CoordBlockSize> northern;
+  for(size_t start = 0; start < numCoords; start += k_CoordBlockSize)
+  {
+    const size_t count = std::min(k_CoordBlockSize, numCoords - start);
+    projection.getSquareCoords(xyz + start * 3, count, sqCoords.data(), northern.data());
+    for(size_t i = 0; i < count; i++)
+    {
+      projection.addInterpolatedValues(northern[i] != 0 ? northSquare : southSquare, sqCoords.data() + i * 2, value);
+    }
+  }
+}
+
+#ifdef EbsdLib_USE_PARALLEL_ALGORITHMS
+using ThreadSquares = tbb::enumerable_thread_specific<std::vector<double>>;
+
+/**
+ * @brief The LambertBallToSquareImpl class accumulates a range of points into a pair of squares
+ * that are private to the executing thread
+ */
+class LambertBallToSquareImpl
+{
+  const ModifiedLambertProjection& m_Projection;
+  const float* m_XYZ;
+  ThreadSquares& m_Squares;
+
+public:
+  LambertBallToSquareImpl(const ModifiedLambertProjection& projection, const float* xyz, ThreadSquares& squares)
+  : m_Projection(projection)
+  , m_XYZ(xyz)
+  , m_Squares(squares)
+  {
+  }
+  virtual ~LambertBallToSquareImpl() = default;
+
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    const size_t squareSize = static_cast<size_t>(m_Projection.getDimension()) * static_cast<size_t>(m_Projection.getDimension());
+    std::vector<double>& squares = m_Squares.local();
+    if(squares.empty())
+    {
+      squares.resize(2 * squareSize, 0.0);
+    }
+    accumulateBlock(m_Projection, m_XYZ + r.begin() * 3, r.end() - r.begin(), squares.data(), squares.data() + squareSize);
+  }
+};
+#endif
 } // namespace
 
 // -----------------------------------------------------------------------------
@@ -84,9 +176,6 @@ ModifiedLambertProjection::Pointer ModifiedLambertProjection::LambertBallToSquar
 {
 
   size_t npoints = coords->getNumberOfTuples();
-  bool nhCheck = false;
-  float sqCoord[2];
-  // int sqIndex = 0;
   ModifiedLambertProjection::Pointer squareProj = ModifiedLambertProjection::New();
   squareProj->initializeSquares(dimension, sphereRadius);
 
@@ -110,33 +199,47 @@ ModifiedLambertProjection::Pointer ModifiedLambertProjection::LambertBallToSquar
   fprintf(f, "\n");
 
   fprintf(f, "DATASET UNSTRUCTURED_GRID\nPOINTS %lu float\n", coords->getNumberOfTuples());
+  bool nhCheck = false;
+  float sqCoord[2];
 #endif
 
+#if WRITE_LAMBERT_SQUARE_COORD_VTK
   for(size_t i = 0; i < npoints; ++i)
   {
     sqCoord[0] = 0.0;
     sqCoord[1] = 0.0;
     // get coordinates in square projection of crystal normal parallel to boundary normal
     nhCheck = squareProj->getSquareCoord(coords->getPointer(i * 3), sqCoord);
-#if WRITE_LAMBERT_SQUARE_COORD_VTK
     fprintf(f, "%f %f 0\n", sqCoord[0], sqCoord[1]);
-#endif
-
-    // Based on the XY coordinate, get the pointer index that the value corresponds to in the proper square
-    //    sqIndex = squareProj->getSquareIndex(sqCoord);
-    if(nhCheck)
+    squareProj->addInterpolatedValues(nhCheck ? ModifiedLambertProjection::NorthSquare : ModifiedLambertProjection::SouthSquare, sqCoord, 1.0);
+  }
+#else
+  const float* xyz = coords->getPointer(0);
+  double* northSquare = squareProj->getNorthSquare()->getPointer(0);
+  double* southSquare = squareProj->getSouthSquare()->getPointer(0);
+#ifdef EbsdLib_USE_PARALLEL_ALGORITHMS
+  // Every thread accumulates into its own pair of squares which are summed at the end
+  bool doParallel = (npoints > 2 * k_CoordBlockSize);
+  if(doParallel)
+  {
+    ThreadSquares threadSquares;
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, npoints, k_CoordBlockSize), LambertBallToSquareImpl(*squareProj, xyz, threadSquares), tbb::auto_partitioner());
+    const size_t squareSize = static_cast<size_t>(dimension) * static_cast<size_t>(dimension);
+    for(const auto& squares : threadSquares)
     {
-      // north increment by 1
-      //      squareProj->addValue(ModifiedLambertProjection::NorthSquare, sqIndex, 1.0);
-      squareProj->addInterpolatedValues(ModifiedLambertProjection::NorthSquare, sqCoord, 1.0);
-    }
-    else
-    {
-      // south increment by 1
-      //      squareProj->addValue(ModifiedLambertProjection::SouthSquare, sqIndex, 1.0);
-      squareProj->addInterpolatedValues(ModifiedLambertProjection::SouthSquare, sqCoord, 1.0);
+      for(size_t i = 0; i < squareSize; i++)
+      {
+        northSquare[i] += squares[i];
+        southSquare[i] += squares[squareSize + i];
+      }
     }
   }
+  else
+#endif
+  {
+    accumulateBlock(*squareProj, xyz, npoints, northSquare, southSquare);
+  }
+#endif
 #if WRITE_LAMBERT_SQUARE_COORD_VTK
   fclose(f);
 #endif
@@ -202,94 +305,39 @@ int ModifiedLambertProjection::readHDF5Data(hid_t groupId)
 // -----------------------------------------------------------------------------
 void ModifiedLambertProjection::addInterpolatedValues(Square square, float* sqCoord, double value)
 {
-  int abin1 = 0, bbin1 = 0;
-  int abin2 = 0, bbin2 = 0;
-  int abin3 = 0, bbin3 = 0;
-  int abin4 = 0, bbin4 = 0;
-  int abinSign, bbinSign;
-  float modX = (sqCoord[0] + m_HalfDimensionTimesStepSize) / m_StepSize;
-  float modY = (sqCoord[1] + m_HalfDimensionTimesStepSize) / m_StepSize;
-  int abin = (int)modX;
-  int bbin = (int)modY;
-  modX -= abin;
-  modY -= bbin;
-  modX -= 0.5;
-  modY -= 0.5;
-  if(modX == 0.0)
-  {
-    abinSign = 1;
-  }
-  else
-  {
-    abinSign = static_cast<int>(modX / std::fabs(modX));
-  }
-  if(modY == 0.0)
-  {
-    bbinSign = 1;
-  }
-  else
-  {
-    bbinSign = static_cast<int>(modY / std::fabs(modY));
-  }
-  abin1 = abin;
-  bbin1 = bbin;
-  abin2 = abin + abinSign;
-  bbin2 = bbin;
-  if(abin2 < 0 || abin2 > m_Dimension - 1)
-  {
-    abin2 = abin2 - (abinSign * m_Dimension), bbin2 = m_Dimension - bbin2 - 1;
-  }
-  abin3 = abin;
-  bbin3 = bbin + bbinSign;
-  if(bbin3 < 0 || bbin3 > m_Dimension - 1)
-  {
-    abin3 = m_Dimension - abin3 - 1, bbin3 = bbin3 - (bbinSign * m_Dimension);
-  }
-  abin4 = abin + abinSign;
-  bbin4 = bbin + bbinSign;
-  if((abin4 < 0 || abin4 > m_Dimension - 1) && (bbin4 >= 0 && bbin4 <= m_Dimension - 1))
-  {
-    abin4 = abin4 - (abinSign * m_Dimension), bbin4 = m_Dimension - bbin4 - 1;
-  }
-  else if((abin4 >= 0 && abin4 <= m_Dimension - 1) && (bbin4 < 0 || bbin4 > m_Dimension - 1))
-  {
-    abin4 = m_Dimension - abin4 - 1, bbin4 = bbin4 - (bbinSign * m_Dimension);
-  }
-  else if((abin4 < 0 || abin4 > m_Dimension - 1) && (bbin4 < 0 || bbin4 > m_Dimension - 1))
-  {
-    abin4 = abin4 - (abinSign * m_Dimension), bbin4 = bbin4 - (bbinSign * m_Dimension);
-  }
-  modX = fabs(modX);
-  modY = fabs(modY);
-
-  int index1 = bbin1 * m_Dimension + abin1;
-  int index2 = bbin2 * m_Dimension + abin2;
-  int index3 = bbin3 * m_Dimension + abin3;
-  int index4 = bbin4 * m_Dimension + abin4;
   if(square == NorthSquare)
   {
-    double v1 = m_NorthSquare->getValue(index1) + value * (1.0 - modX) * (1.0 - modY);
-    double v2 = m_NorthSquare->getValue(index2) + value * (modX) * (1.0 - modY);
-    double v3 = m_NorthSquare->getValue(index3) + value * (1.0 - modX) * (modY);
-    double v4 = m_NorthSquare->getValue(index4) + value * (modX) * (modY);
-    m_NorthSquare->setValue(index1, v1);
-    m_NorthSquare->setValue(index2, v2);
-    m_NorthSquare->setValue(index3, v3);
-    m_NorthSquare->setValue(index4, v4);
+    addInterpolatedValues(m_NorthSquare->getPointer(0), sqCoord, value);
   }
   else
   {
-    double v1 = m_SouthSquare->getValue(index1) + value * (1.0 - modX) * (1.0 - modY);
-    double v2 = m_SouthSquare->getValue(index2) + value * (modX) * (1.0 - modY);
-    double v3 = m_SouthSquare->getValue(index3) + value * (1.0 - modX) * (modY);
-    double v4 = m_SouthSquare->getValue(index4) + value * (modX) * (modY);
-    m_SouthSquare->setValue(index1, v1);
-    m_SouthSquare->setValue(index2, v2);
-    m_SouthSquare->setValue(index3, v3);
-    m_SouthSquare->setValue(index4, v4);
+    addInterpolatedValues(m_SouthSquare->getPointer(0), sqCoord, value);
   }
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ModifiedLambertProjection::addInterpolatedValues(double* squareData, const float* sqCoord, double value) const
+{
+  std::array<int32_t, 4> indices = {0, 0, 0, 0};
+  float modX = 0.0f;
+  float modY = 0.0f;
+  getInterpolationCells(sqCoord, indices, modX, modY);
+  squareData[indices[0]] += value * (1.0 - modX) * (1.0 - modY);
+  squareData[indices[1]] += value * (modX) * (1.0 - modY);
+  squareData[indices[2]] += value * (1.0 - modX) * (modY);
+  squareData[indices[3]] += value * (modX) * (modY);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ModifiedLambertProjection::addCoords(const float* xyz, size_t numCoords, double* northSquare, double* southSquare, double value) const
+{
+  accumulateBlock(*this, xyz, numCoords, northSquare, southSquare, value);
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -338,16 +386,15 @@ double ModifiedLambertProjection::getValue(Square square, int index)
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-double ModifiedLambertProjection::getInterpolatedValue(Square square, const float* sqCoord) const
+void ModifiedLambertProjection::getInterpolationCells(const float* sqCoord, std::array<int32_t, 4>& indices, float& modX, float& modY) const
 {
-  // float sqCoord[2] = { sqCoord0[0] - 0.5*m_StepSize, sqCoord0[1] - 0.5*m_StepSize};
   int abin1, bbin1;
   int abin2, bbin2;
   int abin3, bbin3;
   int abin4, bbin4;
   int abinSign, bbinSign;
-  float modX = (sqCoord[0] + m_HalfDimensionTimesStepSize) / m_StepSize;
-  float modY = (sqCoord[1] + m_HalfDimensionTimesStepSize) / m_StepSize;
+  modX = (sqCoord[0] + m_HalfDimensionTimesStepSize) / m_StepSize;
+  modY = (sqCoord[1] + m_HalfDimensionTimesStepSize) / m_StepSize;
   int abin = (int)modX;
   int bbin = (int)modY;
   modX -= abin;
@@ -400,20 +447,26 @@ double ModifiedLambertProjection::getInterpolatedValue(Square square, const floa
   }
   modX = fabs(modX);
   modY = fabs(modY);
-  if(square == NorthSquare)
-  {
-    float intensity1 = static_cast<float>(m_NorthSquare->getValue((abin1) + (bbin1 * m_Dimension)));
-    float intensity2 = static_cast<float>(m_NorthSquare->getValue((abin2) + (bbin2 * m_Dimension)));
-    float intensity3 = static_cast<float>(m_NorthSquare->getValue((abin3) + (bbin3 * m_Dimension)));
-    float intensity4 = static_cast<float>(m_NorthSquare->getValue((abin4) + (bbin4 * m_Dimension)));
-    float interpolatedIntensity = ((intensity1 * (1 - modX) * (1 - modY)) + (intensity2 * (modX) * (1 - modY)) + (intensity3 * (1 - modX) * (modY)) + (intensity4 * (modX) * (modY)));
-    return interpolatedIntensity;
-  }
+  indices[0] = bbin1 * m_Dimension + abin1;
+  indices[1] = bbin2 * m_Dimension + abin2;
+  indices[2] = bbin3 * m_Dimension + abin3;
+  indices[3] = bbin4 * m_Dimension + abin4;
+}
 
-  float intensity1 = static_cast<float>(m_SouthSquare->getValue((abin1) + (bbin1 * m_Dimension)));
-  float intensity2 = static_cast<float>(m_SouthSquare->getValue((abin2) + (bbin2 * m_Dimension)));
-  float intensity3 = static_cast<float>(m_SouthSquare->getValue((abin3) + (bbin3 * m_Dimension)));
-  float intensity4 = static_cast<float>(m_SouthSquare->getValue((abin4) + (bbin4 * m_Dimension)));
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double ModifiedLambertProjection::getInterpolatedValue(Square square, const float* sqCoord) const
+{
+  std::array<int32_t, 4> indices = {0, 0, 0, 0};
+  float modX = 0.0f;
+  float modY = 0.0f;
+  getInterpolationCells(sqCoord, indices, modX, modY);
+  const double* squareData = (square == NorthSquare) ? m_NorthSquare->getPointer(0) : m_SouthSquare->getPointer(0);
+  float intensity1 = static_cast<float>(squareData[indices[0]]);
+  float intensity2 = static_cast<float>(squareData[indices[1]]);
+  float intensity3 = static_cast<float>(squareData[indices[2]]);
+  float intensity4 = static_cast<float>(squareData[indices[3]]);
   float interpolatedIntensity = ((intensity1 * (1 - modX) * (1 - modY)) + (intensity2 * (modX) * (1 - modY)) + (intensity3 * (1 - modX) * (modY)) + (intensity4 * (modX) * (modY)));
   return interpolatedIntensity;
 }
@@ -423,41 +476,20 @@ double ModifiedLambertProjection::getInterpolatedValue(Square square, const floa
 // -----------------------------------------------------------------------------
 bool ModifiedLambertProjection::getSquareCoord(const float* xyz, float* sqCoord) const
 {
-  bool nhCheck = false;
-  float adjust = 1.0;
-  if(xyz[2] >= 0.0)
-  {
-    adjust = -1.0;
-    nhCheck = true;
-  }
-  if(xyz[0] == 0 && xyz[1] == 0)
-  {
-    sqCoord[0] = 0.0;
-    sqCoord[1] = 0.0;
-    return nhCheck;
-  }
-  if(std::fabs(xyz[0]) >= std::fabs(xyz[1]))
-  {
-    sqCoord[0] = static_cast<float>((xyz[0] / std::fabs(xyz[0])) * std::sqrt(2.0 * m_SphereRadius * (m_SphereRadius + (xyz[2] * adjust))) * EbsdLib::Constants::k_HalfOfSqrtPiD);
-    sqCoord[1] =
-        static_cast<float>((xyz[0] / std::fabs(xyz[0])) * std::sqrt(2.0 * m_SphereRadius * (m_SphereRadius + (xyz[2] * adjust))) * ((EbsdLib::Constants::k_2OverSqrtPiD)*std::atan(xyz[1] / xyz[0])));
-  }
-  else
-  {
-    sqCoord[0] =
-        static_cast<float>((xyz[1] / std::fabs(xyz[1])) * std::sqrt(2.0 * m_SphereRadius * (m_SphereRadius + (xyz[2] * adjust))) * ((EbsdLib::Constants::k_2OverSqrtPiD)*std::atan(xyz[0] / xyz[1])));
-    sqCoord[1] = static_cast<float>((xyz[1] / std::fabs(xyz[1])) * std::sqrt(2.0 * m_SphereRadius * (m_SphereRadius + (xyz[2] * adjust))) * (EbsdLib::Constants::k_HalfOfSqrtPiD));
-  }
+  return calcSquareCoord(xyz[0], xyz[1], xyz[2], m_SphereRadius, m_MaxCoord, sqCoord[0], sqCoord[1]);
+}
 
-  if(sqCoord[0] >= m_MaxCoord)
-  {
-    sqCoord[0] = m_MaxCoord - 0.0001f;
-  }
-  if(sqCoord[1] >= m_MaxCoord)
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ModifiedLambertProjection::getSquareCoords(const float* xyz, size_t numCoords, float* sqCoords, uint8_t* northern) const
+{
+  const float sphereRadius = m_SphereRadius;
+  const float maxCoord = m_MaxCoord;
+  for(size_t i = 0; i < numCoords; i++)
   {
-    sqCoord[1] = m_MaxCoord - 0.0001f;
+    northern[i] = calcSquareCoord(xyz[i * 3], xyz[i * 3 + 1], xyz[i * 3 + 2], sphereRadius, maxCoord, sqCoords[i * 2], sqCoords[i * 2 + 1]) ? 1 : 0;
   }
-  return nhCheck;
 }
 
 // -----------------------------------------------------------------------------
@@ -543,46 +575,11 @@ void ModifiedLambertProjection::normalizeSquaresToMRD()
 // -----------------------------------------------------------------------------
 void ModifiedLambertProjection::createStereographicProjection(int dim, EbsdLib::DoubleArrayType& stereoIntensity)
 {
-  int xpoints = dim;
-  int ypoints = dim;
-
-  int xpointshalf = xpoints / 2;
-  int ypointshalf = ypoints / 2;
-
-  float xres = 2.0f / static_cast<float>(xpoints);
-  float yres = 2.0f / static_cast<float>(ypoints);
-
   stereoIntensity.initializeWithZeros();
 
-  for(int64_t y = 0; y < ypoints; y++)
-  {
-    for(int64_t x = 0; x < xpoints; x++)
-    {
-      // get (x,y) for stereographic projection pixel
-      float xtmp = static_cast<float>(x - xpointshalf) * xres + (xres * 0.5f);
-      float ytmp = static_cast<float>(y - ypointshalf) * yres + (yres * 0.5f);
-      int index = static_cast<int>(y * xpoints + x);
-      if((xtmp * xtmp + ytmp * ytmp) <= 1.0)
-      {
-        std::array<float, 3> xyz{};
-        // project xy from stereo projection to the unit spehere
-        xyz[2] = -((xtmp * xtmp + ytmp * ytmp) - 1) / ((xtmp * xtmp + ytmp * ytmp) + 1);
-        xyz[0] = xtmp * (1 + xyz[2]);
-        xyz[1] = ytmp * (1 + xyz[2]);
-
-        stereoIntensity[index] += calcInterpolatedValue(*this, xyz);
-
-        for(auto& value : xyz)
-        {
-          value *= -1.0f;
-        }
-
-        stereoIntensity[index] += calcInterpolatedValue(*this, xyz);
-
-        stereoIntensity[index] *= 0.5;
-      }
-    }
-  }
+  // The pixel to Lambert cell mapping only depends on the dimensions so it is shared between calls
+  StereographicLambertTable::Pointer table = StereographicLambertTable::Get(dim, m_Dimension, m_SphereRadius);
+  table->project(m_NorthSquare->getPointer(0), m_SouthSquare->getPointer(0), stereoIntensity.getPointer(0));
 }
 
 // -----------------------------------------------------------------------------
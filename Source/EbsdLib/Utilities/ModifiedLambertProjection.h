@@ -35,6 +35,7 @@
 
 #pragma once
 
+#include <array>
 #include <memory>
 
 #include "EbsdLib/Core/EbsdDataArray.hpp"
@@ -144,6 +145,16 @@ public:
    */
   void addInterpolatedValues(Square square, float* sqCoord, double value);
 
+  /**
+   * @brief addInterpolatedValues Adds the value, bilinearly interpolated, into a caller owned square
+   * that has the same dimension as this projection. This allows several threads to accumulate
+   * into their own squares at the same time.
+   * @param squareData The square, getDimension() * getDimension() values
+   * @param sqCoord The XY coordinate in the Modified Lambert Square
+   * @param value The value to add
+   */
+  void addInterpolatedValues(double* squareData, const float* sqCoord, double value) const;
+
   /**
    * @brief addValue
    * @param square
@@ -176,6 +187,17 @@ public:
    */
   double getInterpolatedValue(Square square, const float* sqCoord) const;
 
+  /**
+   * @brief getInterpolationCells Returns the 4 cells and the fractional offsets that bilinear
+   * interpolation at a square coordinate uses. Cells that fall off the edge of the square are
+   * wrapped onto the neighboring edge.
+   * @param sqCoord The XY coordinate in the Modified Lambert Square
+   * @param indices [output] The index of the 4 cells
+   * @param modX [output] Fractional offset in X from the center of the first cell
+   * @param modY [output] Fractional offset in Y from the center of the first cell
+   */
+  void getInterpolationCells(const float* sqCoord, std::array<int32_t, 4>& indices, float& modX, float& modY) const;
+
   /**
    * @brief getSquareCoord
    * @param xyz The input XYZ coordinate on the unit sphere.
@@ -184,6 +206,26 @@ public:
    */
   bool getSquareCoord(const float* xyz, float* sqCoord) const;
 
+  /**
+   * @brief getSquareCoords Batch version of getSquareCoord() over a contiguous block of coordinates.
+   * @param xyz The input XYZ coordinates on the unit sphere, 3 values per point
+   * @param numCoords The number of points
+   * @param sqCoords [output] The XY coordinates in the Modified Lambert Square, 2 values per point
+   * @param northern [output] 1 if the point is in the north square, 0 if it is in the south square
+   */
+  void getSquareCoords(const float* xyz, size_t numCoords, float* sqCoords, uint8_t* northern) const;
+
+  /**
+   * @brief addCoords Adds a value for each of the coordinates into a caller supplied pair of squares
+   * so several threads can accumulate into their own squares with the same projection.
+   * @param xyz The coordinates, 3 values per coordinate
+   * @param numCoords The number of coordinates
+   * @param northSquare [input/output] The North square, getDimension() * getDimension() values
+   * @param southSquare [input/output] The South square, getDimension() * getDimension() values
+   * @param value The value each coordinate adds. A negative value takes previously added coordinates back out.
+   */
+  void addCoords(const float* xyz, size_t numCoords, double* northSquare, double* southSquare, double value = 1.0) const;
+
   /**
    * @brief getSquareIndex
    * @param sqCoord
@@ -0,0 +1,130 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <utility>
+
+/**
+ * @brief The SharedObjectCache class maps keys to objects that are expensive to build and are shared, read only,
+ * between all callers, such as lookup tables and rendered legends. ValueType is a std::shared_ptr. This is thread safe.
+ *
+ * get() builds a missing object outside of the lock so callers asking for other keys are not blocked. If two
+ * threads build the same key at the same time the object that is stored first is kept and both callers receive it.
+ *
+ * The cache holds at most getMaxSize() objects and drops the least recently used one when it is full. Objects that
+ * are dropped or cleared stay valid for as long as a caller still holds a reference to them.
+ */
+template <typename KeyType, typename ValueType>
+class SharedObjectCache
+{
+public:
+  explicit SharedObjectCache(size_t maxSize)
+  : m_MaxSize(std::max<size_t>(maxSize, 1))
+  {
+  }
+  ~SharedObjectCache() = default;
+
+  /**
+   * @brief Returns the object stored for key. A missing object is built with factory() and stored.
+   * @param key
+   * @param factory Callable that takes no arguments and returns a ValueType
+   */
+  template <typename FactoryType>
+  ValueType get(const KeyType& key, FactoryType&& factory)
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_Mutex);
+      auto iter = m_Entries.find(key);
+      if(iter != m_Entries.end())
+      {
+        iter->second.second = ++m_UseCount;
+        return iter->second.first;
+      }
+    }
+    ValueType value = factory();
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    auto iter = m_Entries.emplace(key, EntryType(value, 0)).first;
+    iter->second.second = ++m_UseCount;
+    if(m_Entries.size() > m_MaxSize)
+    {
+      auto oldest = std::min_element(m_Entries.begin(), m_Entries.end(), [](const auto& a, const auto& b) { return a.second.second < b.second.second; });
+      m_Entries.erase(oldest);
+    }
+    return iter->second.first;
+  }
+
+  /**
+   * @brief Removes all objects
+   */
+  void clear()
+  {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_Entries.clear();
+  }
+
+  /**
+   * @brief Returns the number of stored objects
+   */
+  size_t size() const
+  {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return m_Entries.size();
+  }
+
+  size_t getMaxSize() const
+  {
+    return m_MaxSize;
+  }
+
+private:
+  using EntryType = std::pair<ValueType, uint64_t>; // The object and the use count of its last lookup
+
+  const size_t m_MaxSize;
+  mutable std::mutex m_Mutex;
+  std::map<KeyType, EntryType> m_Entries;
+  uint64_t m_UseCount = 0;
+
+public:
+  SharedObjectCache(const SharedObjectCache&) = delete;            // Copy Constructor Not Implemented
+  SharedObjectCache(SharedObjectCache&&) = delete;                 // Move Constructor Not Implemented
+  SharedObjectCache& operator=(const SharedObjectCache&) = delete; // Copy Assignment Not Implemented
+  SharedObjectCache& operator=(SharedObjectCache&&) = delete;      // Move Assignment Not Implemented
+};
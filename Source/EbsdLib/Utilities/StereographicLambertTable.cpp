@@ -0,0 +1,193 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "StereographicLambertTable.h"
+
+#include <tuple>
+
+#ifdef EbsdLib_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#endif
+
+#include "EbsdLib/Utilities/ModifiedLambertProjection.h"
+#include "EbsdLib/Utilities/SharedObjectCache.hpp"
+
+namespace
+{
+using TableKey = std::tuple<int, int, float>;
+using TableCacheType = SharedObjectCache<TableKey, StereographicLambertTable::Pointer>;
+
+constexpr size_t k_MaxCachedTables = 8;
+
+TableCacheType& Cache()
+{
+  static TableCacheType cache(k_MaxCachedTables);
+  return cache;
+}
+
+inline float interpolate(const double* squareData, const StereographicLambertTable::Lookup& lookup)
+{
+  float intensity1 = static_cast<float>(squareData[lookup.indices[0]]);
+  float intensity2 = static_cast<float>(squareData[lookup.indices[1]]);
+  float intensity3 = static_cast<float>(squareData[lookup.indices[2]]);
+  float intensity4 = static_cast<float>(squareData[lookup.indices[3]]);
+  float modX = lookup.modX;
+  float modY = lookup.modY;
+  return ((intensity1 * (1 - modX) * (1 - modY)) + (intensity2 * (modX) * (1 - modY)) + (intensity3 * (1 - modX) * (modY)) + (intensity4 * (modX) * (modY)));
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+StereographicLambertTable::Pointer StereographicLambertTable::Get(int imageDim, int lambertDim, float sphereRadius)
+{
+  return Cache().get(TableKey(imageDim, lambertDim, sphereRadius),
+                     [imageDim, lambertDim, sphereRadius]() { return std::make_shared<const Self>(imageDim, lambertDim, sphereRadius); });
+}
+
+// -----------------------------------------------------------------------------
+void StereographicLambertTable::ClearCache()
+{
+  Cache().clear();
+}
+
+// -----------------------------------------------------------------------------
+StereographicLambertTable::StereographicLambertTable(int imageDim, int lambertDim, float sphereRadius)
+: m_ImageDimension(imageDim)
+, m_LambertDimension(lambertDim)
+, m_SphereRadius(sphereRadius)
+{
+  ModifiedLambertProjection::Pointer lambert = ModifiedLambertProjection::New();
+  lambert->initializeSquares(lambertDim, sphereRadius);
+
+  int xpoints = imageDim;
+  int ypoints = imageDim;
+
+  int xpointshalf = xpoints / 2;
+  int ypointshalf = ypoints / 2;
+
+  float xres = 2.0f / static_cast<float>(xpoints);
+  float yres = 2.0f / static_cast<float>(ypoints);
+
+  m_RowOffsets.resize(static_cast<size_t>(ypoints) + 1, 0);
+  for(int64_t y = 0; y < ypoints; y++)
+  {
+    m_RowOffsets[y] = m_PixelIndices.size();
+    for(int64_t x = 0; x < xpoints; x++)
+    {
+      // get (x,y) for stereographic projection pixel
+      float xtmp = static_cast<float>(x - xpointshalf) * xres + (xres * 0.5f);
+      float ytmp = static_cast<float>(y - ypointshalf) * yres + (yres * 0.5f);
+      if((xtmp * xtmp + ytmp * ytmp) > 1.0)
+      {
+        continue;
+      }
+      // project xy from stereo projection to the unit sphere
+      std::array<float, 3> xyz{};
+      xyz[2] = -((xtmp * xtmp + ytmp * ytmp) - 1) / ((xtmp * xtmp + ytmp * ytmp) + 1);
+      xyz[0] = xtmp * (1 + xyz[2]);
+      xyz[1] = ytmp * (1 + xyz[2]);
+
+      m_PixelIndices.push_back(static_cast<size_t>(y * xpoints + x));
+      for(int hemisphere = 0; hemisphere < 2; hemisphere++)
+      {
+        std::array<float, 2> sqCoord{};
+        Lookup lookup{};
+        lookup.northern = lambert->getSquareCoord(xyz.data(), sqCoord.data()) ? 1 : 0;
+        lambert->getInterpolationCells(sqCoord.data(), lookup.indices, lookup.modX, lookup.modY);
+        m_Lookups.push_back(lookup);
+        for(auto& value : xyz)
+        {
+          value *= -1.0f;
+        }
+      }
+    }
+  }
+  m_RowOffsets[ypoints] = m_PixelIndices.size();
+}
+
+// -----------------------------------------------------------------------------
+int StereographicLambertTable::getImageDimension() const
+{
+  return m_ImageDimension;
+}
+
+// -----------------------------------------------------------------------------
+int StereographicLambertTable::getLambertDimension() const
+{
+  return m_LambertDimension;
+}
+
+// -----------------------------------------------------------------------------
+float StereographicLambertTable::getSphereRadius() const
+{
+  return m_SphereRadius;
+}
+
+// -----------------------------------------------------------------------------
+size_t StereographicLambertTable::getNumberOfPixels() const
+{
+  return m_PixelIndices.size();
+}
+
+// -----------------------------------------------------------------------------
+void StereographicLambertTable::project(const double* northSquare, const double* southSquare, double* image, size_t start, size_t end) const
+{
+  for(size_t p = m_RowOffsets[start]; p < m_RowOffsets[end]; p++)
+  {
+    const Lookup& upper = m_Lookups[2 * p];
+    const Lookup& lower = m_Lookups[2 * p + 1];
+    double value = interpolate(upper.northern != 0 ? northSquare : southSquare, upper);
+    value += interpolate(lower.northern != 0 ? northSquare : southSquare, lower);
+    image[m_PixelIndices[p]] = value * 0.5;
+  }
+}
+
+// -----------------------------------------------------------------------------
+void StereographicLambertTable::project(const double* northSquare, const double* southSquare, double* image) const
+{
+  size_t numRows = static_cast<size_t>(m_ImageDimension);
+#ifdef EbsdLib_USE_PARALLEL_ALGORITHMS
+  bool doParallel = true;
+  if(doParallel)
+  {
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(0, numRows), [&](const tbb::blocked_range<size_t>& r) { project(northSquare, southSquare, image, r.begin(), r.end()); }, tbb::auto_partitioner());
+    return;
+  }
+#endif
+  project(northSquare, southSquare, image, 0, numRows);
+}
@@ -0,0 +1,124 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "EbsdLib/EbsdLib.h"
+
+/**
+ * @brief The StereographicLambertTable class holds, for every pixel of a square stereographic
+ * image, the Modified Lambert cells and bilinear offsets that ModifiedLambertProjection::createStereographicProjection()
+ * interpolates. The mapping only depends on the image dimension, the Lambert dimension and the
+ * sphere radius so it is computed once per combination and shared through Get(). Turning a pair of
+ * Lambert squares into a stereographic image is then a gather over the pixels inside the unit circle.
+ */
+class EbsdLib_EXPORT StereographicLambertTable
+{
+public:
+  using Self = StereographicLambertTable;
+  using Pointer = std::shared_ptr<const Self>;
+
+  /**
+   * @brief One of the two Lambert lookups of a pixel
+   */
+  struct Lookup
+  {
+    std::array<int32_t, 4> indices; // Cells used by the bilinear interpolation
+    float modX;                     // Fractional offsets as returned by ModifiedLambertProjection::getInterpolationCells()
+    float modY;
+    uint8_t northern; // 1 when the lookup reads the North square
+  };
+
+  /**
+   * @brief Returns the shared table for the given dimensions, creating it on first use. The most recently used
+   * tables are kept in a SharedObjectCache.
+   * @param imageDim The width and height of the stereographic image
+   * @param lambertDim The dimension of the Modified Lambert squares
+   * @param sphereRadius The sphere radius of the Modified Lambert squares
+   */
+  static Pointer Get(int imageDim, int lambertDim, float sphereRadius);
+
+  /**
+   * @brief Removes all cached tables
+   */
+  static void ClearCache();
+
+  StereographicLambertTable(int imageDim, int lambertDim, float sphereRadius);
+  ~StereographicLambertTable() = default;
+
+  int getImageDimension() const;
+  int getLambertDimension() const;
+  float getSphereRadius() const;
+
+  /**
+   * @brief Returns the number of image pixels that fall inside the unit circle
+   */
+  size_t getNumberOfPixels() const;
+
+  /**
+   * @brief Fills the pixels inside the unit circle with the average of the interpolated values
+   * of the upper and lower hemisphere points. Pixels outside the circle are left untouched.
+   * @param northSquare The North square, getLambertDimension()^2 values
+   * @param southSquare The South square, getLambertDimension()^2 values
+   * @param image [output] The image, getImageDimension()^2 values
+   */
+  void project(const double* northSquare, const double* southSquare, double* image) const;
+
+  /**
+   * @brief Projects the image rows [start, end)
+   */
+  void project(const double* northSquare, const double* southSquare, double* image, size_t start, size_t end) const;
+
+private:
+  int m_ImageDimension = 0;
+  int m_LambertDimension = 0;
+  float m_SphereRadius = 1.0f;
+
+  std::vector<size_t> m_RowOffsets;   // First pixel of each image row, m_ImageDimension + 1 values
+  std::vector<size_t> m_PixelIndices; // Image index of each pixel inside the unit circle
+  std::vector<Lookup> m_Lookups;      // 2 lookups per pixel: the point and its inverse
+
+public:
+  StereographicLambertTable(const StereographicLambertTable&) = delete;            // Copy Constructor Not Implemented
+  StereographicLambertTable(StereographicLambertTable&&) = delete;                 // Move Constructor Not Implemented
+  StereographicLambertTable& operator=(const StereographicLambertTable&) = delete; // Copy Assignment Not Implemented
+  StereographicLambertTable& operator=(StereographicLambertTable&&) = delete;      // Move Assignment Not Implemented
+};
@@ -33,12 +33,21 @@
  *
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
+#include <algorithm>
+#include <array>
+#include <cstdio>
 #include <cstring>
 #include <fstream>
 #include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
 
+#include "EbsdLib/Core/OrientationTransformation.hpp"
 #include "EbsdLib/EbsdLib.h"
+#include "EbsdLib/IO/FundamentalZoneQuaternions.h"
 #include "EbsdLib/IO/TSL/AngReader.h"
+#include "EbsdLib/LaueOps/LaueOps.h"
 
 #ifdef EbsdLib_ENABLE_HDF5
 #include "EbsdLib/IO/TSL/H5AngImporter.h"
@@ -50,6 +59,18 @@
 
 #include "EbsdLib/Test/EbsdLibTestFileLocations.h"
 
+/**
+ * @brief Reads .ang files in row windows the same way the H5 readers do, by slicing the complete scan in memory
+ */
+class InMemoryRowWindowAngReader : public AngReader
+{
+public:
+  int readFileInRowWindows(size_t rowsPerWindow, const RowWindowCallback& callback) override
+  {
+    return EbsdReader::readFileInRowWindows(rowsPerWindow, callback);
+  }
+};
+
 class AngImportTest
 {
 public:
@@ -163,12 +184,352 @@ public:
     DREAM3D_REQUIRED(ptr[159], ==, 12.56637f)
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  template <typename T>
+  void CompareArrays(AngReader& reader, AngReader& mappedReader, const std::string& arrayName)
+  {
+    T* expected = reinterpret_cast<T*>(reader.getPointerByName(arrayName));
+    T* actual = reinterpret_cast<T*>(mappedReader.getPointerByName(arrayName));
+    DREAM3D_REQUIRE_VALID_POINTER(expected)
+    DREAM3D_REQUIRE_VALID_POINTER(actual)
+    for(size_t i = 0; i < reader.getNumberOfElements(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(expected[i], actual[i])
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestAlignedAllocatorRead()
+  {
+    AngReader reader;
+    reader.setFileName(UnitTest::AngImportTest::TestFile1);
+    int err = reader.readFile();
+    DREAM3D_REQUIRED(err, ==, 0)
+
+    AngReader alignedReader;
+    alignedReader.setAllocator(AlignedAllocator::New(64, true, true));
+    alignedReader.setFileName(UnitTest::AngImportTest::TestFile1);
+    err = alignedReader.readFile();
+    DREAM3D_REQUIRED(err, ==, 0)
+    DREAM3D_REQUIRED(alignedReader.getNumberOfElements(), ==, reader.getNumberOfElements())
+
+    const std::vector<std::string> arrayNames = {EbsdLib::Ang::Phi1,         EbsdLib::Ang::Phi,       EbsdLib::Ang::Phi2,      EbsdLib::Ang::ImageQuality, EbsdLib::Ang::ConfidenceIndex,
+                                                 EbsdLib::Ang::PhaseData,    EbsdLib::Ang::XPosition, EbsdLib::Ang::YPosition, EbsdLib::Ang::SEMSignal,    EbsdLib::Ang::Fit};
+    for(const auto& arrayName : arrayNames)
+    {
+      DREAM3D_REQUIRED(reinterpret_cast<uintptr_t>(alignedReader.getPointerByName(arrayName)) % 64, ==, 0)
+    }
+    for(const auto& arrayName : arrayNames)
+    {
+      if(arrayName == EbsdLib::Ang::PhaseData)
+      {
+        CompareArrays<int32_t>(reader, alignedReader, arrayName);
+        continue;
+      }
+      CompareArrays<float>(reader, alignedReader, arrayName);
+    }
+
+    // Released pointers go back to the allocator of the reader
+    float* phi1 = alignedReader.getPhi1Pointer(true);
+    DREAM3D_REQUIRE_VALID_POINTER(phi1)
+    BufferAllocator::Deallocate(alignedReader.getAllocator(), phi1);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestMemoryMappedRead()
+  {
+    AngReader reader;
+    reader.setFileName(UnitTest::AngImportTest::TestFile1);
+    int err = reader.readFile();
+    DREAM3D_REQUIRED(err, ==, 0)
+
+    AngReader mappedReader;
+    mappedReader.setUseMemoryMapping(true);
+    mappedReader.setFileName(UnitTest::AngImportTest::TestFile1);
+    err = mappedReader.readFile();
+    std::cout << mappedReader.getErrorMessage();
+    DREAM3D_REQUIRED(err, ==, 0)
+    DREAM3D_REQUIRED(mappedReader.getNumberOfElements(), ==, reader.getNumberOfElements())
+
+    CompareArrays<float>(reader, mappedReader, EbsdLib::Ang::Phi1);
+    CompareArrays<float>(reader, mappedReader, EbsdLib::Ang::Phi);
+    CompareArrays<float>(reader, mappedReader, EbsdLib::Ang::Phi2);
+    CompareArrays<float>(reader, mappedReader, EbsdLib::Ang::XPosition);
+    CompareArrays<float>(reader, mappedReader, EbsdLib::Ang::YPosition);
+    CompareArrays<float>(reader, mappedReader, EbsdLib::Ang::ImageQuality);
+    CompareArrays<float>(reader, mappedReader, EbsdLib::Ang::ConfidenceIndex);
+    CompareArrays<int32_t>(reader, mappedReader, EbsdLib::Ang::PhaseData);
+
+    AngReader shortReader;
+    shortReader.setUseMemoryMapping(true);
+    shortReader.setFileName(UnitTest::AngImportTest::ShortFile);
+    err = shortReader.readFile();
+    DREAM3D_REQUIRED(err, <, 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  std::string WriteLargeAngFile(size_t numCols, size_t numRows, size_t badPoint, bool reverseRows = false)
+  {
+    std::string outputFile = UnitTest::TestTempDir + "/AngImportTest_Large.ang";
+    std::ifstream in(UnitTest::AngImportTest::TestFile1);
+    std::ofstream out(outputFile, std::ios_base::out | std::ios_base::trunc);
+    std::string line;
+    while(std::getline(in, line) && !line.empty() && line[0] == '#')
+    {
+      if(line.find("NCOLS_ODD") != std::string::npos)
+      {
+        line = "# NCOLS_ODD: " + std::to_string(numCols);
+      }
+      else if(line.find("NCOLS_EVEN") != std::string::npos)
+      {
+        line = "# NCOLS_EVEN: " + std::to_string(numCols);
+      }
+      else if(line.find("NROWS") != std::string::npos)
+      {
+        line = "# NROWS: " + std::to_string(numRows);
+      }
+      out << line << "\n";
+    }
+
+    std::array<char, 256> buf = {0};
+    for(size_t i = 0; i < numCols * numRows; i++)
+    {
+      float x = static_cast<float>(i % numCols) * 0.25f;
+      float y = static_cast<float>(reverseRows ? numRows - 1 - i / numCols : i / numCols) * 0.25f;
+      float angle = static_cast<float>(i % 628) * 0.01f;
+      if(i == badPoint)
+      {
+        out << " 1.00000 abc 1.00000 " << x << " " << y << " 0.0 -1.000 0 0 0.000\n";
+        continue;
+      }
+      snprintf(buf.data(), buf.size(), " %8.5f %8.5f %8.5f %12.5f %12.5f %6.1f %6.3f %2d %6d %7.3f\n", angle, angle * 0.5f, angle * 0.25f, x, y, static_cast<float>(i % 1000) * 0.1f,
+               static_cast<float>(i % 100) * 0.01f, static_cast<int>(i % 2), static_cast<int>(i % 2048) - 1024, static_cast<float>(i % 180));
+      out << buf.data();
+    }
+    return outputFile;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestParallelRead()
+  {
+    // Large enough that the data section is split into several chunks
+    std::string largeFile = WriteLargeAngFile(200, 250, std::numeric_limits<size_t>::max());
+
+    AngReader reader;
+    reader.setFileName(largeFile);
+    int err = reader.readFile();
+    DREAM3D_REQUIRED(err, ==, 0)
+
+    AngReader parallelReader;
+    parallelReader.setUseParallelParsing(true);
+    parallelReader.setFileName(largeFile);
+    err = parallelReader.readFile();
+    DREAM3D_REQUIRED(err, ==, 0)
+    DREAM3D_REQUIRED(parallelReader.getNumberOfElements(), ==, reader.getNumberOfElements())
+
+    CompareArrays<float>(reader, parallelReader, EbsdLib::Ang::Phi1);
+    CompareArrays<float>(reader, parallelReader, EbsdLib::Ang::Phi);
+    CompareArrays<float>(reader, parallelReader, EbsdLib::Ang::Phi2);
+    CompareArrays<float>(reader, parallelReader, EbsdLib::Ang::XPosition);
+    CompareArrays<float>(reader, parallelReader, EbsdLib::Ang::YPosition);
+    CompareArrays<float>(reader, parallelReader, EbsdLib::Ang::ImageQuality);
+    CompareArrays<float>(reader, parallelReader, EbsdLib::Ang::ConfidenceIndex);
+    CompareArrays<int32_t>(reader, parallelReader, EbsdLib::Ang::PhaseData);
+    CompareArrays<float>(reader, parallelReader, EbsdLib::Ang::SEMSignal);
+    CompareArrays<float>(reader, parallelReader, EbsdLib::Ang::Fit);
+
+    // A bad value deep inside the data section must report the same point as a serial scan would
+    largeFile = WriteLargeAngFile(200, 250, 30000);
+    AngReader badReader;
+    badReader.setUseParallelParsing(true);
+    badReader.setFileName(largeFile);
+    err = badReader.readFile();
+    DREAM3D_REQUIRED(err, ==, -2502)
+    DREAM3D_REQUIRE(badReader.getErrorMessage().find("Current Data Point Count: 30001") != std::string::npos)
+
+#if REMOVE_TEST_FILES
+    fs::remove(largeFile);
+#endif
+
+    AngReader shortReader;
+    shortReader.setUseParallelParsing(true);
+    shortReader.setFileName(UnitTest::AngImportTest::ShortFile);
+    err = shortReader.readFile();
+    DREAM3D_REQUIRED(err, <, 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  template <typename WindowReaderType = AngReader>
+  void CompareRowWindows(const std::string& filePath, size_t rowsPerWindow, bool parallel)
+  {
+    AngReader reader;
+    reader.setFileName(filePath);
+    int err = reader.readFile();
+    DREAM3D_REQUIRED(err, ==, 0)
+
+    WindowReaderType windowReader;
+    windowReader.setUseParallelParsing(parallel);
+    windowReader.setFileName(filePath);
+    std::vector<std::string> floatNames = {EbsdLib::Ang::Phi1, EbsdLib::Ang::Phi, EbsdLib::Ang::Phi2, EbsdLib::Ang::XPosition, EbsdLib::Ang::YPosition, EbsdLib::Ang::ImageQuality,
+                                           EbsdLib::Ang::ConfidenceIndex};
+    size_t numRowsRead = 0;
+    size_t numElementsRead = 0;
+    err = windowReader.readFileInRowWindows(rowsPerWindow, [&](const EbsdReader::RowWindow& window) {
+      DREAM3D_REQUIRED(window.firstRow, ==, numRowsRead)
+      DREAM3D_REQUIRED(window.firstElement, ==, numElementsRead)
+      DREAM3D_REQUIRED(window.numRows, <=, rowsPerWindow)
+      for(const auto& name : floatNames)
+      {
+        float* expected = reinterpret_cast<float*>(reader.getPointerByName(name)) + window.firstElement;
+        float* actual = reinterpret_cast<float*>(windowReader.getPointerByName(name));
+        DREAM3D_REQUIRE(std::equal(actual, actual + window.numElements, expected))
+      }
+      int32_t* expectedPhases = reader.getPhaseDataPointer() + window.firstElement;
+      DREAM3D_REQUIRE(std::equal(expectedPhases, expectedPhases + window.numElements, windowReader.getPhaseDataPointer()))
+      numRowsRead += window.numRows;
+      numElementsRead += window.numElements;
+      return true;
+    });
+    DREAM3D_REQUIRED(err, ==, 0)
+    DREAM3D_REQUIRED(numRowsRead, ==, static_cast<size_t>(reader.getNumRows()))
+    DREAM3D_REQUIRED(numElementsRead, ==, reader.getNumberOfElements())
+    DREAM3D_REQUIRED(windowReader.getNumberOfElements(), ==, reader.getNumberOfElements())
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestRowWindowRead()
+  {
+    CompareRowWindows(UnitTest::AngImportTest::TestFile1, 1, false);
+    CompareRowWindows(UnitTest::AngImportTest::TestFile1, 3, true);
+    CompareRowWindows(UnitTest::AngImportTest::TestFile1, 1000, false);
+
+    std::string largeFile = WriteLargeAngFile(200, 250, std::numeric_limits<size_t>::max());
+    CompareRowWindows(largeFile, 16, true);
+
+    // The H5 readers slice the complete scan in memory
+    CompareRowWindows<InMemoryRowWindowAngReader>(UnitTest::AngImportTest::TestFile1, 3, false);
+    CompareRowWindows<InMemoryRowWindowAngReader>(largeFile, 16, true);
+    CompareRowWindows<InMemoryRowWindowAngReader>(largeFile, 1000, false);
+
+    // The callback can stop the read early
+    AngReader reader;
+    reader.setFileName(largeFile);
+    size_t numWindows = 0;
+    int err = reader.readFileInRowWindows(10, [&numWindows](const EbsdReader::RowWindow&) { return ++numWindows < 2; });
+    DREAM3D_REQUIRED(err, ==, 0)
+    DREAM3D_REQUIRED(numWindows, ==, 2)
+
+    InMemoryRowWindowAngReader inMemoryReader;
+    inMemoryReader.setFileName(largeFile);
+    numWindows = 0;
+    err = inMemoryReader.readFileInRowWindows(10, [&numWindows](const EbsdReader::RowWindow&) { return ++numWindows < 2; });
+    DREAM3D_REQUIRED(err, ==, 0)
+    DREAM3D_REQUIRED(numWindows, ==, 2)
+
+    // Errors in a later window are reported with the position in the complete scan
+    largeFile = WriteLargeAngFile(200, 250, 30000);
+    AngReader badReader;
+    err = badReader.readFileInRowWindows(16, [](const EbsdReader::RowWindow&) { return true; });
+    DREAM3D_REQUIRED(err, <, 0)
+    badReader.setFileName(largeFile);
+    err = badReader.readFileInRowWindows(16, [](const EbsdReader::RowWindow&) { return true; });
+    DREAM3D_REQUIRED(err, ==, -2502)
+    DREAM3D_REQUIRE(badReader.getErrorMessage().find("Current Data Point Count: 30001") != std::string::npos)
+
+#if REMOVE_TEST_FILES
+    fs::remove(largeFile);
+#endif
+
+    AngReader shortReader;
+    shortReader.setFileName(UnitTest::AngImportTest::ShortFile);
+    err = shortReader.readFileInRowWindows(4, [](const EbsdReader::RowWindow&) { return true; });
+    DREAM3D_REQUIRED(err, <, 0)
+
+    // readFile() reorders points that are not in row order, windows can not so the file is rejected
+    largeFile = WriteLargeAngFile(20, 25, std::numeric_limits<size_t>::max(), true);
+    AngReader reversedReader;
+    reversedReader.setFileName(largeFile);
+    err = reversedReader.readFile();
+    DREAM3D_REQUIRED(err, ==, 0)
+    size_t numReversedWindows = 0;
+    err = reversedReader.readFileInRowWindows(4, [&numReversedWindows](const EbsdReader::RowWindow&) {
+      numReversedWindows++;
+      return true;
+    });
+    DREAM3D_REQUIRED(err, ==, -101101)
+    DREAM3D_REQUIRED(numReversedWindows, ==, 0)
+
+#if REMOVE_TEST_FILES
+    fs::remove(largeFile);
+#endif
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestFundamentalZoneQuaternions()
+  {
+    AngReader reader;
+    reader.setFileName(UnitTest::AngImportTest::TestFile1);
+    int err = reader.readFile();
+    DREAM3D_REQUIRED(err, ==, 0)
+
+    EbsdLib::FloatArrayType::Pointer fzQuats = FundamentalZoneQuaternions::FromAngReader(reader);
+    DREAM3D_REQUIRE_VALID_POINTER(fzQuats.get())
+    size_t numElements = reader.getNumberOfElements();
+    DREAM3D_REQUIRED(fzQuats->getNumberOfTuples(), ==, numElements)
+    DREAM3D_REQUIRED(fzQuats->getNumberOfComponents(), ==, 4)
+
+    LaueOps::Pointer ops = LaueOps::GetAllOrientationOps()[reader.getPhaseVector().front()->determineLaueGroup()];
+    float* phi1 = reader.getPhi1Pointer();
+    float* phi = reader.getPhiPointer();
+    float* phi2 = reader.getPhi2Pointer();
+    float* quats = fzQuats->getPointer(0);
+    for(size_t i = 0; i < numElements; i++)
+    {
+      QuatD expected = ops->getFZQuat(OrientationTransformation::eu2qu(EulerD(phi1[i], phi[i], phi2[i])));
+      for(size_t c = 0; c < 4; c++)
+      {
+        DREAM3D_REQUIRE(std::abs(quats[i * 4 + c] - static_cast<float>(expected[c])) < 1.0E-5F)
+      }
+    }
+
+    // The angle between neighbors must not change because of the pre-reduction
+    for(size_t i = 1; i < numElements; i++)
+    {
+      QuatD q1(quats[i * 4 - 4], quats[i * 4 - 3], quats[i * 4 - 2], quats[i * 4 - 1]);
+      QuatD q2(quats[i * 4], quats[i * 4 + 1], quats[i * 4 + 2], quats[i * 4 + 3]);
+      AxisAngleD axisAngle;
+      ops->calculateMisorientation(OrientationTransformation::eu2qu(EulerD(phi1[i - 1], phi[i - 1], phi2[i - 1])), OrientationTransformation::eu2qu(EulerD(phi1[i], phi[i], phi2[i])), axisAngle);
+      DREAM3D_REQUIRE(std::abs(ops->calculateMisorientationAngleFZ(q1, q2) - axisAngle[3]) < 1.0E-4)
+    }
+  }
+
   void operator()()
   {
     int err = EXIT_SUCCESS;
     std::cout << "<===== Start " << getNameOfClass() << std::endl;
 
     DREAM3D_REGISTER_TEST(TestNormalFile())
+    DREAM3D_REGISTER_TEST(TestMemoryMappedRead())
+    DREAM3D_REGISTER_TEST(TestAlignedAllocatorRead())
+    DREAM3D_REGISTER_TEST(TestParallelRead())
+    DREAM3D_REGISTER_TEST(TestRowWindowRead())
+    DREAM3D_REGISTER_TEST(TestFundamentalZoneQuaternions())
     DREAM3D_REGISTER_TEST(TestMissingHeaders())
     DREAM3D_REGISTER_TEST(TestHexGrid())
     DREAM3D_REGISTER_TEST(TestMissingGrid())
@@ -235,6 +235,96 @@ public:
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
+  void CompareReaders(const std::string& filePath)
+  {
+    CtfReader reader;
+    reader.setFileName(filePath);
+    int err = reader.readFile();
+    DREAM3D_REQUIRED(err, >=, 0)
+
+    CtfReader parallelReader;
+    parallelReader.setUseParallelParsing(true);
+    parallelReader.setFileName(filePath);
+    err = parallelReader.readFile();
+    DREAM3D_REQUIRED(err, >=, 0)
+    DREAM3D_REQUIRED(parallelReader.getNumberOfElements(), ==, reader.getNumberOfElements())
+
+    std::vector<std::string> columnNames = reader.getColumnNames();
+    for(const auto& name : columnNames)
+    {
+      EbsdLib::NumericTypes::Type type = reader.getPointerType(name);
+      void* expected = reader.getPointerByName(name);
+      void* actual = parallelReader.getPointerByName(name);
+      DREAM3D_REQUIRE_VALID_POINTER(expected)
+      DREAM3D_REQUIRE_VALID_POINTER(actual)
+      size_t numBytes = reader.getNumberOfElements() * (type == EbsdLib::NumericTypes::Type::UInt8 ? 1 : 4);
+      DREAM3D_REQUIRE_EQUAL(std::memcmp(expected, actual, numBytes), 0)
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestParallelRead()
+  {
+    CompareReaders(UnitTest::CtfReaderTest::USInputFile2);
+    CompareReaders(UnitTest::CtfReaderTest::EuropeanInputFile2);
+
+    CtfReader reader;
+    reader.setUseParallelParsing(true);
+    reader.setFileName(UnitTest::CtfReaderTest::ShortFile);
+    int err = reader.readFile();
+    DREAM3D_REQUIRED(err, ==, -105)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void CompareRowWindows(const std::string& filePath, size_t rowsPerWindow, bool parallel)
+  {
+    CtfReader reader;
+    reader.setFileName(filePath);
+    int err = reader.readFile();
+    DREAM3D_REQUIRED(err, >=, 0)
+
+    CtfReader windowReader;
+    windowReader.setUseParallelParsing(parallel);
+    windowReader.setFileName(filePath);
+    size_t numElementsRead = 0;
+    err = windowReader.readFileInRowWindows(rowsPerWindow, [&](const EbsdReader::RowWindow& window) {
+      DREAM3D_REQUIRED(window.firstElement, ==, numElementsRead)
+      DREAM3D_REQUIRED(window.numElements, ==, window.numRows * static_cast<size_t>(reader.getXCells()))
+      std::vector<std::string> columnNames = reader.getColumnNames();
+      for(const auto& name : columnNames)
+      {
+        size_t typeSize = reader.getPointerType(name) == EbsdLib::NumericTypes::Type::UInt8 ? 1 : 4;
+        uint8_t* expected = reinterpret_cast<uint8_t*>(reader.getPointerByName(name)) + window.firstElement * typeSize;
+        void* actual = windowReader.getPointerByName(name);
+        DREAM3D_REQUIRE_VALID_POINTER(actual)
+        DREAM3D_REQUIRE_EQUAL(std::memcmp(expected, actual, window.numElements * typeSize), 0)
+      }
+      numElementsRead += window.numElements;
+      return true;
+    });
+    DREAM3D_REQUIRED(err, ==, 0)
+    DREAM3D_REQUIRED(numElementsRead, ==, reader.getNumberOfElements())
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestRowWindowRead()
+  {
+    CompareRowWindows(UnitTest::CtfReaderTest::USInputFile2, 1, false);
+    CompareRowWindows(UnitTest::CtfReaderTest::USInputFile2, 7, true);
+    CompareRowWindows(UnitTest::CtfReaderTest::EuropeanInputFile2, 5, false);
+
+    CtfReader reader;
+    reader.setFileName(UnitTest::CtfReaderTest::ShortFile);
+    int err = reader.readFileInRowWindows(4, [](const EbsdReader::RowWindow&) { return true; });
+    DREAM3D_REQUIRED(err, ==, -105)
+  }
+
   void operator()()
   {
     int err = EXIT_SUCCESS;
@@ -245,6 +335,8 @@ public:
     DREAM3D_REGISTER_TEST(TestMultiplePhases_US())
     DREAM3D_REGISTER_TEST(TestCellCountToLarge())
     DREAM3D_REGISTER_TEST(TestShortFile())
+    DREAM3D_REGISTER_TEST(TestParallelRead())
+    DREAM3D_REGISTER_TEST(TestRowWindowRead())
     DREAM3D_REGISTER_TEST(TestZeroXYCells())
     DREAM3D_REGISTER_TEST(TestWriteCtfFile());
   }
@@ -37,8 +37,10 @@
 
 #include <fstream>
 #include <iostream>
+#include <vector>
 
 #include "EbsdLib/EbsdLib.h"
+#include "EbsdLib/IO/H5EbsdChunkedIO.h"
 #include "EbsdLib/IO/TSL/AngReader.h"
 #include "EbsdLib/IO/TSL/H5OIMReader.h"
 #include "EbsdLib/Test/EbsdLibTestFileLocations.h"
@@ -118,12 +120,109 @@ public:
     }
   }
 
+  // -----------------------------------------------------------------------------
+  void TestH5OIMReaderRowRange()
+  {
+    H5OIMReader::Pointer reader = H5OIMReader::New();
+    reader->setFileName(UnitTest::AngImportTest::EdaxOIMH5File);
+    reader->setHDF5Path("Scan_1");
+    reader->setReadPatternData(false);
+    int err = reader->readFile();
+    DREAM3D_REQUIRED(err, >=, 0)
+    size_t numCols = static_cast<size_t>(reader->getNumOddCols());
+
+    const size_t rowStart = 50;
+    const size_t rowCount = 20;
+    H5OIMReader::Pointer roiReader = H5OIMReader::New();
+    roiReader->setFileName(UnitTest::AngImportTest::EdaxOIMH5File);
+    roiReader->setHDF5Path("Scan_1");
+    roiReader->setReadPatternData(false);
+    roiReader->setReadRowRange(rowStart, rowCount);
+    roiReader->setChunkCacheSize(1024 * 1024);
+    err = roiReader->readFile();
+    DREAM3D_REQUIRED(err, >=, 0)
+    DREAM3D_REQUIRED(roiReader->getNumRows(), ==, static_cast<int>(rowCount))
+
+    float* phi1 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ang::Phi1));
+    float* roiPhi1 = reinterpret_cast<float*>(roiReader->getPointerByName(EbsdLib::Ang::Phi1));
+    int* phases = reinterpret_cast<int*>(reader->getPointerByName(EbsdLib::Ang::PhaseData));
+    int* roiPhases = reinterpret_cast<int*>(roiReader->getPointerByName(EbsdLib::Ang::PhaseData));
+    DREAM3D_REQUIRE_VALID_POINTER(roiPhi1)
+    DREAM3D_REQUIRE_VALID_POINTER(roiPhases)
+    for(size_t i = 0; i < rowCount * numCols; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(roiPhi1[i], phi1[rowStart * numCols + i])
+      DREAM3D_REQUIRE_EQUAL(roiPhases[i], phases[rowStart * numCols + i])
+    }
+
+    // Rows past the end of the scan are an error
+    H5OIMReader::Pointer badReader = H5OIMReader::New();
+    badReader->setFileName(UnitTest::AngImportTest::EdaxOIMH5File);
+    badReader->setHDF5Path("Scan_1");
+    badReader->setReadPatternData(false);
+    badReader->setReadRowRange(static_cast<size_t>(reader->getNumRows()), 1);
+    err = badReader->readFile();
+    DREAM3D_REQUIRED(err, <, 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  void TestChunkedDatasets()
+  {
+    std::string filePath = UnitTest::TestTempDir + "/EdaxOIMReaderTest_Chunked.h5";
+    const hsize_t numCols = 37;
+    const hsize_t numRows = 53;
+    std::vector<float> values(numCols * numRows);
+    for(size_t i = 0; i < values.size(); i++)
+    {
+      values[i] = static_cast<float>(i % 97) * 0.25f;
+    }
+
+    H5EbsdStorageOptions options;
+    options.chunkRows = 8;
+    options.deflateLevel = 6;
+    options.shuffle = true;
+
+    hid_t fileId = H5Fcreate(filePath.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+    DREAM3D_REQUIRED(fileId, >=, 0)
+    herr_t err = H5EbsdChunkedIO::WriteDataset(fileId, "Chunked", numCols, numRows, values.data(), options);
+    DREAM3D_REQUIRED(err, >=, 0)
+    err = H5EbsdChunkedIO::WriteDataset(fileId, "Contiguous", numCols, numRows, values.data(), H5EbsdStorageOptions());
+    DREAM3D_REQUIRED(err, >=, 0)
+
+    hid_t dataset = H5Dopen2(fileId, "Chunked", H5P_DEFAULT);
+    hid_t dcpl = H5Dget_create_plist(dataset);
+    DREAM3D_REQUIRE_EQUAL(H5Pget_layout(dcpl), H5D_CHUNKED)
+    DREAM3D_REQUIRE_EQUAL(H5Pget_nfilters(dcpl), 2)
+    H5Pclose(dcpl);
+    H5Dclose(dataset);
+
+    // Read a band of rows that spans several chunks from both layouts
+    const hsize_t rowStart = 5;
+    const hsize_t rowCount = 19;
+    std::vector<float> chunked(numCols * rowCount);
+    std::vector<float> contiguous(numCols * rowCount);
+    err = H5EbsdChunkedIO::ReadRows(fileId, "Chunked", numCols, rowStart, rowCount, 0, chunked.data());
+    DREAM3D_REQUIRED(err, >=, 0)
+    err = H5EbsdChunkedIO::ReadRows(fileId, "Contiguous", numCols, rowStart, rowCount, 0, contiguous.data());
+    DREAM3D_REQUIRED(err, >=, 0)
+    for(size_t i = 0; i < chunked.size(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(chunked[i], values[rowStart * numCols + i])
+      DREAM3D_REQUIRE_EQUAL(contiguous[i], values[rowStart * numCols + i])
+    }
+    err = H5EbsdChunkedIO::ReadRows(fileId, "Chunked", numCols, numRows - 2, 3, 0, chunked.data());
+    DREAM3D_REQUIRED(err, <, 0)
+    H5Fclose(fileId);
+  }
+
   void operator()()
   {
     int err = EXIT_SUCCESS;
     std::cout << "<===== Start " << getNameOfClass() << std::endl;
 
     DREAM3D_REGISTER_TEST(TestH5OIMReader())
+    DREAM3D_REGISTER_TEST(TestH5OIMReaderRowRange())
+    DREAM3D_REGISTER_TEST(TestChunkedDatasets())
 
     DREAM3D_REGISTER_TEST(RemoveTestFiles())
   }
@@ -0,0 +1,171 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#include "EbsdLib/EbsdLib.h"
+#include "EbsdLib/IO/H5EbsdSliceCopier.hpp"
+
+#include "UnitTestSupport.hpp"
+
+#include "EbsdLib/Test/EbsdLibTestFileLocations.h"
+
+class H5EbsdSliceCopierTest
+{
+public:
+  H5EbsdSliceCopierTest() = default;
+  virtual ~H5EbsdSliceCopierTest() = default;
+
+  EBSD_GET_NAME_OF_CLASS_DECL(H5EbsdSliceCopierTest)
+
+  static constexpr int32_t k_Untouched = -1;
+
+  // -----------------------------------------------------------------------------
+  void RemoveTestFiles()
+  {
+#if REMOVE_TEST_FILES
+// fs::remove();
+#endif
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void CompareSliceCopy(int64_t xDim, int64_t yDim, int64_t zDim, int64_t xSlice, int64_t ySlice, int64_t zIndex)
+  {
+    std::vector<int32_t> slice(static_cast<size_t>(std::max(xSlice * ySlice, int64_t(0))));
+    std::iota(slice.begin(), slice.end(), 0);
+    std::vector<int32_t> volume(static_cast<size_t>(xDim * yDim * zDim), k_Untouched);
+    std::vector<int32_t> clampedVolume(volume.size(), k_Untouched);
+
+    H5EbsdSliceCopier copier(xDim, yDim, xSlice, ySlice, zIndex);
+    copier.addArray(slice.data(), volume.data());
+    copier.addArrayWithMinimum(slice.data(), clampedVolume.data(), 5);
+    copier.addArray<int32_t>(nullptr, volume.data());
+    copier.copy();
+
+    // A smaller slice is centered in the volume, a larger one is cropped around its center
+    for(int64_t z = 0; z < zDim; z++)
+    {
+      for(int64_t y = 0; y < yDim; y++)
+      {
+        for(int64_t x = 0; x < xDim; x++)
+        {
+          int64_t sx = x - (xDim - xSlice) / 2;
+          int64_t sy = y - (yDim - ySlice) / 2;
+          int32_t expected = k_Untouched;
+          if(z == zIndex && sx >= 0 && sx < xSlice && sy >= 0 && sy < ySlice)
+          {
+            expected = slice[sy * xSlice + sx];
+          }
+          size_t index = static_cast<size_t>((z * yDim + y) * xDim + x);
+          DREAM3D_REQUIRED(volume[index], ==, expected)
+          DREAM3D_REQUIRED(clampedVolume[index], ==, (expected == k_Untouched ? expected : std::max(expected, 5)))
+        }
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestFullSlices()
+  {
+    // The slice spans the full X dimension so blocks of rows are copied at once
+    CompareSliceCopy(6, 5, 3, 6, 5, 0);
+    CompareSliceCopy(6, 5, 3, 6, 5, 2);
+    CompareSliceCopy(1, 1, 1, 1, 1, 0);
+    CompareSliceCopy(64, 300, 2, 64, 300, 1);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestPartialSlices()
+  {
+    // The final slice of a volume is often smaller than the largest slice
+    CompareSliceCopy(6, 5, 3, 4, 3, 2);
+    CompareSliceCopy(6, 5, 3, 6, 3, 2);
+    CompareSliceCopy(6, 5, 3, 5, 5, 1);
+    CompareSliceCopy(7, 6, 2, 2, 1, 1);
+    CompareSliceCopy(65, 301, 2, 40, 17, 1);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestEmptySlices()
+  {
+    CompareSliceCopy(6, 5, 2, 0, 5, 1);
+    CompareSliceCopy(6, 5, 2, 6, 0, 1);
+    CompareSliceCopy(6, 5, 2, 0, 0, 0);
+    CompareSliceCopy(6, 5, 2, -3, 5, 0);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestSlicesLargerThanVolume()
+  {
+    // Nothing may be written outside of the z plane of the slice
+    CompareSliceCopy(6, 5, 3, 8, 7, 1);
+    CompareSliceCopy(6, 5, 3, 9, 5, 0);
+    CompareSliceCopy(6, 5, 3, 6, 8, 2);
+    CompareSliceCopy(6, 5, 3, 4, 9, 1);
+    CompareSliceCopy(6, 5, 3, 10, 2, 1);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "<===== Start " << getNameOfClass() << std::endl;
+    int err = EXIT_SUCCESS;
+    DREAM3D_REGISTER_TEST(TestFullSlices())
+    DREAM3D_REGISTER_TEST(TestPartialSlices())
+    DREAM3D_REGISTER_TEST(TestEmptySlices())
+    DREAM3D_REGISTER_TEST(TestSlicesLargerThanVolume())
+    DREAM3D_REGISTER_TEST(RemoveTestFiles())
+  }
+
+public:
+  H5EbsdSliceCopierTest(const H5EbsdSliceCopierTest&) = delete;            // Copy Constructor Not Implemented
+  H5EbsdSliceCopierTest(H5EbsdSliceCopierTest&&) = delete;                 // Move Constructor Not Implemented
+  H5EbsdSliceCopierTest& operator=(const H5EbsdSliceCopierTest&) = delete; // Copy Assignment Not Implemented
+  H5EbsdSliceCopierTest& operator=(H5EbsdSliceCopierTest&&) = delete;      // Move Assignment Not Implemented
+};
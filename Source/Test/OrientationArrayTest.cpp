@@ -4,6 +4,7 @@
 #include <cstdlib>
 #include <iomanip>
 #include <iostream>
+#include <numeric>
 #include <string>
 #include <vector>
 
@@ -1065,6 +1066,140 @@ Orientation Matrix               : | -1.0000   0.0000   0.0000 |
     std::cout << "vg: " << vg[0] << "," << vg[1] << "," << vg[2] << std::endl;
   }
 
+  // -----------------------------------------------------------------------------
+  void TestDataArrayAllocator()
+  {
+    // Small heap blocks and large mapped blocks, both with and without huge pages
+    std::vector<BufferAllocator::Pointer> allocators = {AlignedAllocator::New(), AlignedAllocator::New(128, true, true)};
+    for(const auto& allocator : allocators)
+    {
+      auto alignment = std::dynamic_pointer_cast<AlignedAllocator>(allocator)->getAlignment();
+      for(size_t numElements : {size_t(1), size_t(1000), AlignedAllocator::k_MappedThreshold + size_t(3)})
+      {
+        auto* values = BufferAllocator::Allocate<float>(allocator, numElements, true);
+        DREAM3D_REQUIRE_VALID_POINTER(values)
+        DREAM3D_REQUIRED(reinterpret_cast<uintptr_t>(values) % alignment, ==, 0)
+        DREAM3D_REQUIRE(std::all_of(values, values + numElements, [](float v) { return v == 0.0f; }))
+        std::fill_n(values, numElements, 1.0f);
+        BufferAllocator::Deallocate(allocator, values);
+      }
+    }
+
+    // Resizing keeps the values and initializes only the new tuples
+    auto array = EbsdLib::FloatArrayType::CreateArray(0, {3}, "Test", false);
+    array->setAllocator(AlignedAllocator::New());
+    array->setInitValue(2.0f);
+    array->resizeTuples(10);
+    DREAM3D_REQUIRED(reinterpret_cast<uintptr_t>(array->getPointer(0)) % AlignedAllocator::k_DefaultAlignment, ==, 0)
+    DREAM3D_REQUIRE(std::all_of(array->begin(), array->end(), [](float v) { return v == 2.0f; }))
+    std::iota(array->begin(), array->end(), 0.0f);
+    array->resizeTuples(500000);
+    DREAM3D_REQUIRED(reinterpret_cast<uintptr_t>(array->getPointer(0)) % AlignedAllocator::k_DefaultAlignment, ==, 0)
+    for(size_t i = 0; i < 30; i++)
+    {
+      DREAM3D_REQUIRED(array->getValue(i), ==, static_cast<float>(i))
+    }
+    DREAM3D_REQUIRE(std::all_of(array->begin() + 30, array->end(), [](float v) { return v == 2.0f; }))
+
+    EbsdDataArray<float>::comp_dims_type erase = {0, 2};
+    DREAM3D_REQUIRED(array->eraseTuples(erase), ==, 0)
+    DREAM3D_REQUIRED(array->getSize(), ==, 499998 * 3)
+    DREAM3D_REQUIRED(array->getValue(0), ==, 3.0f)
+    DREAM3D_REQUIRED(array->getValue(3), ==, 9.0f)
+
+    // An array constructed without allocating has a size but no values, all of the resized values are initialized
+    auto unallocated = EbsdLib::FloatArrayType::CreateArray(5, {3}, "Unallocated", false);
+    unallocated->setAllocator(AlignedAllocator::New());
+    unallocated->setInitValue(4.0f);
+    unallocated->resizeTuples(100);
+    DREAM3D_REQUIRED(unallocated->getSize(), ==, 300)
+    DREAM3D_REQUIRE(std::all_of(unallocated->begin(), unallocated->end(), [](float v) { return v == 4.0f; }))
+
+    // Memory from an allocator is copied when it is moved to a class that frees it with delete[]
+    for(size_t numTuples : {size_t(10), AlignedAllocator::k_MappedThreshold / sizeof(float)})
+    {
+      auto aligned = EbsdLib::FloatArrayType::CreateArray(0, {1}, "Aligned", false);
+      aligned->setAllocator(AlignedAllocator::New(64, true));
+      aligned->resizeTuples(numTuples);
+      std::iota(aligned->begin(), aligned->end(), 0.0f);
+      auto moved = aligned->moveToDataArrayType<EbsdLib::FloatArrayType>();
+      DREAM3D_REQUIRE_VALID_POINTER(moved.get())
+      DREAM3D_REQUIRE(moved->getPointer(0) != aligned->getPointer(0))
+      DREAM3D_REQUIRED(moved->getNumberOfTuples(), ==, numTuples)
+      DREAM3D_REQUIRE(std::equal(aligned->begin(), aligned->end(), moved->begin()))
+    }
+    auto heap = EbsdLib::FloatArrayType::CreateArray(10, {1}, "Heap", true);
+    float* heapValues = heap->getPointer(0);
+    auto movedHeap = heap->moveToDataArrayType<EbsdLib::FloatArrayType>();
+    DREAM3D_REQUIRE(movedHeap->getPointer(0) == heapValues)
+
+    // Wrapped memory is still freed with delete[] even if the array has an allocator
+    auto wrapped = EbsdLib::FloatArrayType::WrapPointer(new float[12](), 4, {3}, "Wrapped", true);
+    wrapped->setAllocator(AlignedAllocator::New());
+    wrapped->resizeTuples(8);
+    DREAM3D_REQUIRED(wrapped->getValue(23), ==, 0.0f)
+  }
+
+  // -----------------------------------------------------------------------------
+  void TestMappedDataArray()
+  {
+    const size_t numTuples = 100000;
+    std::string filePath = UnitTest::TestTempDir + "/OrientationArrayTest_Quats.raw";
+
+    auto eulers = EbsdLib::FloatArrayType::CreateArray(numTuples, {3}, "Eulers", true);
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      eulers->setComponent(i, 0, static_cast<float>(i % 360) * k_PiOver180F);
+      eulers->setComponent(i, 1, static_cast<float>(i % 180) * k_PiOver180F * 0.5f);
+      eulers->setComponent(i, 2, static_cast<float>((i * 7) % 360) * k_PiOver180F);
+    }
+    OrientationConverter<EbsdLib::FloatArrayType, float>::Pointer converter = EulerConverter<EbsdLib::FloatArrayType, float>::New();
+    converter->setInputData(eulers);
+    converter->convertRepresentationTo(OrientationRepresentation::Type::Quaternion);
+    EbsdLib::FloatArrayType::Pointer expected = converter->getOutputData();
+
+    {
+      // A new mapped array starts out zero filled and conversions write straight into the file
+      auto mapped = EbsdLib::FloatArrayType::CreateMappedArray(numTuples, {4}, "Quats", filePath);
+      DREAM3D_REQUIRE_VALID_POINTER(mapped.get())
+      DREAM3D_REQUIRE(mapped->isMapped())
+      DREAM3D_REQUIRED(mapped->getNumberOfTuples(), ==, numTuples)
+      DREAM3D_REQUIRE(std::all_of(mapped->begin(), mapped->end(), [](float v) { return v == 0.0f; }))
+      DREAM3D_REQUIRE(converter->convertRepresentationTo(OrientationRepresentation::Type::Quaternion, mapped->getPointer(0), 4))
+      DREAM3D_REQUIRE(mapped->flush())
+    }
+
+    // Reopening does not read the file up front and the copy-on-write mapping never changes it
+    auto reopened = EbsdLib::FloatArrayType::MapFile(filePath, 0, 0, {4}, "Quats", false);
+    DREAM3D_REQUIRE_VALID_POINTER(reopened.get())
+    DREAM3D_REQUIRED(reopened->getNumberOfTuples(), ==, numTuples)
+    DREAM3D_REQUIRE(std::equal(expected->begin(), expected->end(), reopened->begin()))
+    reopened->setValue(0, 42.0f);
+    auto region = EbsdLib::FloatArrayType::MapFile(filePath, 4 * sizeof(float) * 3, 10, {4}, "Region", false);
+    DREAM3D_REQUIRE_VALID_POINTER(region.get())
+    DREAM3D_REQUIRED(region->getNumberOfTuples(), ==, 10)
+    DREAM3D_REQUIRED(region->getValue(0), ==, expected->getValue(12))
+    auto start = EbsdLib::FloatArrayType::MapFile(filePath, 0, 1, {4}, "Start", false);
+    DREAM3D_REQUIRED(start->getValue(0), ==, expected->getValue(0))
+
+    // Regions past the end of a read only file can not be mapped
+    auto invalid = EbsdLib::FloatArrayType::MapFile(filePath, 0, numTuples + 1, {4}, "Invalid", false);
+    DREAM3D_REQUIRE(invalid.get() == nullptr)
+
+    // Changing the size moves the values into memory
+    reopened->resizeTuples(numTuples + 10);
+    DREAM3D_REQUIRE(!reopened->isMapped())
+    DREAM3D_REQUIRED(reopened->getValue(0), ==, 42.0f)
+    DREAM3D_REQUIRED(reopened->getValue(4 * numTuples - 1), ==, expected->getValue(4 * numTuples - 1))
+
+    reopened = nullptr;
+    region = nullptr;
+    start = nullptr;
+#if REMOVE_TEST_FILES
+    fs::remove(filePath);
+#endif
+  }
+
   // -----------------------------------------------------------------------------
   void operator()()
   {
@@ -1092,5 +1227,7 @@ Orientation Matrix               : | -1.0000   0.0000   0.0000 |
     DREAM3D_REGISTER_TEST(Test_ho2_XXX());
 
     DREAM3D_REGISTER_TEST(TestInputs());
+    DREAM3D_REGISTER_TEST(TestDataArrayAllocator());
+    DREAM3D_REGISTER_TEST(TestMappedDataArray());
   }
 };
@@ -33,6 +33,9 @@
  *
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include <cstdio>
 #include <iomanip>
 #include <iostream>
@@ -43,6 +46,7 @@
 #include "EbsdLib/Core/Quaternion.hpp"
 #include "EbsdLib/EbsdLib.h"
 #include "EbsdLib/LaueOps/CubicOps.h"
+#include "EbsdLib/Math/BatchMath.hpp"
 #include "EbsdLib/OrientationMath/OrientationConverter.hpp"
 
 #include "TestPrintFunctions.h"
@@ -188,6 +192,421 @@ public:
     }
   }
 
+  // -----------------------------------------------------------------------------
+  void TestConvertIntoBuffer()
+  {
+    using FloatConverter = OrientationConverter<EbsdLib::FloatArrayType, float>;
+    const size_t nTuples = 50000;
+    std::vector<size_t> cDims(1, 3);
+    EbsdLib::FloatArrayType::Pointer eulers = EbsdLib::FloatArrayType::CreateArray(nTuples, cDims, "Eulers", true);
+    for(size_t i = 0; i < nTuples; i++)
+    {
+      std::array<double, 3> euler = QuasiRandomEuler(i, false);
+      eulers->setComponent(i, 0, static_cast<float>(euler[0]));
+      eulers->setComponent(i, 1, static_cast<float>(euler[1]));
+      eulers->setComponent(i, 2, static_cast<float>(euler[2]));
+    }
+
+    // Reference orientation matrices from the allocating path
+    FloatConverter::Pointer ocEulers = EulerConverter<EbsdLib::FloatArrayType, float>::New();
+    ocEulers->setInputData(eulers);
+    ocEulers->convertRepresentationTo(OrientationRepresentation::Type::OrientationMatrix);
+    EbsdLib::FloatArrayType::Pointer om = ocEulers->getOutputData();
+    ocEulers->convertRepresentationTo(OrientationRepresentation::Type::Quaternion);
+    EbsdLib::FloatArrayType::Pointer quats = ocEulers->getOutputData();
+
+    // Quaternions into a strided buffer, with a marker value in the padding
+    const size_t stride = 5;
+    std::vector<float> buffer(nTuples * stride, -99.0f);
+    DREAM3D_REQUIRE(ocEulers->convertRepresentationTo(OrientationRepresentation::Type::Quaternion, buffer.data(), stride))
+    DREAM3D_REQUIRE(ocEulers->getOutputData()->getPointer(0) == buffer.data())
+    for(size_t i = 0; i < nTuples; i++)
+    {
+      for(size_t c = 0; c < 4; c++)
+      {
+        DREAM3D_REQUIRE_EQUAL(buffer[i * stride + c], quats->getComponent(i, c))
+      }
+      DREAM3D_REQUIRE_EQUAL(buffer[i * stride + 4], -99.0f)
+    }
+
+    // Invalid arguments convert nothing
+    DREAM3D_REQUIRE_EQUAL(ocEulers->convertRepresentationTo(OrientationRepresentation::Type::Quaternion, buffer.data(), 3), false)
+    DREAM3D_REQUIRE_EQUAL(ocEulers->convertRepresentationTo(OrientationRepresentation::Type::OrientationMatrix, eulers->getPointer(0), 9), false)
+    DREAM3D_REQUIRE_EQUAL(ocEulers->convertRepresentationTo(OrientationRepresentation::Type::Homochoric, eulers->getPointer(3), 3), false)
+
+    // In place: orientation matrices (9) shrink to Eulers (3) and quaternions (4) to Homochoric (3)
+    EbsdLib::FloatArrayType::Pointer omCopy = std::dynamic_pointer_cast<EbsdLib::FloatArrayType>(om->deepCopy());
+    FloatConverter::Pointer ocOm = OrientationMatrixConverter<EbsdLib::FloatArrayType, float>::New();
+    ocOm->setInputData(omCopy);
+    ocOm->convertRepresentationTo(OrientationRepresentation::Type::Euler);
+    EbsdLib::FloatArrayType::Pointer expected = ocOm->getOutputData();
+    DREAM3D_REQUIRE(ocOm->convertRepresentationTo(OrientationRepresentation::Type::Euler, omCopy->getPointer(0), 3))
+    for(size_t i = 0; i < nTuples * 3; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(omCopy->getValue(i), expected->getValue(i))
+    }
+
+    EbsdLib::FloatArrayType::Pointer quatCopy = std::dynamic_pointer_cast<EbsdLib::FloatArrayType>(quats->deepCopy());
+    FloatConverter::Pointer ocQuats = QuaternionConverter<EbsdLib::FloatArrayType, float>::New();
+    ocQuats->setInputData(quatCopy);
+    ocQuats->convertRepresentationTo(OrientationRepresentation::Type::Homochoric);
+    expected = ocQuats->getOutputData();
+    DREAM3D_REQUIRE(ocQuats->convertRepresentationTo(OrientationRepresentation::Type::Homochoric, quatCopy->getPointer(0), 3))
+    for(size_t i = 0; i < nTuples * 3; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(quatCopy->getValue(i), expected->getValue(i))
+    }
+
+    // Same representation into a buffer is a strided copy
+    DREAM3D_REQUIRE(ocEulers->convertRepresentationTo(OrientationRepresentation::Type::Euler, buffer.data(), stride))
+    for(size_t i = 0; i < nTuples; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(buffer[i * stride + 2], eulers->getComponent(i, 2))
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  template <typename T>
+  typename OrientationConverter<EbsdDataArray<T>, T>::Pointer CreateConverter(OrientationRepresentation::Type type)
+  {
+    switch(type)
+    {
+    case OrientationRepresentation::Type::Euler:
+      return EulerConverter<EbsdDataArray<T>, T>::New();
+    case OrientationRepresentation::Type::OrientationMatrix:
+      return OrientationMatrixConverter<EbsdDataArray<T>, T>::New();
+    case OrientationRepresentation::Type::Quaternion:
+      return QuaternionConverter<EbsdDataArray<T>, T>::New();
+    case OrientationRepresentation::Type::AxisAngle:
+      return AxisAngleConverter<EbsdDataArray<T>, T>::New();
+    case OrientationRepresentation::Type::Rodrigues:
+      return RodriguesConverter<EbsdDataArray<T>, T>::New();
+    case OrientationRepresentation::Type::Homochoric:
+      return HomochoricConverter<EbsdDataArray<T>, T>::New();
+    case OrientationRepresentation::Type::Cubochoric:
+      return CubochoricConverter<EbsdDataArray<T>, T>::New();
+    default:
+      break;
+    }
+    return nullptr;
+  }
+
+  // -----------------------------------------------------------------------------
+  template <typename T, typename ReferenceFunc>
+  void CompareFusedConversion(typename EbsdDataArray<T>::Pointer input, OrientationRepresentation::Type fromType, OrientationRepresentation::Type toType, ReferenceFunc reference, T tolerance)
+  {
+    typename OrientationConverter<EbsdDataArray<T>, T>::Pointer converter = CreateConverter<T>(fromType);
+    converter->setUseBatchTransforms(false);
+    converter->setInputData(input);
+    converter->convertRepresentationTo(toType);
+    typename EbsdDataArray<T>::Pointer output = converter->getOutputData();
+
+    size_t inStride = input->getNumberOfComponents();
+    size_t outStride = output->getNumberOfComponents();
+    std::vector<T> expected(outStride);
+    for(size_t i = 0; i < input->getNumberOfTuples(); i++)
+    {
+      reference(input->getPointer(i * inStride), expected.data());
+      T* fused = output->getPointer(i * outStride);
+      for(size_t c = 0; c < outStride; c++)
+      {
+        T delta = std::fabs(fused[c] - expected[c]);
+        if(toType == OrientationRepresentation::Type::Euler)
+        {
+          delta = std::min(delta, static_cast<T>(std::fabs(delta - EbsdLib::Constants::k_2PiD)));
+        }
+        DREAM3D_REQUIRED(delta, <=, tolerance)
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  template <typename T>
+  void TestFusedKernels(T tolerance)
+  {
+    namespace OT = OrientationTransformation;
+    using OrientationType = Orientation<T>;
+    using QuaternionType = Quaternion<T>;
+    using OrientationRepresentation::Type;
+
+    // A scattered set of Euler angles plus the degenerate cases each kernel special cases
+    const size_t nScattered = 20000;
+    std::vector<std::array<T, 3>> angles = {{0.0, 0.0, 0.0},
+                                            {static_cast<T>(EbsdLib::Constants::k_PiOver2D), 0.0, static_cast<T>(EbsdLib::Constants::k_PiOver2D)},
+                                            {0.0, static_cast<T>(EbsdLib::Constants::k_PiD), 0.0},
+                                            {1.0, static_cast<T>(EbsdLib::Constants::k_PiD), 2.0},
+                                            {0.5, 0.0, 0.25}};
+    for(size_t i = 0; i < nScattered; i++)
+    {
+      std::array<double, 3> euler = QuasiRandomEuler(i, false);
+      angles.push_back({static_cast<T>(euler[0]), static_cast<T>(euler[1]), static_cast<T>(euler[2])});
+    }
+
+    // Build the inputs for every representation with the generic conversions
+    size_t nTuples = angles.size();
+    auto makeArray = [nTuples](size_t numComps, const std::string& name) { return EbsdDataArray<T>::CreateArray(nTuples, std::vector<size_t>(1, numComps), name, true); };
+    typename EbsdDataArray<T>::Pointer eu = makeArray(3, "eu");
+    typename EbsdDataArray<T>::Pointer om = makeArray(9, "om");
+    typename EbsdDataArray<T>::Pointer qu = makeArray(4, "qu");
+    typename EbsdDataArray<T>::Pointer ax = makeArray(4, "ax");
+    typename EbsdDataArray<T>::Pointer ro = makeArray(4, "ro");
+    typename EbsdDataArray<T>::Pointer ho = makeArray(3, "ho");
+    typename EbsdDataArray<T>::Pointer cu = makeArray(3, "cu");
+    for(size_t i = 0; i < nTuples; i++)
+    {
+      OrientationType euler(angles[i][0], angles[i][1], angles[i][2]);
+      std::copy(euler.begin(), euler.end(), eu->getPointer(i * 3));
+      OrientationType o = OT::eu2om<OrientationType, OrientationType>(euler);
+      std::copy(o.begin(), o.end(), om->getPointer(i * 9));
+      OT::eu2qu<OrientationType, QuaternionType>(euler).copyInto(qu->getPointer(i * 4), QuaternionType::Order::VectorScalar);
+      OrientationType a = OT::eu2ax<OrientationType, OrientationType>(euler);
+      std::copy(a.begin(), a.end(), ax->getPointer(i * 4));
+      OrientationType r = OT::eu2ro<OrientationType, OrientationType>(euler);
+      std::copy(r.begin(), r.end(), ro->getPointer(i * 4));
+      OrientationType h = OT::eu2ho<OrientationType, OrientationType>(euler);
+      std::copy(h.begin(), h.end(), ho->getPointer(i * 3));
+      OrientationType c = OT::eu2cu<OrientationType, OrientationType>(euler);
+      std::copy(c.begin(), c.end(), cu->getPointer(i * 3));
+    }
+
+    // Reference results from the chained, Orientation based conversions
+    auto toOrientation = [](OrientationType (*func)(const OrientationType&), size_t inComps) {
+      return [func, inComps](T* in, T* out) {
+        OrientationType input(in, inComps);
+        OrientationType result = func(input);
+        std::copy(result.begin(), result.end(), out);
+      };
+    };
+    auto toQuaternion = [](QuaternionType (*func)(const OrientationType&, typename QuaternionType::Order), size_t inComps) {
+      return [func, inComps](T* in, T* out) {
+        OrientationType input(in, inComps);
+        func(input, QuaternionType::Order::VectorScalar).copyInto(out, QuaternionType::Order::VectorScalar);
+      };
+    };
+
+    CompareFusedConversion<T>(eu, Type::Euler, Type::OrientationMatrix, toOrientation(&OT::eu2om<OrientationType, OrientationType>, 3), tolerance);
+    CompareFusedConversion<T>(eu, Type::Euler, Type::Quaternion, toQuaternion(&OT::eu2qu<OrientationType, QuaternionType>, 3), tolerance);
+    CompareFusedConversion<T>(eu, Type::Euler, Type::AxisAngle, toOrientation(&OT::eu2ax<OrientationType, OrientationType>, 3), tolerance);
+    CompareFusedConversion<T>(eu, Type::Euler, Type::Homochoric, toOrientation(&OT::eu2ho<OrientationType, OrientationType>, 3), tolerance);
+    CompareFusedConversion<T>(eu, Type::Euler, Type::Cubochoric, toOrientation(&OT::eu2cu<OrientationType, OrientationType>, 3), tolerance);
+    CompareFusedConversion<T>(om, Type::OrientationMatrix, Type::Euler, toOrientation(&OT::om2eu<OrientationType, OrientationType>, 9), tolerance);
+    CompareFusedConversion<T>(
+        qu, Type::Quaternion, Type::OrientationMatrix,
+        [](T* in, T* out) {
+          OrientationType result = OT::qu2om<QuaternionType, OrientationType>(QuaternionType(in[0], in[1], in[2], in[3]));
+          std::copy(result.begin(), result.end(), out);
+        },
+        tolerance);
+    CompareFusedConversion<T>(ax, Type::AxisAngle, Type::OrientationMatrix, toOrientation(&OT::ax2om<OrientationType, OrientationType>, 4), tolerance);
+    CompareFusedConversion<T>(ax, Type::AxisAngle, Type::Quaternion, toQuaternion(&OT::ax2qu<OrientationType, QuaternionType>, 4), tolerance);
+    CompareFusedConversion<T>(ax, Type::AxisAngle, Type::Homochoric, toOrientation(&OT::ax2ho<OrientationType, OrientationType>, 4), tolerance);
+    CompareFusedConversion<T>(ro, Type::Rodrigues, Type::AxisAngle, toOrientation(&OT::ro2ax<OrientationType, OrientationType>, 4), tolerance);
+    CompareFusedConversion<T>(ro, Type::Rodrigues, Type::Quaternion, toQuaternion(&OT::ro2qu<OrientationType, QuaternionType>, 4), tolerance);
+    CompareFusedConversion<T>(ho, Type::Homochoric, Type::Euler, toOrientation(&OT::ho2eu<OrientationType, OrientationType>, 3), tolerance);
+    CompareFusedConversion<T>(ho, Type::Homochoric, Type::Quaternion, toQuaternion(&OT::ho2qu<OrientationType, QuaternionType>, 3), tolerance);
+    CompareFusedConversion<T>(ho, Type::Homochoric, Type::AxisAngle, toOrientation(&OT::ho2ax<OrientationType, OrientationType>, 3), tolerance);
+    CompareFusedConversion<T>(ho, Type::Homochoric, Type::Cubochoric, toOrientation(&OT::ho2cu<OrientationType, OrientationType>, 3), tolerance);
+    CompareFusedConversion<T>(cu, Type::Cubochoric, Type::Euler, toOrientation(&OT::cu2eu<OrientationType, OrientationType>, 3), tolerance);
+    CompareFusedConversion<T>(cu, Type::Cubochoric, Type::Quaternion, toQuaternion(&OT::cu2qu<OrientationType, QuaternionType>, 3), tolerance);
+    CompareFusedConversion<T>(cu, Type::Cubochoric, Type::Homochoric, toOrientation(&OT::cu2ho<OrientationType, OrientationType>, 3), tolerance);
+
+    // In place cubochoric to Eulers gives the same answer as the out of place conversion
+    typename EbsdDataArray<T>::Pointer cuCopy = std::dynamic_pointer_cast<EbsdDataArray<T>>(cu->deepCopy());
+    typename OrientationConverter<EbsdDataArray<T>, T>::Pointer ocCu = CreateConverter<T>(Type::Cubochoric);
+    ocCu->setUseBatchTransforms(false);
+    ocCu->setInputData(cuCopy);
+    ocCu->convertRepresentationTo(Type::Euler);
+    typename EbsdDataArray<T>::Pointer expected = ocCu->getOutputData();
+    DREAM3D_REQUIRE(ocCu->convertRepresentationTo(Type::Euler, cuCopy->getPointer(0), 3))
+    for(size_t i = 0; i < nTuples * 3; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(cuCopy->getValue(i), expected->getValue(i))
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  void TestFusedConversions()
+  {
+    TestFusedKernels<float>(1.0E-5f);
+    TestFusedKernels<double>(1.0E-12);
+  }
+
+  // -----------------------------------------------------------------------------
+  template <typename T>
+  void TestBatchMathAccuracy(T sinCosTolerance, T atanTolerance)
+  {
+    const size_t nSamples = 100000;
+    T maxSinCos = 0;
+    T maxAtan = 0;
+    for(size_t i = 0; i <= nSamples; i++)
+    {
+      T frac = static_cast<T>(i) / static_cast<T>(nSamples);
+      T angle = static_cast<T>(-8.0 * EbsdLib::Constants::k_PiD) + frac * static_cast<T>(16.0 * EbsdLib::Constants::k_PiD);
+      T s = 0;
+      T c = 0;
+      BatchMath::SinCos(angle, s, c);
+      maxSinCos = std::max({maxSinCos, std::fabs(s - std::sin(angle)), std::fabs(c - std::cos(angle))});
+
+      T x = static_cast<T>(-1.0) + static_cast<T>(2.0) * frac;
+      maxAtan = std::max(maxAtan, std::fabs(BatchMath::Acos(x) - std::acos(x)));
+      T t = static_cast<T>(-100.0) + static_cast<T>(200.0) * frac;
+      maxAtan = std::max(maxAtan, std::fabs(BatchMath::Atan(t) - std::atan(t)));
+      maxAtan = std::max(maxAtan, std::fabs(BatchMath::Atan2(s, c) - std::atan2(s, c)));
+      maxAtan = std::max(maxAtan, std::fabs(BatchMath::Atan2(t, x) - std::atan2(t, x)));
+    }
+    DREAM3D_REQUIRED(maxSinCos, <=, sinCosTolerance)
+    DREAM3D_REQUIRED(maxAtan, <=, atanTolerance)
+
+    DREAM3D_REQUIRE_EQUAL(BatchMath::Atan2(static_cast<T>(0.0), static_cast<T>(0.0)), static_cast<T>(0.0))
+    DREAM3D_REQUIRE_EQUAL(BatchMath::Select(true, static_cast<T>(1.0), static_cast<T>(2.0)), static_cast<T>(1.0))
+    DREAM3D_REQUIRE_EQUAL(BatchMath::Select(false, static_cast<T>(1.0), static_cast<T>(2.0)), static_cast<T>(2.0))
+  }
+
+  // -----------------------------------------------------------------------------
+  void TestBatchMath()
+  {
+    TestBatchMathAccuracy<float>(2.0E-7f, 4.0E-7f);
+    TestBatchMathAccuracy<double>(1.0E-15, 2.0E-15);
+  }
+
+  // -----------------------------------------------------------------------------
+  template <typename T>
+  void TestBatchKernels(T tolerance)
+  {
+    namespace OT = OrientationTransformation;
+    using OrientationType = Orientation<T>;
+    using QuaternionType = Quaternion<T>;
+    using OrientationRepresentation::Type;
+    using ConverterType = OrientationConverter<EbsdDataArray<T>, T>;
+
+    // Scattered Euler angles plus the identity, Phi = 0, Phi = Pi and 180 degree rotations
+    std::vector<std::array<T, 3>> angles = {{0.0, 0.0, 0.0},
+                                            {0.5, 0.0, 0.25},
+                                            {0.0, static_cast<T>(EbsdLib::Constants::k_PiD), 0.0},
+                                            {1.0, static_cast<T>(EbsdLib::Constants::k_PiD), 2.0},
+                                            {static_cast<T>(EbsdLib::Constants::k_PiD), 0.0, 0.0},
+                                            {0.0, static_cast<T>(EbsdLib::Constants::k_PiOver2D), 0.0}};
+    for(size_t i = 0; i < 20000; i++)
+    {
+      std::array<double, 3> euler = QuasiRandomEuler(i, false);
+      angles.push_back({static_cast<T>(euler[0]), static_cast<T>(euler[1]), static_cast<T>(euler[2])});
+    }
+    size_t nTuples = angles.size();
+    std::vector<Type> types = {Type::Euler, Type::OrientationMatrix, Type::Quaternion, Type::AxisAngle, Type::Rodrigues};
+    std::vector<size_t> counts = ConverterType::template GetComponentCounts<std::vector<size_t>>();
+    std::vector<typename EbsdDataArray<T>::Pointer> inputs;
+    for(Type type : types)
+    {
+      inputs.push_back(EbsdDataArray<T>::CreateArray(nTuples, std::vector<size_t>(1, counts[static_cast<size_t>(type)]), "Input", true));
+    }
+    for(size_t i = 0; i < nTuples; i++)
+    {
+      OrientationType euler(angles[i][0], angles[i][1], angles[i][2]);
+      std::copy(euler.begin(), euler.end(), inputs[0]->getPointer(i * 3));
+      OrientationType o = OT::eu2om<OrientationType, OrientationType>(euler);
+      std::copy(o.begin(), o.end(), inputs[1]->getPointer(i * 9));
+      OT::eu2qu<OrientationType, QuaternionType>(euler).copyInto(inputs[2]->getPointer(i * 4), QuaternionType::Order::VectorScalar);
+      OrientationType a = OT::eu2ax<OrientationType, OrientationType>(euler);
+      std::copy(a.begin(), a.end(), inputs[3]->getPointer(i * 4));
+      OrientationType r = OT::eu2ro<OrientationType, OrientationType>(euler);
+      std::copy(r.begin(), r.end(), inputs[4]->getPointer(i * 4));
+    }
+
+    // Every pair in the family against the scalar conversions
+    for(size_t from = 0; from < types.size(); from++)
+    {
+      for(size_t to = 0; to < types.size(); to++)
+      {
+        if(from == to)
+        {
+          continue;
+        }
+        typename ConverterType::Pointer scalarConverter = CreateConverter<T>(types[from]);
+        scalarConverter->setUseBatchTransforms(false);
+        scalarConverter->setInputData(inputs[from]);
+        scalarConverter->convertRepresentationTo(types[to]);
+        typename EbsdDataArray<T>::Pointer expected = scalarConverter->getOutputData();
+
+        typename ConverterType::Pointer batchConverter = CreateConverter<T>(types[from]);
+        DREAM3D_REQUIRE(batchConverter->getUseBatchTransforms())
+        batchConverter->setInputData(inputs[from]);
+        batchConverter->convertRepresentationTo(types[to]);
+        typename EbsdDataArray<T>::Pointer output = batchConverter->getOutputData();
+
+        DREAM3D_REQUIRE_EQUAL(output->getNumberOfComponents(), expected->getNumberOfComponents())
+        DREAM3D_REQUIRE_EQUAL(output->getNumberOfTuples(), nTuples)
+        for(size_t i = 0; i < expected->getSize(); i++)
+        {
+          if(output->getValue(i) == expected->getValue(i))
+          {
+            continue;
+          }
+          T value = output->getValue(i);
+          T expectedValue = expected->getValue(i);
+          // The Rodrigues length tan(w/2) is compared as an angle, it grows without bound near w = Pi
+          if(types[to] == Type::Rodrigues && i % 4 == 3)
+          {
+            value = std::atan(value);
+            expectedValue = std::atan(expectedValue);
+          }
+          T delta = std::fabs(value - expectedValue);
+          if(types[to] == Type::Euler)
+          {
+            delta = std::min(delta, static_cast<T>(std::fabs(delta - EbsdLib::Constants::k_2PiD)));
+          }
+          DREAM3D_REQUIRED(delta, <=, tolerance)
+        }
+      }
+    }
+
+    // Orientation matrices to Eulers in place matches the out of place conversion
+    typename ConverterType::Pointer omConverter = CreateConverter<T>(Type::OrientationMatrix);
+    omConverter->setInputData(inputs[1]);
+    omConverter->convertRepresentationTo(Type::Euler);
+    typename EbsdDataArray<T>::Pointer omEulers = omConverter->getOutputData();
+    typename EbsdDataArray<T>::Pointer omCopy = std::dynamic_pointer_cast<EbsdDataArray<T>>(inputs[1]->deepCopy());
+    omConverter->setInputData(omCopy);
+    DREAM3D_REQUIRE(omConverter->convertRepresentationTo(Type::Euler, omCopy->getPointer(0), 3))
+    for(size_t i = 0; i < nTuples * 3; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(omCopy->getValue(i), omEulers->getValue(i))
+    }
+
+    // SoA input gives the same values as the interleaved batch conversion
+    typename ConverterType::Pointer euConverter = CreateConverter<T>(Type::Euler);
+    euConverter->setInputData(inputs[0]);
+    euConverter->convertRepresentationTo(Type::Quaternion);
+    typename EbsdDataArray<T>::Pointer quaternions = euConverter->getOutputData();
+    std::vector<std::vector<T>> euComps(3, std::vector<T>(nTuples));
+    std::vector<std::vector<T>> quComps(4, std::vector<T>(nTuples));
+    for(size_t i = 0; i < nTuples; i++)
+    {
+      for(size_t c = 0; c < 3; c++)
+      {
+        euComps[c][i] = inputs[0]->getComponent(i, static_cast<int>(c));
+      }
+    }
+    const T* soaIn[3] = {euComps[0].data(), euComps[1].data(), euComps[2].data()};
+    T* soaOut[4] = {quComps[0].data(), quComps[1].data(), quComps[2].data(), quComps[3].data()};
+    DREAM3D_REQUIRE(ConverterType::ConvertSoA(Type::Euler, Type::Quaternion, soaIn, soaOut, nTuples))
+    for(size_t i = 0; i < nTuples; i++)
+    {
+      for(size_t c = 0; c < 4; c++)
+      {
+        DREAM3D_REQUIRE_EQUAL(quComps[c][i], quaternions->getComponent(i, static_cast<int>(c)))
+      }
+    }
+    DREAM3D_REQUIRE_EQUAL(ConverterType::ConvertSoA(Type::Euler, Type::Homochoric, soaIn, soaOut, nTuples), false)
+  }
+
+  // -----------------------------------------------------------------------------
+  void TestBatchConversions()
+  {
+    // Angles taken from acos of values near +-1 move by up to 1/sqrt(1 - x^2) times one rounding of x
+    TestBatchKernels<float>(1.0E-4f);
+    TestBatchKernels<double>(1.0E-11);
+  }
+
   // -----------------------------------------------------------------------------
   void operator()()
   {
@@ -196,5 +615,9 @@ public:
     int err = 0;
     DREAM3D_REGISTER_TEST(TestEuler2Quaternion());
     DREAM3D_REGISTER_TEST(TestEulerConversion());
+    DREAM3D_REGISTER_TEST(TestConvertIntoBuffer());
+    DREAM3D_REGISTER_TEST(TestFusedConversions());
+    DREAM3D_REGISTER_TEST(TestBatchMath());
+    DREAM3D_REGISTER_TEST(TestBatchConversions());
   }
 };
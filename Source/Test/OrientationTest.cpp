@@ -1,7 +1,9 @@
 
 #include <algorithm>
+#include <array>
 #include <complex>
 #include <cstdlib>
+#include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <string>
@@ -19,12 +21,21 @@
 #include <vector>
 
 #include "EbsdLib/Core/EbsdDataArray.hpp"
+#include "EbsdLib/Core/FixedOrientation.hpp"
 #include "EbsdLib/Core/Orientation.hpp"
 #include "EbsdLib/Core/OrientationTransformation.hpp"
 #include "EbsdLib/Core/Quaternion.hpp"
 #include "EbsdLib/EbsdLib.h"
+#include "EbsdLib/LaueOps/CubicOps.h"
+#include "EbsdLib/LaueOps/IPFColorTable.h"
+#include "EbsdLib/LaueOps/IPFLegendCache.h"
+#include "EbsdLib/LaueOps/LaueOps.h"
+#include "EbsdLib/LaueOps/SymmetryGroup.hpp"
+#include "EbsdLib/Utilities/ColorTable.h"
+#include "EbsdLib/Utilities/SharedObjectCache.hpp"
 #include "EbsdLib/Math/ArrayHelpers.hpp"
 #include "EbsdLib/Math/EbsdLibMath.h"
+#include "EbsdLib/Math/EbsdLibRandomEngine.h"
 #include "EbsdLib/Math/EbsdMatrixMath.h"
 
 using namespace EbsdLib::Constants;
@@ -998,6 +1009,773 @@ Rotation vector map              : -0.7854   0.0000   0.0000
     std::cout << "vg: " << vg[0] << "," << vg[1] << "," << vg[2] << std::endl;
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  template <typename FixedType, typename ArrayType>
+  void CompareFixedOrientation(const FixedType& fixed, const ArrayType& expected)
+  {
+    using K = typename FixedType::value_type;
+    DREAM3D_REQUIRE_EQUAL(fixed.size(), expected.size())
+    for(size_t i = 0; i < expected.size(); i++)
+    {
+      K actual = fixed[i];
+      K value = expected[i];
+      DREAM3D_REQUIRE(actual == value || std::abs(actual - value) < static_cast<K>(1.0E-5))
+    }
+  }
+
+  template <typename K>
+  void CompareFixedOrientation(const Quaternion<K>& fixed, const Quaternion<K>& expected)
+  {
+    for(size_t i = 0; i < 4; i++)
+    {
+      DREAM3D_REQUIRE(fixed[i] == expected[i] || std::abs(fixed[i] - expected[i]) < static_cast<K>(1.0E-5))
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  template <typename K>
+  void Test_FixedOrientation()
+  {
+    using OrientType = Orientation<K>;
+    using QuatType = Quaternion<K>;
+    namespace OT = OrientationTransformation;
+
+    static_assert(sizeof(EulerType<K>) == 3 * sizeof(K), "Fixed orientations should not carry any extra storage");
+    static_assert(sizeof(OrientationMatrixType<K>) == 9 * sizeof(K), "Fixed orientations should not carry any extra storage");
+
+    std::vector<std::array<K, 3>> eulers = {{static_cast<K>(0.3926990816987242L), 0.0, 0.0}, {1.0, 0.5, 2.0}, {5.5, 2.9, 0.1}, {0.2, 1.5707963267948966L, 4.0}};
+    for(const auto& e : eulers)
+    {
+      OrientType eu(e[0], e[1], e[2]);
+      OrientType om = OT::eu2om<OrientType, OrientType>(eu);
+      OrientType ax = OT::eu2ax<OrientType, OrientType>(eu);
+      OrientType ro = OT::eu2ro<OrientType, OrientType>(eu);
+      QuatType qu = OT::eu2qu<OrientType, QuatType>(eu);
+      OrientType ho = OT::eu2ho<OrientType, OrientType>(eu);
+      OrientType cu = OT::eu2cu<OrientType, OrientType>(eu);
+      OrientType st = OT::eu2st<OrientType, OrientType>(eu);
+
+      EulerType<K> feu(eu);
+      OrientationMatrixType<K> fom(om);
+      AxisAngleType<K> fax(ax);
+      RodriguesType<K> fro(ro);
+      const QuatType& fqu = qu;
+      HomochoricType<K> fho(ho);
+      CubochoricType<K> fcu(cu);
+      StereographicType<K> fst(st);
+
+      CompareFixedOrientation(OT::eu2om(feu), OT::eu2om<OrientType, OrientType>(eu));
+      CompareFixedOrientation(OT::eu2ax(feu), OT::eu2ax<OrientType, OrientType>(eu));
+      CompareFixedOrientation(OT::eu2ro(feu), OT::eu2ro<OrientType, OrientType>(eu));
+      CompareFixedOrientation(OT::eu2qu(feu), OT::eu2qu<OrientType, QuatType>(eu));
+      CompareFixedOrientation(OT::eu2ho(feu), OT::eu2ho<OrientType, OrientType>(eu));
+      CompareFixedOrientation(OT::eu2cu(feu), OT::eu2cu<OrientType, OrientType>(eu));
+      CompareFixedOrientation(OT::eu2st(feu), OT::eu2st<OrientType, OrientType>(eu));
+      CompareFixedOrientation(OT::om2eu(fom), OT::om2eu<OrientType, OrientType>(om));
+      CompareFixedOrientation(OT::om2ax(fom), OT::om2ax<OrientType, OrientType>(om));
+      CompareFixedOrientation(OT::om2ro(fom), OT::om2ro<OrientType, OrientType>(om));
+      CompareFixedOrientation(OT::om2qu(fom), OT::om2qu<OrientType, QuatType>(om));
+      CompareFixedOrientation(OT::om2ho(fom), OT::om2ho<OrientType, OrientType>(om));
+      CompareFixedOrientation(OT::om2cu(fom), OT::om2cu<OrientType, OrientType>(om));
+      CompareFixedOrientation(OT::om2st(fom), OT::om2st<OrientType, OrientType>(om));
+      CompareFixedOrientation(OT::ax2eu(fax), OT::ax2eu<OrientType, OrientType>(ax));
+      CompareFixedOrientation(OT::ax2om(fax), OT::ax2om<OrientType, OrientType>(ax));
+      CompareFixedOrientation(OT::ax2ro(fax), OT::ax2ro<OrientType, OrientType>(ax));
+      CompareFixedOrientation(OT::ax2qu(fax), OT::ax2qu<OrientType, QuatType>(ax));
+      CompareFixedOrientation(OT::ax2ho(fax), OT::ax2ho<OrientType, OrientType>(ax));
+      CompareFixedOrientation(OT::ax2cu(fax), OT::ax2cu<OrientType, OrientType>(ax));
+      CompareFixedOrientation(OT::ax2st(fax), OT::ax2st<OrientType, OrientType>(ax));
+      CompareFixedOrientation(OT::ro2eu(fro), OT::ro2eu<OrientType, OrientType>(ro));
+      CompareFixedOrientation(OT::ro2om(fro), OT::ro2om<OrientType, OrientType>(ro));
+      CompareFixedOrientation(OT::ro2ax(fro), OT::ro2ax<OrientType, OrientType>(ro));
+      CompareFixedOrientation(OT::ro2qu(fro), OT::ro2qu<OrientType, QuatType>(ro));
+      CompareFixedOrientation(OT::ro2ho(fro), OT::ro2ho<OrientType, OrientType>(ro));
+      CompareFixedOrientation(OT::ro2cu(fro), OT::ro2cu<OrientType, OrientType>(ro));
+      CompareFixedOrientation(OT::ro2st(fro), OT::ro2st<OrientType, OrientType>(ro));
+      CompareFixedOrientation(OT::qu2eu(fqu), OT::qu2eu<QuatType, OrientType>(qu));
+      CompareFixedOrientation(OT::qu2om(fqu), OT::qu2om<QuatType, OrientType>(qu));
+      CompareFixedOrientation(OT::qu2ax(fqu), OT::qu2ax<QuatType, OrientType>(qu));
+      CompareFixedOrientation(OT::qu2ro(fqu), OT::qu2ro<QuatType, OrientType>(qu));
+      CompareFixedOrientation(OT::qu2ho(fqu), OT::qu2ho<QuatType, OrientType>(qu));
+      CompareFixedOrientation(OT::qu2cu(fqu), OT::qu2cu<QuatType, OrientType>(qu));
+      CompareFixedOrientation(OT::qu2st(fqu), OT::qu2st<QuatType, OrientType>(qu));
+      CompareFixedOrientation(OT::ho2eu(fho), OT::ho2eu<OrientType, OrientType>(ho));
+      CompareFixedOrientation(OT::ho2om(fho), OT::ho2om<OrientType, OrientType>(ho));
+      CompareFixedOrientation(OT::ho2ax(fho), OT::ho2ax<OrientType, OrientType>(ho));
+      CompareFixedOrientation(OT::ho2ro(fho), OT::ho2ro<OrientType, OrientType>(ho));
+      CompareFixedOrientation(OT::ho2qu(fho), OT::ho2qu<OrientType, QuatType>(ho));
+      CompareFixedOrientation(OT::ho2cu(fho), OT::ho2cu<OrientType, OrientType>(ho));
+      CompareFixedOrientation(OT::ho2st(fho), OT::ho2st<OrientType, OrientType>(ho));
+      CompareFixedOrientation(OT::cu2eu(fcu), OT::cu2eu<OrientType, OrientType>(cu));
+      CompareFixedOrientation(OT::cu2om(fcu), OT::cu2om<OrientType, OrientType>(cu));
+      CompareFixedOrientation(OT::cu2ax(fcu), OT::cu2ax<OrientType, OrientType>(cu));
+      CompareFixedOrientation(OT::cu2ro(fcu), OT::cu2ro<OrientType, OrientType>(cu));
+      CompareFixedOrientation(OT::cu2qu(fcu), OT::cu2qu<OrientType, QuatType>(cu));
+      CompareFixedOrientation(OT::cu2ho(fcu), OT::cu2ho<OrientType, OrientType>(cu));
+      CompareFixedOrientation(OT::cu2st(fcu), OT::cu2st<OrientType, OrientType>(cu));
+      CompareFixedOrientation(OT::st2eu(fst), OT::st2eu<OrientType, OrientType>(st));
+      CompareFixedOrientation(OT::st2om(fst), OT::st2om<OrientType, OrientType>(st));
+      CompareFixedOrientation(OT::st2ax(fst), OT::st2ax<OrientType, OrientType>(st));
+      CompareFixedOrientation(OT::st2ro(fst), OT::st2ro<OrientType, OrientType>(st));
+      CompareFixedOrientation(OT::st2qu(fst), OT::st2qu<OrientType, QuatType>(st));
+      CompareFixedOrientation(OT::st2ho(fst), OT::st2ho<OrientType, OrientType>(st));
+      CompareFixedOrientation(OT::st2cu(fst), OT::st2cu<OrientType, OrientType>(st));
+    }
+
+    // Round trip between the fixed and heap allocated types
+    EulerType<K> eu(1.0, 0.5, 2.0);
+    OrientType heap = eu.toOrientation();
+    DREAM3D_REQUIRE_EQUAL(heap.size(), 3)
+    EulerType<K> back(heap);
+    DREAM3D_REQUIRE(back[0] == eu[0] && back[1] == eu[1] && back[2] == eu[2])
+    EulerType<double> euD = eu.template to<double>();
+    DREAM3D_REQUIRE(euD[2] == static_cast<double>(eu[2]))
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void Test_LaueOpsFixedOrientation()
+  {
+    namespace OT = OrientationTransformation;
+    std::vector<std::array<double, 3>> eulers = {{0.1, 0.2, 0.3}, {1.5, 0.75, 4.0}, {5.1, 2.9, 0.4}};
+    double random[3] = {0.25, 0.5, 0.75};
+
+    std::vector<LaueOps::Pointer> allOps = LaueOps::GetAllOrientationOps();
+    for(const auto& ops : allOps)
+    {
+      for(size_t i = 0; i < eulers.size(); i++)
+      {
+        EulerD eu(eulers[i][0], eulers[i][1], eulers[i][2]);
+        EulerD eu2(eulers[(i + 1) % eulers.size()][0], eulers[(i + 1) % eulers.size()][1], eulers[(i + 1) % eulers.size()][2]);
+        QuatD q1 = OT::eu2qu(eu);
+        QuatD q2 = OT::eu2qu(eu2);
+
+        AxisAngleD axisAngle;
+        ops->calculateMisorientation(q1, q2, axisAngle);
+        CompareFixedOrientation(axisAngle, ops->calculateMisorientation(q1, q2));
+
+        AxisAngleF axisAngleF;
+        ops->calculateMisorientation(q1.to<float>(), q2.to<float>(), axisAngleF);
+        CompareFixedOrientation(axisAngleF, ops->calculateMisorientation(q1.to<float>(), q2.to<float>()));
+
+        RodriguesD rod = OT::eu2ro(eu);
+        OrientationType rodHeap = rod.toOrientation();
+        CompareFixedOrientation(ops->getODFFZRod(rod), ops->getODFFZRod(rodHeap));
+        DREAM3D_REQUIRE_EQUAL(ops->getOdfBin(rod), ops->getOdfBin(rodHeap))
+        DREAM3D_REQUIRE_EQUAL(ops->getMisoBin(rod), ops->getMisoBin(rodHeap))
+
+        EulerD euler;
+        ops->determineEulerAngles(random, static_cast<int>(i), euler);
+        CompareFixedOrientation(euler, ops->determineEulerAngles(random, static_cast<int>(i)));
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void Test_LaueOpsBatch()
+  {
+    namespace OT = OrientationTransformation;
+    const size_t numPoints = 500;
+    std::vector<float> eulers(numPoints * 3);
+    std::vector<float> q1s(numPoints * 4);
+    std::vector<float> q2s(numPoints * 4);
+    std::vector<int32_t> phases(numPoints);
+    std::vector<uint8_t> mask(numPoints);
+    for(size_t i = 0; i < numPoints; i++)
+    {
+      EulerD eu(0.011 * i, 0.007 * i, 0.013 * i);
+      EulerD eu2(0.017 * i, 0.003 * i, 0.005 * i);
+      OT::eu2qu(eu).to<float>().copyInto(q1s.data() + i * 4, QuatF::Order::VectorScalar);
+      OT::eu2qu(eu2).to<float>().copyInto(q2s.data() + i * 4, QuatF::Order::VectorScalar);
+      eulers[i * 3] = static_cast<float>(eu[0]);
+      eulers[i * 3 + 1] = static_cast<float>(eu[1]);
+      eulers[i * 3 + 2] = static_cast<float>(eu[2]);
+      phases[i] = static_cast<int32_t>(i % 4); // Phase 3 is out of range
+      mask[i] = (i % 7 != 0);
+    }
+    const bool* maskPtr = reinterpret_cast<const bool*>(mask.data());
+    std::vector<uint32_t> crystalStructures = {EbsdLib::CrystalStructure::Cubic_High, EbsdLib::CrystalStructure::Hexagonal_High, EbsdLib::CrystalStructure::UnknownCrystalStructure};
+    std::vector<LaueOps::Pointer> allOps = LaueOps::GetAllOrientationOps();
+    double refDir[3] = {0.0, 0.0, 1.0};
+
+    std::vector<float> axisAngles(numPoints * 4);
+    LaueOps::CalculateMisorientations(q1s.data(), q2s.data(), phases.data(), crystalStructures.data(), crystalStructures.size(), numPoints, axisAngles.data(), maskPtr);
+    std::vector<uint8_t> rgb(numPoints * 3);
+    LaueOps::GenerateIPFColors(eulers.data(), phases.data(), crystalStructures.data(), crystalStructures.size(), numPoints, refDir, rgb.data(), maskPtr);
+    std::vector<float> fzQuats = q1s;
+    LaueOps::ToFundamentalZone(fzQuats.data(), phases.data(), crystalStructures.data(), crystalStructures.size(), numPoints, maskPtr);
+
+    for(size_t i = 0; i < numPoints; i++)
+    {
+      const float* q1 = q1s.data() + i * 4;
+      const float* q2 = q2s.data() + i * 4;
+      bool valid = mask[i] != 0 && phases[i] < 2;
+      if(!valid)
+      {
+        DREAM3D_REQUIRE(axisAngles[i * 4 + 3] == 0.0F)
+        DREAM3D_REQUIRE(rgb[i * 3] == 0 && rgb[i * 3 + 1] == 0 && rgb[i * 3 + 2] == 0)
+        DREAM3D_REQUIRE(std::equal(q1, q1 + 4, fzQuats.data() + i * 4))
+        continue;
+      }
+      const LaueOps& ops = *allOps[crystalStructures[phases[i]]];
+
+      AxisAngleD axisAngle;
+      ops.calculateMisorientation(QuatD(q1[0], q1[1], q1[2], q1[3]), QuatD(q2[0], q2[1], q2[2], q2[3]), axisAngle);
+      for(size_t c = 0; c < 4; c++)
+      {
+        DREAM3D_REQUIRE(axisAngles[i * 4 + c] == static_cast<float>(axisAngle[c]))
+      }
+
+      EbsdLib::Rgb argb = ops.generateIPFColor(eulers[i * 3], eulers[i * 3 + 1], eulers[i * 3 + 2], refDir[0], refDir[1], refDir[2], false);
+      DREAM3D_REQUIRE(rgb[i * 3] == EbsdLib::RgbColor::dRed(argb) && rgb[i * 3 + 1] == EbsdLib::RgbColor::dGreen(argb) && rgb[i * 3 + 2] == EbsdLib::RgbColor::dBlue(argb))
+
+      QuatD fz = ops.getFZQuat(QuatD(q1[0], q1[1], q1[2], q1[3]));
+      for(size_t c = 0; c < 4; c++)
+      {
+        DREAM3D_REQUIRE(fzQuats[i * 4 + c] == static_cast<float>(fz[c]))
+      }
+    }
+
+    // Single phase entry points
+    const LaueOps& cubic = *allOps[EbsdLib::CrystalStructure::Cubic_High];
+    std::vector<float> singleAxisAngles(numPoints * 4);
+    cubic.calculateMisorientations(q1s.data(), q2s.data(), numPoints, singleAxisAngles.data());
+    std::vector<uint8_t> singleRgb(numPoints * 3);
+    cubic.generateIPFColors(eulers.data(), numPoints, refDir, singleRgb.data());
+    for(size_t i = 0; i < numPoints; i++)
+    {
+      if(mask[i] != 0 && phases[i] == 0)
+      {
+        DREAM3D_REQUIRE(std::equal(axisAngles.begin() + i * 4, axisAngles.begin() + i * 4 + 4, singleAxisAngles.begin() + i * 4))
+        DREAM3D_REQUIRE(std::equal(rgb.begin() + i * 3, rgb.begin() + i * 3 + 3, singleRgb.begin() + i * 3))
+      }
+    }
+
+    // The batches run the non-virtual code of each Laue class, which must match the virtual methods exactly. A
+    // subclass from outside of the library goes through the virtual methods.
+    class DerivedCubicOps : public CubicOps
+    {
+    };
+    DerivedCubicOps derivedCubic;
+    std::vector<const LaueOps*> batchOps = {&derivedCubic};
+    for(size_t l = 0; l < EbsdLib::CrystalStructure::LaueGroupEnd; l++)
+    {
+      batchOps.push_back(allOps[l].get());
+    }
+    for(const LaueOps* ops : batchOps)
+    {
+      ops->calculateMisorientations(q1s.data(), q2s.data(), numPoints, singleAxisAngles.data());
+      ops->generateIPFColors(eulers.data(), numPoints, refDir, singleRgb.data());
+      std::vector<float> singleFZQuats = q1s;
+      ops->toFundamentalZone(singleFZQuats.data(), numPoints);
+      for(size_t i = 0; i < numPoints; i++)
+      {
+        const float* q1 = q1s.data() + i * 4;
+        const float* q2 = q2s.data() + i * 4;
+        AxisAngleD axisAngle;
+        ops->calculateMisorientation(QuatD(q1[0], q1[1], q1[2], q1[3]), QuatD(q2[0], q2[1], q2[2], q2[3]), axisAngle);
+        QuatD fz = ops->getFZQuat(QuatD(q1[0], q1[1], q1[2], q1[3]));
+        for(size_t c = 0; c < 4; c++)
+        {
+          DREAM3D_REQUIRE(singleAxisAngles[i * 4 + c] == static_cast<float>(axisAngle[c]))
+          DREAM3D_REQUIRE(singleFZQuats[i * 4 + c] == static_cast<float>(fz[c]))
+        }
+        EbsdLib::Rgb argb = ops->generateIPFColor(eulers[i * 3], eulers[i * 3 + 1], eulers[i * 3 + 2], refDir[0], refDir[1], refDir[2], false);
+        DREAM3D_REQUIRE(singleRgb[i * 3] == EbsdLib::RgbColor::dRed(argb) && singleRgb[i * 3 + 1] == EbsdLib::RgbColor::dGreen(argb) &&
+                        singleRgb[i * 3 + 2] == EbsdLib::RgbColor::dBlue(argb))
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void Test_QuatSymmetrySoA()
+  {
+    namespace OT = OrientationTransformation;
+    std::vector<LaueOps::Pointer> allOps = LaueOps::GetAllOrientationOps();
+    for(const auto& ops : allOps)
+    {
+      std::vector<QuatD> quatsym;
+      for(int i = 0; i < ops->getNumSymOps(); i++)
+      {
+        quatsym.push_back(ops->getQuatSymOp(i));
+      }
+      QuatSymmetrySoA soa(quatsym);
+      DREAM3D_REQUIRE_EQUAL(soa.size(), quatsym.size())
+
+      for(size_t n = 0; n < 50; n++)
+      {
+        QuatD q1 = OT::eu2qu(EulerD(0.13 * n, 0.051 * n, 0.29 * n));
+        QuatD q2 = OT::eu2qu(EulerD(0.37 * n, 0.023 * n, 0.11 * n));
+
+        // Reference: apply every operator one at a time
+        size_t originIndex = 0;
+        size_t nearestIndex = 0;
+        double originDist = 1000000.0;
+        double nearestDist = 1000000.0;
+        for(size_t i = 0; i < quatsym.size(); i++)
+        {
+          QuatD qc = quatsym[i] * q2;
+          QuatD product = soa.multiply(i, q2);
+          CompareFixedOrientation(product, qc);
+          double dist = 1.0 - std::min(std::abs(qc.w()), 1.0);
+          if(dist < originDist)
+          {
+            originDist = dist;
+            originIndex = i;
+          }
+          if(qc.w() < 0)
+          {
+            qc.negate();
+          }
+          dist = 1.0 - (qc.w() * q1.w() + qc.x() * q1.x() + qc.y() * q1.y() + qc.z() * q1.z());
+          if(dist < nearestDist)
+          {
+            nearestDist = dist;
+            nearestIndex = i;
+          }
+        }
+        DREAM3D_REQUIRE_EQUAL(soa.findMaxAbsScalar(q2), originIndex)
+        DREAM3D_REQUIRE_EQUAL(soa.findNearest(q1, q2), nearestIndex)
+
+        // The misorientation angle must be the smallest angle of all of the symmetric equivalents
+        AxisAngleD axisAngle;
+        ops->calculateMisorientation(q1, q2, axisAngle);
+        QuatD qr = q1 * q2.conjugate();
+        double minAngle = EbsdLib::Constants::k_2PiD;
+        for(const auto& sym : quatsym)
+        {
+          double angle = 2.0 * std::acos(std::min(std::abs((sym * qr).w()), 1.0));
+          minAngle = std::min(minAngle, angle);
+        }
+        DREAM3D_REQUIRE(std::abs(axisAngle[3] - minAngle) < 1.0E-6)
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  template <uint32_t LaueClass>
+  void CheckSymmetryGroup()
+  {
+    namespace OT = OrientationTransformation;
+    using GroupType = SymmetryGroup<LaueClass>;
+    LaueOps::Pointer ops = LaueOps::GetAllOrientationOps()[LaueClass];
+    DREAM3D_REQUIRE_EQUAL(GroupType::k_SymOpsCount, static_cast<size_t>(ops->getNumSymOps()))
+
+    for(size_t i = 0; i < GroupType::k_SymOpsCount; i++)
+    {
+      CompareFixedOrientation(GroupType::QuatSymOp(i), ops->getQuatSymOp(static_cast<int>(i)));
+      double rod[3] = {0.0, 0.0, 0.0};
+      ops->getRodSymOp(static_cast<int>(i), rod);
+      double g[3][3];
+      ops->getMatSymOp(static_cast<int>(i), g);
+      for(size_t r = 0; r < 3; r++)
+      {
+        DREAM3D_REQUIRE(GroupType::RodSym[i][r] == rod[r])
+        for(size_t c = 0; c < 3; c++)
+        {
+          DREAM3D_REQUIRE(GroupType::MatSym[i][r][c] == g[r][c])
+        }
+      }
+    }
+
+    for(size_t n = 0; n < 25; n++)
+    {
+      QuatD q1 = OT::eu2qu(EulerD(0.21 * n, 0.043 * n, 0.17 * n));
+      QuatD q2 = OT::eu2qu(EulerD(0.31 * n, 0.027 * n, 0.09 * n));
+      CompareFixedOrientation(GroupType::FZQuat(q1), ops->getFZQuat(q1));
+      CompareFixedOrientation(GroupType::NearestQuat(q1, q2), ops->getNearestQuat(q1, q2));
+      AxisAngleD axisAngle;
+      ops->calculateMisorientation(q1, q2, axisAngle);
+      DREAM3D_REQUIRE(std::abs(GroupType::Misorientation(q1, q2)[3] - axisAngle[3]) < 1.0E-6)
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void Test_SymmetryGroup()
+  {
+    CheckSymmetryGroup<EbsdLib::CrystalStructure::Hexagonal_High>();
+    CheckSymmetryGroup<EbsdLib::CrystalStructure::Cubic_High>();
+    CheckSymmetryGroup<EbsdLib::CrystalStructure::Hexagonal_Low>();
+    CheckSymmetryGroup<EbsdLib::CrystalStructure::Cubic_Low>();
+    CheckSymmetryGroup<EbsdLib::CrystalStructure::Triclinic>();
+    CheckSymmetryGroup<EbsdLib::CrystalStructure::Monoclinic>();
+    CheckSymmetryGroup<EbsdLib::CrystalStructure::OrthoRhombic>();
+    CheckSymmetryGroup<EbsdLib::CrystalStructure::Tetragonal_Low>();
+    CheckSymmetryGroup<EbsdLib::CrystalStructure::Tetragonal_High>();
+    CheckSymmetryGroup<EbsdLib::CrystalStructure::Trigonal_Low>();
+    CheckSymmetryGroup<EbsdLib::CrystalStructure::Trigonal_High>();
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void Test_MisorientationCache()
+  {
+    namespace OT = OrientationTransformation;
+    LaueOps::Pointer ops = LaueOps::GetAllOrientationOps()[EbsdLib::CrystalStructure::Cubic_High];
+    DREAM3D_REQUIRE(ops->getMisorientationCache() == nullptr)
+
+    const size_t numPairs = 200;
+    std::vector<QuatD> q1s;
+    std::vector<QuatD> q2s;
+    for(size_t i = 0; i < numPairs; i++)
+    {
+      q1s.push_back(OT::eu2qu(EulerD(0.021 * i, 0.013 * i, 0.007 * i)));
+      q2s.push_back(OT::eu2qu(EulerD(0.011 * i, 0.017 * i, 0.019 * i)));
+    }
+
+    MisorientationCache::Pointer cache = MisorientationCache::New(1024);
+    ops->setMisorientationCache(cache);
+    for(size_t pass = 0; pass < 2; pass++)
+    {
+      for(size_t i = 0; i < numPairs; i++)
+      {
+        AxisAngleD expected;
+        ops->calculateMisorientation(q1s[i], q2s[i], expected);
+        AxisAngleD cached;
+        ops->calculateMisorientationCached(q1s[i], q2s[i], cached);
+        CompareFixedOrientation(cached, expected);
+        AxisAngleD feature;
+        ops->calculateFeatureMisorientation(static_cast<int32_t>(i), static_cast<int32_t>(i + 1), q1s[i], q2s[i], feature);
+        CompareFixedOrientation(feature, expected);
+      }
+    }
+    MisorientationCache::Statistics stats = cache->getStatistics();
+    DREAM3D_REQUIRE_EQUAL(stats.misses, 2 * numPairs)
+    DREAM3D_REQUIRE_EQUAL(stats.hits, 2 * numPairs)
+    DREAM3D_REQUIRE_EQUAL(stats.size, 2 * numPairs)
+
+    // The cache must stay bounded
+    MisorientationCache::Pointer smallCache = MisorientationCache::New(64);
+    AxisAngleD axisAngle(0.0, 0.0, 1.0, 0.5);
+    for(int32_t i = 0; i < 10000; i++)
+    {
+      smallCache->insert(MisorientationCache::FeatureKey(0, i, i), axisAngle);
+    }
+    stats = smallCache->getStatistics();
+    DREAM3D_REQUIRED(stats.size, <=, 2 * 64)
+    DREAM3D_REQUIRED(stats.evictions, >, 0)
+    smallCache->clear();
+    DREAM3D_REQUIRE_EQUAL(smallCache->getStatistics().size, 0)
+
+    // A hit in the previous generation must survive even when the current generation is full. Each shard holds
+    // a single entry, so some of these keys land in the same shard as the hot key.
+    MisorientationCache::Key hotKey = MisorientationCache::FeatureKey(0, -1, -1);
+    for(int32_t i = 0; i < 1000; i++)
+    {
+      smallCache->clear();
+      smallCache->insert(hotKey, axisAngle);
+      smallCache->insert(MisorientationCache::FeatureKey(0, i, i), axisAngle);
+      AxisAngleD found;
+      DREAM3D_REQUIRE(smallCache->find(hotKey, found))
+      DREAM3D_REQUIRE(smallCache->find(hotKey, found))
+    }
+    smallCache->clear();
+
+    // Pairs with the same relative rotation share an entry, whichever way each quaternion is written
+    cache->clear();
+    QuatD rotation = OT::eu2qu(EulerD(0.3, 1.1, 2.5));
+    AxisAngleD equivalent;
+    ops->calculateMisorientationCached(q1s[7], q2s[7], equivalent);
+    ops->calculateMisorientationCached(q1s[7] * rotation, q2s[7] * rotation, equivalent);
+    ops->calculateMisorientationCached(QuatD(-q1s[7].x(), -q1s[7].y(), -q1s[7].z(), -q1s[7].w()), q2s[7], equivalent);
+    DREAM3D_REQUIRE_EQUAL(cache->getStatistics().misses, 1)
+    DREAM3D_REQUIRE_EQUAL(cache->getStatistics().hits, 2)
+
+    // A cache shared between Laue classes never returns the result of the other symmetry
+    LaueOps::Pointer hexOps = LaueOps::GetAllOrientationOps()[EbsdLib::CrystalStructure::Hexagonal_High];
+    hexOps->setMisorientationCache(cache);
+    for(size_t i = 0; i < numPairs; i++)
+    {
+      AxisAngleD expected;
+      hexOps->calculateMisorientation(q1s[i], q2s[i], expected);
+      AxisAngleD cached;
+      ops->calculateMisorientationCached(q1s[i], q2s[i], cached);
+      hexOps->calculateMisorientationCached(q1s[i], q2s[i], cached);
+      CompareFixedOrientation(cached, expected);
+    }
+    hexOps->setMisorientationCache(MisorientationCache::NullPointer());
+
+    // Quantized keys keep the misorientation angle within the documented bound. The perturbed pairs mostly share
+    // the key of the original pair and are then answered with its result.
+    const double k_QuantizedAngleBound = 1.25E-4;
+    cache->clear();
+    for(size_t i = 0; i < numPairs; i++)
+    {
+      AxisAngleD cached;
+      ops->calculateMisorientationCached(q1s[i], q2s[i], cached);
+      QuatD q1Perturbed(q1s[i].x() + 1.0E-5, q1s[i].y() - 1.0E-5, q1s[i].z(), q1s[i].w());
+      QuatD q2Perturbed(q2s[i].x(), q2s[i].y() + 1.0E-5, q2s[i].z() - 1.0E-5, q2s[i].w());
+      q1Perturbed = q1Perturbed.unitQuaternion();
+      q2Perturbed = q2Perturbed.unitQuaternion();
+      AxisAngleD exact;
+      ops->calculateMisorientation(q1Perturbed, q2Perturbed, exact);
+      ops->calculateMisorientationCached(q1Perturbed, q2Perturbed, cached);
+      DREAM3D_REQUIRED(std::abs(cached[3] - exact[3]), <=, k_QuantizedAngleBound)
+    }
+    DREAM3D_REQUIRED(cache->getStatistics().hits, >, 0)
+
+    // Batched (and possibly threaded) calls only go through the cache when asked to
+    std::vector<float> q1f(numPairs * 4);
+    std::vector<float> q2f(numPairs * 4);
+    for(size_t i = 0; i < numPairs; i++)
+    {
+      q1s[i].to<float>().copyInto(q1f.data() + i * 4, QuatF::Order::VectorScalar);
+      q2s[i].to<float>().copyInto(q2f.data() + i * 4, QuatF::Order::VectorScalar);
+    }
+    cache->clear();
+    std::vector<float> first(numPairs * 4);
+    std::vector<float> second(numPairs * 4);
+    ops->calculateMisorientations(q1f.data(), q2f.data(), numPairs, first.data());
+    DREAM3D_REQUIRE_EQUAL(cache->getStatistics().misses, 0)
+    ops->calculateMisorientations(q1f.data(), q2f.data(), numPairs, second.data(), nullptr, true);
+    ops->calculateMisorientations(q1f.data(), q2f.data(), numPairs, second.data(), nullptr, true);
+    DREAM3D_REQUIRED(cache->getStatistics().hits, >=, numPairs)
+    for(size_t i = 0; i < numPairs; i++)
+    {
+      DREAM3D_REQUIRED(std::abs(first[i * 4 + 3] - second[i * 4 + 3]), <=, k_QuantizedAngleBound)
+    }
+
+    ops->setMisorientationCache(MisorientationCache::NullPointer());
+    DREAM3D_REQUIRE(ops->getMisorientationCache() == nullptr)
+  }
+
+  void Test_MisorientationAngleFZ()
+  {
+    namespace OT = OrientationTransformation;
+    std::vector<LaueOps::Pointer> allOps = LaueOps::GetAllOrientationOps();
+    const size_t numPairs = 300;
+    for(size_t l = 0; l < EbsdLib::CrystalStructure::LaueGroupEnd; l++)
+    {
+      const LaueOps& ops = *allOps[l];
+      DREAM3D_REQUIRE_EQUAL(ops.getQuatSymmetrySoA().size(), static_cast<size_t>(ops.getNumSymOps()))
+
+      std::vector<float> q1f(numPairs * 4);
+      std::vector<float> q2f(numPairs * 4);
+      std::vector<double> expected(numPairs);
+      for(size_t i = 0; i < numPairs; i++)
+      {
+        QuatD q1 = ops.getFZQuat(OT::eu2qu(EulerD(0.021 * i, 0.013 * i, 0.007 * i)));
+        // Every third pair is far apart, the rest are small rotations like neighbors inside a grain
+        QuatD delta = OT::eu2qu(EulerD(0.003 * (i % 7), 0.002 * (i % 5), 0.001 * (i % 3)));
+        if(i % 3 == 0)
+        {
+          delta = OT::eu2qu(EulerD(0.037 * i, 0.029 * i, 0.011 * i));
+        }
+        QuatD q2 = ops.getFZQuat(q1 * delta);
+
+        AxisAngleD axisAngle;
+        ops.calculateMisorientation(q1, q2, axisAngle);
+        expected[i] = axisAngle[3];
+        DREAM3D_REQUIRE(std::abs(ops.calculateMisorientationAngleFZ(q1, q2) - expected[i]) < 1.0E-6)
+
+        q1.to<float>().copyInto(q1f.data() + i * 4, QuatF::Order::VectorScalar);
+        q2.to<float>().copyInto(q2f.data() + i * 4, QuatF::Order::VectorScalar);
+      }
+
+      std::vector<float> angles(numPairs);
+      ops.calculateMisorientationAnglesFZ(q1f.data(), q2f.data(), numPairs, angles.data());
+      for(size_t i = 0; i < numPairs; i++)
+      {
+        DREAM3D_REQUIRE(std::abs(angles[i] - expected[i]) < 1.0E-3)
+      }
+
+      std::vector<int32_t> phases(numPairs, 1);
+      phases[0] = 0;
+      std::array<uint32_t, 2> crystalStructures = {EbsdLib::CrystalStructure::UnknownCrystalStructure, static_cast<uint32_t>(l)};
+      std::vector<float> phaseAngles(numPairs);
+      LaueOps::CalculateMisorientationAnglesFZ(q1f.data(), q2f.data(), phases.data(), crystalStructures.data(), crystalStructures.size(), numPairs, phaseAngles.data());
+      DREAM3D_REQUIRE_EQUAL(phaseAngles[0], 0.0F)
+      for(size_t i = 1; i < numPairs; i++)
+      {
+        DREAM3D_REQUIRE_EQUAL(phaseAngles[i], angles[i])
+      }
+    }
+  }
+
+  void Test_RandomEngine()
+  {
+    namespace OT = OrientationTransformation;
+    // Known answer vectors from the Random123 reference implementation
+    std::array<uint32_t, 4> block = PhiloxEngine::Generate({0, 0}, 0, 0);
+    DREAM3D_REQUIRE_EQUAL(block[0], 0x6627e8d5U)
+    DREAM3D_REQUIRE_EQUAL(block[3], 0x9b00dbd8U)
+    block = PhiloxEngine::Generate({0xa4093822, 0x299f31d0}, 0x85a308d3243f6a88ULL, 0x0370734413198a2eULL);
+    DREAM3D_REQUIRE_EQUAL(block[0], 0xd16cfe09U)
+    DREAM3D_REQUIRE_EQUAL(block[3], 0x24126ea1U)
+
+    PhiloxEngine engine(42);
+    for(size_t i = 0; i < 1000; i++)
+    {
+      double value = engine.generateDouble();
+      DREAM3D_REQUIRE(value >= 0.0 && value < 1.0)
+      DREAM3D_REQUIRE(engine.generateIndex(24) < 24)
+    }
+
+    std::vector<size_t> first(100);
+    EbsdLibRandomEngine::SetSeed(1234);
+    DREAM3D_REQUIRE_EQUAL(EbsdLibRandomEngine::GetSeed(), 1234)
+    std::vector<LaueOps::Pointer> allOps = LaueOps::GetAllOrientationOps();
+    const LaueOps& cubic = *allOps[EbsdLib::CrystalStructure::Cubic_High];
+    for(auto& symOp : first)
+    {
+      symOp = cubic.getRandomSymmetryOperatorIndex(cubic.getNumSymOps());
+    }
+    EbsdLibRandomEngine::SetSeed(1234);
+    for(const auto& symOp : first)
+    {
+      DREAM3D_REQUIRE_EQUAL(cubic.getRandomSymmetryOperatorIndex(cubic.getNumSymOps()), symOp)
+    }
+
+    const size_t numEulers = 500;
+    std::vector<float> eulers(numEulers * 3);
+    for(size_t i = 0; i < numEulers; i++)
+    {
+      eulers[i * 3] = static_cast<float>(0.011 * i);
+      eulers[i * 3 + 1] = static_cast<float>(0.005 * i);
+      eulers[i * 3 + 2] = static_cast<float>(0.007 * i);
+    }
+    for(size_t l = 0; l < EbsdLib::CrystalStructure::LaueGroupEnd; l++)
+    {
+      const LaueOps& ops = *allOps[l];
+      std::vector<float> random1 = eulers;
+      std::vector<float> random2 = eulers;
+      std::vector<float> random3 = eulers;
+      ops.randomizeEulerAngles(random1.data(), numEulers, 99);
+      ops.randomizeEulerAngles(random2.data(), numEulers, 99);
+      ops.randomizeEulerAngles(random3.data(), numEulers, 100);
+      DREAM3D_REQUIRE(random1 == random2)
+      if(ops.getNumSymOps() > 1)
+      {
+        DREAM3D_REQUIRE(random1 != random3)
+      }
+      for(size_t i = 0; i < numEulers; i++)
+      {
+        // The randomized orientation is symmetrically equivalent to the input
+        QuatD q1 = OT::eu2qu(EulerD(eulers[i * 3], eulers[i * 3 + 1], eulers[i * 3 + 2]));
+        QuatD q2 = OT::eu2qu(EulerD(random1[i * 3], random1[i * 3 + 1], random1[i * 3 + 2]));
+        DREAM3D_REQUIRE(ops.calculateMisorientationAngleFZ(ops.getFZQuat(q1), ops.getFZQuat(q2)) < 1.0E-2)
+      }
+    }
+  }
+
+  void Test_IPFColorTable()
+  {
+    const size_t numPoints = 5000;
+    std::vector<float> eulers(numPoints * 3);
+    for(size_t i = 0; i < numPoints; i++)
+    {
+      std::array<double, 3> euler = QuasiRandomEuler(i, true);
+      eulers[i * 3] = static_cast<float>(euler[0]);
+      eulers[i * 3 + 1] = static_cast<float>(euler[1]);
+      eulers[i * 3 + 2] = static_cast<float>(euler[2]);
+    }
+    const double refDir[3] = {0.0, 0.0, 1.0};
+    std::vector<LaueOps::Pointer> allOps = LaueOps::GetAllOrientationOps();
+    for(size_t l = 0; l < EbsdLib::CrystalStructure::LaueGroupEnd; l++)
+    {
+      const LaueOps& ops = *allOps[l];
+      IPFColorTable::Pointer table = IPFColorTable::Get(ops, 256);
+      DREAM3D_REQUIRE(table == IPFColorTable::Get(ops, 256))
+
+      std::vector<uint8_t> exact(numPoints * 3);
+      std::vector<uint8_t> nearest(numPoints * 3);
+      std::vector<uint8_t> bilinear(numPoints * 3);
+      ops.generateIPFColors(eulers.data(), numPoints, refDir, exact.data());
+      table->generateIPFColors(eulers.data(), numPoints, refDir, nearest.data(), nullptr, false, IPFColorTable::Interpolation::Nearest);
+      table->generateIPFColors(eulers.data(), numPoints, refDir, bilinear.data());
+
+      // Away from the edges of the unit triangle the table colors are within a few levels of the exact colors
+      size_t nearestClose = 0;
+      size_t bilinearClose = 0;
+      for(size_t i = 0; i < numPoints * 3; i++)
+      {
+        nearestClose += (std::abs(static_cast<int>(nearest[i]) - static_cast<int>(exact[i])) <= 8) ? 1 : 0;
+        bilinearClose += (std::abs(static_cast<int>(bilinear[i]) - static_cast<int>(exact[i])) <= 8) ? 1 : 0;
+      }
+      DREAM3D_REQUIRE(nearestClose > numPoints * 3 * 98 / 100)
+      DREAM3D_REQUIRE(bilinearClose > numPoints * 3 * 98 / 100)
+    }
+    IPFColorTable::ClearCache();
+  }
+
+  void Test_IPFLegendCache()
+  {
+    const int imageDim = 64;
+    IPFLegendCache::ClearCache();
+    std::vector<LaueOps::Pointer> allOps = LaueOps::GetAllOrientationOps();
+    for(size_t l = 0; l < EbsdLib::CrystalStructure::LaueGroupEnd; l++)
+    {
+      const LaueOps& ops = *allOps[l];
+      EbsdLib::UInt8ArrayType::Pointer legend = IPFLegendCache::Get(ops, imageDim);
+      DREAM3D_REQUIRE(legend == IPFLegendCache::Get(ops, imageDim))
+      DREAM3D_REQUIRE_EQUAL(legend->getNumberOfTuples(), static_cast<size_t>(imageDim * imageDim))
+      DREAM3D_REQUIRE_EQUAL(legend->getNumberOfComponents(), 4)
+
+      // A legend rendered again after the cache is cleared is identical, whatever the row split was
+      EbsdLib::UInt8ArrayType::Pointer rendered = ops.generateIPFTriangleLegend(imageDim);
+      DREAM3D_REQUIRE(legend != rendered)
+      DREAM3D_REQUIRE(std::equal(legend->getPointer(0), legend->getPointer(0) + legend->getSize(), rendered->getPointer(0)))
+      DREAM3D_REQUIRE(legend != IPFLegendCache::Get(ops, imageDim + 1))
+    }
+    IPFLegendCache::ClearCache();
+    DREAM3D_REQUIRE_EQUAL(IPFLegendCache::GetCacheSize(), 0)
+
+    std::pair<int32_t, std::string> result = IPFLegendCache::ExportLegends(UnitTest::TestTempDir, 32);
+    DREAM3D_REQUIRE_EQUAL(result.first, 0)
+    for(size_t l = 0; l < EbsdLib::CrystalStructure::LaueGroupEnd; l++)
+    {
+      std::ifstream file(UnitTest::TestTempDir + "/" + IPFLegendCache::ExportLegendFileName(*allOps[l], 32), std::ios::binary | std::ios::ate);
+      DREAM3D_REQUIRE(file.is_open())
+      DREAM3D_REQUIRE(static_cast<size_t>(file.tellg()) > 32 * 32 * 4)
+    }
+    IPFLegendCache::ClearCache();
+  }
+
+  void Test_SharedObjectCache()
+  {
+    SharedObjectCache<int, std::shared_ptr<const int>> cache(2);
+    DREAM3D_REQUIRE_EQUAL(cache.getMaxSize(), 2)
+    int builds = 0;
+    auto get = [&cache, &builds](int key) {
+      return cache.get(key, [key, &builds]() {
+        builds++;
+        return std::make_shared<const int>(key);
+      });
+    };
+
+    std::shared_ptr<const int> one = get(1);
+    std::shared_ptr<const int> two = get(2);
+    DREAM3D_REQUIRE(one == get(1))
+    DREAM3D_REQUIRE_EQUAL(builds, 2)
+
+    // Key 2 is the least recently used one, so it is dropped. The caller's reference stays valid.
+    get(3);
+    DREAM3D_REQUIRE_EQUAL(cache.size(), 2)
+    DREAM3D_REQUIRE_EQUAL(*two, 2)
+    DREAM3D_REQUIRE(one == get(1))
+    DREAM3D_REQUIRE_EQUAL(builds, 3)
+    DREAM3D_REQUIRE(two != get(2))
+    DREAM3D_REQUIRE_EQUAL(builds, 4)
+
+    cache.clear();
+    DREAM3D_REQUIRE_EQUAL(cache.size(), 0)
+    DREAM3D_REQUIRE_EQUAL(*one, 1)
+  }
+
   void operator()()
   {
     std::cout << "<===== Start " << getNameOfClass() << std::endl;
@@ -1025,6 +1803,19 @@ Rotation vector map              : -0.7854   0.0000   0.0000
 
     DREAM3D_REGISTER_TEST(Test_st2_XXX());
 
+    DREAM3D_REGISTER_TEST(Test_FixedOrientation<double>());
+    DREAM3D_REGISTER_TEST(Test_FixedOrientation<float>());
+    DREAM3D_REGISTER_TEST(Test_LaueOpsFixedOrientation());
+    DREAM3D_REGISTER_TEST(Test_LaueOpsBatch());
+    DREAM3D_REGISTER_TEST(Test_QuatSymmetrySoA());
+    DREAM3D_REGISTER_TEST(Test_SymmetryGroup());
+    DREAM3D_REGISTER_TEST(Test_MisorientationCache());
+    DREAM3D_REGISTER_TEST(Test_MisorientationAngleFZ());
+    DREAM3D_REGISTER_TEST(Test_RandomEngine());
+    DREAM3D_REGISTER_TEST(Test_IPFColorTable());
+    DREAM3D_REGISTER_TEST(Test_IPFLegendCache());
+    DREAM3D_REGISTER_TEST(Test_SharedObjectCache());
+
     DREAM3D_REGISTER_TEST(TestInputs());
   }
 
@@ -33,7 +33,11 @@
  *
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include <iostream>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -49,8 +53,14 @@
 #include "EbsdLib/LaueOps/TriclinicOps.h"
 #include "EbsdLib/LaueOps/TrigonalLowOps.h"
 #include "EbsdLib/LaueOps/TrigonalOps.h"
+#include "EbsdLib/Texture/ODFBuilder.h"
+#include "EbsdLib/Texture/ODFSampler.h"
 #include "EbsdLib/Texture/StatsGen.hpp"
 #include "EbsdLib/Texture/Texture.hpp"
+#include "EbsdLib/Texture/TextureAccumulator.h"
+#include "EbsdLib/Utilities/ComputeStereographicProjection.h"
+#include "EbsdLib/Utilities/ModifiedLambertProjection.h"
+#include "EbsdLib/Utilities/StereographicLambertTable.h"
 
 #include "UnitTestSupport.hpp"
 
@@ -186,6 +196,361 @@ public:
     TestTextureOdf<TrigonalOps>();
   }
 
+  void TestODFSampler()
+  {
+    std::vector<float> weights = {0.0f, 1.0f, 3.0f, 0.0f, 4.0f, -2.0f};
+    ODFSampler sampler(weights);
+    DREAM3D_REQUIRE_EQUAL(sampler.size(), weights.size())
+    DREAM3D_REQUIRE(std::abs(sampler.getTotalWeight() - 8.0) < 1.0E-9)
+
+    // An evenly spaced set of uniform values reproduces the bin weights
+    const size_t numDraws = 80000;
+    std::vector<size_t> counts(weights.size(), 0);
+    for(size_t k = 0; k < numDraws; k++)
+    {
+      size_t bin = sampler.sample((static_cast<double>(k) + 0.5) / static_cast<double>(numDraws));
+      DREAM3D_REQUIRE(bin < weights.size())
+      counts[bin]++;
+    }
+    DREAM3D_REQUIRE_EQUAL(counts[0], 0)
+    DREAM3D_REQUIRE_EQUAL(counts[3], 0)
+    DREAM3D_REQUIRE_EQUAL(counts[5], 0)
+    DREAM3D_REQUIRE_EQUAL(counts[1], 10000)
+    DREAM3D_REQUIRE_EQUAL(counts[2], 30000)
+    DREAM3D_REQUIRE_EQUAL(counts[4], 40000)
+
+    // Every sampled orientation lands in the only populated ODF bin. The bin holding a small rotation
+    // lies well inside the Fundamental Zone.
+    CubicOps ops;
+    std::vector<float> odf(static_cast<size_t>(ops.getODFSize()), 0.0f);
+    RodriguesD smallRotation = OrientationTransformation::eu2ro<EulerD, RodriguesD>(EulerD(0.1, 0.1, 0.1));
+    const int populatedBin = ops.getOdfBin(ops.getODFFZRod(smallRotation));
+    odf[populatedBin] = 1.0f;
+    ODFSampler odfSampler(odf);
+    const size_t numSamples = 1000;
+    std::vector<double> eulers(numSamples * 3);
+    std::vector<double> eulers2(numSamples * 3);
+    odfSampler.generateEulerAngles(ops, eulers.data(), numSamples, 7);
+    odfSampler.generateEulerAngles(ops, eulers2.data(), numSamples, 7);
+    DREAM3D_REQUIRE(eulers == eulers2)
+    for(size_t i = 0; i < numSamples; i++)
+    {
+      RodriguesD rod = OrientationTransformation::eu2ro<EulerD, RodriguesD>(EulerD(eulers[i * 3], eulers[i * 3 + 1], eulers[i * 3 + 2]));
+      DREAM3D_REQUIRE_EQUAL(ops.getOdfBin(ops.getODFFZRod(rod)), populatedBin)
+    }
+  }
+
+  void TestODFBuilder()
+  {
+    CubicOps ops;
+    const size_t odfSize = static_cast<size_t>(ops.getODFSize());
+    const std::array<size_t, 3> odfNumBins = ops.getOdfNumBins();
+    const std::array<int, 3> numBins = {static_cast<int>(odfNumBins[0]), static_cast<int>(odfNumBins[1]), static_cast<int>(odfNumBins[2])};
+    std::vector<float> e1s = {0.61f, 1.03f, 2.5f};
+    std::vector<float> e2s = {0.78f, 0.64f, 0.2f};
+    std::vector<float> e3s = {0.0f, 1.1f, 0.9f};
+    std::vector<float> weights = {500.0f, 250.0f, 100.0f};
+    std::vector<float> sigmas = {2.0f, 1.0f, 0.0f};
+
+    // Reference: scatter every entry through the kernel one cell at a time
+    std::vector<double> reference(odfSize, 0.0);
+    for(size_t i = 0; i < e1s.size(); i++)
+    {
+      RodriguesD rod = OrientationTransformation::eu2ro<EulerD, RodriguesD>(EulerD(e1s[i], e2s[i], e3s[i]));
+      int bin = ops.getOdfBin(ops.getODFFZRod(rod));
+      int bin1 = bin % numBins[0];
+      int bin2 = (bin / numBins[0]) % numBins[1];
+      int bin3 = bin / (numBins[0] * numBins[1]);
+      int sigma = static_cast<int>(sigmas[i]);
+      for(int j = -sigma; j <= sigma; j++)
+      {
+        for(int k = -sigma; k <= sigma; k++)
+        {
+          for(int l = -sigma; l <= sigma; l++)
+          {
+            int x = bin1 + j;
+            int y = bin2 + k;
+            int z = bin3 + l;
+            double dist = std::sqrt(static_cast<double>(j * j + k * k + l * l));
+            if(x < 0 || y < 0 || z < 0 || x >= numBins[0] || y >= numBins[1] || z >= numBins[2] || dist > sigma)
+            {
+              continue;
+            }
+            double fraction = (sigma == 0 ? 1.0 : 1.0 - (dist / sigma) * (dist / sigma));
+            reference[z * numBins[0] * numBins[1] + y * numBins[0] + x] += weights[i] * fraction;
+          }
+        }
+      }
+    }
+    double totalAddWeight = 0.0;
+    for(double value : reference)
+    {
+      totalAddWeight += value;
+    }
+    double background = (static_cast<double>(odfSize) - totalAddWeight) / static_cast<double>(odfSize);
+
+    std::vector<float> odf;
+    Texture::CalculateODFData<float, CubicOps, std::vector<float>>(e1s, e2s, e3s, weights, sigmas, false, odf, e1s.size());
+    DREAM3D_REQUIRE_EQUAL(odf.size(), odfSize)
+    double odfSum = 0.0;
+    for(size_t i = 0; i < odfSize; i++)
+    {
+      DREAM3D_REQUIRE(std::abs(odf[i] - (reference[i] + background)) < 1.0E-3)
+      odfSum += odf[i];
+    }
+    DREAM3D_REQUIRE(std::abs(odfSum - static_cast<double>(odfSize)) < 1.0)
+
+    // A scan with many copies of the same orientation matches a single weighted entry
+    const size_t numPoints = 100000;
+    std::vector<float> scan(numPoints * 3);
+    std::unique_ptr<bool[]> mask(new bool[numPoints]);
+    for(size_t i = 0; i < numPoints; i++)
+    {
+      scan[i * 3] = e1s[0];
+      scan[i * 3 + 1] = e2s[0];
+      scan[i * 3 + 2] = e3s[0];
+      mask[i] = (i % 2 == 0);
+    }
+    ODFBuilder builder(ops);
+    builder.addOrientations(scan.data(), numPoints, 0.01f, 2.0f, mask.get());
+    std::vector<float> scanODF = builder.getODF(true);
+    ODFBuilder single(ops);
+    std::array<float, 3> euler = {e1s[0], e2s[0], e3s[0]};
+    float weight = 500.0f;
+    float sigma = 2.0f;
+    single.addOrientations(euler.data(), &weight, &sigma, 1);
+    std::vector<float> singleODF = single.getODF(true);
+    for(size_t i = 0; i < odfSize; i++)
+    {
+      DREAM3D_REQUIRE(std::abs(scanODF[i] - singleODF[i]) < 1.0E-6)
+    }
+    builder.clear();
+    std::vector<float> emptyODF = builder.getODF(true);
+    DREAM3D_REQUIRE(std::abs(emptyODF[0] - 1.0f / static_cast<float>(odfSize)) < 1.0E-9)
+  }
+
+  void TestLambertBallToSquare()
+  {
+    // Points spread over the whole sphere, including both poles and the equator
+    const size_t numPoints = 50000;
+    EbsdLib::FloatArrayType::Pointer coords = EbsdLib::FloatArrayType::CreateArray(numPoints, {3}, "Coords", true);
+    for(size_t i = 0; i < numPoints; i++)
+    {
+      double z = 1.0 - 2.0 * static_cast<double>(i) / static_cast<double>(numPoints - 1);
+      double r = std::sqrt(std::max(0.0, 1.0 - z * z));
+      double phi = static_cast<double>(i) * 2.39996322972865332;
+      coords->setComponent(i, 0, static_cast<float>(r * std::cos(phi)));
+      coords->setComponent(i, 1, static_cast<float>(r * std::sin(phi)));
+      coords->setComponent(i, 2, static_cast<float>(z));
+    }
+    coords->setComponent(1, 0, 0.0f);
+    coords->setComponent(1, 1, 0.0f);
+    coords->setComponent(2, 2, 0.0f);
+
+    const int dimension = 72;
+    ModifiedLambertProjection::Pointer lambert = ModifiedLambertProjection::LambertBallToSquare(coords.get(), dimension, 1.0f);
+
+    // Reference: one point at a time into the shared squares
+    ModifiedLambertProjection::Pointer reference = ModifiedLambertProjection::New();
+    reference->initializeSquares(dimension, 1.0f);
+    std::vector<float> sqCoords(numPoints * 2);
+    std::vector<uint8_t> northern(numPoints);
+    lambert->getSquareCoords(coords->getPointer(0), numPoints, sqCoords.data(), northern.data());
+    for(size_t i = 0; i < numPoints; i++)
+    {
+      std::array<float, 2> sqCoord = {0.0f, 0.0f};
+      bool nhCheck = reference->getSquareCoord(coords->getPointer(i * 3), sqCoord.data());
+      DREAM3D_REQUIRE_EQUAL(nhCheck, (northern[i] != 0))
+      DREAM3D_REQUIRE_EQUAL(sqCoord[0], sqCoords[i * 2])
+      DREAM3D_REQUIRE_EQUAL(sqCoord[1], sqCoords[i * 2 + 1])
+      reference->addInterpolatedValues(nhCheck ? ModifiedLambertProjection::NorthSquare : ModifiedLambertProjection::SouthSquare, sqCoord.data(), 1.0);
+    }
+
+    double total = 0.0;
+    for(size_t i = 0; i < static_cast<size_t>(dimension * dimension); i++)
+    {
+      DREAM3D_REQUIRE(std::abs(lambert->getNorthSquare()->getValue(i) - reference->getNorthSquare()->getValue(i)) < 1.0E-9)
+      DREAM3D_REQUIRE(std::abs(lambert->getSouthSquare()->getValue(i) - reference->getSouthSquare()->getValue(i)) < 1.0E-9)
+      total += lambert->getNorthSquare()->getValue(i) + lambert->getSouthSquare()->getValue(i);
+    }
+    DREAM3D_REQUIRE(std::abs(total - static_cast<double>(numPoints)) < 1.0E-6)
+  }
+
+  void TestStereographicLambertTable()
+  {
+    const int lambertDim = 72;
+    const int imageDim = 129;
+    ModifiedLambertProjection::Pointer lambert = ModifiedLambertProjection::New();
+    lambert->initializeSquares(lambertDim, 1.0f);
+    for(size_t i = 0; i < static_cast<size_t>(lambertDim * lambertDim); i++)
+    {
+      lambert->getNorthSquare()->setValue(i, static_cast<double>(i % 97) * 0.25);
+      lambert->getSouthSquare()->setValue(i, static_cast<double>(i % 89) * 0.5);
+    }
+
+    EbsdLib::DoubleArrayType::Pointer image = lambert->createStereographicProjection(imageDim);
+
+    // Reference: interpolate every pixel directly
+    int pointsHalf = imageDim / 2;
+    float res = 2.0f / static_cast<float>(imageDim);
+    size_t numInside = 0;
+    for(int64_t y = 0; y < imageDim; y++)
+    {
+      for(int64_t x = 0; x < imageDim; x++)
+      {
+        float xtmp = static_cast<float>(x - pointsHalf) * res + (res * 0.5f);
+        float ytmp = static_cast<float>(y - pointsHalf) * res + (res * 0.5f);
+        double expected = 0.0;
+        if((xtmp * xtmp + ytmp * ytmp) <= 1.0)
+        {
+          numInside++;
+          std::array<float, 3> xyz{};
+          xyz[2] = -((xtmp * xtmp + ytmp * ytmp) - 1) / ((xtmp * xtmp + ytmp * ytmp) + 1);
+          xyz[0] = xtmp * (1 + xyz[2]);
+          xyz[1] = ytmp * (1 + xyz[2]);
+          for(int hemisphere = 0; hemisphere < 2; hemisphere++)
+          {
+            std::array<float, 2> sqCoord = {0.0f, 0.0f};
+            bool nhCheck = lambert->getSquareCoord(xyz.data(), sqCoord.data());
+            expected += lambert->getInterpolatedValue(nhCheck ? ModifiedLambertProjection::NorthSquare : ModifiedLambertProjection::SouthSquare, sqCoord.data());
+            for(auto& value : xyz)
+            {
+              value *= -1.0f;
+            }
+          }
+          expected *= 0.5;
+        }
+        DREAM3D_REQUIRE(std::abs(image->getValue(y * imageDim + x) - expected) < 1.0E-6)
+      }
+    }
+
+    StereographicLambertTable::Pointer table = StereographicLambertTable::Get(imageDim, lambertDim, 1.0f);
+    DREAM3D_REQUIRE_EQUAL(table->getNumberOfPixels(), numInside)
+    DREAM3D_REQUIRE(table == StereographicLambertTable::Get(imageDim, lambertDim, 1.0f))
+    DREAM3D_REQUIRE(table != StereographicLambertTable::Get(imageDim + 1, lambertDim, 1.0f))
+    StereographicLambertTable::ClearCache();
+    DREAM3D_REQUIRE(table != StereographicLambertTable::Get(imageDim, lambertDim, 1.0f))
+  }
+
+  void TestPoleFigureIntensities()
+  {
+    // More orientations than one block so the blocks and the per thread squares are exercised
+    const size_t numOrientations = 10000;
+    EbsdLib::FloatArrayType::Pointer eulers = EbsdLib::FloatArrayType::CreateArray(numOrientations, {3}, "Eulers", true);
+    for(size_t i = 0; i < numOrientations; i++)
+    {
+      std::array<double, 3> euler = QuasiRandomEuler(i, true);
+      eulers->setComponent(i, 0, static_cast<float>(euler[0]));
+      eulers->setComponent(i, 1, static_cast<float>(euler[1]));
+      eulers->setComponent(i, 2, static_cast<float>(euler[2]));
+    }
+
+    std::vector<LaueOps::Pointer> allOps = {CubicOps::New(), HexagonalOps::New(), OrthoRhombicOps::New()};
+    for(const auto& ops : allOps)
+    {
+      for(bool discrete : {false, true})
+      {
+        PoleFigureConfiguration_t config;
+        config.eulers = eulers.get();
+        config.imageDim = 64;
+        config.lambertDim = 32;
+        config.sphereRadius = 1.0f;
+        config.discrete = discrete;
+
+        std::array<EbsdLib::DoubleArrayType::Pointer, 3> intensities = ops->generatePoleFigureIntensities(config, {"A", "B", "C"});
+
+        // Reference: materialize every coordinate and project each family separately
+        std::array<int32_t, 3> numSym = ops->getNumSymmetry();
+        std::array<EbsdLib::FloatArrayType::Pointer, 3> coords;
+        for(size_t f = 0; f < 3; f++)
+        {
+          coords[f] = EbsdLib::FloatArrayType::CreateArray(numOrientations * static_cast<size_t>(numSym[f]), {3}, "Coords", true);
+        }
+        ops->generateSphereCoordsFromEulers(eulers.get(), coords[0].get(), coords[1].get(), coords[2].get());
+        for(size_t f = 0; f < 3; f++)
+        {
+          EbsdLib::DoubleArrayType::Pointer reference = EbsdLib::DoubleArrayType::CreateArray(config.imageDim * config.imageDim, "Reference", true);
+          ComputeStereographicProjection projection(coords[f].get(), &config, reference.get());
+          projection();
+          DREAM3D_REQUIRE_EQUAL(intensities[f]->getNumberOfTuples(), reference->getNumberOfTuples())
+          for(size_t i = 0; i < reference->getNumberOfTuples(); i++)
+          {
+            DREAM3D_REQUIRE(std::abs(intensities[f]->getValue(i) - reference->getValue(i)) < 1.0E-4)
+          }
+        }
+      }
+    }
+  }
+
+  void TestTextureAccumulator()
+  {
+    const size_t numOrientations = 9000;
+    EbsdLib::FloatArrayType::Pointer eulers = EbsdLib::FloatArrayType::CreateArray(numOrientations, {3}, "Eulers", true);
+    for(size_t i = 0; i < numOrientations; i++)
+    {
+      std::array<double, 3> euler = QuasiRandomEuler(i, true);
+      eulers->setComponent(i, 0, static_cast<float>(euler[0]));
+      eulers->setComponent(i, 1, static_cast<float>(euler[1]));
+      eulers->setComponent(i, 2, static_cast<float>(euler[2]));
+    }
+
+    CubicOps ops;
+    const int lambertDim = 32;
+    const float sigma = 1.0f;
+
+    // Two workers each take part of the orientations, one of them also adds and takes back an extra slice
+    TextureAccumulator first(ops, lambertDim, sigma);
+    TextureAccumulator second(ops, lambertDim, sigma);
+    first.add(eulers->getPointer(0), 5000);
+    second.add(eulers->getPointer(5000 * 3), 2000);
+    second.add(eulers->getPointer(0), 1000);
+    second.add(eulers->getPointer(7000 * 3), 2000);
+    second.remove(eulers->getPointer(0), 1000);
+    DREAM3D_REQUIRE(first.merge(second))
+    DREAM3D_REQUIRE_EQUAL(first.getNumberOfOrientations(), static_cast<int64_t>(numOrientations))
+
+    TextureAccumulator other(ops, lambertDim + 1, sigma);
+    DREAM3D_REQUIRE_EQUAL(first.merge(other), false)
+
+    PoleFigureConfiguration_t config;
+    config.eulers = eulers.get();
+    config.imageDim = 64;
+    config.lambertDim = lambertDim;
+    config.sphereRadius = 1.0f;
+    config.discrete = false;
+    std::array<EbsdLib::DoubleArrayType::Pointer, 3> expected = ops.generatePoleFigureIntensities(config, {"A", "B", "C"});
+    std::array<EbsdLib::DoubleArrayType::Pointer, 3> intensities = first.getIntensities(config.imageDim, {"A", "B", "C"});
+    for(size_t f = 0; f < 3; f++)
+    {
+      for(size_t i = 0; i < expected[f]->getNumberOfTuples(); i++)
+      {
+        DREAM3D_REQUIRE(std::abs(intensities[f]->getValue(i) - expected[f]->getValue(i)) < 1.0E-4)
+      }
+    }
+
+    ODFBuilder builder(ops);
+    builder.addOrientations(eulers->getPointer(0), numOrientations, 1.0f, sigma);
+    std::vector<float> expectedODF = builder.getODF(true);
+    std::vector<float> odf = first.getODF(true);
+    DREAM3D_REQUIRE_EQUAL(odf.size(), expectedODF.size())
+    for(size_t i = 0; i < odf.size(); i++)
+    {
+      DREAM3D_REQUIRE(std::abs(odf[i] - expectedODF[i]) < 1.0E-6f)
+    }
+
+    config.numColors = 32;
+    std::vector<EbsdLib::UInt8ArrayType::Pointer> images = first.snapshot(config);
+    DREAM3D_REQUIRE_EQUAL(images.size(), 3)
+    for(const auto& image : images)
+    {
+      DREAM3D_REQUIRE_EQUAL(image->getNumberOfTuples(), static_cast<size_t>(config.imageDim * config.imageDim))
+    }
+    DREAM3D_REQUIRE(config.maxScale > config.minScale)
+
+    first.clear();
+    DREAM3D_REQUIRE_EQUAL(first.getNumberOfOrientations(), 0)
+  }
+
   void operator()()
   {
     std::cout << "<===== Start " << getNameOfClass() << std::endl;
@@ -193,6 +558,12 @@ public:
     int err = EXIT_SUCCESS;
     DREAM3D_REGISTER_TEST(TestOdfGeneration())
     DREAM3D_REGISTER_TEST(TestMdfGeneration())
+    DREAM3D_REGISTER_TEST(TestODFSampler())
+    DREAM3D_REGISTER_TEST(TestODFBuilder())
+    DREAM3D_REGISTER_TEST(TestLambertBallToSquare())
+    DREAM3D_REGISTER_TEST(TestStereographicLambertTable())
+    DREAM3D_REGISTER_TEST(TestPoleFigureIntensities())
+    DREAM3D_REGISTER_TEST(TestTextureAccumulator())
   }
 
 public:
@@ -39,11 +39,15 @@
 #include <assert.h>
 
 //-- C++ Includes
+#include <array>
+#include <cmath>
 #include <iostream>
 #include <sstream>
 #include <string.h>
 #include <string>
 
+#include "EbsdLib/Math/EbsdLibMath.h"
+
 #define NUM_COLS 120
 
 #include <sstream>
@@ -587,3 +591,22 @@ void require_greater_than(T l, const std::string& L, K r, const std::string& R,
     throw TestException(buf, file, line);
   }
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+/**
+ * @brief QuasiRandomEuler Returns the i'th Euler angles (radians) of a reproducible, evenly spread sequence built
+ * from the fractional parts of i times irrational numbers.
+ * @param i Index of the orientation
+ * @param uniformOrientations When true cos(Phi) is spread evenly so that orientation space is sampled uniformly.
+ * Otherwise Phi itself is spread evenly over [0, Pi].
+ */
+inline std::array<double, 3> QuasiRandomEuler(size_t i, bool uniformOrientations)
+{
+  const double u0 = std::fmod(static_cast<double>(i) * 0.61803398875, 1.0);
+  const double u1 = std::fmod(static_cast<double>(i) * 0.41421356237, 1.0);
+  const double u2 = std::fmod(static_cast<double>(i) * 0.73205080757, 1.0);
+  const double phi = uniformOrientations ? std::acos(1.0 - 2.0 * u1) : u1 * EbsdLib::Constants::k_PiD;
+  return {u0 * EbsdLib::Constants::k_2PiD, phi, u2 * EbsdLib::Constants::k_2PiD};
+}